@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "datastructure/HashMap.h"
+#include "baseline/HashMapTree.h"
+
+/**
+ * HashMap benchmark: Robin Hood open-addressing table vs the red-black tree it replaced
+ * -
+ * Keys are 36-character UUID-like strings hashed with FNV-1a and stored as their own values
+ * (i.e. the same shape as the favourites sets). Each size is filled once then looked up
+ * repeatedly (hits and misses) and half the keys are removed.
+ */
+
+#define BENCH_KEY_SIZE 40
+
+/**
+ * [PRIVATE] Gets the current monotonic time
+ * @return Time in nanoseconds
+ */
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( (double) ts.tv_sec * 1e9 ) + (double) ts.tv_nsec;
+}
+
+/**
+ * [PRIVATE] FNV-1a hash of a string key
+ * @param key String
+ * @return Hash
+ */
+static uint64_t bench_hash( const void * key ) {
+    const unsigned char * c    = key;
+    uint64_t              hash = 14695981039346656037ULL;
+
+    while( *c ) {
+        hash ^= *c++;
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * [PRIVATE] Key/value equivalence check
+ * @param key String key
+ * @param val String value
+ * @return Equivalence
+ */
+static bool bench_equal( const void * key, const void * val ) {
+    return ( strcmp( key, val ) == 0 );
+}
+
+/**
+ * [PRIVATE] Value copy
+ * @param val String value
+ * @return Copy
+ */
+static void * bench_copy( const void * val ) {
+    return strdup( val );
+}
+
+/**
+ * Benchmark results (in ns/operation)
+ * @param insert Insertion
+ * @param hit    Lookup of a key in the map
+ * @param miss   Lookup of a key not in the map
+ * @param remove Removal
+ */
+typedef struct {
+    double insert;
+    double hit;
+    double miss;
+    double remove;
+} BenchResult_t;
+
+/**
+ * Generates the body of a benchmark run for a HashMap-like namespace
+ * @param NS      Namespace (`HashMap` or `HashMapTree`)
+ * @param MAP_T   Map type
+ * @param keys    Keys in the map
+ * @param misses  Keys not in the map
+ * @param n       Number of keys
+ * @param reps    Number of lookup rounds
+ * @param res     BenchResult_t to fill
+ * @param err     Error flag to set
+ */
+#define BENCH_RUN( NS, MAP_T, keys, misses, n, reps, res, err )                                  \
+    do {                                                                                         \
+        MAP_T  map   = NS.init( free, bench_copy, bench_hash, bench_equal );                     \
+        size_t found = 0;                                                                        \
+        double t0    = bench_now();                                                              \
+                                                                                                 \
+        for( size_t i = 0; i < (n); ++i ) {                                                      \
+            if( !NS.add( &map, (keys)[i], (keys)[i] ) ) (err) = true;                            \
+        }                                                                                        \
+                                                                                                 \
+        double t1 = bench_now();                                                                 \
+                                                                                                 \
+        for( size_t r = 0; r < (reps); ++r ) {                                                   \
+            for( size_t i = 0; i < (n); ++i ) {                                                  \
+                found += ( NS.at( &map, (keys)[i] ) != NULL );                                   \
+            }                                                                                    \
+        }                                                                                        \
+                                                                                                 \
+        double t2 = bench_now();                                                                 \
+                                                                                                 \
+        for( size_t r = 0; r < (reps); ++r ) {                                                   \
+            for( size_t i = 0; i < (n); ++i ) {                                                  \
+                found += ( NS.at( &map, (misses)[i] ) != NULL );                                 \
+            }                                                                                    \
+        }                                                                                        \
+                                                                                                 \
+        double t3 = bench_now();                                                                 \
+                                                                                                 \
+        for( size_t i = 0; i < (n); i += 2 ) {                                                   \
+            if( !NS.remove( &map, (keys)[i] ) ) (err) = true;                                    \
+        }                                                                                        \
+                                                                                                 \
+        double t4 = bench_now();                                                                 \
+                                                                                                 \
+        if( found != ( (reps) * (n) ) || NS.size( &map ) != ( (n) / 2 ) ) (err) = true;          \
+                                                                                                 \
+        (res).insert = ( t1 - t0 ) / (double) (n);                                               \
+        (res).hit    = ( t2 - t1 ) / (double) ( (reps) * (n) );                                  \
+        (res).miss   = ( t3 - t2 ) / (double) ( (reps) * (n) );                                  \
+        (res).remove = ( t4 - t3 ) / (double) ( ( (n) + 1 ) / 2 );                               \
+                                                                                                 \
+        NS.clear( &map );                                                                        \
+    } while( 0 )
+
+int main( void ) {
+    const size_t sizes[] = { 100, 10000, 1000000 };
+
+    printf( "%-9s | %-17s | %-17s | %-17s | %-17s\n", "entries", "insert tree/new", "hit tree/new", "miss tree/new", "remove tree/new" );
+    printf( "----------+-------------------+-------------------+-------------------+------------------\n" );
+
+    for( size_t s = 0; s < ( sizeof( sizes ) / sizeof( sizes[0] ) ); ++s ) {
+        const size_t n      = sizes[s];
+        const size_t reps   = ( n <= 100 ? 10000 : ( n <= 10000 ? 100 : 3 ) );
+        char      (* keys   )[BENCH_KEY_SIZE] = malloc( n * BENCH_KEY_SIZE );
+        char      (* misses )[BENCH_KEY_SIZE] = malloc( n * BENCH_KEY_SIZE );
+        bool         error  = false;
+
+        BenchResult_t tree = { 0 };
+        BenchResult_t open = { 0 };
+
+        if( keys == NULL || misses == NULL ) {
+            fprintf( stderr, "Failed key allocation (n=%zu).\n", n );
+            return 1;
+        }
+
+        for( size_t i = 0; i < n; ++i ) {
+            snprintf( keys[i],   BENCH_KEY_SIZE, "%08zx-1234-5678-9abc-%012zx", ( i * 2654435761u ) & 0xFFFFFFFF, i );
+            snprintf( misses[i], BENCH_KEY_SIZE, "%08zx-8765-4321-cba9-%012zx", ( i * 2654435761u ) & 0xFFFFFFFF, i );
+        }
+
+        BENCH_RUN( HashMapTree, HashMapTree_t, keys, misses, n, reps, tree, error );
+        BENCH_RUN( HashMap,     HashMap_t,     keys, misses, n, reps, open, error );
+
+        printf( "%-9zu | %7.1f / %7.1f | %7.1f / %7.1f | %7.1f / %7.1f | %7.1f / %7.1f  (ns/op)%s\n",
+                n, tree.insert, open.insert, tree.hit, open.hit, tree.miss, open.miss, tree.remove, open.remove,
+                ( error ? "  [RESULT MISMATCH]" : "" ) );
+
+        free( keys );
+        free( misses );
+
+        if( error ) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
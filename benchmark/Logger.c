@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "logger/src/Logger.h"
+
+/**
+ * Logger benchmark: latency of `ctune_Logger.log(..)` calls as seen by the producer threads
+ * -
+ * Each producer logs ~150 byte DEBUG messages to a file, either back-to-back (saturates the
+ * writer thread) or paced with a short nap every few messages (the usual load). The time is
+ * measured around each call. The number of `write` syscalls comes from `/proc/self/io`.
+ * Each run happens in its own process as the Logger is set up once per process.
+ */
+
+#define BENCH_MAX_THREADS  4
+#define BENCH_MSG_COUNT    200000
+#define BENCH_PACE_NAP_NS  20000
+
+/**
+ * Producer thread arguments/results
+ * @param id        Thread ID
+ * @param pace_mask Nap after each message where `( i & pace_mask ) == pace_mask` (0: no pacing)
+ * @param total_ns  Cumulative time spent in the log calls
+ * @param max_ns    Longest log call
+ */
+typedef struct {
+    long   id;
+    int    pace_mask;
+    double total_ns;
+    double max_ns;
+} BenchProducer_t;
+
+/**
+ * [PRIVATE] Gets the current monotonic time
+ * @return Time in nanoseconds
+ */
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( (double) ts.tv_sec * 1e9 ) + (double) ts.tv_nsec;
+}
+
+/**
+ * [PRIVATE] Gets the number of write syscalls made by the process so far
+ * @return Syscall count (-1 if not available)
+ */
+static long bench_writeSyscalls( void ) {
+    FILE * file  = fopen( "/proc/self/io", "r" );
+    char   line[128];
+    long   count = -1;
+
+    if( file == NULL ) {
+        return -1; //EARLY RETURN
+    }
+
+    while( fgets( line, sizeof( line ), file ) ) {
+        if( sscanf( line, "syscw: %ld", &count ) == 1 ) {
+            break;
+        }
+    }
+
+    fclose( file );
+    return count;
+}
+
+/**
+ * [PRIVATE] Producer thread
+ * @param arg Pointer to a BenchProducer_t object
+ * @return NULL
+ */
+static void * bench_producer( void * arg ) {
+    BenchProducer_t * producer = arg;
+
+    for( int i = 0; i < BENCH_MSG_COUNT; ++i ) {
+        const double t0 = bench_now();
+
+        ctune_Logger.log( CTUNE_LOG_DEBUG,
+                          "[bench_producer( %ld )] station '%s' (uuid: %s) bitrate=%i iteration %i",
+                          producer->id, "Some Radio Station Name", "960e57c5-0601-11e8-ae97-52543be04c81", 128, i );
+
+        const double elapsed = bench_now() - t0;
+
+        producer->total_ns += elapsed;
+
+        if( elapsed > producer->max_ns ) {
+            producer->max_ns = elapsed;
+        }
+
+        if( producer->pace_mask && ( i & producer->pace_mask ) == producer->pace_mask ) {
+            nanosleep( &(struct timespec){ .tv_sec = 0, .tv_nsec = BENCH_PACE_NAP_NS }, NULL );
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * [PRIVATE] Runs a set of producers against a fresh logger
+ * @param log_path  Log file path
+ * @param threads   Number of producer threads
+ * @param pace_mask Pacing mask (see BenchProducer_t)
+ * @return Success
+ */
+static bool bench_run( const char * log_path, int threads, int pace_mask ) {
+    BenchProducer_t producers[BENCH_MAX_THREADS];
+    pthread_t       handles[BENCH_MAX_THREADS];
+    double          total_ns = 0;
+    double          max_ns   = 0;
+
+    if( !ctune_Logger.init( log_path, "w", CTUNE_LOG_DEBUG ) ) {
+        fprintf( stderr, "Failed to open log file \"%s\".\n", log_path );
+        return false; //EARLY RETURN
+    }
+
+    const long   w0 = bench_writeSyscalls();
+    const double t0 = bench_now();
+
+    for( int i = 0; i < threads; ++i ) {
+        producers[i] = (BenchProducer_t) { .id = i, .pace_mask = pace_mask, .total_ns = 0, .max_ns = 0 };
+        pthread_create( &handles[i], NULL, bench_producer, &producers[i] );
+    }
+
+    for( int i = 0; i < threads; ++i ) {
+        pthread_join( handles[i], NULL );
+        total_ns += producers[i].total_ns;
+        max_ns    = ( producers[i].max_ns > max_ns ? producers[i].max_ns : max_ns );
+    }
+
+    const double t1 = bench_now();
+
+    ctune_Logger.close();
+
+    const long w1 = bench_writeSyscalls();
+
+    printf( "%-7d | %-21s | %8.0f | %8.0f | %8.0f | %ld\n",
+            threads,
+            ( pace_mask ? "paced" : "back-to-back" ),
+            total_ns / ( (double) BENCH_MSG_COUNT * threads ),
+            max_ns / 1e3,
+            ( t1 - t0 ) / 1e6,
+            ( w0 < 0 || w1 < 0 ? -1 : ( w1 - w0 ) ) );
+
+    return true;
+}
+
+int main( int argc, char * argv[] ) {
+    const char * log_path = ( argc > 1 ? argv[1] : "ctune_bench_logger.log" );
+
+    printf( "%d messages per thread, log file: %s\n", BENCH_MSG_COUNT, log_path );
+    printf( "threads | mode                  | ns/call  | max (us) | wall (ms) | write syscalls\n" );
+    printf( "--------+-----------------------+----------+----------+----------+---------------\n" );
+
+    const int runs[][2] = { { 1, 63 }, { 1, 0 }, { 4, 7 }, { 4, 0 } }; //{ threads, pace mask }
+    bool      ok        = true;
+
+    for( size_t i = 0; ok && i < ( sizeof( runs ) / sizeof( runs[0] ) ); ++i ) {
+        fflush( stdout ); //so that the child does not print the buffered header again
+
+        int         status = 0;
+        const pid_t pid    = fork();
+
+        if( pid == 0 ) {
+            exit( bench_run( log_path, runs[i][0], runs[i][1] ) ? 0 : 1 );
+        }
+
+        ok = ( pid > 0 && waitpid( pid, &status, 0 ) == pid && WIFEXITED( status ) && WEXITSTATUS( status ) == 0 );
+    }
+
+    remove( log_path );
+
+    return ( ok ? 0 : 1 );
+}
@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef NO_NCURSESW
+    #include <ncurses.h>
+#else
+    #include <ncursesw/ncurses.h>
+#endif
+
+#include "ui/window/RSListWin.h"
+#include "ui/widget/SlideMenu.h"
+#include "ui/definitions/Theme.h"
+#include "ui/definitions/Language.h"
+#include "dto/UIConfig.h"
+
+/**
+ * UI scroll benchmark: terminal output per scroll step of RSListWin and SlideMenu
+ * -
+ * The UI is drawn with `newterm(..)` into a file (xterm-256color, 40x110) so that the bytes
+ * that would be sent to the terminal can be counted. Each step moves the selection by one
+ * row and shows the window. The "in-page" column covers moves that stay within the first
+ * page and the "scroll" column covers 300 steps down (page changes included).
+ */
+
+#define BENCH_TERM          "xterm-256color"
+#define BENCH_ROWS          40
+#define BENCH_COLS          110
+#define BENCH_STATION_COUNT 500
+#define BENCH_SCROLL_STEPS  300
+#define BENCH_MENU_ITEMS    40
+
+/**
+ * [PRIVATE] Terminal output state
+ * @param file   Output file the terminal writes to
+ * @param screen Screen created for the output file
+ */
+static struct {
+    FILE   * file;
+    SCREEN * screen;
+} bench = { NULL, NULL };
+
+/**
+ * [PRIVATE] Gets the current monotonic time
+ * @return Time in microseconds
+ */
+static double bench_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( (double) ts.tv_sec * 1e6 ) + ( (double) ts.tv_nsec / 1e3 );
+}
+
+/**
+ * [PRIVATE] Gets the number of bytes sent to the terminal so far
+ * @return Byte count
+ */
+static long bench_written( void ) {
+    fflush( bench.file );
+    return ftell( bench.file );
+}
+
+/**
+ * [PRIVATE] Station state callback (no queued/favourite stations)
+ * @param rsi Station
+ * @return 0
+ */
+static unsigned bench_stationState( const ctune_RadioStationInfo_t * rsi ) {
+    (void) rsi;
+    return 0;
+}
+
+/**
+ * [PRIVATE] SlideMenu item control callback (no-op)
+ * @param item Menu item
+ * @return true
+ */
+static bool bench_menuCtrl( ctune_UI_SlideMenu_Item_t * item ) {
+    (void) item;
+    return true;
+}
+
+/**
+ * [PRIVATE] Runs the RSListWin steps with a given row layout
+ * @param stations  Stations to load
+ * @param large_row Large row flag (2 lines + delimiter per station)
+ */
+static void bench_rsListWin( Vector_t * stations, bool large_row ) {
+    WindowProperty_t     property = { BENCH_ROWS - 2, BENCH_COLS, 1, 0 };
+    ctune_UI_RSListWin_t win      = ctune_UI_RSListWin.init( &property, ctune_UI_Language.text, NULL, NULL, NULL, bench_stationState, NULL );
+    const int            in_page  = ( large_row ? ( property.rows / 3 ) : property.rows ) - 2;
+
+    ctune_UI_RSListWin.loadResults( &win, stations, NULL );
+    ctune_UI_RSListWin.setLargeRow( &win, large_row );
+    ctune_UI_RSListWin.resize( &win );
+
+    long   b0 = bench_written();
+    double t0 = bench_now();
+
+    for( int i = 0; i < in_page; ++i ) {
+        ctune_UI_RSListWin.selectDown( &win );
+        ctune_UI_RSListWin.show( &win );
+    }
+
+    long   b1 = bench_written();
+    double t1 = bench_now();
+
+    ctune_UI_RSListWin.selectFirst( &win );
+    ctune_UI_RSListWin.show( &win );
+
+    long   b2 = bench_written();
+    double t2 = bench_now();
+
+    for( int i = 0; i < BENCH_SCROLL_STEPS; ++i ) {
+        ctune_UI_RSListWin.selectDown( &win );
+        ctune_UI_RSListWin.show( &win );
+    }
+
+    long   b3 = bench_written();
+    double t3 = bench_now();
+
+    fprintf( stdout, "%-22s | %8.1f | %8.1f | %8.1f | %8.1f\n",
+             ( large_row ? "RSListWin (large rows)" : "RSListWin (small rows)" ),
+             (double) ( b1 - b0 ) / in_page, ( t1 - t0 ) / in_page,
+             (double) ( b3 - b2 ) / BENCH_SCROLL_STEPS, ( t3 - t2 ) / BENCH_SCROLL_STEPS );
+
+    ctune_UI_RSListWin.free( &win );
+}
+
+/**
+ * [PRIVATE] Runs the SlideMenu steps
+ */
+static void bench_slideMenu( void ) {
+    WindowProperty_t     property = { 20, 30, 2, 2 };
+    ctune_UI_SlideMenu_t menu     = ctune_UI_SlideMenu.init( &property );
+    const int            in_page  = property.rows - 1;
+    char                 text[32];
+
+    for( int i = 0; i < BENCH_MENU_ITEMS; ++i ) {
+        snprintf( text, sizeof( text ), "Menu item %d", i );
+        ctune_UI_SlideMenu.createMenuItem( &menu.root, CTUNE_UI_SLIDEMENU_LEAF, text, NULL, bench_menuCtrl );
+    }
+
+    ctune_UI_SlideMenu.show( &menu );
+
+    long   b0 = bench_written();
+    double t0 = bench_now();
+
+    for( int i = 0; i < in_page; ++i ) {
+        ctune_UI_SlideMenu.navKeyDown( &menu );
+        ctune_UI_SlideMenu.show( &menu );
+    }
+
+    long   b1 = bench_written();
+    double t1 = bench_now();
+
+    for( int i = in_page; i < ( BENCH_MENU_ITEMS - 1 ); ++i ) {
+        ctune_UI_SlideMenu.navKeyDown( &menu );
+        ctune_UI_SlideMenu.show( &menu );
+    }
+
+    long   b2 = bench_written();
+    double t2 = bench_now();
+    int    n  = ( BENCH_MENU_ITEMS - 1 - in_page );
+
+    fprintf( stdout, "%-22s | %8.1f | %8.1f | %8.1f | %8.1f\n",
+             "SlideMenu",
+             (double) ( b1 - b0 ) / in_page, ( t1 - t0 ) / in_page,
+             (double) ( b2 - b1 ) / n, ( t2 - t1 ) / n );
+
+    ctune_UI_SlideMenu.free( &menu );
+}
+
+int main( int argc, char * argv[] ) {
+    const char     * out_path = ( argc > 1 ? argv[1] : "ctune_bench_uiscroll.out" );
+    FILE           * in       = fopen( "/dev/null", "r" );
+    ctune_UIConfig_t ui_cfg   = ctune_UIConfig.create();
+    Vector_t         stations = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    char             name[64];
+
+    if( in == NULL || ( bench.file = fopen( out_path, "w" ) ) == NULL ) {
+        fprintf( stderr, "Failed to open output file \"%s\".\n", out_path );
+        return 1;
+    }
+
+    if( ( bench.screen = newterm( BENCH_TERM, bench.file, in ) ) == NULL ) {
+        fprintf( stderr, "Failed to create terminal \"%s\".\n", BENCH_TERM );
+        return 1;
+    }
+
+    set_term( bench.screen );
+    resizeterm( BENCH_ROWS, BENCH_COLS );
+    start_color();
+    cbreak();
+    noecho();
+    ctune_UI_Theme.init( ctune_UIConfig.theming.getCurrentThemePallet( &ui_cfg ) );
+
+    for( int i = 0; i < BENCH_STATION_COUNT; ++i ) {
+        ctune_RadioStationInfo_t * rsi = Vector.init_back( &stations, ctune_RadioStationInfo.init );
+
+        snprintf( name, sizeof( name ), "Station number %d - some radio name", i );
+        ctune_RadioStationInfo.set.stationName( rsi, strdup( name ) );
+        ctune_RadioStationInfo.set.countryCode_ISO3166_1( rsi, "DE" );
+        ctune_RadioStationInfo.set.bitrate( rsi, 128 );
+        ctune_RadioStationInfo.set.tags( rsi, strdup( "jazz,blues" ) );
+    }
+
+    fprintf( stdout, "%dx%d terminal (%s), output: %s\n", BENCH_ROWS, BENCH_COLS, BENCH_TERM, out_path );
+    fprintf( stdout, "%-22s | %-19s | %-19s\n", "", "in-page", "scrolling" );
+    fprintf( stdout, "%-22s | %8s | %8s | %8s | %8s\n", "window", "B/step", "us/step", "B/step", "us/step" );
+    fprintf( stdout, "-----------------------+----------+----------+----------+----------\n" );
+
+    bench_rsListWin( &stations, false );
+    bench_rsListWin( &stations, true );
+    bench_slideMenu();
+
+    endwin();
+    delscreen( bench.screen );
+    fclose( bench.file );
+    fclose( in );
+    Vector.clear_vector( &stations );
+    remove( out_path );
+
+    return 0;
+}
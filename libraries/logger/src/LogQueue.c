@@ -1,110 +1,164 @@
 #include "LogQueue.h"
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
 
 /**
- * Creates a new LogQueueNode
- * @param str  String
- * @param next Pointer to the next node in the Queue (NULL if none)
- * @return Created LogQueueNode
+ * Initialises a LogQueue over a ring of slots
+ * @param queue    LogQueue instance
+ * @param slots    Storage for the ring (lives as long as the queue)
+ * @param capacity Number of slots (power of 2)
+ * @return Success
  */
-LogQueueNode_t * ctune_LogQueue_create_node( const char * str, LogQueueNode_t * next ) {
-    LogQueueNode_t * node;
-
-    if( ( node = (LogQueueNode_t *) malloc( sizeof( LogQueueNode_t ) ) ) == NULL ) {
-        return NULL;
-    }
+static bool ctune_LogQueue_init( LogQueue_t * queue, LogQueueSlot_t * slots, size_t capacity ) {
+    if( queue == NULL || slots == NULL || capacity < 2 || ( capacity & ( capacity - 1 ) ) != 0 )
+        return false; //EARLY RETURN
 
-    if( ( node->data = malloc( strlen( str ) + 1 ) ) == NULL ) {
-        free( node );
-        return NULL;
+    for( size_t i = 0; i < capacity; ++i ) {
+        atomic_init( &slots[i].sequence, i );
+        slots[i].length   = 0;
+        slots[i].flush    = false;
+        slots[i].overflow = NULL;
     }
 
-    strcpy( node->data, str );
-    node->next = next;
+    queue->_slots = slots;
+    queue->_mask  = ( capacity - 1 );
+    atomic_init( &queue->_head, 0 );
+    atomic_init( &queue->_tail, 0 );
+    atomic_init( &queue->_dropped, 0 );
+    atomic_init( &queue->_flush, false );
 
-    return node;
+    return true;
 }
 
 /**
- * [THREAD SAFE] Add a node containing string to the queue
- * @param queue LogQueue instance
- * @param str   String to copy to the queued node
- * @return Success
+ * [THREAD SAFE/LOCK-FREE] Copies a message into the next free slot of the queue
+ * @param queue  LogQueue instance
+ * @param str    Message string
+ * @param length Length of the message string
+ * @param flush  Flag requesting the output to be flushed once the message is written
+ * @return Success (false when the ring stayed full and the message was dropped)
  */
-bool ctune_LogQueue_enqueue( struct ctune_LogQueue * queue, const char * str ) {
-    if( queue == NULL )
+static bool ctune_LogQueue_enqueue( LogQueue_t * queue, const char * str, size_t length, bool flush ) {
+    if( queue == NULL || queue->_slots == NULL || str == NULL )
         return false; //EARLY RETURN
 
-    LogQueueNode_t * node    = ctune_LogQueue.create_node( str, NULL );
-    bool             success = false;
+    LogQueueSlot_t * slot    = NULL;
+    size_t           retries = 0;
+    size_t           pos     = atomic_load_explicit( &queue->_head, memory_order_relaxed );
 
-    pthread_mutex_lock( &queue->_mutex );
+    for(;;) { //claim a slot
+        slot = &queue->_slots[ pos & queue->_mask ];
 
-    if( node != NULL ) {
+        size_t   seq  = atomic_load_explicit( &slot->sequence, memory_order_acquire );
+        intptr_t diff = (intptr_t) seq - (intptr_t) pos;
 
-        if( queue->_back == NULL ) { //i.e.: empty queue
-            queue->_back  = node;
-            queue->_front = queue->_back;
+        if( diff == 0 ) { //slot is free at this position
+            if( atomic_compare_exchange_weak( &queue->_head, &pos, ( pos + 1 ) ) )
+                break;
 
-        } else {
-            queue->_back->next = node;
-            queue->_back       = queue->_back->next;
+        } else if( diff < 0 ) { //slot still holds an unread message from the previous lap (i.e.: full)
+            if( retries++ >= CTUNE_LOGQUEUE_FULL_RETRY ) {
+                atomic_fetch_add_explicit( &queue->_dropped, 1, memory_order_relaxed );
+                return false; //EARLY RETURN
+            }
+
+            nanosleep( &(struct timespec){ .tv_sec = 0, .tv_nsec = CTUNE_LOGQUEUE_FULL_NAP }, NULL ); //give the consumer a chance to catch up
+            pos = atomic_load_explicit( &queue->_head, memory_order_relaxed );
+
+        } else { //another producer got there first
+            pos = atomic_load_explicit( &queue->_head, memory_order_relaxed );
         }
+    }
 
-        queue->_length += 1;
-        success = true;
+    if( length < CTUNE_LOGQUEUE_SLOT_SIZE ) {
+        memcpy( slot->data, str, length );
+        slot->data[ length ] = '\0';
+        slot->overflow       = NULL;
+
+    } else if( ( slot->overflow = malloc( length + 1 ) ) != NULL ) {
+        memcpy( slot->overflow, str, length );
+        slot->overflow[ length ] = '\0';
+
+    } else { //truncate to what fits in-place
+        length = ( CTUNE_LOGQUEUE_SLOT_SIZE - 1 );
+        memcpy( slot->data, str, length );
+        slot->data[ length ] = '\0';
     }
 
-    pthread_mutex_unlock( &queue->_mutex );
+    slot->length = length;
+    slot->flush  = flush;
+
+    atomic_store( &slot->sequence, ( pos + 1 ) ); //publish to the consumer
 
-    queue->queued_items_signal_cb();
-    return success;
+    if( flush )
+        atomic_store( &queue->_flush, true );
+
+    if( queue->queued_items_signal_cb )
+        queue->queued_items_signal_cb();
+
+    return true;
 }
 
 /**
- * [THREAD SAFE] Dequeues a node
- * @param queue LogQueue instance
- * @return Pointer to dequeued node
+ * [CONSUMER ONLY] Gets the message at the front of the queue without removing it
+ * @param queue  LogQueue instance
+ * @param length Pointer to set to the length of the message
+ * @param flush  Pointer to set to the flush request flag of the message
+ * @return Pointer to the message or NULL if there are none ready
  */
-LogQueueNode_t * ctune_LogQueue_dequeue( struct ctune_LogQueue * queue ) {
-    LogQueueNode_t * node = NULL;
+static const char * ctune_LogQueue_front( LogQueue_t * queue, size_t * length, bool * flush ) {
+    if( queue == NULL || queue->_slots == NULL )
+        return NULL; //EARLY RETURN
 
-    pthread_mutex_lock( &queue->_mutex );
+    const size_t     pos  = atomic_load_explicit( &queue->_tail, memory_order_relaxed );
+    LogQueueSlot_t * slot = &queue->_slots[ pos & queue->_mask ];
 
-    if( queue != NULL && queue->_front ) {
-        node = queue->_front;
+    if( atomic_load( &slot->sequence ) != ( pos + 1 ) )
+        return NULL; //EARLY RETURN - not published yet
 
-        if( queue->_front == queue->_back ) { //i.e.: was last node in queue
-            queue->_front = NULL;
-            queue->_back  = NULL;
+    if( length )
+        *length = slot->length;
 
-        } else {
-            queue->_front = queue->_front->next;
-        }
+    if( flush )
+        *flush = slot->flush;
 
-        queue->_length -= 1;
-        node->next = NULL;
-    }
+    return ( slot->overflow ? slot->overflow : slot->data );
+}
+
+/**
+ * [CONSUMER ONLY] Releases the slot at the front of the queue
+ * @param queue LogQueue instance
+ */
+static void ctune_LogQueue_pop( LogQueue_t * queue ) {
+    if( queue == NULL || queue->_slots == NULL )
+        return; //EARLY RETURN
+
+    const size_t     pos  = atomic_load_explicit( &queue->_tail, memory_order_relaxed );
+    LogQueueSlot_t * slot = &queue->_slots[ pos & queue->_mask ];
+
+    if( atomic_load_explicit( &slot->sequence, memory_order_acquire ) != ( pos + 1 ) )
+        return; //EARLY RETURN - nothing to pop
 
-    pthread_mutex_unlock( &queue->_mutex );
+    free( slot->overflow );
+    slot->overflow = NULL;
+    slot->length   = 0;
 
-    return node;
+    atomic_store( &queue->_tail, ( pos + 1 ) );
+    atomic_store_explicit( &slot->sequence, ( pos + queue->_mask + 1 ), memory_order_release ); //hand back to producers for the next lap
 }
 
 /**
- * Gets the number of items in the LogQueue
+ * [THREAD SAFE] Gets the number of items in the LogQueue
  * @param self LogQueue instance
- * @return number of items
+ * @return number of items (includes slots claimed but not yet published)
  */
-static size_t ctune_LogQueue_size( struct ctune_LogQueue * queue ) {
-    size_t l = 0;
+static size_t ctune_LogQueue_size( LogQueue_t * queue ) {
+    const size_t tail = atomic_load( &queue->_tail );
+    const size_t head = atomic_load( &queue->_head );
 
-    pthread_mutex_lock( &queue->_mutex );
-    l = queue->_length;
-    pthread_mutex_unlock( &queue->_mutex );
-
-    return l;
+    return ( head - tail );
 }
 
 /**
@@ -112,53 +166,43 @@ static size_t ctune_LogQueue_size( struct ctune_LogQueue * queue ) {
  * @param queue LogQueue instance
  * @return Empty state
  */
-bool ctune_LogQueue_empty( struct ctune_LogQueue * queue ) {
-    bool empty_state = false;
-
-    pthread_mutex_lock( &queue->_mutex );
-    empty_state = ( queue->_front == NULL );
-    pthread_mutex_unlock( &queue->_mutex );
-
-    return empty_state;
+static bool ctune_LogQueue_empty( LogQueue_t * queue ) {
+    return ( ctune_LogQueue_size( queue ) == 0 );
 }
 
 /**
- * Removes and de-allocates all LogQueueNode(s) in LogQueue
+ * [THREAD SAFE] Checks if the consumer should get to the queued messages without delay
  * @param queue LogQueue instance
+ * @return Flush request state (a queued message requested a flush or the ring is at least half full)
  */
-void ctune_LogQueue_freeLogQueue( struct ctune_LogQueue * queue ) {
-    pthread_mutex_lock( &queue->_mutex );
-
-    if( queue->_front ) {
-        LogQueueNode_t * next = queue->_front;
-
-        while( next ) {
-            LogQueueNode_t * tmp = next->next;
-
-            free( next->data );
-            free( next );
-
-            next = tmp;
-        }
-
-        queue->_front  = NULL;
-        queue->_back   = NULL;
-        queue->_length = 0;
-    }
+static bool ctune_LogQueue_flushRequested( LogQueue_t * queue ) {
+    return atomic_load( &queue->_flush ) || ( ctune_LogQueue_size( queue ) > ( queue->_mask / 2 ) );
+}
 
-    pthread_mutex_unlock( &queue->_mutex );
+/**
+ * [CONSUMER ONLY] Lowers the flush request flag (call before draining the queue)
+ * @param queue LogQueue instance
+ */
+static void ctune_LogQueue_clearFlushRequest( LogQueue_t * queue ) {
+    atomic_store( &queue->_flush, false );
 }
 
 /**
- * De-allocates a _dequeued_ LogQueueNode
- * @param node Dequeued node to free
+ * [THREAD SAFE] Gets and resets the number of messages dropped because the queue was full
+ * @param queue LogQueue instance
+ * @return Number of messages dropped since the last call
  */
-void ctune_LogQueue_freeLogQueueNode( LogQueueNode_t * node ) {
-    if( node ) {
-        if( node->data )
-            free( node->data );
+static size_t ctune_LogQueue_dropped( LogQueue_t * queue ) {
+    return atomic_exchange( &queue->_dropped, 0 );
+}
 
-        free( node );
+/**
+ * [CONSUMER ONLY] Discards all the messages left in the LogQueue
+ * @param queue LogQueue instance
+ */
+static void ctune_LogQueue_freeLogQueue( LogQueue_t * queue ) {
+    while( ctune_LogQueue_front( queue, NULL, NULL ) != NULL ) {
+        ctune_LogQueue_pop( queue );
     }
 }
 
@@ -167,33 +211,23 @@ void ctune_LogQueue_freeLogQueueNode( LogQueueNode_t * node ) {
  * @param queue LogQueue instance
  * @param cb    Callback method to use
  */
-void ctune_LogQueue_setSendReadySignalCallback( LogQueue_t * queue, void(* cb)( void ) ) {
+static void ctune_LogQueue_setSendReadySignalCallback( LogQueue_t * queue, void(* cb)( void ) ) {
     queue->queued_items_signal_cb = cb;
 }
 
-/**
- * Initializer
- * @return An initialized LogQueue
- */
-static struct ctune_LogQueue ctune_LogQueue_init() {
-    return (struct ctune_LogQueue) {
-        ._mutex        = PTHREAD_MUTEX_INITIALIZER,
-        ._front        = NULL,
-        ._back         = NULL,
-    };
-}
-
 /**
  * Namespace constructor
  */
-const struct LogQueueClass ctune_LogQueue={
+const struct LogQueueClass ctune_LogQueue = {
     .init                       = &ctune_LogQueue_init,
-    .create_node                = &ctune_LogQueue_create_node,
     .enqueue                    = &ctune_LogQueue_enqueue,
-    .dequeue                    = &ctune_LogQueue_dequeue,
+    .front                      = &ctune_LogQueue_front,
+    .pop                        = &ctune_LogQueue_pop,
     .size                       = &ctune_LogQueue_size,
     .empty                      = &ctune_LogQueue_empty,
+    .flushRequested             = &ctune_LogQueue_flushRequested,
+    .clearFlushRequest          = &ctune_LogQueue_clearFlushRequest,
+    .dropped                    = &ctune_LogQueue_dropped,
     .freeLogQueue               = &ctune_LogQueue_freeLogQueue,
-    .freeLogQueueNode           = &ctune_LogQueue_freeLogQueueNode,
     .setSendReadySignalCallback = &ctune_LogQueue_setSendReadySignalCallback,
-};
\ No newline at end of file
+};
@@ -3,19 +3,47 @@
 
 #include <string.h>
 #include <stdbool.h>
-#include <pthread.h>
-
-typedef struct ctune_LogQueueNode {
-    char                      * data;
-    struct ctune_LogQueueNode * next;
-
-} LogQueueNode_t;
-
+#include <stdatomic.h>
+
+#define CTUNE_LOGQUEUE_CAPACITY  1024 //number of slots in the ring (must be a power of 2)
+#define CTUNE_LOGQUEUE_SLOT_SIZE 512  //max size of a message stored in-place in a slot (longer ones are copied to the heap)
+#define CTUNE_LOGQUEUE_FULL_RETRY 512  //max number of naps a producer takes waiting on a full ring before dropping its message
+#define CTUNE_LOGQUEUE_FULL_NAP   10000 //in nanoseconds (length of a nap waiting on a full ring)
+
+/**
+ * Ring slot
+ * @param sequence Sequence number used to hand the slot between the producers and the consumer
+ * @param length   Length of the message (without the terminating '\0')
+ * @param flush    Flag requesting the output to be flushed once the message is written
+ * @param overflow Heap copy of a message too long to fit in `data` (NULL otherwise)
+ * @param data     In-place message storage
+ */
+typedef struct ctune_LogQueueSlot {
+    atomic_size_t sequence;
+    size_t        length;
+    bool          flush;
+    char        * overflow;
+    char          data[CTUNE_LOGQUEUE_SLOT_SIZE];
+
+} LogQueueSlot_t;
+
+/**
+ * Bounded lock-free multi-producer/single-consumer queue of log messages
+ * @param _slots    Ring of slots
+ * @param _mask     Index mask (slot count - 1)
+ * @param _head     Next position to be claimed by a producer
+ * @param _tail     Next position to be read by the consumer
+ * @param _dropped  Number of messages discarded since last checked because the ring was full
+ * @param _flush    Flag raised when a message requesting a flush is queued
+ * @param queued_items_signal_cb Callback called after each enqueue operation
+ */
 struct ctune_LogQueue {
-    pthread_mutex_t  _mutex;
-    LogQueueNode_t * _front;
-    LogQueueNode_t * _back;
-    size_t           _length;
+    LogQueueSlot_t * _slots;
+    size_t           _mask;
+    atomic_size_t    _head;
+    atomic_size_t    _tail;
+    atomic_size_t    _dropped;
+    atomic_bool      _flush;
 
     void(* queued_items_signal_cb)( void );
 };
@@ -24,36 +52,41 @@ typedef struct ctune_LogQueue LogQueue_t;
 
 extern const struct LogQueueClass {
     /**
-     * Initializer
-     * @return An initialized LogQueue
+     * Initialises a LogQueue over a ring of slots
+     * @param queue    LogQueue instance
+     * @param slots    Storage for the ring (lives as long as the queue)
+     * @param capacity Number of slots (power of 2)
+     * @return Success
      */
-    struct ctune_LogQueue (* init)( void );
+    bool (* init)( LogQueue_t * queue, LogQueueSlot_t * slots, size_t capacity );
 
     /**
-     * Creates a new LogQueueNode
-     * @param str  String
-     * @param next Pointer to the next node in the Queue (NULL if none)
-     * @return Created LogQueueNode
+     * [THREAD SAFE/LOCK-FREE] Copies a message into the next free slot of the queue
+     * @param queue  LogQueue instance
+     * @param str    Message string
+     * @param length Length of the message string
+     * @param flush  Flag requesting the output to be flushed once the message is written
+     * @return Success (false when the ring stayed full and the message was dropped)
      */
-    LogQueueNode_t * (* create_node)( const char * str, LogQueueNode_t * next );
+    bool (* enqueue)( LogQueue_t * queue, const char * str, size_t length, bool flush );
 
     /**
-     * [THREAD SAFE] Add a node containing string to the queue
-     * @param queue LogQueue instance
-     * @param str   String to copy to the queued node
-     * @return Success
+     * [CONSUMER ONLY] Gets the message at the front of the queue without removing it
+     * @param queue  LogQueue instance
+     * @param length Pointer to set to the length of the message
+     * @param flush  Pointer to set to the flush request flag of the message
+     * @return Pointer to the message or NULL if there are none ready
      */
-    bool (* enqueue)( LogQueue_t * queue, const char * str );
+    const char * (* front)( LogQueue_t * queue, size_t * length, bool * flush );
 
     /**
-     * [THREAD SAFE] Dequeues a node
+     * [CONSUMER ONLY] Releases the slot at the front of the queue
      * @param queue LogQueue instance
-     * @return Pointer to dequeued node
      */
-    LogQueueNode_t * (* dequeue)( LogQueue_t * queue );
+    void (* pop)( LogQueue_t * queue );
 
     /**
-     * Gets the number of items in the LogQueue
+     * [THREAD SAFE] Gets the number of items in the LogQueue
      * @param self LogQueue instance
      * @return number of items
      */
@@ -67,16 +100,30 @@ extern const struct LogQueueClass {
     bool (* empty)( LogQueue_t * queue );
 
     /**
-     * Removes and de-allocates all LogQueueNode(s) in LogQueue
+     * [THREAD SAFE] Checks if the consumer should get to the queued messages without delay
      * @param queue LogQueue instance
+     * @return Flush request state (a queued message requested a flush or the ring is at least half full)
      */
-    void (* freeLogQueue)( LogQueue_t * queue );
+    bool (* flushRequested)( LogQueue_t * queue );
 
     /**
-     * De-allocates a _dequeued_ LogQueueNode
-     * @param node Dequeued node to free
+     * [CONSUMER ONLY] Lowers the flush request flag (call before draining the queue)
+     * @param queue LogQueue instance
      */
-    void (* freeLogQueueNode)( LogQueueNode_t * node );
+    void (* clearFlushRequest)( LogQueue_t * queue );
+
+    /**
+     * [THREAD SAFE] Gets and resets the number of messages dropped because the queue was full
+     * @param queue LogQueue instance
+     * @return Number of messages dropped since the last call
+     */
+    size_t (* dropped)( LogQueue_t * queue );
+
+    /**
+     * [CONSUMER ONLY] Discards all the messages left in the LogQueue
+     * @param queue LogQueue instance
+     */
+    void (* freeLogQueue)( LogQueue_t * queue );
 
     /**
      * Sets a callback to signal items are in the queue
@@ -1,3 +1,7 @@
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE //for `pthread_timedjoin_np(..)`
+#endif
+
 #include "LogWriter.h"
 
 #include <stdio.h>
@@ -5,17 +9,34 @@
 #include <errno.h>
 #include <wchar.h>
 #include <time.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/uio.h>
 
 #include "Logger.h"
 #include "../src/ctune_err.h"
-#include "../src/utils/Timeout.h"
 
-#define CTUNE_LOGGER_LOGWRITER_STOP_TIMEOUT 5 //in seconds
+#define CTUNE_LOGGER_LOGWRITER_STOP_TIMEOUT   5     //in seconds
+#define CTUNE_LOGGER_LOGWRITER_BUFFER_SIZE    65536 //in bytes
+#define CTUNE_LOGGER_LOGWRITER_FLUSH_LATENCY  200   //in milliseconds (default)
+#define CTUNE_LOGGER_LOGWRITER_TRACE_BUFFER   1024  //in records
+
+/**
+ * Log writer thread states
+ * @param CTUNE_LOGWRITER_AWAKE  Draining the queue
+ * @param CTUNE_LOGWRITER_DOZING Holding buffered output until the flush latency is up (woken early only on a flush request)
+ * @param CTUNE_LOGWRITER_IDLE   Nothing buffered: waiting on the next message
+ */
+enum ctune_LogWriter_State {
+    CTUNE_LOGWRITER_AWAKE = 0,
+    CTUNE_LOGWRITER_DOZING,
+    CTUNE_LOGWRITER_IDLE,
+};
 
 static struct LogWriterCfg {
     pthread_mutex_t sleep_mutex;
-    volatile bool   sleeping; //sleep signal
-    pthread_cond_t  wakeup_cond;
+    atomic_int      state; //ctune_LogWriter_State
+    pthread_cond_t  wakeup_cond; //uses the monotonic clock for timed waits (set in `ctune_LogWriter_start(..)`)
 
     pthread_mutex_t interrupt_mutex;
     volatile bool   interrupt; //main loop interrupt
@@ -23,24 +44,41 @@ static struct LogWriterCfg {
     FILE          * out;
     LogQueue_t    * msg_queue;
 
-    struct Timer {
-        const    u_int64_t timeout;
-        volatile u_int64_t start;
+    int                     trace_fd;
+    _Atomic(TraceQueue_t *) trace_queue; //set once the trace file is attached
+
+    struct Buffer {
+        char      data[CTUNE_LOGGER_LOGWRITER_BUFFER_SIZE];
+        size_t    length;
+        u_int64_t since; //time the oldest message or record in the buffers was added (microseconds)
 
-    } timer; //microsecond resolution
+    } buffer;
+
+    struct TraceBuffer {
+        ctune_TraceRecord_t records[CTUNE_LOGGER_LOGWRITER_TRACE_BUFFER];
+        size_t              count;
+
+    } trace;
+
+    _Atomic u_int64_t flush_latency; //max time a message stays in the buffer (microseconds)
 
 } log_writer = {
     .sleep_mutex     = PTHREAD_MUTEX_INITIALIZER,
-    .sleeping        = false,
+    .state           = CTUNE_LOGWRITER_AWAKE,
     .wakeup_cond     = PTHREAD_COND_INITIALIZER,
     .interrupt_mutex = PTHREAD_MUTEX_INITIALIZER,
     .interrupt       = false,
     .out             = NULL,
     .msg_queue       = NULL,
-    .timer           = { .timeout = 1500000 /* 1.5s */ },
+    .trace_fd        = -1,
+    .trace_queue     = NULL,
+    .buffer          = { .length = 0, .since = 0 },
+    .trace           = { .count = 0 },
+    .flush_latency   = ( CTUNE_LOGGER_LOGWRITER_FLUSH_LATENCY * 1000 ),
 };
 
 static pthread_t log_writer_thread;
+static bool      log_writer_running = false;
 
 /**
  * [PRIVATE] Get time now in microseconds (1us = 0.000001s)
@@ -54,6 +92,14 @@ static u_int64_t ctune_LogWriter_getTimeNow() {
         return 0;
 }
 
+/**
+ * [PRIVATE] Checks if there is output waiting to be written out
+ * @return Pending state
+ */
+static bool ctune_LogWriter_pending() {
+    return ( log_writer.buffer.length > 0 || log_writer.trace.count > 0 );
+}
+
 /**
  * [PRIVATE/THREAD SAFE] check the running state of the main loop
  * @return Running state
@@ -67,29 +113,174 @@ static bool ctune_LogWriter_checkInterruptState() {
 }
 
 /**
- * [PRIVATE/THREAD SAFE] Puts the log writer to sleep if the timer timed-out
- * @param start       Start value of the timer
- * @param timeout_val Timeout value for the timer
- * @param split       Timer value when method is called (i.e. now)
+ * [PRIVATE] Writes the buffered messages, followed by an optional message, to the output file in a single call
+ * @param msg    Message to write after the buffered ones (NULL for none)
+ * @param length Length of the message
+ * @return Success
+ */
+static bool ctune_LogWriter_flush( const char * msg, size_t length ) {
+    struct iovec iov[3] = {
+        { .iov_base = log_writer.buffer.data, .iov_len = log_writer.buffer.length },
+        { .iov_base = (void *) msg,           .iov_len = ( msg ? length : 0 )     },
+        { .iov_base = "\n",                   .iov_len = ( msg ? 1 : 0 )          },
+    };
+
+    struct iovec * vec         = iov;
+    int            count       = 3;
+    bool           error_state = false;
+    const int      fd          = fileno( log_writer.out );
+
+    for(;;) {
+        while( count > 0 && vec->iov_len == 0 ) { //skip what has been written out already
+            ++vec;
+            --count;
+        }
+
+        if( count == 0 )
+            break;
+
+        ssize_t ret = writev( fd, vec, count );
+
+        if( ret < 0 && errno == EINTR )
+            continue;
+
+        if( ret <= 0 ) {
+            syslog( LOG_ERR, "[ctune_LogWriter_flush( %p, %zu )] Failed to write to the log file: %s", msg, length, strerror( errno ) );
+            error_state = true;
+            break;
+        }
+
+        size_t written = (size_t) ret;
+
+        for( ; count > 0 && written > 0; ++vec, --count ) { //partial write
+            if( written < vec->iov_len ) {
+                vec->iov_base  = (char *) vec->iov_base + written;
+                vec->iov_len  -= written;
+                break;
+            }
+
+            written -= vec->iov_len;
+        }
+    }
+
+    log_writer.buffer.length = 0;
+    return !( error_state );
+}
+
+/**
+ * [PRIVATE] Writes the buffered trace records to the trace file
+ * @return Success
+ */
+static bool ctune_LogWriter_flushTrace( void ) {
+    const char * data        = (const char *) log_writer.trace.records;
+    size_t       remaining   = ( log_writer.trace.count * sizeof( ctune_TraceRecord_t ) );
+    bool         error_state = false;
+
+    while( remaining > 0 ) {
+        ssize_t ret = write( log_writer.trace_fd, data, remaining );
+
+        if( ret < 0 && errno == EINTR )
+            continue;
+
+        if( ret <= 0 ) {
+            syslog( LOG_ERR, "[ctune_LogWriter_flushTrace()] Failed to write to the trace file: %s", strerror( errno ) );
+            error_state = true;
+            break;
+        }
+
+        data      += ret;
+        remaining -= (size_t) ret;
+    }
+
+    log_writer.trace.count = 0;
+    return !( error_state );
+}
+
+/**
+ * [PRIVATE] Adds a record to the trace buffer (the buffer is written out first if full)
+ * @param record Trace record
+ * @param now    Time now (microseconds)
  */
-void ctune_LogWriter_checkTired( u_int64_t start, u_int64_t timeout_val, u_int64_t split ) {
-    if( ctune_LogWriter_checkInterruptState() == true )
-        return;
+static void ctune_LogWriter_bufferTrace( const ctune_TraceRecord_t * record, u_int64_t now ) {
+    if( log_writer.trace.count == CTUNE_LOGGER_LOGWRITER_TRACE_BUFFER )
+        ctune_LogWriter_flushTrace();
 
-    bool goto_sleep = ( split == 0 ) || ( ( split - start ) > timeout_val );
+    if( !ctune_LogWriter_pending() )
+        log_writer.buffer.since = now;
+
+    log_writer.trace.records[ log_writer.trace.count++ ] = *record;
+}
+
+/**
+ * [PRIVATE] Adds a message to the output buffer (the buffer is written out first if the message does not fit)
+ * @param msg    Message
+ * @param length Length of the message
+ * @param now    Time now (microseconds)
+ */
+static void ctune_LogWriter_buffer( const char * msg, size_t length, u_int64_t now ) {
+    if( ( length + 1 ) > ( CTUNE_LOGGER_LOGWRITER_BUFFER_SIZE - log_writer.buffer.length ) ) {
+        ctune_LogWriter_flush( msg, length );
+        return; //EARLY RETURN
+    }
 
+    if( !ctune_LogWriter_pending() )
+        log_writer.buffer.since = now;
+
+    memcpy( &log_writer.buffer.data[ log_writer.buffer.length ], msg, length );
+    log_writer.buffer.length += length;
+    log_writer.buffer.data[ log_writer.buffer.length++ ] = '\n';
+}
+
+/**
+ * [PRIVATE/THREAD SAFE] Suspends the log writer until there is something to do
+ * - with output buffered it dozes until the flush latency is up unless a flush is requested in the meantime
+ * - with nothing buffered it idles until a message is queued
+ * - the queue and interrupt state are re-checked after the state is set so that
+ *   a producer that saw the writer awake (and skipped the wake-up call) is never missed
+ */
+static void ctune_LogWriter_wait( void ) {
     pthread_mutex_lock( &log_writer.sleep_mutex );
-    log_writer.sleeping = goto_sleep;
+
+    TraceQueue_t * traces   = atomic_load( &log_writer.trace_queue );
+    const bool     buffered = ctune_LogWriter_pending();
+
+    atomic_store( &log_writer.state, ( buffered ? CTUNE_LOGWRITER_DOZING : CTUNE_LOGWRITER_IDLE ) );
+
+    while( atomic_load( &log_writer.state ) != CTUNE_LOGWRITER_AWAKE ) {
+        if( ctune_LogWriter_checkInterruptState() )
+            break;
+
+        if( buffered ) {
+            if( ctune_LogQueue.flushRequested( log_writer.msg_queue ) || ( traces && ctune_TraceQueue.flushRequested( traces ) ) )
+                break;
+
+            const u_int64_t due      = log_writer.buffer.since + atomic_load( &log_writer.flush_latency );
+            struct timespec deadline = { .tv_sec  = (time_t) ( due / 1000000 ),
+                                         .tv_nsec = (long) ( ( due % 1000000 ) * 1000 ) };
+
+            if( pthread_cond_timedwait( &log_writer.wakeup_cond, &log_writer.sleep_mutex, &deadline ) == ETIMEDOUT )
+                break;
+
+        } else {
+            if( !ctune_LogQueue.empty( log_writer.msg_queue ) || ( traces && !ctune_TraceQueue.empty( traces ) ) )
+                break;
+
+            pthread_cond_wait( &log_writer.wakeup_cond, &log_writer.sleep_mutex );
+        }
+    }
+
+    atomic_store( &log_writer.state, CTUNE_LOGWRITER_AWAKE );
+
     pthread_mutex_unlock( &log_writer.sleep_mutex );
 }
 
 /**
- * [PRIVATE/THREAD SAFE] Checks if log writer is suspended
+ * [PRIVATE/THREAD SAFE] Wakes up the log writer unconditionally
  */
-void ctune_LogWriter_checkSleeping() {
+static void ctune_LogWriter_wake( void ) {
     pthread_mutex_lock( &log_writer.sleep_mutex );
-    while ( log_writer.sleeping )
-        pthread_cond_wait( &log_writer.wakeup_cond, &log_writer.sleep_mutex );
+    atomic_store( &log_writer.state, CTUNE_LOGWRITER_AWAKE );
+    pthread_cond_broadcast( &log_writer.wakeup_cond );
     pthread_mutex_unlock( &log_writer.sleep_mutex );
 }
 
@@ -99,24 +290,77 @@ void ctune_LogWriter_checkSleeping() {
  * @return NULL
  */
 static void * ctune_LogWriter_runLoop( void * args ) {
-    struct LogWriterCfg * cfg      = args;
-    LogQueueNode_t      * msg_node = NULL;
+    struct LogWriterCfg * cfg     = args;
+    const char          * msg     = NULL;
+    size_t                length  = 0;
+    size_t                dropped = 0;
+    bool                  urgent  = false;
+
+    TraceQueue_t              * traces = NULL;
+    const ctune_TraceRecord_t * record = NULL;
+
+    for(;;) {
+        //read before draining so that everything queued ahead of the interrupt gets written out
+        const bool      interrupted = ctune_LogWriter_checkInterruptState();
+        const u_int64_t now         = ctune_LogWriter_getTimeNow();
+        bool            flush       = interrupted;
+
+        ctune_LogQueue.clearFlushRequest( cfg->msg_queue ); //any request raised from here on is caught by the next wait
+
+        while( ( msg = ctune_LogQueue.front( cfg->msg_queue, &length, &urgent ) ) != NULL ) {
+            ctune_LogWriter_buffer( msg, length, now );
+            ctune_LogQueue.pop( cfg->msg_queue );
+            flush |= urgent;
+        }
+
+        if( ( dropped = ctune_LogQueue.dropped( cfg->msg_queue ) ) > 0 ) {
+            char notice[128];
+            int  ret = snprintf( notice, sizeof( notice ), "[ctune_LogWriter] %zu log message(s) dropped: queue full.", dropped );
+
+            if( ret > 0 )
+                ctune_LogWriter_buffer( notice, (size_t) ret, now );
+        }
+
+        if( ( traces = atomic_load( &cfg->trace_queue ) ) != NULL ) {
+            while( ( record = ctune_TraceQueue.front( traces ) ) != NULL ) {
+                ctune_LogWriter_bufferTrace( record, now );
+                ctune_TraceQueue.pop( traces );
+            }
+
+            if( ( dropped = ctune_TraceQueue.dropped( traces ) ) > 0 ) {
+                struct timespec     ts;
+                ctune_TraceRecord_t notice = { .id = CTUNE_TRACE_ID_DROPPED, .thread = 0 };
+                const uint64_t      count  = dropped;
 
-    while( ctune_LogWriter_checkInterruptState() == false ) {
-        ctune_LogWriter_checkSleeping();
+                clock_gettime( CLOCK_REALTIME, &ts );
+                notice.timestamp = ( (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec );
+                memcpy( notice.payload, &count, sizeof( count ) );
 
-        while( ( msg_node = ctune_LogQueue.dequeue( cfg->msg_queue ) ) != NULL ) {
-            fprintf( cfg->out, "%s\n", msg_node->data );
-            ctune_LogQueue.freeLogQueueNode( msg_node );
-            fflush( cfg->out );
+                ctune_LogWriter_bufferTrace( &notice, now );
+            }
         }
 
-        ctune_LogWriter_checkTired( log_writer.timer.start,
-                                    log_writer.timer.timeout,
-                                    ctune_LogWriter_getTimeNow() );
+        if( ctune_LogWriter_pending() && ( flush || ( now - log_writer.buffer.since ) >= atomic_load( &log_writer.flush_latency ) ) ) {
+            if( log_writer.buffer.length > 0 )
+                ctune_LogWriter_flush( NULL, 0 );
+
+            if( log_writer.trace.count > 0 )
+                ctune_LogWriter_flushTrace();
+        }
+
+        if( interrupted )
+            break;
+
+        ctune_LogWriter_wait();
     }
 
     fclose( cfg->out );
+
+    if( cfg->trace_fd >= 0 ) {
+        close( cfg->trace_fd );
+        cfg->trace_fd = -1;
+    }
+
     return NULL;
 }
 
@@ -143,8 +387,18 @@ static bool ctune_LogWriter_start( const char * out_filepath, const char * file_
 
     log_writer.out       = fopen( out_filepath, file_mode );
     log_writer.msg_queue = queue;
-    log_writer.interrupt = false;
-    log_writer.sleeping  = false;
+    log_writer.interrupt     = false;
+    log_writer.buffer.length = 0;
+    log_writer.trace.count   = 0;
+    log_writer.trace_fd      = -1;
+    atomic_store( &log_writer.trace_queue, NULL );
+    atomic_store( &log_writer.state, CTUNE_LOGWRITER_AWAKE );
+
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init( &cond_attr );
+    pthread_condattr_setclock( &cond_attr, CLOCK_MONOTONIC ); //same clock as `ctune_LogWriter_getTimeNow()`
+    pthread_cond_init( &log_writer.wakeup_cond, &cond_attr );
+    pthread_condattr_destroy( &cond_attr );
 
     if( log_writer.out == NULL ) {
         syslog( LOG_ERR,
@@ -164,6 +418,9 @@ static bool ctune_LogWriter_start( const char * out_filepath, const char * file_
 
         ctune_err.set( CTUNE_ERR_THREAD_CREATE );
         log_writer.interrupt = true;
+
+    } else {
+        log_writer_running = true;
     }
 
     end:
@@ -173,6 +430,7 @@ static bool ctune_LogWriter_start( const char * out_filepath, const char * file_
 
 /**
  * [THREAD SAFE] Stops the log writer
+ * - blocks until everything queued before the call is written out and the writer thread has exited
  * @return 0 for success or negative cTune error number on failure
  */
 static int ctune_LogWriter_stop() {
@@ -180,38 +438,72 @@ static int ctune_LogWriter_stop() {
     log_writer.interrupt = true; //sends interrupt to loop
     pthread_mutex_unlock( &log_writer.interrupt_mutex );
 
-    ctune_LogWriter.resume(); //get the loop going so it can exit
+    ctune_LogWriter_wake(); //get the loop going so it can exit
 
-    ctune_Timeout_t timer = ctune_Timeout.init( CTUNE_LOGGER_LOGWRITER_STOP_TIMEOUT, 0, NULL );
+    if( !log_writer_running )
+        return CTUNE_ERR_NONE; //EARLY RETURN
 
-    while( ctune_LogWriter_checkInterruptState() == false && !ctune_Timeout.timedOut( &timer ) );
+    struct timespec deadline;
+    clock_gettime( CLOCK_REALTIME, &deadline );
+    deadline.tv_sec += CTUNE_LOGGER_LOGWRITER_STOP_TIMEOUT;
 
-    if( ctune_LogWriter_checkInterruptState() == false ) {
+    //the loop writes out whatever is still buffered before closing the file
+    if( pthread_timedjoin_np( log_writer_thread, NULL, &deadline ) != 0 ) {
         return -CTUNE_ERR_LOG_STOP_TIMEOUT;
     }
 
+    log_writer_running = false;
     return CTUNE_ERR_NONE;
 }
 
 /**
  * [THREAD SAFE] Wake-up the log writer
  * - (use as callback on the LoqQueue whenever a enqueue operation is made)
+ * - lock-free unless the writer is idle or a flush was requested while it dozes (i.e.: once per batch)
  */
 void ctune_LogWriter_resume() {
-    pthread_mutex_lock( &log_writer.sleep_mutex );
-    pthread_cond_broadcast( &log_writer.wakeup_cond );
-    pthread_mutex_unlock( &log_writer.sleep_mutex );
+    const int state = atomic_load( &log_writer.state );
+
+    if( state == CTUNE_LOGWRITER_AWAKE )
+        return; //EARLY RETURN
 
-    //resets timer everytime a call is made
-    log_writer.sleeping    = false;
-    log_writer.timer.start = ctune_LogWriter_getTimeNow();
+    if( state == CTUNE_LOGWRITER_DOZING ) {
+        TraceQueue_t * traces = atomic_load( &log_writer.trace_queue );
+
+        if( !ctune_LogQueue.flushRequested( log_writer.msg_queue ) && !( traces && ctune_TraceQueue.flushRequested( traces ) ) )
+            return; //EARLY RETURN - picked up when the flush latency is up
+    }
+
+    ctune_LogWriter_wake();
+}
+
+/**
+ * [THREAD SAFE] Sets the maximum time a message can be held in the output buffer before being written out
+ * @param latency_ms Latency bound in milliseconds (0: write out every batch)
+ */
+static void ctune_LogWriter_setFlushLatency( unsigned latency_ms ) {
+    atomic_store( &log_writer.flush_latency, ( (u_int64_t) latency_ms * 1000 ) );
+}
+
+/**
+ * Hands a binary trace file over to the log writer
+ * - the records queued are written out on the same schedule as the log messages
+ * - the file descriptor is closed when the writer stops
+ * @param fd    Trace file descriptor (header already written)
+ * @param queue Pointer to an instantiated TraceQueue
+ */
+static void ctune_LogWriter_attachTrace( int fd, TraceQueue_t * queue ) {
+    log_writer.trace_fd = fd;
+    atomic_store( &log_writer.trace_queue, queue ); //publishes `trace_fd` along with it
 }
 
 /**
  * Namespace constructor
  */
 const struct ctune_LogWriter_Instance ctune_LogWriter = {
-    .start    = &ctune_LogWriter_start,
-    .stop     = &ctune_LogWriter_stop,
-    .resume   = &ctune_LogWriter_resume,
+    .start           = &ctune_LogWriter_start,
+    .stop            = &ctune_LogWriter_stop,
+    .resume          = &ctune_LogWriter_resume,
+    .setFlushLatency = &ctune_LogWriter_setFlushLatency,
+    .attachTrace     = &ctune_LogWriter_attachTrace,
 };
\ No newline at end of file
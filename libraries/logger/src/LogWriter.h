@@ -2,6 +2,7 @@
 #define CTUNE_LOGGER_WRITER_H
 
 #include "LogQueue.h"
+#include "TraceQueue.h"
 
 extern const struct ctune_LogWriter_Instance {
     /**
@@ -15,6 +16,7 @@ extern const struct ctune_LogWriter_Instance {
 
     /**
      * [THREAD SAFE] Stops the log writer
+     * - blocks until everything queued before the call is written out and the writer thread has exited
      * @return 0 for success or negative cTune error number on failure
      */
     int  (* stop)( void );
@@ -24,6 +26,22 @@ extern const struct ctune_LogWriter_Instance {
      */
     void (* resume)( void );
 
+    /**
+     * [THREAD SAFE] Sets the maximum time a message can be held in the output buffer before being written out
+     * - ERROR/FATAL messages and shutdown always trigger a write
+     * @param latency_ms Latency bound in milliseconds (0: write out every batch)
+     */
+    void (* setFlushLatency)( unsigned latency_ms );
+
+    /**
+     * Hands a binary trace file over to the log writer
+     * - the records queued are written out on the same schedule as the log messages
+     * - the file descriptor is closed when the writer stops
+     * @param fd    Trace file descriptor (header already written)
+     * @param queue Pointer to an instantiated TraceQueue
+     */
+    void (* attachTrace)( int fd, TraceQueue_t * queue );
+
 } ctune_LogWriter;
 
 #endif //CTUNE_LOGGER_WRITER_H
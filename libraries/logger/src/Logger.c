@@ -2,17 +2,24 @@
 
 #include <time.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <syslog.h>
 #include <wchar.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/syscall.h>
 
 #include "LogQueue.h"
 #include "LogWriter.h"
+#include "TraceFormat.h"
+#include "TraceQueue.h"
 #include "project_version.h"
 #include "../src/ctune_err.h"
-#include "../src/utils/Timeout.h"
-#include "../src/datastructure/String.h"
 
-#define CTUNE_LOGGER_MSG_MAX_SIZE 512
+#define CTUNE_LOGGER_LEVEL_TAG_LENGTH 12 //length of each of the `log_level` tags
 
 static const char * log_level[] = {
     "|EMERGENCY| ", //0 (not implemented)
@@ -29,38 +36,278 @@ static const char * log_level[] = {
 static struct Logger {
     bool                init_success;
     enum ctune_LogLevel level;
-    int                 timeout_val;
     pthread_mutex_t     mutex;
     LogQueue_t          message_queue;
 
+    atomic_bool         trace_open;
+    pthread_mutex_t     trace_mutex; //serialises trace format registrations
+    TraceQueue_t        trace_queue;
+    uint32_t            trace_format_count;
+
 } logger = {
-    .init_success  = false,
-    .level         = CTUNE_LOG_DEBUG, //default level
-    .timeout_val   = 5, //in seconds
-    .mutex         = PTHREAD_MUTEX_INITIALIZER,
-    .message_queue = {
-        ._mutex = PTHREAD_MUTEX_INITIALIZER,
-        ._front = NULL,
-        ._back  = NULL,
-    }
+    .init_success       = false,
+    .level              = CTUNE_LOG_DEBUG, //default level
+    .mutex              = PTHREAD_MUTEX_INITIALIZER,
+    .message_queue      = { ._slots = NULL },
+    .trace_open         = false,
+    .trace_mutex        = PTHREAD_MUTEX_INITIALIZER,
+    .trace_queue        = { ._slots = NULL },
+    .trace_format_count = 1, //0 is `CTUNE_TRACE_ID_DROPPED`
 };
 
+static LogQueueSlot_t   message_slots[CTUNE_LOGQUEUE_CAPACITY];
+static TraceQueueSlot_t trace_slots[CTUNE_TRACEQUEUE_CAPACITY];
+
+/**
+ * Registered trace formats (indexed by id)
+ * @param types Argument types
+ * @param count Number of arguments
+ */
+static struct ctune_Logger_TraceFormat {
+    uint8_t types[CTUNE_TRACE_MAX_ARGS];
+    uint8_t count;
+
+} trace_formats[CTUNE_TRACE_MAX_FORMATS];
+
+/**
+ * Per-thread formatting state so that logging a message needs no allocation or locking
+ * @param buffer      Message buffer (any message that fits also fits in-place in a LogQueue slot)
+ * @param time_sec    Second for which `time_prefix` was generated
+ * @param time_prefix Cached "YYYY-MM-DD HH:MM:SS" (UTC) date/time
+ * @param time_length Length of `time_prefix`
+ * @param thread_id   Cached kernel thread id (0 until first needed)
+ */
+static __thread struct ctune_Logger_ThreadBuffer {
+    char   buffer[CTUNE_LOGQUEUE_SLOT_SIZE];
+    time_t time_sec;
+    char   time_prefix[32];
+    size_t time_length;
+    pid_t  thread_id;
+
+} thread_buffer = { .time_sec = -1, .thread_id = 0 };
+
 /**
- * [PRIVATE] Append date/time (UTC) to the end of a string
- * @param str String to append
+ * [PRIVATE] Writes the date/time (UTC) into a buffer
+ * @param buffer Buffer to write into (at least 64 bytes)
+ * @return Length written
  */
-static void ctune_Logger_getTime( String_t * str ) {
+static size_t ctune_Logger_getTime( char * buffer ) {
     //Uses the POSIX function `clock_gettime(CLOCK_REALTIME, ts)`
     //https://pubs.opengroup.org/onlinepubs/9699919799/functions/clock_getres.html
     struct timespec ts;
     clock_gettime( CLOCK_REALTIME, &ts );
 
-    char date_time1[128];
-    strftime( date_time1, sizeof date_time1, "%F %T", gmtime( &ts.tv_sec ) );
-    char date_time2[255];
-    snprintf( date_time2, 255, "%s.%09ld ", date_time1, ts.tv_nsec );
+    if( ts.tv_sec != thread_buffer.time_sec ) {
+        struct tm date_time;
+        gmtime_r( &ts.tv_sec, &date_time );
+
+        thread_buffer.time_length = strftime( thread_buffer.time_prefix, sizeof( thread_buffer.time_prefix ), "%F %T", &date_time );
+        thread_buffer.time_sec    = ts.tv_sec;
+    }
+
+    size_t length = thread_buffer.time_length;
+    long   nsec   = ts.tv_nsec;
+
+    memcpy( buffer, thread_buffer.time_prefix, length );
+
+    buffer[ length++ ] = '.';
+
+    for( size_t i = ( length + 9 ); i > length; --i, nsec /= 10 ) {
+        buffer[ i - 1 ] = (char) ( '0' + ( nsec % 10 ) );
+    }
+
+    length += 9;
+    buffer[ length++ ] = ' ';
+
+    return length;
+}
+
+/**
+ * [PRIVATE] Formats a message once in the calling thread's buffer and queues it for the writer
+ * @param lvl      Message log level
+ * @param filename Source file name (NULL to omit)
+ * @param line_num Line number in source file
+ * @param format   String format (similar to `vprintf`)
+ * @param args     List of arguments (similar to `vprintf`)
+ */
+static void ctune_Logger_write( enum ctune_LogLevel lvl, const char * filename, int line_num, const char * format, va_list args ) {
+    const size_t buff_size = sizeof( thread_buffer.buffer );
+    char       * buffer    = thread_buffer.buffer;
+    char       * heap_buff = NULL;
+    size_t       length    = ctune_Logger_getTime( buffer );
+    int          ret       = 0;
+
+    memcpy( &buffer[ length ], log_level[(int) lvl], CTUNE_LOGGER_LEVEL_TAG_LENGTH );
+    length += CTUNE_LOGGER_LEVEL_TAG_LENGTH;
+
+    if( filename != NULL ) {
+        if( ( ret = snprintf( &buffer[ length ], ( buff_size - length ), "(%s:%i) ", filename, line_num ) ) > 0 ) {
+            length += ( (size_t) ret < ( buff_size - length ) ? (size_t) ret : ( buff_size - length - 1 ) );
+
+        } else { //should not happen but just in case...
+            syslog( LOG_ERR,
+                    "[ctune_Logger_write( %i, %s, %i, \"%s\", ... )] "
+                    "Could not parse filename:line_no into string buffer (ret=%i).",
+                    (int) lvl, filename, line_num, format, ret
+            );
+        }
+    }
+
+    const size_t msg_offset = length;
+
+    va_list args_cp;
+    va_copy( args_cp, args );
+    //reason for copy of args: https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/stdarg.h.html
+    ret = vsnprintf( &buffer[ length ], ( buff_size - length ), format, args_cp ); //OK with C99, not with older versions!
+    va_end( args_cp );
+
+    if( ret < 0 ) {
+        syslog( LOG_ERR,
+                "[ctune_Logger_write( %i, %s, %i, \"%s\", ... )] "
+                "Could not parse into string buffer (ret=%i).",
+                (int) lvl, filename, line_num, format, ret
+        );
+
+        return; //EARLY RETURN
+    }
+
+    if( (size_t) ret < ( buff_size - length ) ) {
+        length += (size_t) ret;
+
+    } else if( ( heap_buff = malloc( length + (size_t) ret + 1 ) ) != NULL ) { //slow path: message too long for the thread buffer
+        memcpy( heap_buff, buffer, length );
+        vsnprintf( &heap_buff[ length ], ( (size_t) ret + 1 ), format, args );
+        buffer  = heap_buff;
+        length += (size_t) ret;
+
+    } else { //keep the truncated message
+        length = ( buff_size - 1 );
+    }
+
+    if( logger.init_success ) {
+        ctune_LogQueue.enqueue( &logger.message_queue, buffer, length, ( lvl <= CTUNE_LOG_ERROR ) ); //errors are flushed straight away
+
+    } else { //syslog
+        if( lvl < CTUNE_LOG_TRACE ) //lvl>=8 not supported by syslog
+            syslog( lvl, "%s", &buffer[ msg_offset ] );
+    }
+
+    free( heap_buff );
+}
+
+/**
+ * [PRIVATE] Registers the format of a trace call site and sends its definition to the trace file
+ * @param id       Pointer to the call site's format id
+ * @param filename Source file path
+ * @param line_num Line number in source file
+ * @param format   String format
+ * @return Format id (`CTUNE_TRACE_ID_UNSUPPORTED` when the format cannot be recorded in binary)
+ */
+static uint32_t ctune_Logger_registerTrace( uint32_t * id, const char * filename, int line_num, const char * format ) {
+    pthread_mutex_lock( &logger.trace_mutex );
+
+    uint32_t         trace_id   = __atomic_load_n( id, __ATOMIC_ACQUIRE );
+    ctune_TraceArg_e types[CTUNE_TRACE_MAX_ARGS];
+    size_t           count      = 0;
+    char           * definition = NULL;
+
+    if( trace_id != 0 )
+        goto end; //registered by another thread in the meantime
+
+    trace_id = CTUNE_TRACE_ID_UNSUPPORTED;
+
+    if( logger.trace_format_count >= CTUNE_TRACE_MAX_FORMATS || !ctune_TraceFormat.parse( format, types, &count ) )
+        goto publish;
+
+    const char * name   = strrchr( filename, '/' );
+    const int    length = snprintf( NULL, 0, "%s:%i%c%s", ( name ? name + 1 : filename ), line_num, '\0', format );
+
+    if( length < 0 || ( definition = calloc( (size_t) length + CTUNE_TRACE_PAYLOAD_SIZE, sizeof( char ) ) ) == NULL )
+        goto publish;
+
+    snprintf( definition, (size_t) length + 1, "%s:%i%c%s", ( name ? name + 1 : filename ), line_num, '\0', format );
+
+    const uint32_t new_id = logger.trace_format_count;
+
+    for( size_t offset = 0; offset <= (size_t) length; offset += CTUNE_TRACE_PAYLOAD_SIZE ) {
+        size_t                pos    = 0;
+        ctune_TraceRecord_t * record = ctune_TraceQueue.claim( &logger.trace_queue, true, &pos ); //definitions are not dropped lightly
+
+        if( record == NULL )
+            goto publish; //the decoder ignores incomplete definitions
+
+        record->timestamp = 0;
+        record->id        = ( new_id | CTUNE_TRACE_ID_DEFINITION );
+        record->thread    = (uint32_t) offset;
+        memcpy( record->payload, &definition[ offset ], CTUNE_TRACE_PAYLOAD_SIZE );
+
+        ctune_TraceQueue.publish( &logger.trace_queue, pos );
+    }
 
-    String.append_back( str, date_time2 );
+    for( size_t i = 0; i < count; ++i ) {
+        trace_formats[ new_id ].types[ i ] = (uint8_t) types[ i ];
+    }
+
+    trace_formats[ new_id ].count = (uint8_t) count;
+    trace_id = logger.trace_format_count++;
+
+    publish:
+        __atomic_store_n( id, trace_id, __ATOMIC_RELEASE );
+    end:
+        pthread_mutex_unlock( &logger.trace_mutex );
+        free( definition );
+        return trace_id;
+}
+
+/**
+ * [PRIVATE] Packs arguments into a trace record's payload (what does not fit is left out)
+ * @param payload Record payload
+ * @param format  Registered format of the arguments
+ * @param args    List of arguments
+ */
+static void ctune_Logger_packTrace( uint8_t * payload, const struct ctune_Logger_TraceFormat * format, va_list args ) {
+    size_t offset = 0;
+
+    for( size_t i = 0; i < format->count; ++i ) {
+        int64_t value = 0;
+
+        switch( (ctune_TraceArg_e) format->types[ i ] ) {
+            case CTUNE_TRACEARG_INT    : value = va_arg( args, int );                    break;
+            case CTUNE_TRACEARG_LONG   : value = va_arg( args, long );                   break;
+            case CTUNE_TRACEARG_LLONG  : value = va_arg( args, long long );              break;
+            case CTUNE_TRACEARG_SIZE   : value = (int64_t) va_arg( args, size_t );       break;
+            case CTUNE_TRACEARG_INTMAX : value = va_arg( args, intmax_t );               break;
+            case CTUNE_TRACEARG_PTRDIFF: value = va_arg( args, ptrdiff_t );              break;
+            case CTUNE_TRACEARG_PTR    : value = (int64_t) (uintptr_t) va_arg( args, void * ); break;
+
+            case CTUNE_TRACEARG_DOUBLE: {
+                const double d = va_arg( args, double );
+                memcpy( &value, &d, sizeof( value ) );
+            } break;
+
+            case CTUNE_TRACEARG_STR: {
+                const char * str = va_arg( args, const char * );
+
+                if( offset >= CTUNE_TRACE_PAYLOAD_SIZE )
+                    return; //EARLY RETURN
+
+                if( str == NULL )
+                    str = "(null)";
+
+                const size_t length = strnlen( str, ( CTUNE_TRACE_PAYLOAD_SIZE - offset - 1 ) );
+
+                memcpy( &payload[ offset ], str, length );
+                payload[ offset + length ] = '\0';
+                offset += ( length + 1 );
+            } continue;
+        }
+
+        if( ( offset + sizeof( value ) ) > CTUNE_TRACE_PAYLOAD_SIZE )
+            return; //EARLY RETURN
+
+        memcpy( &payload[ offset ], &value, sizeof( value ) );
+        offset += sizeof( value );
+    }
 }
 
 /**
@@ -79,6 +326,7 @@ static bool ctune_Logger_init( const char * log_filepath, const char * file_mode
 
     logger.level = level;
 
+    ctune_LogQueue.init( &logger.message_queue, message_slots, CTUNE_LOGQUEUE_CAPACITY );
     ctune_LogQueue.setSendReadySignalCallback( &logger.message_queue, ctune_LogWriter.resume );
 
     if( !ctune_LogWriter.start( log_filepath, file_mode, &logger.message_queue ) ) {
@@ -101,82 +349,104 @@ static ctune_LogLevel_e ctune_Logger_logLevel( void ) {
 }
 
 /**
- * Terminate logger and closes output file
+ * Sets the maximum time a message can wait in the output buffer before being written to the log file
+ * @param latency_ms Latency bound in milliseconds (0: write out every batch)
  */
-static void ctune_Logger_close() {
-    pthread_mutex_lock( &logger.mutex );
+static void ctune_Logger_setFlushLatency( unsigned latency_ms ) {
+    ctune_LogWriter.setFlushLatency( latency_ms );
+}
 
-    ctune_Timeout_t timer = ctune_Timeout.init( logger.timeout_val, CTUNE_ERR_LOG_FLUSH_TIMEOUT, ctune_err.set );
+/**
+ * Opens a binary trace file that `CTUNE_TRACE(..)` records go to from then on (call after `init(..)`)
+ * @param trace_filepath Trace file path (truncated)
+ * @return Success
+ */
+static bool ctune_Logger_openTrace( const char * trace_filepath ) {
+    bool error_state = false;
+    int  fd          = -1;
 
-    while( !ctune_LogQueue.empty( &logger.message_queue ) && !ctune_Timeout.timedOut( &timer ) ); //wait for the queue to clear
+    pthread_mutex_lock( &logger.mutex );
 
-    if( !ctune_LogQueue.empty( &logger.message_queue ) ) {
-        syslog( LOG_ERR, "[ctune_Logger_close()] LogQueue flushing timed-out (%ld items left).", ctune_LogQueue.size( &logger.message_queue ) );
+    if( !logger.init_success || atomic_load( &logger.trace_open ) ) {
+        syslog( LOG_ERR, "[ctune_Logger_openTrace( \"%s\" )] Logger not initialised or trace already open.", trace_filepath );
+        error_state = true;
+        goto end;
     }
 
-    int ret = ctune_LogWriter.stop();
+    if( ( fd = open( trace_filepath, ( O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC ), 0644 ) ) < 0 ) {
+        syslog( LOG_ERR, "[ctune_Logger_openTrace( \"%s\" )] Could not open file: %s", trace_filepath, strerror( errno ) );
+        error_state = true;
+        goto end;
+    }
 
-    if( ret != CTUNE_ERR_NONE ) {
-        syslog( LOG_ERR, "[ctune_Logger_close()] LogWriter.stop() returned an error: (%i) %s.", ret, ctune_err.print( ret ) );
+    ctune_TraceHeader_t header = {
+        .version     = CTUNE_TRACE_VERSION,
+        .record_size = sizeof( ctune_TraceRecord_t ),
+    };
+
+    memcpy( header.magic, CTUNE_TRACE_MAGIC, sizeof( header.magic ) );
+
+    if( write( fd, &header, sizeof( header ) ) != (ssize_t) sizeof( header ) ) {
+        syslog( LOG_ERR, "[ctune_Logger_openTrace( \"%s\" )] Could not write header: %s", trace_filepath, strerror( errno ) );
+        close( fd );
+        error_state = true;
+        goto end;
     }
 
-    ctune_LogQueue.freeLogQueue( &logger.message_queue );
+    ctune_TraceQueue.init( &logger.trace_queue, trace_slots, CTUNE_TRACEQUEUE_CAPACITY );
+    ctune_TraceQueue.setSendReadySignalCallback( &logger.trace_queue, ctune_LogWriter.resume );
+    ctune_LogWriter.attachTrace( fd, &logger.trace_queue ); //the writer owns the descriptor from here on
 
-    pthread_mutex_unlock( &logger.mutex );
+    atomic_store( &logger.trace_open, true );
 
-    closelog(); //syslog
+    end:
+        pthread_mutex_unlock( &logger.mutex );
+        return !( error_state );
 }
 
 /**
- * Sends a message to the log
- * @param lvl      Message log level
- * @param format   String format (similar to `printf`)
- * @param ...      Arguments (similar to `printf`)
+ * Terminate logger and closes output file
  */
-static void ctune_Logger_log( enum ctune_LogLevel lvl, const char * format, ... ) {
-    if( lvl > logger.level )
-        return; //discard
-
-    int      ret = 0;
-    String_t str = String.init();
+static void ctune_Logger_close() {
+    pthread_mutex_lock( &logger.mutex );
 
-    ctune_Logger_getTime( &str );
+    atomic_store( &logger.trace_open, false ); //anything traced from now on goes to the log
 
-    va_list args, args_cp;
-    va_start( args, format );
+    int ret = ctune_LogWriter.stop(); //writes out the queued messages and joins the writer thread
 
-    va_copy( args_cp, args );
-    //reason for copy of args: https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/stdarg.h.html
-    size_t req_size  = vsnprintf( NULL, 0, format, args_cp ) + 1; //OK with C99, not with older versions!
-    size_t buff_size = ( CTUNE_LOGGER_MSG_MAX_SIZE < req_size ? req_size : CTUNE_LOGGER_MSG_MAX_SIZE );
-    va_end( args_cp );
+    logger.init_success = false; //anything logged from now on goes to syslog
 
-    char buffer[buff_size];
+    if( ret != CTUNE_ERR_NONE ) {
+        ctune_err.set( CTUNE_ERR_LOG_FLUSH_TIMEOUT );
 
-    if( ( ret = vsprintf( buffer, format, args ) ) < 0 ) {
         syslog( LOG_ERR,
-                "[ctune_Logger_log( %i, \"%s\", ... )] "
-                "Could not parse into string buffer (ret=%i).",
-                (int) lvl, format, ret
+                "[ctune_Logger_close()] LogWriter.stop() returned an error: (%i) %s (%ld items left in the LogQueue).",
+                ret, ctune_err.print( ret ), ctune_LogQueue.size( &logger.message_queue )
         );
 
-        goto end;
+    } else { //i.e.: the writer thread is gone
+        ctune_LogQueue.freeLogQueue( &logger.message_queue );
     }
 
-    String.append_back( &str, log_level[(int) lvl] );
-    String.append_back( &str, buffer );
+    pthread_mutex_unlock( &logger.mutex );
 
-    if( logger.init_success ) {
-        ctune_LogQueue.enqueue( &logger.message_queue, str._raw );
+    closelog(); //syslog
+}
 
-    } else { //syslog
-        if( lvl < CTUNE_LOG_TRACE ) //lvl>=8 not supported by syslog
-           syslog( lvl, "%s", buffer );
-    }
+/**
+ * Sends a message to the log
+ * @param lvl      Message log level
+ * @param format   String format (similar to `printf`)
+ * @param ...      Arguments (similar to `printf`)
+ */
+static void ctune_Logger_log( enum ctune_LogLevel lvl, const char * format, ... ) {
+    if( lvl > logger.level )
+        return; //discard
 
-    end:
-        va_end( args );
-        String.free( &str );
+    va_list args;
+    va_start( args, format );
+    ctune_Logger_write( lvl, NULL, 0, format, args );
+    va_end( args );
 }
 
 /**
@@ -189,43 +459,7 @@ static void ctune_logger_vlog( enum ctune_LogLevel lvl, const char * format, va_
     if( lvl > logger.level )
         return; //discard
 
-    int      ret = 0;
-    String_t str = String.init();
-
-    ctune_Logger_getTime( &str );
-
-    va_list args_cp;
-
-    va_copy( args_cp, args );
-    size_t req_size  = vsnprintf( NULL, 0, format, args_cp ) + 1; //OK with C99, not with older versions!
-    size_t buff_size = ( CTUNE_LOGGER_MSG_MAX_SIZE < req_size ? req_size : CTUNE_LOGGER_MSG_MAX_SIZE );
-    va_end( args_cp );
-
-    char buffer[buff_size];
-
-    if( ( ret = vsprintf( buffer, format, args ) ) < 0 ) {
-        syslog( LOG_ERR,
-                "[ctune_Logger_vlog( %i, \"%s\", ... )] "
-                "Could not parse into string buffer (ret=%i).",
-                (int) lvl, format, ret
-        );
-
-        goto end;
-    }
-
-    String.append_back( &str, log_level[(int) lvl] );
-    String.append_back( &str, buffer );
-
-    if( logger.init_success ) {
-        ctune_LogQueue.enqueue( &logger.message_queue, str._raw );
-
-    } else { //syslog
-        if( lvl < CTUNE_LOG_TRACE ) //lvl>=8 not supported by syslog
-           syslog( lvl, "%s", buffer );
-    }
-
-    end:
-        String.free( &str );
+    ctune_Logger_write( lvl, NULL, 0, format, args );
 }
 
 /**
@@ -237,71 +471,13 @@ static void ctune_logger_vlog( enum ctune_LogLevel lvl, const char * format, va_
  * @param ...      Arguments (similar to `printf`)
  */
 static void ctune_Logger_logDBG( enum ctune_LogLevel lvl, char * filename, int line_num, const char * format, ... ) {
-    static const char * file_info_format = "(%s:%i) ";
-
     if( lvl > logger.level )
         return; //discard
 
-    int      ret = 0;
-    String_t str = String.init();
-
-    ctune_Logger_getTime( &str );
-
-    String.append_back( &str, log_level[(int) lvl] );
-
-    if( filename != NULL ) {
-        size_t req_size  = snprintf( NULL, 0, file_info_format, filename, line_num ); //OK with C99, not with older versions!
-        size_t buff_size = ( CTUNE_LOGGER_MSG_MAX_SIZE < req_size ? req_size : CTUNE_LOGGER_MSG_MAX_SIZE ) + 1;
-
-        char buffer[buff_size];
-        size_t written = snprintf( buffer, ( buff_size - 1 ), file_info_format, filename, line_num );
-
-        if( written > 0 && written < buff_size ) {
-            String.append_back( &str, buffer );
-
-        } else { //should not happen but just in case...
-            syslog( LOG_ERR,
-                    "[ctune_Logger_logDBG( %i, %s, %i, \"%s\", ... )] "
-                    "Could not parse filename:line_no into string buffer (ret=%zu).",
-                    (int) lvl, filename, line_num, format, written
-            );
-        }
-    }
-
-    va_list args, args_cp;
+    va_list args;
     va_start( args, format );
-
-    va_copy( args_cp, args );
-    //reason for copy of args: https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/stdarg.h.html
-    size_t req_size  = vsnprintf( NULL, 0, format, args_cp ) + 1; //OK with C99, not with older versions!
-    size_t buff_size = ( CTUNE_LOGGER_MSG_MAX_SIZE < req_size ? req_size : CTUNE_LOGGER_MSG_MAX_SIZE );
-    va_end( args_cp );
-
-    char buffer[buff_size];
-
-    if( ( ret = vsprintf( buffer, format, args ) ) < 0 ) {
-        syslog( LOG_ERR,
-                "[ctune_Logger_logDBG( %i, %s, %i, \"%s\", ... )] "
-                "Could not parse into string buffer (ret=%i).",
-                (int) lvl, filename, line_num, format, ret
-        );
-
-        goto end;
-    }
-
-    String.append_back( &str, buffer );
-
-    if( logger.init_success ) {
-        ctune_LogQueue.enqueue( &logger.message_queue, str._raw );
-
-    } else { //syslog
-        if( lvl < CTUNE_LOG_TRACE ) //lvl>=8 not supported by syslog
-            syslog( lvl, "%s", buffer );
-    }
-
-    end:
-        va_end( args );
-        String.free( &str );
+    ctune_Logger_write( lvl, filename, line_num, format, args );
+    va_end( args );
 }
 
 /**
@@ -313,79 +489,75 @@ static void ctune_Logger_logDBG( enum ctune_LogLevel lvl, char * filename, int l
  * @param args     List of arguments (similar to `vprintf`)
  */
 static void ctune_Logger_vlogDBG( enum ctune_LogLevel lvl, char * filename, int line_num, const char * format, va_list args ) {
-    static const char * file_info_format = "(%s:%i) ";
-
     if( lvl > logger.level )
         return; //discard
 
-    int      ret = 0;
-    String_t str = String.init();
-
-    ctune_Logger_getTime( &str );
-
-    String.append_back( &str, log_level[(int) lvl] );
+    ctune_Logger_write( lvl, filename, line_num, format, args );
+}
 
-    if( filename != NULL ) {
-        size_t req_size  = snprintf( NULL, 0, file_info_format, filename, line_num ); //OK with C99, not with older versions!
-        size_t buff_size = ( CTUNE_LOGGER_MSG_MAX_SIZE < req_size ? req_size : CTUNE_LOGGER_MSG_MAX_SIZE ) + 1;
+/**
+ * Sends a TRACE level message to the trace file (use via the `CTUNE_TRACE(..)` macro)
+ * @param id       Pointer to the call site's format id (0 when not yet registered)
+ * @param filename Source file path
+ * @param line_num Line number in source file
+ * @param format   String format (similar to `printf`)
+ * @param ...      Arguments (similar to `printf`)
+ */
+static void ctune_Logger_trace( uint32_t * id, const char * filename, int line_num, const char * format, ... ) {
+    if( CTUNE_LOG_TRACE > logger.level )
+        return; //discard
 
-        char buffer[buff_size];
-        size_t written = snprintf( buffer, ( buff_size - 1 ), file_info_format, filename, line_num );
+    va_list args;
+    va_start( args, format );
 
-        if( written > 0 && written < buff_size ) {
-            String.append_back( &str, buffer );
+    uint32_t trace_id = CTUNE_TRACE_ID_UNSUPPORTED;
 
-        } else { //should not happen but just in case...
-            syslog( LOG_ERR,
-                    "[ctune_Logger_vlogDBG( %i, %s, %i, \"%s\", ... )] "
-                    "Could not parse filename:line_no into string buffer (ret=%zu).",
-                    (int) lvl, filename, line_num, format, written
-            );
-        }
+    if( atomic_load( &logger.trace_open ) ) {
+        if( ( trace_id = __atomic_load_n( id, __ATOMIC_ACQUIRE ) ) == 0 )
+            trace_id = ctune_Logger_registerTrace( id, filename, line_num, format );
     }
 
-    va_list args_cp;
-
-    va_copy( args_cp, args );
-    size_t req_size  = vsnprintf( NULL, 0, format, args_cp ) + 1; //OK with C99, not with older versions!
-    size_t buff_size = ( CTUNE_LOGGER_MSG_MAX_SIZE < req_size ? req_size : CTUNE_LOGGER_MSG_MAX_SIZE );
-    va_end( args_cp );
+    if( trace_id == CTUNE_TRACE_ID_UNSUPPORTED ) { //text fallback
+        const char * name = strrchr( filename, '/' );
+        ctune_Logger_write( CTUNE_LOG_TRACE, ( name ? name + 1 : filename ), line_num, format, args );
+        goto end;
+    }
 
-    char buffer[buff_size];
+    size_t                pos    = 0;
+    ctune_TraceRecord_t * record = ctune_TraceQueue.claim( &logger.trace_queue, false, &pos );
 
-    if( ( ret = vsprintf( buffer, format, args ) ) < 0 ) {
-        syslog( LOG_ERR,
-                "[ctune_Logger_vlogDBG( %i, %s, %i, \"%s\", ... )] "
-                "Could not parse into string buffer (ret=%i).",
-                (int) lvl, filename, line_num, format, ret
-        );
+    if( record == NULL )
+        goto end; //dropped (counted by the queue)
 
-        goto end;
-    }
+    struct timespec ts;
+    clock_gettime( CLOCK_REALTIME, &ts );
 
-    String.append_back( &str, buffer );
+    if( thread_buffer.thread_id == 0 )
+        thread_buffer.thread_id = (pid_t) syscall( SYS_gettid );
 
-    if( logger.init_success ) {
-        ctune_LogQueue.enqueue( &logger.message_queue, str._raw );
+    record->timestamp = ( (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec );
+    record->id        = trace_id;
+    record->thread    = (uint32_t) thread_buffer.thread_id;
 
-    } else { //syslog
-        if( lvl < CTUNE_LOG_TRACE ) //lvl>=8 not supported by syslog
-            syslog( lvl, "%s", buffer );
-    }
+    ctune_Logger_packTrace( record->payload, &trace_formats[ trace_id ], args );
+    ctune_TraceQueue.publish( &logger.trace_queue, pos );
 
     end:
-        String.free( &str );
+        va_end( args );
 }
 
 /**
  * Namespace constructor
  */
 const struct ctune_Logger_Singleton ctune_Logger = {
-    .init     = &ctune_Logger_init,
-    .logLevel = &ctune_Logger_logLevel,
-    .close    = &ctune_Logger_close,
-    .log      = &ctune_Logger_log,
-    .vlog     = &ctune_logger_vlog,
-    .logDBG   = &ctune_Logger_logDBG,
-    .vlogDBG  = &ctune_Logger_vlogDBG,
+    .init            = &ctune_Logger_init,
+    .logLevel        = &ctune_Logger_logLevel,
+    .setFlushLatency = &ctune_Logger_setFlushLatency,
+    .openTrace       = &ctune_Logger_openTrace,
+    .close           = &ctune_Logger_close,
+    .log             = &ctune_Logger_log,
+    .vlog            = &ctune_logger_vlog,
+    .logDBG          = &ctune_Logger_logDBG,
+    .vlogDBG         = &ctune_Logger_vlogDBG,
+    .trace           = &ctune_Logger_trace,
 };
\ No newline at end of file
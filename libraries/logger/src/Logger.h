@@ -2,18 +2,41 @@
 #define CTUNE_UTILS_LOGGER_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <pthread.h>
 
+#ifndef CTUNE_LOG_COMPILE_LEVEL
+    #define CTUNE_LOG_COMPILE_LEVEL 8 //highest log level compiled in (see the `CTUNE_LOG_COMPILE_LEVEL` cmake option)
+#endif
+
+/**
+ * Checks that a log level is compiled in and enabled at runtime
+ * - levels above `CTUNE_LOG_COMPILE_LEVEL` fold to `false` so the log call, arguments included, is compiled out
+ */
+#define CTUNE_LOG_ENABLED( lvl ) ( (lvl) <= CTUNE_LOG_COMPILE_LEVEL && (lvl) <= ctune_Logger.logLevel() )
+
 #ifdef DEBUG
     #include <libgen.h>
-    #define CTUNE_LOG( lvl, fmt, args... ) ctune_Logger.logDBG( lvl, basename(__FILE__), __LINE__, fmt, ##args );
-    #define CTUNE_VLOG( lvl, fmt, args ) ctune_Logger.logDBG( lvl, basename(__FILE__), __LINE__, fmt, args );
+    #define CTUNE_LOG( lvl, fmt, args... ) ( CTUNE_LOG_ENABLED( lvl ) ? ctune_Logger.logDBG( lvl, basename(__FILE__), __LINE__, fmt, ##args ) : (void) 0 );
+    #define CTUNE_VLOG( lvl, fmt, args ) ( CTUNE_LOG_ENABLED( lvl ) ? ctune_Logger.vlogDBG( lvl, basename(__FILE__), __LINE__, fmt, args ) : (void) 0 );
 #else
-    #define CTUNE_LOG( lvl, fmt, args... ) ctune_Logger.log( lvl, fmt, ##args );
-    #define CTUNE_VLOG( lvl, fmt, args ) ctune_Logger.log( lvl, fmt, args );
+    #define CTUNE_LOG( lvl, fmt, args... ) ( CTUNE_LOG_ENABLED( lvl ) ? ctune_Logger.log( lvl, fmt, ##args ) : (void) 0 );
+    #define CTUNE_VLOG( lvl, fmt, args ) ( CTUNE_LOG_ENABLED( lvl ) ? ctune_Logger.vlog( lvl, fmt, args ) : (void) 0 );
 #endif
 
+/**
+ * Sends a TRACE level message as a fixed-size binary record (format id + raw arguments) when a trace file is open
+ * - falls back to a regular log message when it is not, or when the format cannot be recorded (see `ctune_TraceFormat.parse(..)`)
+ * - the format string must be a literal: it is registered once per call site and decoded offline with `ctune-tracedump`
+ */
+#define CTUNE_TRACE( fmt, args... )                                                               \
+    do {                                                                                          \
+        static uint32_t ctune_trace_id = 0;                                                       \
+        if( CTUNE_LOG_ENABLED( CTUNE_LOG_TRACE ) )                                                \
+            ctune_Logger.trace( &ctune_trace_id, __FILE__, __LINE__, fmt, ##args );               \
+    } while( 0 )
+
 enum ctune_LogLevel {
     CTUNE_LOG_FATAL   = 1, //RFC.5424 Syslog
     CTUNE_LOG_ERROR   = 3, //RFC.5424 Syslog
@@ -41,6 +64,20 @@ extern const struct ctune_Logger_Singleton {
      */
     ctune_LogLevel_e (* logLevel)( void );
 
+    /**
+     * Sets the maximum time a message can wait in the output buffer before being written to the log file
+     * - ERROR/FATAL messages and shutdown always trigger a write
+     * @param latency_ms Latency bound in milliseconds (0: write out every batch)
+     */
+    void (* setFlushLatency)( unsigned latency_ms );
+
+    /**
+     * Opens a binary trace file that `CTUNE_TRACE(..)` records go to from then on (call after `init(..)`)
+     * @param trace_filepath Trace file path (truncated)
+     * @return Success
+     */
+    bool (* openTrace)( const char * trace_filepath );
+
     /**
      * Terminate logger and closes output file
      */
@@ -82,6 +119,16 @@ extern const struct ctune_Logger_Singleton {
      */
     void (* vlogDBG)( enum ctune_LogLevel lvl, char * filename, int line_number, const char * format, va_list args );
 
+    /**
+     * Sends a TRACE level message to the trace file (use via the `CTUNE_TRACE(..)` macro)
+     * @param id       Pointer to the call site's format id (0 when not yet registered)
+     * @param filename Source file path
+     * @param line_num Line number in source file
+     * @param format   String format (similar to `printf`)
+     * @param ...      Arguments (similar to `printf`)
+     */
+    void (* trace)( uint32_t * id, const char * filename, int line_num, const char * format, ... );
+
 } ctune_Logger;
 
 #endif //CTUNE_UTILS_LOGGER_H
\ No newline at end of file
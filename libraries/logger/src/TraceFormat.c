@@ -0,0 +1,115 @@
+#include "TraceFormat.h"
+
+#include <string.h>
+
+/**
+ * Gets the next conversion in a format string
+ * @param format Format string position to start looking from
+ * @param begin  Pointer to set to the start of the conversion ('%')
+ * @param end    Pointer to set to one past the end of the conversion
+ * @param type   Pointer to set to the argument type of the conversion
+ * @return Success (false when there are no more conversions or the conversion is not supported)
+ */
+static bool ctune_TraceFormat_next( const char * format, const char ** begin, const char ** end, ctune_TraceArg_e * type ) {
+    const char * p = format;
+
+    for(;;) {
+        if( ( p = strchr( p, '%' ) ) == NULL ) {
+            *begin = NULL;
+            return false; //EARLY RETURN - no more conversions
+        }
+
+        if( p[1] == '%' ) {
+            p += 2;
+            continue;
+        }
+
+        break;
+    }
+
+    *begin = p++;
+
+    p += strspn( p, "-+ #0" );       //flags
+    p += strspn( p, "0123456789" );  //width
+
+    if( *p == '.' ) {                //precision
+        ++p;
+        p += strspn( p, "0123456789" );
+    }
+
+    if( *p == '*' || *p == '$' )
+        return false; //EARLY RETURN - variable width/precision or positional args
+
+    ctune_TraceArg_e length = CTUNE_TRACEARG_INT;
+
+    switch( *p ) {
+        case 'h': p += ( p[1] == 'h' ? 2 : 1 );                                                  break;
+        case 'l': length = ( p[1] == 'l' ? CTUNE_TRACEARG_LLONG : CTUNE_TRACEARG_LONG );
+                  p     += ( p[1] == 'l' ? 2 : 1 );                                              break;
+        case 'z': length = CTUNE_TRACEARG_SIZE;    ++p;                                          break;
+        case 'j': length = CTUNE_TRACEARG_INTMAX;  ++p;                                          break;
+        case 't': length = CTUNE_TRACEARG_PTRDIFF; ++p;                                          break;
+        case 'L': return false; //EARLY RETURN - long double
+        default : break;
+    }
+
+    switch( *p ) {
+        case 'd': //fallthrough
+        case 'i': //fallthrough
+        case 'u': //fallthrough
+        case 'o': //fallthrough
+        case 'x': //fallthrough
+        case 'X': *type = length; break;
+
+        case 'c': //fallthrough
+        case 's': if( length == CTUNE_TRACEARG_LONG )
+                      return false; //EARLY RETURN - wide char/string
+                  *type = ( *p == 'c' ? CTUNE_TRACEARG_INT : CTUNE_TRACEARG_STR );
+                  break;
+
+        case 'f': //fallthrough
+        case 'F': //fallthrough
+        case 'e': //fallthrough
+        case 'E': //fallthrough
+        case 'g': //fallthrough
+        case 'G': //fallthrough
+        case 'a': //fallthrough
+        case 'A': *type = CTUNE_TRACEARG_DOUBLE; break;
+
+        case 'p': *type = CTUNE_TRACEARG_PTR; break;
+
+        default : return false; //EARLY RETURN - 'n' or malformed
+    }
+
+    *end = ( p + 1 );
+    return true;
+}
+
+/**
+ * Parses the conversions of a printf-style format string
+ * @param format Format string
+ * @param types  Array to fill with the argument types in order (`CTUNE_TRACE_MAX_ARGS` long)
+ * @param count  Pointer to set to the number of arguments
+ * @return Success (false if the format uses conversions that cannot be recorded: '*', 'n', 'L', wide chars, positional args)
+ */
+static bool ctune_TraceFormat_parse( const char * format, ctune_TraceArg_e * types, size_t * count ) {
+    const char * begin = NULL;
+    const char * end   = format;
+
+    *count = 0;
+
+    while( ctune_TraceFormat_next( end, &begin, &end, &types[ *count ] ) ) {
+        if( ++(*count) >= CTUNE_TRACE_MAX_ARGS )
+            return false; //EARLY RETURN
+    }
+
+    return ( begin == NULL ); //i.e.: stopped at the end of the string and not on an unsupported conversion
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_TraceFormat_Namespace ctune_TraceFormat = {
+    .parse = &ctune_TraceFormat_parse,
+    .next  = &ctune_TraceFormat_next,
+};
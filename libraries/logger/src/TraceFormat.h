@@ -0,0 +1,86 @@
+#ifndef CTUNE_LOGGER_TRACEFORMAT_H
+#define CTUNE_LOGGER_TRACEFORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define CTUNE_TRACE_MAGIC           "CTUNETRC" //trace file signature (8 bytes)
+#define CTUNE_TRACE_VERSION         1
+#define CTUNE_TRACE_PAYLOAD_SIZE    48         //in bytes
+#define CTUNE_TRACE_MAX_ARGS        16         //max number of conversions in a format string
+#define CTUNE_TRACE_MAX_FORMATS     1024       //max number of distinct trace formats (ids 1..max-1)
+#define CTUNE_TRACE_ID_DROPPED      0          //record reporting dropped records (payload: uint64_t count)
+#define CTUNE_TRACE_ID_DEFINITION   0x80000000 //bit set on records carrying a chunk of a format definition
+#define CTUNE_TRACE_ID_UNSUPPORTED  UINT32_MAX //id given to formats that cannot be recorded in binary
+
+/**
+ * Trace file header
+ * @param magic       File signature (`CTUNE_TRACE_MAGIC`)
+ * @param version     Format version
+ * @param record_size Size of a record in bytes
+ */
+typedef struct ctune_TraceHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+
+} ctune_TraceHeader_t;
+
+/**
+ * Fixed-size trace record
+ * - regular record: `payload` holds the arguments packed in order (numbers as 8 bytes, strings '\0' terminated and truncated to fit)
+ * - definition record (`CTUNE_TRACE_ID_DEFINITION` bit set): `thread` is the offset of the `payload` chunk in the
+ *   definition string "file:line\0format\0"
+ * @param timestamp Time (UTC) in nanoseconds since the epoch
+ * @param id        Format id
+ * @param thread    Kernel thread id of the caller
+ * @param payload   Packed arguments
+ */
+typedef struct ctune_TraceRecord {
+    uint64_t timestamp;
+    uint32_t id;
+    uint32_t thread;
+    uint8_t  payload[CTUNE_TRACE_PAYLOAD_SIZE];
+
+} ctune_TraceRecord_t;
+
+/**
+ * Argument types of printf-style conversions
+ */
+typedef enum ctune_TraceArg {
+    CTUNE_TRACEARG_INT = 0, //'d', 'i', 'u', 'o', 'x', 'X', 'c' (and 'h'/'hh' variants)
+    CTUNE_TRACEARG_LONG,    //'l' modifier
+    CTUNE_TRACEARG_LLONG,   //'ll' modifier
+    CTUNE_TRACEARG_SIZE,    //'z' modifier
+    CTUNE_TRACEARG_INTMAX,  //'j' modifier
+    CTUNE_TRACEARG_PTRDIFF, //'t' modifier
+    CTUNE_TRACEARG_DOUBLE,  //'f', 'F', 'e', 'E', 'g', 'G', 'a', 'A'
+    CTUNE_TRACEARG_PTR,     //'p'
+    CTUNE_TRACEARG_STR,     //'s'
+
+} ctune_TraceArg_e;
+
+extern const struct ctune_TraceFormat_Namespace {
+    /**
+     * Parses the conversions of a printf-style format string
+     * @param format Format string
+     * @param types  Array to fill with the argument types in order (`CTUNE_TRACE_MAX_ARGS` long)
+     * @param count  Pointer to set to the number of arguments
+     * @return Success (false if the format uses conversions that cannot be recorded: '*', 'n', 'L', wide chars, positional args)
+     */
+    bool (* parse)( const char * format, ctune_TraceArg_e * types, size_t * count );
+
+    /**
+     * Gets the next conversion in a format string
+     * @param format Format string position to start looking from
+     * @param begin  Pointer to set to the start of the conversion ('%')
+     * @param end    Pointer to set to one past the end of the conversion
+     * @param type   Pointer to set to the argument type of the conversion
+     * @return Success (false when there are no more conversions or the conversion is not supported)
+     */
+    bool (* next)( const char * format, const char ** begin, const char ** end, ctune_TraceArg_e * type );
+
+} ctune_TraceFormat;
+
+#endif //CTUNE_LOGGER_TRACEFORMAT_H
@@ -0,0 +1,174 @@
+#include "TraceQueue.h"
+
+#include <stdint.h>
+#include <time.h>
+
+#include "LogQueue.h"
+
+/**
+ * Initialises a TraceQueue over a ring of slots
+ * @param queue    TraceQueue instance
+ * @param slots    Storage for the ring (lives as long as the queue)
+ * @param capacity Number of slots (power of 2)
+ * @return Success
+ */
+static bool ctune_TraceQueue_init( TraceQueue_t * queue, TraceQueueSlot_t * slots, size_t capacity ) {
+    if( queue == NULL || slots == NULL || capacity < 2 || ( capacity & ( capacity - 1 ) ) != 0 )
+        return false; //EARLY RETURN
+
+    for( size_t i = 0; i < capacity; ++i ) {
+        atomic_init( &slots[i].sequence, i );
+    }
+
+    queue->_slots = slots;
+    queue->_mask  = ( capacity - 1 );
+    atomic_init( &queue->_head, 0 );
+    atomic_init( &queue->_tail, 0 );
+    atomic_init( &queue->_dropped, 0 );
+
+    return true;
+}
+
+/**
+ * [THREAD SAFE/LOCK-FREE] Claims the next free slot of the queue
+ * @param queue TraceQueue instance
+ * @param wait  Flag to wait on the consumer when the ring is full instead of dropping the record
+ * @param pos   Pointer to set to the claimed position
+ * @return Record to fill in or NULL when the ring is full and the record was dropped
+ */
+static ctune_TraceRecord_t * ctune_TraceQueue_claim( TraceQueue_t * queue, bool wait, size_t * pos ) {
+    if( queue == NULL || queue->_slots == NULL )
+        return NULL; //EARLY RETURN
+
+    TraceQueueSlot_t * slot    = NULL;
+    size_t             retries = 0;
+    size_t             curr    = atomic_load_explicit( &queue->_head, memory_order_relaxed );
+
+    for(;;) {
+        slot = &queue->_slots[ curr & queue->_mask ];
+
+        size_t   seq  = atomic_load_explicit( &slot->sequence, memory_order_acquire );
+        intptr_t diff = (intptr_t) seq - (intptr_t) curr;
+
+        if( diff == 0 ) { //slot is free at this position
+            if( atomic_compare_exchange_weak( &queue->_head, &curr, ( curr + 1 ) ) )
+                break;
+
+        } else if( diff < 0 ) { //full: only records that must not be lost (i.e.: format definitions) wait on the consumer
+            if( !wait || retries++ >= CTUNE_LOGQUEUE_FULL_RETRY ) {
+                atomic_fetch_add_explicit( &queue->_dropped, 1, memory_order_relaxed );
+                return NULL; //EARLY RETURN
+            }
+
+            if( queue->queued_items_signal_cb )
+                queue->queued_items_signal_cb();
+
+            nanosleep( &(struct timespec){ .tv_sec = 0, .tv_nsec = CTUNE_LOGQUEUE_FULL_NAP }, NULL );
+            curr = atomic_load_explicit( &queue->_head, memory_order_relaxed );
+
+        } else { //another producer got there first
+            curr = atomic_load_explicit( &queue->_head, memory_order_relaxed );
+        }
+    }
+
+    *pos = curr;
+    return &slot->record;
+}
+
+/**
+ * [THREAD SAFE/LOCK-FREE] Hands a claimed record over to the consumer
+ * @param queue TraceQueue instance
+ * @param pos   Claimed position
+ */
+static void ctune_TraceQueue_publish( TraceQueue_t * queue, size_t pos ) {
+    atomic_store_explicit( &queue->_slots[ pos & queue->_mask ].sequence, ( pos + 1 ), memory_order_release );
+
+    if( queue->queued_items_signal_cb )
+        queue->queued_items_signal_cb();
+}
+
+/**
+ * [CONSUMER ONLY] Gets the record at the front of the queue without removing it
+ * @param queue TraceQueue instance
+ * @return Pointer to the record or NULL if there are none ready
+ */
+static const ctune_TraceRecord_t * ctune_TraceQueue_front( TraceQueue_t * queue ) {
+    if( queue == NULL || queue->_slots == NULL )
+        return NULL; //EARLY RETURN
+
+    const size_t       pos  = atomic_load_explicit( &queue->_tail, memory_order_relaxed );
+    TraceQueueSlot_t * slot = &queue->_slots[ pos & queue->_mask ];
+
+    if( atomic_load_explicit( &slot->sequence, memory_order_acquire ) != ( pos + 1 ) )
+        return NULL; //EARLY RETURN - not published yet
+
+    return &slot->record;
+}
+
+/**
+ * [CONSUMER ONLY] Releases the slot at the front of the queue
+ * @param queue TraceQueue instance
+ */
+static void ctune_TraceQueue_pop( TraceQueue_t * queue ) {
+    if( ctune_TraceQueue_front( queue ) == NULL )
+        return; //EARLY RETURN - nothing to pop
+
+    const size_t pos = atomic_load_explicit( &queue->_tail, memory_order_relaxed );
+
+    atomic_store( &queue->_tail, ( pos + 1 ) );
+    atomic_store_explicit( &queue->_slots[ pos & queue->_mask ].sequence, ( pos + queue->_mask + 1 ), memory_order_release );
+}
+
+/**
+ * [THREAD SAFE] Gets the empty state of the TraceQueue
+ * @param queue TraceQueue instance
+ * @return Empty state
+ */
+static bool ctune_TraceQueue_empty( TraceQueue_t * queue ) {
+    return ( atomic_load( &queue->_head ) == atomic_load( &queue->_tail ) );
+}
+
+/**
+ * [THREAD SAFE] Checks if the consumer should get to the queued records without delay
+ * @param queue TraceQueue instance
+ * @return Flush request state (the ring is at least half full)
+ */
+static bool ctune_TraceQueue_flushRequested( TraceQueue_t * queue ) {
+    const size_t tail = atomic_load( &queue->_tail );
+    const size_t head = atomic_load( &queue->_head );
+
+    return ( ( head - tail ) > ( queue->_mask / 2 ) );
+}
+
+/**
+ * [THREAD SAFE] Gets and resets the number of records dropped because the queue was full
+ * @param queue TraceQueue instance
+ * @return Number of records dropped since the last call
+ */
+static size_t ctune_TraceQueue_dropped( TraceQueue_t * queue ) {
+    return atomic_exchange( &queue->_dropped, 0 );
+}
+
+/**
+ * Sets a callback to signal items are in the queue
+ * @param queue TraceQueue instance
+ * @param cb    Callback method to use
+ */
+static void ctune_TraceQueue_setSendReadySignalCallback( TraceQueue_t * queue, void(* cb)( void ) ) {
+    queue->queued_items_signal_cb = cb;
+}
+
+/**
+ * Namespace constructor
+ */
+const struct TraceQueueClass ctune_TraceQueue = {
+    .init                       = &ctune_TraceQueue_init,
+    .claim                      = &ctune_TraceQueue_claim,
+    .publish                    = &ctune_TraceQueue_publish,
+    .front                      = &ctune_TraceQueue_front,
+    .pop                        = &ctune_TraceQueue_pop,
+    .empty                      = &ctune_TraceQueue_empty,
+    .flushRequested             = &ctune_TraceQueue_flushRequested,
+    .dropped                    = &ctune_TraceQueue_dropped,
+    .setSendReadySignalCallback = &ctune_TraceQueue_setSendReadySignalCallback,
+};
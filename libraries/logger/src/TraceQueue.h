@@ -0,0 +1,113 @@
+#ifndef CTUNE_LOGGER_TRACEQUEUE_H
+#define CTUNE_LOGGER_TRACEQUEUE_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "TraceFormat.h"
+
+#define CTUNE_TRACEQUEUE_CAPACITY 4096 //number of records in the ring (must be a power of 2)
+
+/**
+ * Ring slot
+ * @param sequence Sequence number used to hand the slot between the producers and the consumer
+ * @param record   Trace record
+ */
+typedef struct ctune_TraceQueueSlot {
+    atomic_size_t       sequence;
+    ctune_TraceRecord_t record;
+
+} TraceQueueSlot_t;
+
+/**
+ * Bounded lock-free multi-producer/single-consumer queue of fixed-size trace records
+ * @param _slots   Ring of slots
+ * @param _mask    Index mask (slot count - 1)
+ * @param _head    Next position to be claimed by a producer
+ * @param _tail    Next position to be read by the consumer
+ * @param _dropped Number of records discarded since last checked because the ring was full
+ * @param queued_items_signal_cb Callback called after each enqueue operation
+ */
+struct ctune_TraceQueue {
+    TraceQueueSlot_t * _slots;
+    size_t             _mask;
+    atomic_size_t      _head;
+    atomic_size_t      _tail;
+    atomic_size_t      _dropped;
+
+    void(* queued_items_signal_cb)( void );
+};
+
+typedef struct ctune_TraceQueue TraceQueue_t;
+
+extern const struct TraceQueueClass {
+    /**
+     * Initialises a TraceQueue over a ring of slots
+     * @param queue    TraceQueue instance
+     * @param slots    Storage for the ring (lives as long as the queue)
+     * @param capacity Number of slots (power of 2)
+     * @return Success
+     */
+    bool (* init)( TraceQueue_t * queue, TraceQueueSlot_t * slots, size_t capacity );
+
+    /**
+     * [THREAD SAFE/LOCK-FREE] Claims the next free slot of the queue
+     * - the record must be filled in and then handed over with `publish(..)`
+     * @param queue TraceQueue instance
+     * @param wait  Flag to wait on the consumer when the ring is full instead of dropping the record
+     * @param pos   Pointer to set to the claimed position
+     * @return Record to fill in or NULL when the ring is full and the record was dropped
+     */
+    ctune_TraceRecord_t * (* claim)( TraceQueue_t * queue, bool wait, size_t * pos );
+
+    /**
+     * [THREAD SAFE/LOCK-FREE] Hands a claimed record over to the consumer
+     * @param queue TraceQueue instance
+     * @param pos   Claimed position
+     */
+    void (* publish)( TraceQueue_t * queue, size_t pos );
+
+    /**
+     * [CONSUMER ONLY] Gets the record at the front of the queue without removing it
+     * @param queue TraceQueue instance
+     * @return Pointer to the record or NULL if there are none ready
+     */
+    const ctune_TraceRecord_t * (* front)( TraceQueue_t * queue );
+
+    /**
+     * [CONSUMER ONLY] Releases the slot at the front of the queue
+     * @param queue TraceQueue instance
+     */
+    void (* pop)( TraceQueue_t * queue );
+
+    /**
+     * [THREAD SAFE] Gets the empty state of the TraceQueue
+     * @param queue TraceQueue instance
+     * @return Empty state
+     */
+    bool (* empty)( TraceQueue_t * queue );
+
+    /**
+     * [THREAD SAFE] Checks if the consumer should get to the queued records without delay
+     * @param queue TraceQueue instance
+     * @return Flush request state (the ring is at least half full)
+     */
+    bool (* flushRequested)( TraceQueue_t * queue );
+
+    /**
+     * [THREAD SAFE] Gets and resets the number of records dropped because the queue was full
+     * @param queue TraceQueue instance
+     * @return Number of records dropped since the last call
+     */
+    size_t (* dropped)( TraceQueue_t * queue );
+
+    /**
+     * Sets a callback to signal items are in the queue
+     * @param queue TraceQueue instance
+     * @param cb    Callback method to use
+     */
+    void (* setSendReadySignalCallback)( TraceQueue_t * queue, void(* cb)( void ) );
+
+} ctune_TraceQueue;
+
+#endif //CTUNE_LOGGER_TRACEQUEUE_H
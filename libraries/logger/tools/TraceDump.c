@@ -0,0 +1,227 @@
+/**
+ * ctune-tracedump: decodes a binary trace file written by the cTune logger (see `CTUNE_TRACE(..)`)
+ * into log-style text lines on stdout
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "../src/TraceFormat.h"
+
+/**
+ * Trace format definition as collected from the definition records
+ * @param data     Definition string ("file:line\0format\0")
+ * @param length   Length of the data collected so far
+ * @param location Pointer to the "file:line" part of `data` (NULL until the definition is complete)
+ * @param format   Pointer to the format part of `data` (NULL until the definition is complete)
+ */
+struct TraceDump_Definition {
+    char       * data;
+    size_t       length;
+    const char * location;
+    const char * format;
+};
+
+static struct TraceDump_Definition definitions[CTUNE_TRACE_MAX_FORMATS];
+
+/**
+ * [PRIVATE] Prints a timestamp as "YYYY-MM-DD HH:MM:SS.nnnnnnnnn " (UTC)
+ * @param timestamp Time in nanoseconds since the epoch
+ */
+static void TraceDump_printTime( uint64_t timestamp ) {
+    const time_t sec = (time_t) ( timestamp / 1000000000 );
+    struct tm    date_time;
+    char         buffer[32];
+
+    gmtime_r( &sec, &date_time );
+    strftime( buffer, sizeof( buffer ), "%F %T", &date_time );
+    printf( "%s.%09lu ", buffer, (unsigned long) ( timestamp % 1000000000 ) );
+}
+
+/**
+ * [PRIVATE] Prints a literal part of a format string ("%%" escapes are unescaped)
+ * @param begin Start of the literal
+ * @param end   End of the literal
+ */
+static void TraceDump_printLiteral( const char * begin, const char * end ) {
+    for( const char * p = begin; p < end; ++p ) {
+        if( *p == '%' && ( p + 1 ) < end && p[1] == '%' )
+            ++p;
+
+        putchar( *p );
+    }
+}
+
+/**
+ * [PRIVATE] Prints a record's message by formatting each of its packed arguments with its conversion
+ * @param format  Format string
+ * @param payload Record payload
+ */
+static void TraceDump_printMessage( const char * format, const uint8_t * payload ) {
+    const char     * pos    = format;
+    const char     * begin  = NULL;
+    const char     * end    = NULL;
+    size_t           offset = 0;
+    ctune_TraceArg_e type   = CTUNE_TRACEARG_INT;
+
+    while( ctune_TraceFormat.next( pos, &begin, &end, &type ) ) {
+        char    spec[64] = { 0 };
+        int64_t value    = 0;
+
+        TraceDump_printLiteral( pos, begin );
+        pos = end;
+
+        if( (size_t) ( end - begin ) >= sizeof( spec ) ) {
+            printf( "<?>" );
+            continue;
+        }
+
+        memcpy( spec, begin, (size_t) ( end - begin ) );
+
+        if( type == CTUNE_TRACEARG_STR ) {
+            if( offset >= CTUNE_TRACE_PAYLOAD_SIZE ) {
+                printf( "<?>" );
+                continue;
+            }
+
+            const char * str    = (const char *) &payload[ offset ];
+            const size_t length = strnlen( str, ( CTUNE_TRACE_PAYLOAD_SIZE - offset - 1 ) );
+            char         copy[CTUNE_TRACE_PAYLOAD_SIZE];
+
+            memcpy( copy, str, length );
+            copy[ length ] = '\0';
+            offset += ( length + 1 );
+
+            printf( spec, copy );
+            continue;
+        }
+
+        if( ( offset + sizeof( value ) ) > CTUNE_TRACE_PAYLOAD_SIZE ) { //did not fit in the record
+            printf( "<?>" );
+            continue;
+        }
+
+        memcpy( &value, &payload[ offset ], sizeof( value ) );
+        offset += sizeof( value );
+
+        switch( type ) {
+            case CTUNE_TRACEARG_INT    : printf( spec, (int) value );                break;
+            case CTUNE_TRACEARG_LONG   : printf( spec, (long) value );               break;
+            case CTUNE_TRACEARG_LLONG  : printf( spec, (long long) value );          break;
+            case CTUNE_TRACEARG_SIZE   : printf( spec, (size_t) value );             break;
+            case CTUNE_TRACEARG_INTMAX : printf( spec, (intmax_t) value );           break;
+            case CTUNE_TRACEARG_PTRDIFF: printf( spec, (ptrdiff_t) value );          break;
+            case CTUNE_TRACEARG_PTR    : printf( spec, (void *) (uintptr_t) value ); break;
+
+            case CTUNE_TRACEARG_DOUBLE: {
+                double d = 0;
+                memcpy( &d, &value, sizeof( d ) );
+                printf( spec, d );
+            } break;
+
+            default: break;
+        }
+    }
+
+    TraceDump_printLiteral( pos, ( pos + strlen( pos ) ) );
+    putchar( '\n' );
+}
+
+/**
+ * [PRIVATE] Adds a chunk of a format definition
+ * @param record Definition record
+ */
+static void TraceDump_addDefinition( const ctune_TraceRecord_t * record ) {
+    const uint32_t                id  = ( record->id & ~CTUNE_TRACE_ID_DEFINITION );
+    struct TraceDump_Definition * def = NULL;
+
+    if( id == 0 || id >= CTUNE_TRACE_MAX_FORMATS )
+        return; //EARLY RETURN
+
+    def = &definitions[ id ];
+
+    if( record->thread != def->length ) //out of sequence (i.e.: an earlier chunk was lost)
+        return; //EARLY RETURN
+
+    char * data = realloc( def->data, ( def->length + CTUNE_TRACE_PAYLOAD_SIZE + 1 ) );
+
+    if( data == NULL )
+        return; //EARLY RETURN
+
+    def->data = data;
+    memcpy( &def->data[ def->length ], record->payload, CTUNE_TRACE_PAYLOAD_SIZE );
+    def->length += CTUNE_TRACE_PAYLOAD_SIZE;
+    def->data[ def->length ] = '\0';
+
+    const size_t location_length = strlen( def->data );
+
+    if( location_length + 1 < def->length && memchr( &def->data[ location_length + 1 ], '\0', ( def->length - location_length - 1 ) ) ) {
+        def->location = def->data;
+        def->format   = &def->data[ location_length + 1 ];
+    }
+}
+
+/**
+ * Program entry point
+ * @param argc Number of arguments
+ * @param argv Pointer to arguments array
+ * @return Exit state
+ */
+int main( int argc, char * argv[] ) {
+    int                 ret    = EXIT_SUCCESS;
+    FILE              * file   = NULL;
+    ctune_TraceHeader_t header;
+    ctune_TraceRecord_t record;
+
+    if( argc != 2 ) {
+        fprintf( stderr, "Usage: %s FILE\nDecodes a cTune binary trace file (ctune.trace) to stdout.\n", argv[0] );
+        return EXIT_FAILURE; //EARLY RETURN
+    }
+
+    if( ( file = fopen( argv[1], "rb" ) ) == NULL ) {
+        perror( argv[1] );
+        return EXIT_FAILURE; //EARLY RETURN
+    }
+
+    if( fread( &header, sizeof( header ), 1, file ) != 1
+        || memcmp( header.magic, CTUNE_TRACE_MAGIC, sizeof( header.magic ) ) != 0
+        || header.version     != CTUNE_TRACE_VERSION
+        || header.record_size != sizeof( ctune_TraceRecord_t ) )
+    {
+        fprintf( stderr, "%s: not a cTune trace file (or unsupported version).\n", argv[1] );
+        ret = EXIT_FAILURE;
+        goto end;
+    }
+
+    while( fread( &record, sizeof( record ), 1, file ) == 1 ) {
+        if( record.id & CTUNE_TRACE_ID_DEFINITION ) {
+            TraceDump_addDefinition( &record );
+
+        } else if( record.id == CTUNE_TRACE_ID_DROPPED ) {
+            uint64_t count = 0;
+            memcpy( &count, record.payload, sizeof( count ) );
+            TraceDump_printTime( record.timestamp );
+            printf( "|--TRACE--| %lu trace record(s) dropped: queue full.\n", (unsigned long) count );
+
+        } else if( record.id >= CTUNE_TRACE_MAX_FORMATS || definitions[ record.id ].format == NULL ) {
+            TraceDump_printTime( record.timestamp );
+            printf( "|--TRACE--| [%u] <unknown trace format id %u>\n", record.thread, record.id );
+
+        } else {
+            TraceDump_printTime( record.timestamp );
+            printf( "|--TRACE--| [%u] (%s) ", record.thread, definitions[ record.id ].location );
+            TraceDump_printMessage( definitions[ record.id ].format, record.payload );
+        }
+    }
+
+    end:
+        for( size_t i = 0; i < CTUNE_TRACE_MAX_FORMATS; ++i ) {
+            free( definitions[ i ].data );
+        }
+
+        fclose( file );
+        return ret;
+}
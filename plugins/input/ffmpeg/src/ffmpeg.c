@@ -125,6 +125,19 @@ static void ctune_Player_timeoutCallback( int err ) {
     ctune_err.set( err );
 }
 
+/**
+ * [PRIVATE] Interrupt callback for the blocking calls of the playback (polled by libav while waiting on the network)
+ * @param timer Pointer to the playback's Timeout instance
+ * @return Interrupt state (1: abort, 0: carry on)
+ */
+static int ctune_Player_interruptCallback( void * timer ) {
+    if( !ffmpeg_player.cb.playback_ctrl_callback( CTUNE_PLAYBACK_CTRL_STATE_REQ ) ) {
+        return 1; //EARLY RETURN - playback was stopped
+    }
+
+    return ctune_Timeout.timedOut( timer );
+}
+
 /**
  * [PRIVATE] (Step 1) Setup the stream input context
  * @param in_format_ctx  Pointer to the `AVFormatContext` to use for the input stream
@@ -413,7 +426,7 @@ static bool ctune_Player_playRadioStream( const char * url, const int volume, in
     AVPacket          * packet               = NULL;
     AVFrame           * frame                = NULL;
     ctune_Timeout_t     timeout_timer        = ctune_Timeout.init( timeout_val, CTUNE_ERR_STREAM_OPEN_TIMEOUT, ctune_Player_timeoutCallback );
-    AVIOInterruptCB     interrupt_callback   = { .callback = ctune_Timeout.timedOut, &timeout_timer };
+    AVIOInterruptCB     interrupt_callback   = { .callback = ctune_Player_interruptCallback, &timeout_timer };
 
     if( ffmpeg_player.audio_out == NULL ) {
         CTUNE_LOG( CTUNE_LOG_FATAL,
@@ -427,10 +440,14 @@ static bool ctune_Player_playRadioStream( const char * url, const int volume, in
     }
 
     //---(1) setup input---
-    in_format_ctx->interrupt_callback = interrupt_callback; //interrupt callback for when connection fails on `avformat_open_input` (e.g. tcp timeout)
+    in_format_ctx->interrupt_callback = interrupt_callback; //interrupt callback for when connection fails on `avformat_open_input` (e.g. tcp timeout) or on a stop request
     ctune_Timeout.reset( &timeout_timer );
 
     if( ( ret = ctune_Player_setupStreamInput( in_format_ctx, &in_codec, &audio_stream_index, radio_stream_url ) ) != 0 ) {
+        if( !timeout_timer.timed_out && !ffmpeg_player.cb.playback_ctrl_callback( CTUNE_PLAYBACK_CTRL_STATE_REQ ) ) {
+            goto end; //stopped while connecting
+        }
+
         error_state = true;
         ffmpeg_player.error = abs( ret );
         goto end;
@@ -504,6 +521,10 @@ static bool ctune_Player_playRadioStream( const char * url, const int volume, in
             in_format_ctx->event_flags = 0;
         }
 
+        CTUNE_TRACE( "[ctune_Player_playRadioStream(..)] Packet: stream=%d, size=%d, pts=%lld",
+                     packet->stream_index, packet->size, (long long) packet->pts
+        );
+
         //decode compressed frame packet into raw uncompressed frame
         if( ( ret = avcodec_send_packet( in_codec_ctx, packet ) ) < 0 ) {
             CTUNE_LOG( CTUNE_LOG_ERROR,
@@ -547,6 +568,10 @@ static bool ctune_Player_playRadioStream( const char * url, const int volume, in
                 goto end;
             }
 
+            CTUNE_TRACE( "[ctune_Player_playRadioStream(..)] Frame: samples=%d, resampled=%d, bytes=%d",
+                         frame->nb_samples, sample_count, data_size
+            );
+
             ffmpeg_player.audio_out->write( out_buffer, data_size );
 
             if( ffmpeg_player.record_plugin ) {
@@ -558,6 +583,10 @@ static bool ctune_Player_playRadioStream( const char * url, const int volume, in
         ctune_Timeout.reset( &timeout_timer );
     }
 
+    if( ret == AVERROR_EXIT && !timeout_timer.timed_out ) {
+        ret = 0; //interrupted by a stop request
+    }
+
     if( ret < 0 && ret != AVERROR(EAGAIN) ) {
         if( ret == AVERROR_EOF ) {
             CTUNE_LOG( CTUNE_LOG_ERROR,
@@ -785,7 +814,7 @@ bool ctune_Player_testStream( const char * url, int timeout_val, String_t * code
     AVCodecParameters * in_codec_param       = NULL;
     AVCodecContext    * in_codec_ctx         = NULL;
     AVCodec           * in_codec             = NULL;
-    ctune_Timeout_t     timeout_timer        = ctune_Timeout.init( timeout_val, CTUNE_ERR_STREAM_OPEN_TIMEOUT, ctune_Player_timeoutCallback );
+    ctune_Timeout_t     timeout_timer        = ctune_Timeout.init( timeout_val, CTUNE_ERR_STREAM_OPEN_TIMEOUT, NULL ); //no callback: a probe timing out must not stop playback
     AVIOInterruptCB     interrupt_callback   = { .callback = ctune_Timeout.timedOut, &timeout_timer };
 
     //---(1) setup input---
@@ -1,14 +1,25 @@
 #include "Controller.h"
 
 #include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
 
 #include "logger/src/Logger.h"
 #include "ctune_err.h"
+#include "datastructure/StationIndex.h"
 #include "fs/Settings.h"
 #include "fs/PlaybackLog.h"
+#include "fs/StationCatalogue.h"
 #include "player/RadioPlayer.h"
 #include "network/RadioBrowser.h"
 #include "network/NetworkUtils.h"
+#include "network/NetworkJobs.h"
+#include "network/Outbox.h"
+#include "network/ResponseCache.h"
+#include "network/MirrorStats.h"
+
+#define CTUNE_CONTROLLER_FAV_SYNC_BATCH 100 //max number of station UUIDs per bulk lookup (keeps the URI well under 8KB)
 
 /**
  * Controller variables
@@ -17,6 +28,63 @@ static struct {
     ctune_UIConfig_t     ui_config;
     ctune_ServerList_t   radio_browser_servers;
 
+    struct { /* LOCAL STATION CATALOGUE */
+        pthread_t             sync_thread;
+        bool                  sync_thread_started;
+        bool                  sync;
+        bool                  full_sync;
+        atomic_bool           cancel_sync; //also aborts the in-flight download
+    } catalogue;
+
+    struct { /* RESUMED STATION REFRESH */
+        pthread_t             thread;
+        bool                  thread_started;
+        volatile sig_atomic_t cancel;
+    } resume;
+
+    struct { /* PLAYBACK */
+        pthread_mutex_t       lock; //recursive: serialises starts from the UI and resume threads
+    } playback;
+
+    struct { /* AUDIO PLUGINS */
+        pthread_mutex_t       lock;
+        bool                  initialised;
+    } audio;
+
+    struct { /* LOCAL SEARCH INDICES */
+        pthread_mutex_t       lock;
+        ctune_StationIndex_t  favourites;
+        ctune_StationIndex_t  catalogue;
+        bool                  favourites_stale;
+    } index;
+
+    struct { /* FAVOURITES BULK SYNC */
+        pthread_mutex_t       lock;
+        bool                  running;
+        size_t                batches;   //number of bulk lookups submitted
+        size_t                completed; //number of bulk lookups completed
+        size_t                requested; //number of stations looked up by the successful batches
+        bool                  failed;
+        bool                  cancelled;
+        Vector_t              results;   //stations fetched so far
+        void               (* progress)( size_t, size_t );
+        void               (* done)( bool, size_t, size_t );
+    } fav_sync;
+
+    struct { /* FAVOURITES STREAM CHECK */
+        pthread_mutex_t       lock;
+        bool                  running;
+        size_t                submitted; //number of stream tests submitted
+        size_t                completed; //number of stream tests completed
+        size_t                reachable;
+        size_t                unreachable;
+        bool                  cancelled;
+        Vector_t              stations;  //copies of the stations being checked (indexed by the job data)
+        Vector_t              results;   //stations checked so far with their updated check state
+        void               (* progress)( size_t, size_t, const char *, const ctune_NetworkJob_t * );
+        void               (* done)( bool, size_t, size_t );
+    } stream_check;
+
     struct { /* CALLBACKS METHODS */
         void (* station_change_cb)( const ctune_RadioStationInfo_t * );
         void (* song_change_cb)( const char * );
@@ -27,6 +95,32 @@ static struct {
     } cb;
 
 } controller = {
+    .catalogue = {
+        .sync_thread_started      = false,
+        .sync                     = false,
+        .full_sync                = false,
+        .cancel_sync              = false,
+    },
+    .resume = {
+        .thread_started           = false,
+        .cancel                   = 0,
+    },
+    .audio = {
+        .lock                     = PTHREAD_MUTEX_INITIALIZER,
+        .initialised              = false,
+    },
+    .index = {
+        .lock                     = PTHREAD_MUTEX_INITIALIZER,
+        .favourites_stale         = true,
+    },
+    .fav_sync = {
+        .lock                     = PTHREAD_MUTEX_INITIALIZER,
+        .running                  = false,
+    },
+    .stream_check = {
+        .lock                     = PTHREAD_MUTEX_INITIALIZER,
+        .running                  = false,
+    },
     .cb = {
         .station_change_cb        = NULL,
         .song_change_cb           = NULL,
@@ -91,6 +185,582 @@ static void ctune_Controller_volumeChangeEvent( int vol ) {
     ctune_Settings.cfg.setVolume( vol );
 }
 
+/**
+ * [PRIVATE] Downloads the remote station list (or the changes since the last sync) into the local catalogue
+ * @param arg Unused
+ * @return Catalogue changed state
+ */
+static bool ctune_Controller_syncCatalogue( void * arg ) {
+    const bool                 full_sync   = controller.catalogue.full_sync;
+    bool                       error_state = false;
+    bool                       updated     = false;
+    bool                       caught_up   = false;
+    ctune_ServerList_t         servers     = ctune_ServerList.init(); //separate list as the UI thread uses the controller's
+    ctune_RadioBrowserFilter_t filter      = ctune_RadioBrowserFilter.init();
+    Vector_t                   stations    = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    Vector_t                   page        = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    String_t                   last_change = String.init();
+
+    if( !full_sync && !ctune_StationCatalogue.lastChangeTimestamp( &last_change ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_syncCatalogue( %p )] Failed to get the last change timestamp.", arg );
+        error_state = true;
+        goto end;
+    }
+
+    //full: oldest changes first so that stations modified during the sync only shift to later pages
+    //delta: newest changes first so that the paging can stop once the catalogue is caught up
+    ctune_RadioBrowserFilter.set.ordering( &filter, STATION_ATTR_CHANGETIMESTAMP );
+    ctune_RadioBrowserFilter.set.reverseToggle( &filter, !full_sync );
+    ctune_RadioBrowserFilter.set.resultLimit( &filter, CTUNE_STATIONCATALOGUE_SYNC_PAGE_SIZE );
+
+    CTUNE_LOG( CTUNE_LOG_MSG,
+               "[ctune_Controller_syncCatalogue( %p )] Station catalogue %s sync started (last change: %s).",
+               arg, ( full_sync ? "full" : "delta" ), ( String.empty( &last_change ) ? "n/a" : last_change._raw )
+    );
+
+    while( !caught_up && !atomic_load( &controller.catalogue.cancel_sync ) ) {
+        if( !ctune_RadioBrowser.downloadStations( &servers, ctune_Settings.cfg.getNetworkTimeoutVal(), &filter, &page ) ) {
+            if( ctune_NetworkUtils.abortRequested() ) {
+                break; //shutdown
+            }
+
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_Controller_syncCatalogue( %p )] Failed to download stations (offset: %lu).",
+                       arg, filter.offset
+            );
+
+            error_state = true;
+            goto end;
+        }
+
+        const size_t page_size = Vector.size( &page );
+
+        for( size_t i = 0; i < page_size; ++i ) {
+            ctune_RadioStationInfo_t * rsi = Vector.at( &page, i );
+
+            if( !full_sync && ( rsi->iso8601.last_change_time == NULL || strcmp( rsi->iso8601.last_change_time, last_change._raw ) <= 0 ) ) {
+                caught_up = true;
+                break;
+            }
+
+            ctune_RadioStationInfo_t * dest = Vector.init_back( &stations, ctune_RadioStationInfo.init );
+
+            if( dest == NULL ) {
+                CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_syncCatalogue( %p )] Failed to allocate station.", arg );
+                error_state = true;
+                goto end;
+            }
+
+            *dest = *rsi; //move ownership of the content
+            ctune_RadioStationInfo.init( rsi );
+        }
+
+        if( page_size < CTUNE_STATIONCATALOGUE_SYNC_PAGE_SIZE ) {
+            caught_up = true;
+        }
+
+        ctune_RadioBrowserFilter.set.resultOffset( &filter, ( filter.offset + page_size ) );
+        Vector.reinit( &page );
+    }
+
+    if( atomic_load( &controller.catalogue.cancel_sync ) ) {
+        CTUNE_LOG( CTUNE_LOG_MSG, "[ctune_Controller_syncCatalogue( %p )] Station catalogue sync cancelled.", arg );
+        goto end;
+    }
+
+    if( full_sync || !Vector.empty( &stations ) ) {
+        error_state = !ctune_StationCatalogue.update( &stations, full_sync );
+        updated     = !error_state;
+    }
+
+    end:
+        CTUNE_LOG( ( error_state ? CTUNE_LOG_ERROR : CTUNE_LOG_MSG ),
+                   "[ctune_Controller_syncCatalogue( %p )] Station catalogue sync %s (%lu stations received).",
+                   arg, ( error_state ? "failed" : "complete" ), Vector.size( &stations )
+        );
+
+        String.free( &last_change );
+        Vector.clear_vector( &page );
+        Vector.clear_vector( &stations );
+        ctune_RadioBrowserFilter.freeContent( &filter );
+        ctune_ServerList.freeServerList( &servers );
+        return updated;
+}
+
+/**
+ * [PRIVATE] Rebuilds the search index of the local catalogue
+ */
+static void ctune_Controller_indexCatalogue( void ) {
+    ctune_StationIndex_t index = ctune_StationIndex.init();
+
+    if( !ctune_StationCatalogue.buildIndex( &index ) || !ctune_StationIndex.finalise( &index ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_indexCatalogue()] Failed to build the catalogue's search index." );
+        ctune_StationIndex.free( &index );
+        return; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &controller.index.lock );
+    ctune_StationIndex_t old = controller.index.catalogue;
+    controller.index.catalogue = index;
+    pthread_mutex_unlock( &controller.index.lock );
+
+    ctune_StationIndex.free( &old );
+
+    CTUNE_LOG( CTUNE_LOG_MSG,
+               "[ctune_Controller_indexCatalogue()] Catalogue search index built (%lu stations, %lu tokens).",
+               ctune_StationIndex.size( &index ), ctune_StationIndex.tokenCount( &index )
+    );
+}
+
+/**
+ * [PRIVATE] Rebuilds the search index of the favourites if it was flagged stale
+ * -
+ * Note: the favourites' view gets (re)built outside the index lock which is only held to swap the index in
+ */
+static void ctune_Controller_indexFavourites( void ) {
+    pthread_mutex_lock( &controller.index.lock );
+    const bool stale = controller.index.favourites_stale;
+    controller.index.favourites_stale = false; //any invalidation from here on flags the next rebuild
+    pthread_mutex_unlock( &controller.index.lock );
+
+    if( !stale ) {
+        return; //EARLY RETURN
+    }
+
+    ctune_StationIndex_t index = ctune_StationIndex.init();
+    const size_t         count = ctune_Settings.favs.viewSize();
+    bool                 error = false;
+
+    for( size_t i = 0; !error && i < count; ++i ) { //read in-place from the favourites' view
+        const ctune_RadioStationInfo_t * rsi = ctune_Settings.favs.viewAt( i );
+
+        error = ( rsi == NULL ) || !ctune_StationIndex.add( &index,
+                                                            ctune_RadioStationInfo.get.stationUUID( rsi ),
+                                                            ctune_RadioStationInfo.get.stationSource( rsi ),
+                                                            ctune_RadioStationInfo.get.clickCount( rsi ),
+                                                            ctune_RadioStationInfo.get.stationName( rsi ),
+                                                            ctune_RadioStationInfo.get.tags( rsi ),
+                                                            ctune_RadioStationInfo.get.country( rsi ),
+                                                            ctune_RadioStationInfo.get.language( rsi ),
+                                                            ctune_RadioStationInfo.get.codec( rsi ) );
+    }
+
+    if( error || !ctune_StationIndex.finalise( &index ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_indexFavourites()] Failed to build the favourites' search index." );
+        ctune_StationIndex.free( &index );
+
+        pthread_mutex_lock( &controller.index.lock );
+        controller.index.favourites_stale = true;
+        pthread_mutex_unlock( &controller.index.lock );
+
+    } else {
+        pthread_mutex_lock( &controller.index.lock );
+        ctune_StationIndex_t old = controller.index.favourites;
+        controller.index.favourites = index;
+        pthread_mutex_unlock( &controller.index.lock );
+
+        ctune_StationIndex.free( &old );
+    }
+}
+
+/**
+ * [PRIVATE] Flags the favourites' search index for a rebuild on its next use
+ */
+static void ctune_Controller_invalidateFavouritesIndex( void ) {
+    pthread_mutex_lock( &controller.index.lock );
+    controller.index.favourites_stale = true;
+    pthread_mutex_unlock( &controller.index.lock );
+}
+
+/**
+ * [PRIVATE] Signals a change of the search state (background network jobs)
+ * @param state Searching state
+ */
+static void ctune_Controller_searchStateChangeEvent( bool state ) {
+    if( controller.cb.search_state_change_cb != NULL ) {
+        controller.cb.search_state_change_cb( state );
+    }
+}
+
+/**
+ * [PRIVATE] Checks if the local catalogue has any station matching a filter regardless of its result offset
+ * @param filter Filter
+ * @return Match state
+ */
+static bool ctune_Controller_catalogueHasStations( const ctune_RadioBrowserFilter_t * filter ) {
+    ctune_RadioBrowserFilter_t probe = ctune_RadioBrowserFilter.init();
+    Vector_t                   match = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+
+    ctune_RadioBrowserFilter.copy( filter, &probe );
+    ctune_RadioBrowserFilter.set.resultOffset( &probe, 0 );
+    ctune_RadioBrowserFilter.set.resultLimit( &probe, 1 );
+
+    const bool ret = ( ctune_StationCatalogue.getStations( &probe, &match ) && !Vector.empty( &match ) );
+
+    Vector.clear_vector( &match );
+    ctune_RadioBrowserFilter.freeContent( &probe );
+    return ret;
+}
+
+/**
+ * [PRIVATE] Search for all stations matching the criteria in filter
+ * @param servers  List of RadioBrowser API servers to use
+ * @param filter   Filter
+ * @param stations RadioStationInfo container
+ * @return Success
+ */
+static bool ctune_Controller_fetchStations( ctune_ServerList_t * servers, const ctune_RadioBrowserFilter_t * filter, Vector_t * stations ) {
+    if( ctune_StationCatalogue.isLoaded() ) {
+        if( ctune_StationCatalogue.getStations( filter, stations ) && !Vector.empty( stations ) ) {
+            CTUNE_LOG( CTUNE_LOG_DEBUG,
+                       "[ctune_Controller_fetchStations( %p, %p, %p )] Found %lu radio stations in the local catalogue.",
+                       servers, filter, stations, Vector.size( stations ) );
+
+            return true; //EARLY RETURN
+        }
+
+        //pages past the catalogue's last match must not be filled in with remote records
+        if( ctune_RadioBrowserFilter.get.resultOffset( filter ) > 0 && ctune_Controller_catalogueHasStations( filter ) ) {
+            CTUNE_LOG( CTUNE_LOG_DEBUG,
+                       "[ctune_Controller_fetchStations( %p, %p, %p )] No more radio stations in the local catalogue.",
+                       servers, filter, stations );
+
+            return false; //EARLY RETURN
+        }
+    }
+
+    bool ret = ctune_RadioBrowser.downloadStations( servers,
+                                                    ctune_Settings.cfg.getNetworkTimeoutVal(),
+                                                    filter,
+                                                    stations );
+
+    if( !ret ) {
+        if( ctune_NetworkUtils.abortRequested() )
+            return false; //EARLY RETURN - cancelled
+
+        if( ctune_err.number() == CTUNE_ERR_NONE )
+            ctune_err.set( CTUNE_ERR_ACTION_FETCH );
+
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_Controller_fetchStations( %p, %p, %p )] Error downloading radio stations.",
+                   servers, filter, stations );
+    } else {
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_Controller_fetchStations( %p, %p, %p )] Downloaded %lu radio stations.",
+                   servers, filter, stations, Vector.size( stations ) );
+    }
+
+    return ( ret && !Vector.empty( stations ) );
+}
+
+/**
+ * [PRIVATE] Search for all stations matching the criteria
+ * @param servers     List of RadioBrowser API servers to use
+ * @param category    Category
+ * @param search_term Search term (optional)
+ * @param stations    Container for stations
+ * @return Success
+ */
+static bool ctune_Controller_fetchStationsBy( ctune_ServerList_t * servers, const ctune_ByCategory_e category, const char * search_term, Vector_t * stations ) {
+    //UUID lookups always go to the remote as they are used to refresh stations (the catalogue may be up to a sync interval old)
+    if( category != RADIOBROWSER_STATION_BY_UUID && ctune_StationCatalogue.isLoaded() && ctune_StationCatalogue.getStationsBy( category, search_term, stations ) && !Vector.empty( stations ) ) {
+        CTUNE_LOG( CTUNE_LOG_TRACE,
+                   "[ctune_Controller_fetchStationsBy( %p, %i, \"%s\", %p )] Found %lu radio stations in the local catalogue.",
+                   servers, category, ( search_term ? search_term : "" ), stations, Vector.size( stations ) );
+
+        return true; //EARLY RETURN
+    }
+
+    bool ret = ctune_RadioBrowser.downloadStationsBy( servers,
+                                                      ctune_Settings.cfg.getNetworkTimeoutVal(),
+                                                      category,
+                                                      search_term,
+                                                      stations );
+    if( !ret ) {
+        if( ctune_NetworkUtils.abortRequested() )
+            return false; //EARLY RETURN - cancelled
+
+        if( ctune_err.number() == CTUNE_ERR_NONE )
+            ctune_err.set( CTUNE_ERR_ACTION_FETCH );
+
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_Controller_fetchStationsBy( %p, %i, \"%s\", %p )] Error downloading radio stations.",
+                   servers, category, ( search_term ? search_term : "" ), stations );
+    } else {
+        CTUNE_LOG( CTUNE_LOG_TRACE,
+                   "[ctune_Controller_fetchStationsBy( %p, %i, \"%s\", %p )] Downloaded %lu radio stations.",
+                   servers, category, ( search_term ? search_term : "" ), stations, Vector.size( stations ) );
+    }
+
+    return ret;
+}
+
+/**
+ * [PRIVATE] Probes the stream of a stream test job (runs on a worker thread)
+ * @param job Stream test network job (URL in `term`)
+ * @return Stream OK
+ */
+static bool ctune_Controller_testStreamJob( ctune_NetworkJob_t * job ) {
+    struct timespec start;
+    struct timespec end;
+
+    ctune_Controller.initAudio(); //waits on any in-progress deferred init
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    const bool ok = ctune_RadioPlayer.testStream( job->term._raw, ctune_Settings.cfg.getStreamTimeoutVal(), &job->stream.codec, &job->stream.bitrate );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+
+    job->stream.latency_ms = ( (double) ( end.tv_sec - start.tv_sec ) * 1000.0 ) + ( (double) ( end.tv_nsec - start.tv_nsec ) / 1000000.0 );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_Controller_testStreamJob( %p )] Stream \"%s\" %s (%.0fms).",
+               job, job->term._raw, ( ok ? "OK" : "unreachable" ), job->stream.latency_ms
+    );
+
+    return ok;
+}
+
+/**
+ * [PRIVATE] Does the work of a network job (runs on a worker thread)
+ * @param job     Network job
+ * @param servers Worker's own list of RadioBrowser API servers
+ * @return Success
+ */
+static bool ctune_Controller_runSearchJob( ctune_NetworkJob_t * job, ctune_ServerList_t * servers ) {
+    switch( job->type ) {
+        case CTUNE_NETWORKJOB_STATIONS:
+            return ctune_Controller_fetchStations( servers, &job->filter, &job->results );
+
+        case CTUNE_NETWORKJOB_STATIONS_BY:
+            return ctune_Controller_fetchStationsBy( servers, job->category, ( String.empty( &job->term ) ? NULL : job->term._raw ), &job->results );
+
+        case CTUNE_NETWORKJOB_STATIONS_BY_UUIDS:
+            return ctune_RadioBrowser.downloadStationsByUUIDs( servers, ctune_Settings.cfg.getNetworkTimeoutVal(), job->term._raw, &job->results );
+
+        case CTUNE_NETWORKJOB_STREAM_TEST: //fallthrough
+        case CTUNE_NETWORKJOB_STREAM_TEST_BULK:
+            return ctune_Controller_testStreamJob( job );
+
+        default: {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_runSearchJob( %p, %p )] Job type not implemented: %i", job, servers, job->type );
+            return false;
+        }
+    }
+}
+
+/**
+ * [PRIVATE] Delivers a queued RadioBrowser request (runs on the outbox's sender thread)
+ * @param item    Outbox item
+ * @param servers Sender's own list of RadioBrowser API servers
+ * @return Delivery state (false: retry later)
+ */
+static bool ctune_Controller_sendOutboxItem( const ctune_Outbox_Item_t * item, ctune_ServerList_t * servers ) {
+    bool ret = false;
+
+    switch( item->action ) {
+        case CTUNE_OUTBOX_CLICK: { //as per the RadioBrowser API documentation
+            ctune_ClickCounter_t click_counter;
+            ctune_ClickCounter.init( &click_counter );
+
+            if( ( ret = ctune_RadioBrowser.stationClickCounter( servers, ctune_Settings.cfg.getNetworkTimeoutVal(), item->uuid, &click_counter ) ) ) {
+                CTUNE_LOG( CTUNE_LOG_MSG,
+                           "[ctune_Controller_sendOutboxItem( %p, %p )] Click counter for \"%s\": %s (msg: \"%s\")",
+                           item, servers, item->uuid, ( click_counter.ok ? "OK" : "ERR" ), click_counter.message
+                );
+            }
+
+            ctune_ClickCounter.freeContent( &click_counter );
+        } break;
+
+        case CTUNE_OUTBOX_VOTE: {
+            ctune_RadioStationVote_t vote;
+            ctune_RadioStationVote.init( &vote );
+
+            if( ( ret = ctune_RadioBrowser.voteForStation( servers, ctune_Settings.cfg.getNetworkTimeoutVal(), item->uuid, &vote ) ) ) {
+                CTUNE_LOG( CTUNE_LOG_MSG,
+                           "[ctune_Controller_sendOutboxItem( %p, %p )] Vote for \"%s\": %s (msg: \"%s\")",
+                           item, servers, item->uuid, ( vote.ok ? "OK" : "ERR" ), vote.message
+                );
+            }
+
+            ctune_RadioStationVote.freeContent( &vote );
+        } break;
+
+        default: {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_sendOutboxItem( %p, %p )] Action not implemented: %i", item, servers, item->action );
+            ret = true; //i.e.: dropped
+        } break;
+    }
+
+    return ret;
+}
+
+/**
+ * [PRIVATE] Indexes the local catalogue and syncs it with the remote station list when due (thread)
+ * @param arg Unused
+ * @return NULL
+ */
+static void * ctune_Controller_catalogueWorker( void * arg ) {
+    if( ctune_StationCatalogue.isLoaded() ) {
+        ctune_Controller_indexCatalogue();
+    }
+
+    ctune_NetworkUtils.setAbortFlag( &controller.catalogue.cancel_sync );
+
+    if( controller.catalogue.sync && !atomic_load( &controller.catalogue.cancel_sync ) && ctune_Controller_syncCatalogue( arg ) ) {
+        ctune_Controller_indexCatalogue();
+    }
+
+    ctune_NetworkUtils.setAbortFlag( NULL );
+
+    return NULL;
+}
+
+/**
+ * [PRIVATE] Loads the local station catalogue, indexes it and starts a background sync if it is stale
+ */
+static void ctune_Controller_loadCatalogue( void ) {
+    const bool   loaded   = ctune_StationCatalogue.init();
+    const time_t now      = time( NULL );
+    const time_t interval = (time_t) ctune_Settings.cfg.catalogueSyncInterval() * 60 * 60;
+
+    controller.catalogue.sync        = ( !loaded || ( now - ctune_StationCatalogue.lastSync() ) >= interval );
+    controller.catalogue.full_sync   = ( !loaded || ( now - ctune_StationCatalogue.lastFullSync() ) >= CTUNE_STATIONCATALOGUE_FULL_RESYNC_AGE );
+    atomic_store( &controller.catalogue.cancel_sync, false );
+
+    if( !controller.catalogue.sync ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Controller_loadCatalogue()] Station catalogue is up to date." );
+    }
+
+    if( pthread_create( &controller.catalogue.sync_thread, NULL, ctune_Controller_catalogueWorker, NULL ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_loadCatalogue()] Failed to create station catalogue thread." );
+        return; //EARLY RETURN
+    }
+
+    controller.catalogue.sync_thread_started = true;
+}
+
+/**
+ * [PRIVATE] Fetches a fresh record of a resumed station, updates the cached copy and replays it if the cached URL failed (thread)
+ * @param arg Pointer to the allocated ctune_RadioStationInfo_t station resumed from the cache (freed here)
+ * @return NULL
+ */
+static void * ctune_Controller_resumeWorker( void * arg ) {
+    ctune_RadioStationInfo_t * cached       = arg;
+    ctune_ServerList_t         servers      = ctune_ServerList.init(); //separate list as the UI thread uses the controller's
+    Vector_t                   station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    const char               * uuid         = ctune_RadioStationInfo.get.stationUUID( cached );
+
+    if( !ctune_RadioBrowser.downloadStationsBy( &servers,
+                                                ctune_Settings.cfg.getNetworkTimeoutVal(),
+                                                RADIOBROWSER_STATION_BY_UUID,
+                                                uuid,
+                                                &station_list ) || Vector.empty( &station_list ) )
+    {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Controller_resumeWorker( %p )] Failed to refresh station info (UUID: %s).", arg, uuid );
+        goto end;
+    }
+
+    const ctune_RadioStationInfo_t * fresh = Vector.at( &station_list, 0 );
+
+    if( !ctune_Settings.cfg.refreshLastPlayedStation( fresh ) ) {
+        goto end; //station was changed in the meantime
+    }
+
+    if( strcmp( ctune_fallbackStr( ctune_RadioStationInfo.get.resolvedURL( fresh ), "" ), ctune_fallbackStr( ctune_RadioStationInfo.get.resolvedURL( cached ), "" ) ) == 0
+     && strcmp( ctune_fallbackStr( ctune_RadioStationInfo.get.stationURL( fresh ), "" ), ctune_fallbackStr( ctune_RadioStationInfo.get.stationURL( cached ), "" ) ) == 0 )
+    {
+        goto end; //nothing to re-resolve
+    }
+
+    //only re-resolve if the stream from the cached URL fails within the timeout window
+    const long max_polls = ( (long) ctune_Settings.cfg.getStreamTimeoutVal() + 1 ) * 10;
+
+    for( long i = 0; i <= max_polls && !controller.resume.cancel; ++i ) {
+        if( !ctune_Settings.cfg.isLastPlayedStation( uuid, ctune_RadioStationInfo.get.stationSource( cached ) ) ) {
+            goto end; //station was changed in the meantime
+        }
+
+        if( !ctune_RadioPlayer.getPlaybackState() ) {
+            if( ctune_RadioPlayer.getError() != CTUNE_ERR_NONE ) {
+                pthread_mutex_lock( &controller.playback.lock );
+
+                //checked again under the lock so that a station started by the user in the meantime is not replaced
+                if( ctune_Settings.cfg.isLastPlayedStation( uuid, ctune_RadioStationInfo.get.stationSource( cached ) )
+                 && !ctune_RadioPlayer.getPlaybackState() )
+                {
+                    CTUNE_LOG( CTUNE_LOG_MSG,
+                               "[ctune_Controller_resumeWorker( %p )] Cached stream URL failed, retrying with refreshed station info (UUID: %s).",
+                               arg, uuid
+                    );
+
+                    ctune_Controller.playback.start( fresh );
+                }
+
+                pthread_mutex_unlock( &controller.playback.lock );
+            }
+
+            goto end; //(failed or stopped by user)
+        }
+
+        nanosleep( &(struct timespec){ .tv_sec = 0, .tv_nsec = 100000000L }, NULL );
+    }
+
+    end:
+        Vector.clear_vector( &station_list );
+        ctune_ServerList.freeServerList( &servers );
+        ctune_RadioStationInfo.freeContent( cached );
+        free( cached );
+        return NULL;
+}
+
+/**
+ * [PRIVATE] Starts playback of the last station played from its cached record and refreshes it in the background
+ * @param uuid UUID the cached record must match (NULL for any)
+ * @return Success
+ */
+static bool ctune_Controller_resumeCachedStation( const char * uuid ) {
+    ctune_RadioStationInfo_t * station = malloc( sizeof( ctune_RadioStationInfo_t ) );
+
+    if( station == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_resumeCachedStation( %s )] Failed to allocate memory.", uuid );
+        return false; //EARLY RETURN
+    }
+
+    ctune_RadioStationInfo.init( station );
+
+    if( !ctune_Settings.cfg.getLastPlayedStation( station )
+     || ctune_RadioStationInfo.get.stationSource( station ) != CTUNE_STATIONSRC_RADIOBROWSER
+     || ( uuid != NULL && strcmp( uuid, ctune_RadioStationInfo.get.stationUUID( station ) ) != 0 )
+     || !ctune_Controller.playback.start( station ) )
+    {
+        goto fail;
+    }
+
+    if( controller.resume.thread_started ) { //(previous refresh - should not happen as resume is a once-off at startup)
+        controller.resume.cancel = 1;
+        pthread_join( controller.resume.thread, NULL );
+        controller.resume.thread_started = false;
+    }
+
+    controller.resume.cancel = 0;
+
+    if( pthread_create( &controller.resume.thread, NULL, ctune_Controller_resumeWorker, station ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_resumeCachedStation( %s )] Failed to create station refresh thread.", uuid );
+        ctune_RadioStationInfo.freeContent( station );
+        free( station );
+        return true; //EARLY RETURN (playback started regardless)
+    }
+
+    controller.resume.thread_started = true;
+    return true;
+
+    fail:
+        ctune_RadioStationInfo.freeContent( station );
+        free( station );
+        return false;
+}
+
 /* ============================================ PUBLIC ========================================== */
 
 /**
@@ -102,6 +772,14 @@ static bool ctune_Controller_init( void ) {
     controller.radio_browser_servers = ctune_ServerList.init();
     controller.ui_config             = ctune_Settings.cfg.getUIConfig();
 
+    { //playback lock needs to be recursive as the resume thread holds it across its checks and `playback.start(..)`
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init( &attr );
+        pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_RECURSIVE );
+        pthread_mutex_init( &controller.playback.lock, &attr );
+        pthread_mutexattr_destroy( &attr );
+    }
+
     if( !ctune_Settings.cfg.isLoaded() ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] Looks like Settings has not loaded a config file yet." );
     }
@@ -109,23 +787,83 @@ static bool ctune_Controller_init( void ) {
     ctune_RadioPlayer.init( ctune_Controller_songChangeEvent,
                             ctune_Controller_volumeChangeEvent );
 
-    if( !ctune_RadioPlayer.loadSoundServerPlugin( ctune_Settings.plugins.getPlugin( CTUNE_PLUGIN_OUT_AUDIO_SERVER ) ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] Failed to load a sound server plugin." );
+    //audio plugins are linked and initialised later via `ctune_Controller.initAudio()`
+    if( !ctune_Settings.plugins.hasPlugin( CTUNE_PLUGIN_OUT_AUDIO_SERVER ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] No sound server plugin available." );
         return false; //EARLY RETURN
     };
 
-    if( !ctune_RadioPlayer.loadPlayerPlugin( ctune_Settings.plugins.getPlugin( CTUNE_PLUGIN_IN_STREAM_PLAYER ) ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] Failed to load a player plugin." );
+    if( !ctune_Settings.plugins.hasPlugin( CTUNE_PLUGIN_IN_STREAM_PLAYER ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] No player plugin available." );
         return false; //EARLY RETURN
     };
 
-    if( ctune_Settings.plugins.getPlugin( CTUNE_PLUGIN_OUT_AUDIO_RECORDER ) == NULL ) {
-        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Controller_init()] Failed to load a recorder plugin." );
+    if( !ctune_Settings.plugins.hasPlugin( CTUNE_PLUGIN_OUT_AUDIO_RECORDER ) ) { //recorder is only linked when recording starts
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Controller_init()] No recorder plugin available." );
+    }
+
+    ctune_MirrorStats.load();
+
+    if( !ctune_NetworkJobs.init( CTUNE_NETWORKJOBS_WORKER_COUNT, ctune_Controller_runSearchJob, ctune_Controller_searchStateChangeEvent ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] Failed to start the network job workers." );
+    }
+
+    if( !ctune_Outbox.init( ctune_Controller_sendOutboxItem ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_init()] Failed to start the outbox sender." );
+    }
+
+    if( ctune_Settings.cfg.catalogueEnabled() ) {
+        ctune_Controller_loadCatalogue();
     }
 
     return true;
 }
 
+/**
+ * [THREAD SAFE] Links and initialises the selected sound server and player plugins (once)
+ * @return Success
+ */
+static bool ctune_Controller_initAudio( void ) {
+    bool error_state = false;
+
+    pthread_mutex_lock( &controller.audio.lock );
+
+    if( controller.audio.initialised ) {
+        goto end;
+    }
+
+    if( !ctune_RadioPlayer.loadSoundServerPlugin( ctune_Settings.plugins.getPlugin( CTUNE_PLUGIN_OUT_AUDIO_SERVER ) ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_initAudio()] Failed to load a sound server plugin." );
+        error_state = true;
+        goto end;
+    };
+
+    if( !ctune_RadioPlayer.loadPlayerPlugin( ctune_Settings.plugins.getPlugin( CTUNE_PLUGIN_IN_STREAM_PLAYER ) ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_initAudio()] Failed to load a player plugin." );
+        error_state = true;
+        goto end;
+    };
+
+    controller.audio.initialised = true;
+
+    end:
+        pthread_mutex_unlock( &controller.audio.lock );
+        return !( error_state );
+}
+
+/**
+ * Probes the RadioBrowser API mirrors' latency and saves the results (blocking)
+ * @return Number of mirrors that responded
+ */
+static size_t ctune_Controller_probeMirrors( void ) {
+    const size_t responded = ctune_RadioBrowser.probeServers( ctune_Settings.cfg.getNetworkTimeoutVal() );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Controller_probeMirrors()] %lu mirror(s) reachable.", responded );
+
+    ctune_MirrorStats.save();
+    return responded;
+}
+
 /**
  * Loads controller level options and act on these
  * @param opts Options
@@ -140,7 +878,28 @@ static void ctune_Controller_load( ctune_ArgOptions_t * opts ) {
     Vector_t                         station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
 
     if( !String.empty( &opts->playback.init_station_uuid ) ) {
-        if( ctune_Controller.search.getStationsBy( RADIOBROWSER_STATION_BY_UUID, opts->playback.init_station_uuid._raw, &station_list ) ) {
+        if( ctune_Controller_resumeCachedStation( opts->playback.init_station_uuid._raw ) ) {
+            CTUNE_LOG( CTUNE_LOG_MSG,
+                       "[ctune_Controller_load( %p )] "
+                       "Playing 'init' station passed by the options from its cached record (UUID: %s).",
+                       opts, opts->playback.init_station_uuid._raw
+            );
+
+            if( opts->playback.favourite_init && !ctune_Settings.favs.isFavourite( opts->playback.init_station_uuid._raw, CTUNE_STATIONSRC_RADIOBROWSER ) ) {
+                ctune_RadioStationInfo_t cached;
+                ctune_RadioStationInfo.init( &cached );
+
+                if( ctune_Settings.cfg.getLastPlayedStation( &cached ) ) {
+                    ctune_Settings.favs.addStation( &cached, CTUNE_STATIONSRC_RADIOBROWSER );
+                    ctune_Controller_invalidateFavouritesIndex();
+                }
+
+                ctune_RadioStationInfo.freeContent( &cached );
+            }
+
+            goto end; //(happy path)
+
+        } else if( ctune_Controller.search.getStationsBy( RADIOBROWSER_STATION_BY_UUID, opts->playback.init_station_uuid._raw, &station_list ) ) {
             station = ( const ctune_RadioStationInfo_t * ) Vector.at( &station_list, 0 );
 
             if( ctune_Controller.playback.start( station ) ) {
@@ -154,6 +913,7 @@ static void ctune_Controller_load( ctune_ArgOptions_t * opts ) {
 
                 if( opts->playback.favourite_init && !is_favourite ) {
                     ctune_Settings.favs.addStation( station, CTUNE_STATIONSRC_RADIOBROWSER );
+                    ctune_Controller_invalidateFavouritesIndex();
                 }
 
                 goto end; //(happy path)
@@ -205,6 +965,16 @@ static void ctune_Controller_load( ctune_ArgOptions_t * opts ) {
             } break;
 
             case CTUNE_STATIONSRC_RADIOBROWSER: {
+                if( ctune_Controller_resumeCachedStation( NULL ) ) {
+                    CTUNE_LOG( CTUNE_LOG_MSG,
+                               "[ctune_Controller_load( %p )] "
+                               "Resuming playback of '%s' station from its cached record (UUID: %s).",
+                               opts, ctune_StationSrc.str( source ), ctune_Settings.cfg.getLastPlayedUUID()
+                    );
+
+                    goto end; //(happy path)
+                }
+
                 if( ctune_Controller.search.getStationsBy( RADIOBROWSER_STATION_BY_UUID, ctune_Settings.cfg.getLastPlayedUUID(), &station_list ) ) {
                     station = ( const ctune_RadioStationInfo_t * ) Vector.at( &station_list, 0 );
 
@@ -249,10 +1019,51 @@ static void ctune_Controller_resizeUI( void ) {
  * Shutdown and cleanup cTune
  */
 static void ctune_Controller_free() {
+    if( controller.resume.thread_started ) { //first so that it cannot restart playback after the player is shut down
+        controller.resume.cancel = 1;
+        pthread_join( controller.resume.thread, NULL );
+        controller.resume.thread_started = false;
+    }
+
+    ctune_RadioPlayer.shutdown();
+    ctune_NetworkJobs.shutdown();
+    ctune_Outbox.shutdown();
+
+    if( controller.catalogue.sync_thread_started ) {
+        atomic_store( &controller.catalogue.cancel_sync, true );
+        pthread_join( controller.catalogue.sync_thread, NULL );
+        controller.catalogue.sync_thread_started = false;
+    }
+
+    pthread_mutex_lock( &controller.fav_sync.lock );
+    if( controller.fav_sync.running ) { //outstanding batches were dropped with the worker pool
+        Vector.clear_vector( &controller.fav_sync.results );
+        controller.fav_sync.running = false;
+    }
+    pthread_mutex_unlock( &controller.fav_sync.lock );
+
+    pthread_mutex_lock( &controller.stream_check.lock );
+    if( controller.stream_check.running ) { //outstanding stream tests were dropped with the worker pool
+        Vector.clear_vector( &controller.stream_check.stations );
+        Vector.clear_vector( &controller.stream_check.results );
+        controller.stream_check.running = false;
+    }
+    pthread_mutex_unlock( &controller.stream_check.lock );
+
+    pthread_mutex_lock( &controller.index.lock );
+    ctune_StationIndex.free( &controller.index.favourites );
+    ctune_StationIndex.free( &controller.index.catalogue );
+    pthread_mutex_unlock( &controller.index.lock );
+
+    ctune_StationCatalogue.free();
+    ctune_ResponseCache.free();
+    ctune_MirrorStats.save();
+    ctune_MirrorStats.free();
     ctune_Controller.cfg.saveUIConfig();
     ctune_Controller.cfg.saveFavourites();
     ctune_ServerList.freeServerList( &controller.radio_browser_servers );
     String.free( &cache.last_played_song );
+    pthread_mutex_destroy( &controller.playback.lock );
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Controller_free()] Controller freed." );
 }
 
@@ -272,11 +1083,11 @@ static bool ctune_Controller_playback_getPlaybackState() {
 }
 
 /**
- * Starts playback of a radio station
+ * [PRIVATE] Starts playback of a radio station (playback lock must be held)
  * @param station Pointer to a RadioStationInfo DTO
  * @return Success
  */
-static bool ctune_Controller_playback_startPlayback( const ctune_RadioStationInfo_t * station ) {
+static bool ctune_Controller_startStation( const ctune_RadioStationInfo_t * station ) {
     if( station == NULL ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_startPlayback( %p )] Station is NULL.", station );
         return false; //EARLY RETURN
@@ -289,6 +1100,8 @@ static bool ctune_Controller_playback_startPlayback( const ctune_RadioStationInf
         return false; //EARLY RETURN
     }
 
+    ctune_Controller_initAudio(); //waits on any in-progress deferred init
+
     if( ctune_RadioPlayer.getPlaybackState() ) {
         ctune_RadioPlayer.stopPlayback();
     }
@@ -325,35 +1138,28 @@ static bool ctune_Controller_playback_startPlayback( const ctune_RadioStationInf
         CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_startPlayback( %p )] Failed to start playback." );
     }
 
-    ctune_Settings.cfg.setLastPlayedStation( ctune_RadioStationInfo.get.stationUUID( station ), ctune_RadioStationInfo.get.stationSource( station ) );
+    ctune_Settings.cfg.setLastPlayedStation( station );
 
     if( ctune_RadioStationInfo.get.stationSource( station ) == CTUNE_STATIONSRC_RADIOBROWSER ) {
-        //sends RadioBrowser station click request as per the RadioBrowser API documentation
-        ctune_ClickCounter_t click_counter;
-        ctune_ClickCounter.init( &click_counter );
-        bool ret = ctune_RadioBrowser.stationClickCounter( &controller.radio_browser_servers,
-                                                           ctune_Settings.cfg.getNetworkTimeoutVal(),
-                                                           ctune_RadioStationInfo.get.stationUUID( station ),
-                                                           &click_counter );
-
-        if( ret ) {
-            CTUNE_LOG( CTUNE_LOG_MSG,
-                       "[ctune_Controller_startPlayback( %p )] Click counter: %s (msg: \"%s\")",
-                       station, ( click_counter.ok ? "OK" : "ERR" ), click_counter.message
-            );
-        } else {
-            CTUNE_LOG( CTUNE_LOG_ERROR,
-                       "[ctune_Controller_startPlayback( %p )] Click counter request failed.",
-                       station
-            );
-        }
-
-        ctune_ClickCounter.freeContent( &click_counter );
+        //click request is queued so that playback is not held up by it (or lost when offline)
+        ctune_Outbox.post( CTUNE_OUTBOX_CLICK, ctune_RadioStationInfo.get.stationUUID( station ) );
     }
 
     return true;
 }
 
+/**
+ * [THREAD SAFE] Starts playback of a radio station
+ * @param station Pointer to a RadioStationInfo DTO
+ * @return Success
+ */
+static bool ctune_Controller_playback_startPlayback( const ctune_RadioStationInfo_t * station ) {
+    pthread_mutex_lock( &controller.playback.lock );
+    const bool ret = ctune_Controller_startStation( station );
+    pthread_mutex_unlock( &controller.playback.lock );
+    return ret;
+}
+
 /**
  * Search for all stations matching the criteria in filter
  * @param filter   Filter
@@ -361,25 +1167,7 @@ static bool ctune_Controller_playback_startPlayback( const ctune_RadioStationInf
  * @return Success
  */
 static bool ctune_Controller_search_getStations( ctune_RadioBrowserFilter_t * filter, Vector_t * stations ) {
-    bool ret = ctune_RadioBrowser.downloadStations( &controller.radio_browser_servers,
-                                                    ctune_Settings.cfg.getNetworkTimeoutVal(),
-                                                    filter,
-                                                    stations );
-
-    if( !ret ) {
-        if( ctune_err.number() == CTUNE_ERR_NONE )
-            ctune_err.set( CTUNE_ERR_ACTION_FETCH );
-
-        CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_Controller_search_getStations( %p, %p )] Error downloading radio stations.",
-                   filter, stations );
-    } else {
-        CTUNE_LOG( CTUNE_LOG_DEBUG,
-                   "[ctune_Controller_search_getStations( %p, %p )] Downloaded %lu radio stations.",
-                   filter, stations, Vector.size( stations ) );
-    }
-
-    return ( ret && !Vector.empty( stations ) );
+    return ctune_Controller_fetchStations( &controller.radio_browser_servers, filter, stations );
 }
 
 /**
@@ -390,25 +1178,30 @@ static bool ctune_Controller_search_getStations( ctune_RadioBrowserFilter_t * fi
  * @return Success
  */
 static bool ctune_Controller_search_getStationsBy( const ctune_ByCategory_e category, const char * search_term, Vector_t * stations ) {
-    bool ret = ctune_RadioBrowser.downloadStationsBy( &controller.radio_browser_servers,
-                                                      ctune_Settings.cfg.getNetworkTimeoutVal(),
-                                                      category,
-                                                      search_term,
-                                                      stations );
-    if( !ret ) {
-        if( ctune_err.number() == CTUNE_ERR_NONE )
-            ctune_err.set( CTUNE_ERR_ACTION_FETCH );
+    return ctune_Controller_fetchStationsBy( &controller.radio_browser_servers, category, search_term, stations );
+}
 
-        CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_Controller_search_getStationsBy( %i, \"%s\", %p )] Error downloading radio stations.",
-                   category, ( search_term ? search_term : "" ), stations );
-    } else {
-        CTUNE_LOG( CTUNE_LOG_TRACE,
-                   "[ctune_Controller_search_getStationsBy( %i, \"%s\", %p )] Downloaded %lu radio stations.",
-                   category, ( search_term ? search_term : "" ), stations, Vector.size( stations ) );
-    }
+/**
+ * [THREAD SAFE] Search in the background for all stations matching the criteria in filter
+ * @param filter Filter (copied)
+ * @param cb     Completion callback (called on the thread completing the search jobs)
+ * @param data   Data pointer to pass to the callback
+ * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure)
+ */
+static ctune_JobHandle_t ctune_Controller_search_getStationsAsync( const ctune_RadioBrowserFilter_t * filter, ctune_NetworkJob_Callback_f cb, void * data ) {
+    return ctune_NetworkJobs.submit( CTUNE_NETWORKJOB_STATIONS, filter, RADIOBROWSER_STATION_BY_UUID, NULL, cb, data );
+}
 
-    return ret;
+/**
+ * [THREAD SAFE] Search in the background for all stations matching the criteria
+ * @param category    Category
+ * @param search_term Search term (optional; copied)
+ * @param cb          Completion callback (called on the thread completing the search jobs)
+ * @param data        Data pointer to pass to the callback
+ * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure)
+ */
+static ctune_JobHandle_t ctune_Controller_search_getStationsByAsync( const ctune_ByCategory_e category, const char * search_term, ctune_NetworkJob_Callback_f cb, void * data ) {
+    return ctune_NetworkJobs.submit( CTUNE_NETWORKJOB_STATIONS_BY, NULL, category, search_term, cb, data );
 }
 
 /**
@@ -418,6 +1211,14 @@ static bool ctune_Controller_search_getStationsBy( const ctune_ByCategory_e cate
  * @param category_items Data-structure to store the category items (`ctune_CategoryItem_t`) into
  */
 bool ctune_Controller_search_getCategoryItems( const ctune_ListCategory_e category, const ctune_RadioBrowserFilter_t * filter, Vector_t * categories ) {
+    if( filter == NULL && ctune_StationCatalogue.isLoaded() && ctune_StationCatalogue.getCategoryItems( category, categories ) && !Vector.empty( categories ) ) {
+        CTUNE_LOG( CTUNE_LOG_TRACE,
+                   "[ctune_Controller_search_getCategoryItems( %i, %p, %p )] Aggregated %lu items for category %i from the local catalogue.",
+                   category, filter, categories, Vector.size( categories ), category );
+
+        return true; //EARLY RETURN
+    }
+
     bool ret = ctune_RadioBrowser.downloadCategoryItems( &controller.radio_browser_servers,
                                                          ctune_Settings.cfg.getNetworkTimeoutVal(),
                                                          category,
@@ -440,23 +1241,152 @@ bool ctune_Controller_search_getCategoryItems( const ctune_ListCategory_e catego
     return ret;
 }
 
+/**
+ * [THREAD SAFE] Cancels a background search (its callback will not be called)
+ * @param handle Job handle
+ */
+static void ctune_Controller_search_cancel( ctune_JobHandle_t handle ) {
+    ctune_NetworkJobs.cancel( handle );
+}
+
+/**
+ * [THREAD SAFE] Aborts all background searches and their in-flight transfers (callbacks are called with the failed job)
+ */
+static void ctune_Controller_search_cancelAll( void ) {
+    ctune_NetworkJobs.cancelAll();
+}
+
+/**
+ * [THREAD SAFE] Gets the number of background searches queued or running
+ * @return Number of searches
+ */
+static size_t ctune_Controller_search_pending( void ) {
+    return ctune_NetworkJobs.pending();
+}
+
+/**
+ * Completes a finished background search by calling its callback(s) (call from the thread that should run them)
+ * @param job Finished job as passed to the search job completion callback
+ */
+static void ctune_Controller_search_complete( ctune_NetworkJob_t * job ) {
+    ctune_NetworkJobs.complete( job );
+}
+
+/**
+ * Searches the locally known stations (favourites and catalogue) by name, tags, country, language and codec
+ * -
+ * Note: UI thread only as a stale favourites index is rebuilt from the (unsynchronised) favourites view
+ * @param text        Free-text search (prefix and typo tolerant)
+ * @param limit       Maximum number of stations to get
+ * @param stations    Container for the best matching stations ordered by relevance
+ * @param match_count Pointer to store the total number of matches into (can be NULL)
+ * @return Success
+ */
+static bool ctune_Controller_search_quickSearch( const char * text, size_t limit, Vector_t * stations, size_t * match_count ) {
+    if( text == NULL || stations == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_search_quickSearch( %p, %lu, %p, %p )] NULL arg(s).", text, limit, stations, match_count );
+        return false; //EARLY RETURN
+    }
+
+    bool     error_state = false;
+    size_t   total       = 0;
+    Vector_t favs        = Vector.init( sizeof( ctune_StationIndex_Result_t ), NULL );
+    Vector_t cat         = Vector.init( sizeof( ctune_StationIndex_Result_t ), NULL );
+
+    ctune_Controller_indexFavourites();
+
+    pthread_mutex_lock( &controller.index.lock );
+
+    //Note: stations that are both in the favourites and the catalogue get counted twice in the total
+    total += ctune_StationIndex.search( &controller.index.favourites, text, limit, &favs );
+    total += ctune_StationIndex.search( &controller.index.catalogue, text, limit, &cat );
+
+    size_t fi = 0;
+    size_t ci = 0;
+    size_t n  = 0;
+
+    while( n < limit && !error_state && ( fi < Vector.size( &favs ) || ci < Vector.size( &cat ) ) ) {
+        const ctune_StationIndex_Result_t * fav = ( fi < Vector.size( &favs ) ? Vector.at( &favs, fi ) : NULL );
+        const ctune_StationIndex_Result_t * ext = ( ci < Vector.size( &cat ) ? Vector.at( &cat, ci ) : NULL );
+
+        if( ext != NULL && ( fav == NULL || ext->score > fav->score ) ) { //favourites win ties
+            ++ci;
+
+            if( ctune_Settings.favs.isFavourite( ext->doc->uuid, ext->doc->src ) ) {
+                continue; //already in the favourite results if matching
+            }
+
+            if( !ctune_StationCatalogue.getStationsBy( RADIOBROWSER_STATION_BY_UUID, ext->doc->uuid, stations ) ) {
+                continue; //catalogue was swapped since the index was built
+            }
+
+        } else {
+            ++fi;
+
+            const ctune_RadioStationInfo_t * rsi = ctune_Settings.favs.getFavourite( fav->doc->uuid, fav->doc->src );
+
+            if( rsi == NULL ) {
+                continue;
+            }
+
+            ctune_RadioStationInfo_t * dest = Vector.init_back( stations, ctune_RadioStationInfo.init );
+
+            if( dest == NULL ) {
+                CTUNE_LOG( CTUNE_LOG_ERROR,
+                           "[ctune_Controller_search_quickSearch( \"%s\", %lu, %p, %p )] Failed to allocate station.",
+                           text, limit, stations, match_count
+                );
+
+                error_state = true;
+                break;
+            }
+
+            ctune_RadioStationInfo.copy( rsi, dest );
+            ctune_RadioStationInfo.set.favourite( dest, true );
+        }
+
+        ++n;
+    }
+
+    pthread_mutex_unlock( &controller.index.lock );
+
+    if( match_count != NULL ) {
+        *match_count = total;
+    }
+
+    Vector.clear_vector( &favs );
+    Vector.clear_vector( &cat );
+    return !( error_state );
+}
+
 /**
  * [THREAD SAFE] Changes playback volume variable
  * @param delta Volume change (+/-)
  */
 static void ctune_Controller_playback_modifyVolume( int delta ) {
+    ctune_Controller_initAudio();
     ctune_RadioPlayer.modifyVolume( delta );
 }
 
 /**
- * Test a stream and get properties
- * @param url     Stream URL
- * @param codec   Pointer to store codec string value into
- * @param bitrate Pointer to store bitrate value into
- * @return Success
+ * [THREAD SAFE] Tests a stream and gets its properties in the background
+ * @param url  Stream URL
+ * @param cb   Completion callback (`job->success`: stream OK, `job->stream`: probed properties)
+ * @param data Data pointer to pass to the callback
+ * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure)
+ */
+static ctune_JobHandle_t ctune_Controller_playback_testStreamAsync( const char * url, ctune_NetworkJob_Callback_f cb, void * data ) {
+    return ctune_NetworkJobs.submit( CTUNE_NETWORKJOB_STREAM_TEST, NULL, 0, url, cb, data );
+}
+
+/**
+ * [THREAD SAFE] Cancels a background stream test
+ * -
+ * The callback will not be called. A probe already in progress runs to its end (bound by the stream timeout).
+ * @param handle Job handle
  */
-static bool ctune_Controller_playback_testStream( const char * url, String_t * codec, ulong * bitrate ) {
-    return ctune_RadioPlayer.testStream( url, ctune_Settings.cfg.getStreamTimeoutVal(), codec, bitrate );
+static void ctune_Controller_playback_cancelStreamTest( ctune_JobHandle_t handle ) {
+    ctune_NetworkJobs.cancel( handle );
 }
 
 /**
@@ -567,6 +1497,7 @@ static bool ctune_Controller_cfg_toggleFavourite( ctune_RadioStationInfo_t * rsi
     }
 
     ctune_RadioStationInfo.set.favourite( rsi, !( ctune_RadioStationInfo.get.favourite( rsi ) ) );
+    ctune_Controller_invalidateFavouritesIndex();
     return true;
 }
 
@@ -582,6 +1513,7 @@ bool ctune_Controller_cfg_updateFavourite( ctune_RadioStationInfo_t * rsi, ctune
         bool ret2 = ctune_Settings.favs.addStation( rsi, src );
 
         if( ret1 && ret2 ) {
+            ctune_Controller_invalidateFavouritesIndex();
             return true; //EARLY RETURN (happy path)
 
         } else {
@@ -602,6 +1534,356 @@ bool ctune_Controller_cfg_updateFavourite( ctune_RadioStationInfo_t * rsi, ctune
     return false;
 }
 
+/**
+ * [PRIVATE] Completion callback for a batch of the favourites bulk sync
+ * @param job  Finished network job
+ * @param data (unused)
+ */
+static void ctune_Controller_syncFavouritesBatchCb( ctune_NetworkJob_t * job, void * data ) {
+    size_t updated = 0;
+    size_t missing = 0;
+
+    pthread_mutex_lock( &controller.fav_sync.lock );
+
+    if( atomic_load( &job->cancel ) ) {
+        controller.fav_sync.cancelled = true;
+
+    } else if( !job->success ) {
+        controller.fav_sync.failed = true;
+
+    } else {
+        for( const char * c = job->term._raw; c != NULL; c = strchr( c + 1, ',' ) ) { //UUIDs in the batch
+            ++controller.fav_sync.requested;
+        }
+
+        for( size_t i = 0; i < Vector.size( &job->results ); ++i ) {
+            ctune_RadioStationInfo_t * copy = Vector.init_back( &controller.fav_sync.results, ctune_RadioStationInfo.init );
+
+            if( copy == NULL ) {
+                controller.fav_sync.failed = true;
+                break;
+            }
+
+            ctune_RadioStationInfo.copy( Vector.at( &job->results, i ), copy );
+        }
+    }
+
+    const size_t completed = ++controller.fav_sync.completed;
+    const size_t batches   = controller.fav_sync.batches;
+    const bool   finished  = ( completed == batches );
+    const bool   success   = !( controller.fav_sync.failed || controller.fav_sync.cancelled );
+    void      (* progress )( size_t, size_t )     = controller.fav_sync.progress;
+    void      (* done     )( bool, size_t, size_t ) = controller.fav_sync.done;
+
+    if( finished ) {
+        if( !controller.fav_sync.cancelled ) { //i.e.: whatever came back is applied even if some batches failed
+            updated = ctune_Settings.favs.updateStations( &controller.fav_sync.results, CTUNE_STATIONSRC_RADIOBROWSER );
+            missing = ( controller.fav_sync.requested - Vector.size( &controller.fav_sync.results ) );
+
+            if( updated > 0 ) {
+                ctune_Controller_invalidateFavouritesIndex();
+            }
+        }
+
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_Controller_syncFavouritesBatchCb( %p, %p )] Favourites sync %s: %lu updated, %lu not found remotely.",
+                   job, data, ( controller.fav_sync.cancelled ? "cancelled" : ( success ? "complete" : "incomplete" ) ), updated, missing
+        );
+
+        Vector.clear_vector( &controller.fav_sync.results );
+        controller.fav_sync.running = false;
+    }
+
+    pthread_mutex_unlock( &controller.fav_sync.lock );
+
+    if( progress != NULL ) {
+        progress( completed, batches );
+    }
+
+    if( finished && done != NULL ) {
+        done( success, updated, missing );
+    }
+}
+
+/**
+ * [PRIVATE] Submits a batch of the favourites bulk sync (fav_sync lock must be held)
+ * @param uuids Comma separated list of station UUIDs (emptied)
+ */
+static void ctune_Controller_submitFavouritesBatch( String_t * uuids ) {
+    const ctune_JobHandle_t handle = ctune_NetworkJobs.submit( CTUNE_NETWORKJOB_STATIONS_BY_UUIDS,
+                                                               NULL,
+                                                               RADIOBROWSER_STATION_BY_UUID,
+                                                               uuids->_raw,
+                                                               ctune_Controller_syncFavouritesBatchCb,
+                                                               NULL );
+
+    if( handle == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_submitFavouritesBatch( %p )] Failed to submit batch.", uuids );
+        controller.fav_sync.failed = true;
+    } else {
+        ++controller.fav_sync.batches;
+    }
+
+    String.free( uuids );
+}
+
+/**
+ * Synchronises all favourites from RadioBrowser with their remote counterparts in the background
+ * -
+ * UUIDs are batched into bulk lookups that run concurrently on the network job workers. Once
+ * all batches are in, the changes are applied to the favourites in one go.
+ * @param progress Callback called as each batch completes with the number of batches done and the total (can be NULL)
+ * @param done     Callback called once finished with the success state, number of favourites updated and number not found remotely (can be NULL)
+ * @return Number of batches submitted (0: nothing to sync, sync already running or failure)
+ */
+static size_t ctune_Controller_cfg_syncFavourites( void (* progress)( size_t, size_t ), void (* done)( bool, size_t, size_t ) ) {
+    String_t uuids   = String.init();
+    size_t   count   = 0;
+    size_t   batches = 0;
+
+    pthread_mutex_lock( &controller.fav_sync.lock );
+
+    if( controller.fav_sync.running ) {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Controller_cfg_syncFavourites( %p, %p )] Sync already in progress.", progress, done );
+        goto end;
+    }
+
+    controller.fav_sync.running   = true;
+    controller.fav_sync.batches   = 0;
+    controller.fav_sync.completed = 0;
+    controller.fav_sync.requested = 0;
+    controller.fav_sync.failed    = false;
+    controller.fav_sync.cancelled = false;
+    controller.fav_sync.results   = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    controller.fav_sync.progress  = progress;
+    controller.fav_sync.done      = done;
+
+    for( size_t i = 0; i < ctune_Settings.favs.viewSize(); ++i ) {
+        const ctune_RadioStationInfo_t * rsi = ctune_Settings.favs.viewAt( i );
+
+        if( rsi == NULL || ctune_RadioStationInfo.get.stationSource( rsi ) != CTUNE_STATIONSRC_RADIOBROWSER ) {
+            continue;
+        }
+
+        if( count > 0 ) {
+            String.append_back( &uuids, "," );
+        }
+
+        String.append_back( &uuids, ctune_RadioStationInfo.get.stationUUID( rsi ) );
+
+        if( ++count == CTUNE_CONTROLLER_FAV_SYNC_BATCH ) {
+            ctune_Controller_submitFavouritesBatch( &uuids );
+            count = 0;
+        }
+    }
+
+    if( count > 0 ) {
+        ctune_Controller_submitFavouritesBatch( &uuids );
+    }
+
+    if( ( batches = controller.fav_sync.batches ) == 0 ) {
+        Vector.clear_vector( &controller.fav_sync.results );
+        controller.fav_sync.running = false;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Controller_cfg_syncFavourites( %p, %p )] Submitted %lu batch(es).", progress, done, batches );
+
+    end:
+        pthread_mutex_unlock( &controller.fav_sync.lock );
+        String.free( &uuids );
+        return batches;
+}
+
+/**
+ * [PRIVATE] Completion callback for a stream test of the favourites stream check
+ * @param job  Finished network job
+ * @param data Index of the station in the list of stations being checked
+ */
+static void ctune_Controller_checkFavouriteStreamCb( ctune_NetworkJob_t * job, void * data ) {
+    const size_t index     = (size_t) (uintptr_t) data;
+    String_t     timestamp = String.init();
+    String_t     name      = String.init();
+
+    pthread_mutex_lock( &controller.stream_check.lock );
+
+    const ctune_RadioStationInfo_t * rsi = Vector.at( &controller.stream_check.stations, index );
+
+    if( rsi != NULL ) {
+        String.set( &name, ctune_RadioStationInfo.get.stationName( rsi ) );
+    }
+
+    if( atomic_load( &job->cancel ) ) {
+        controller.stream_check.cancelled = true;
+
+    } else if( rsi != NULL ) {
+        ctune_RadioStationInfo_t * copy = Vector.init_back( &controller.stream_check.results, ctune_RadioStationInfo.init );
+
+        if( copy == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_checkFavouriteStreamCb( %p, %p )] Failed to copy station #%lu.", job, data, index );
+
+        } else {
+            ctune_RadioStationInfo.copy( rsi, copy );
+            ctune_timestampISO8601( &timestamp );
+
+            if( job->success ) {
+                if( !String.empty( &job->stream.codec ) ) {
+                    ctune_strupr( job->stream.codec._raw );
+                    ctune_RadioStationInfo.set.codec( copy, strdup( job->stream.codec._raw ) );
+                }
+
+                if( job->stream.bitrate > 0 ) {
+                    ctune_RadioStationInfo.set.bitrate( copy, job->stream.bitrate );
+                }
+
+                ctune_RadioStationInfo.set.lastCheckOkTS( copy, strdup( timestamp._raw ) );
+            }
+
+            ctune_RadioStationInfo.set.lastCheckOK( copy, job->success );
+            ctune_RadioStationInfo.set.lastCheckTS( copy, strdup( timestamp._raw ) );
+            ctune_RadioStationInfo.set.lastLocalCheckTS( copy, strdup( timestamp._raw ) );
+        }
+
+        if( job->success ) {
+            ++controller.stream_check.reachable;
+        } else {
+            ++controller.stream_check.unreachable;
+        }
+
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_Controller_checkFavouriteStreamCb( %p, %p )] \"%s\" (%s): %s, codec: %s, bitrate: %lukbps, latency: %.0fms.",
+                   job, data, name._raw, job->term._raw, ( job->success ? "reachable" : "unreachable" ),
+                   ( String.empty( &job->stream.codec ) ? "?" : job->stream.codec._raw ), job->stream.bitrate, job->stream.latency_ms
+        );
+    }
+
+    const size_t completed   = ++controller.stream_check.completed;
+    const size_t total       = controller.stream_check.submitted;
+    const size_t reachable   = controller.stream_check.reachable;
+    const size_t unreachable = controller.stream_check.unreachable;
+    const bool   finished    = ( completed == total );
+    const bool   success     = !( controller.stream_check.cancelled );
+    void      (* progress )( size_t, size_t, const char *, const ctune_NetworkJob_t * ) = controller.stream_check.progress;
+    void      (* done     )( bool, size_t, size_t )                                     = controller.stream_check.done;
+
+    if( finished ) {
+        if( !Vector.empty( &controller.stream_check.results ) ) { //i.e.: whatever was checked is applied even when cancelled
+            if( ctune_Settings.favs.updateStations( &controller.stream_check.results, CTUNE_STATIONSRC_LOCAL ) > 0 ) {
+                ctune_Controller_invalidateFavouritesIndex();
+            }
+        }
+
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_Controller_checkFavouriteStreamCb( %p, %p )] Stream check %s: %lu reachable, %lu unreachable.",
+                   job, data, ( success ? "complete" : "cancelled" ), reachable, unreachable
+        );
+
+        Vector.clear_vector( &controller.stream_check.stations );
+        Vector.clear_vector( &controller.stream_check.results );
+        controller.stream_check.running = false;
+    }
+
+    pthread_mutex_unlock( &controller.stream_check.lock );
+
+    if( progress != NULL ) {
+        progress( completed, total, name._raw, job );
+    }
+
+    if( finished && done != NULL ) {
+        done( success, reachable, unreachable );
+    }
+
+    String.free( &timestamp );
+    String.free( &name );
+}
+
+/**
+ * Checks the streams of all local favourites in the background
+ * -
+ * Each stream is probed as a bulk job on the network job workers so that several stations are checked
+ * concurrently without holding up searches. Once all are in, the check results (reachability, codec,
+ * bitrate and timestamps) are applied to the favourites in one go.
+ * @param progress Callback called as each stream test completes with the number done, the total, the station name and the finished job (can be NULL)
+ * @param done     Callback called once finished with the success state and the number of reachable and unreachable streams (can be NULL)
+ * @return Number of stream tests submitted (0: nothing to check, check already running or failure)
+ */
+static size_t ctune_Controller_cfg_checkFavouriteStreams( void (* progress)( size_t, size_t, const char *, const ctune_NetworkJob_t * ),
+                                                          void (* done)( bool, size_t, size_t ) ) {
+    size_t submitted = 0;
+
+    pthread_mutex_lock( &controller.stream_check.lock );
+
+    if( controller.stream_check.running ) {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Controller_cfg_checkFavouriteStreams( %p, %p )] Check already in progress.", progress, done );
+        goto end;
+    }
+
+    controller.stream_check.running     = true;
+    controller.stream_check.submitted   = 0;
+    controller.stream_check.completed   = 0;
+    controller.stream_check.reachable   = 0;
+    controller.stream_check.unreachable = 0;
+    controller.stream_check.cancelled   = false;
+    controller.stream_check.stations    = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    controller.stream_check.results     = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    controller.stream_check.progress    = progress;
+    controller.stream_check.done        = done;
+
+    for( size_t i = 0; i < ctune_Settings.favs.viewSize(); ++i ) {
+        const ctune_RadioStationInfo_t * rsi = ctune_Settings.favs.viewAt( i );
+
+        if( rsi == NULL || ctune_RadioStationInfo.get.stationSource( rsi ) != CTUNE_STATIONSRC_LOCAL ) {
+            continue;
+        }
+
+        ctune_RadioStationInfo_t * copy = Vector.init_back( &controller.stream_check.stations, ctune_RadioStationInfo.init );
+
+        if( copy == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_cfg_checkFavouriteStreams( %p, %p )] Failed to copy station #%lu.", progress, done, i );
+            break;
+        }
+
+        ctune_RadioStationInfo.copy( rsi, copy );
+    }
+
+    for( size_t i = 0; i < Vector.size( &controller.stream_check.stations ); ++i ) {
+        const ctune_RadioStationInfo_t * rsi = Vector.at( &controller.stream_check.stations, i );
+        const char                     * url = ctune_RadioStationInfo.get.resolvedURL( rsi );
+
+        if( url == NULL || strlen( url ) == 0 ) {
+            url = ctune_RadioStationInfo.get.stationURL( rsi );
+        }
+
+        if( url == NULL || strlen( url ) == 0 ) {
+            continue;
+        }
+
+        const ctune_JobHandle_t handle = ctune_NetworkJobs.submit( CTUNE_NETWORKJOB_STREAM_TEST_BULK,
+                                                                   NULL,
+                                                                   0,
+                                                                   url,
+                                                                   ctune_Controller_checkFavouriteStreamCb,
+                                                                   (void *) (uintptr_t) i );
+
+        if( handle == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Controller_cfg_checkFavouriteStreams( %p, %p )] Failed to submit stream test: %s", progress, done, url );
+        } else {
+            ++controller.stream_check.submitted;
+        }
+    }
+
+    if( ( submitted = controller.stream_check.submitted ) == 0 ) {
+        Vector.clear_vector( &controller.stream_check.stations );
+        Vector.clear_vector( &controller.stream_check.results );
+        controller.stream_check.running = false;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Controller_cfg_checkFavouriteStreams( %p, %p )] Submitted %lu stream test(s).", progress, done, submitted );
+
+    end:
+        pthread_mutex_unlock( &controller.stream_check.lock );
+        return submitted;
+}
+
 /**
  * Check if a station is in the list of favourites
  * @param rsi RadioStationInfo_t object
@@ -622,6 +1904,14 @@ static bool ctune_Controller_cfg_isFavouriteUUID( const char * uuid, ctune_Stati
     return ctune_Settings.favs.isFavourite( uuid, src );
 }
 
+/**
+ * Gets the generation of the favourites list (changes whenever a station is added to or removed from it)
+ * @return Generation number
+ */
+static uint64_t ctune_Controller_cfg_favouritesGeneration( void ) {
+    return ctune_Settings.favs.generation();
+}
+
 /**
  * Saves the favourite stations to file
  * @return Success
@@ -702,6 +1992,8 @@ static bool ctune_Controller_cfg_setStreamTimeout( int seconds ) {
  * @return Success
  */
 static bool ctune_Controller_plugin_changePlugin( ctune_PluginType_e type, size_t id ) {
+    ctune_Controller_initAudio(); //so that a deferred init does not race the selection change
+
     switch( type ) {
         case CTUNE_PLUGIN_IN_STREAM_PLAYER: //fallthrough
         case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
@@ -795,22 +2087,33 @@ static void ctune_Controller_setSearchStateChangeEvent_cb( void(* cb)( bool ) )
     controller.cb.search_state_change_cb = cb;
 }
 
+/**
+ * [OPTIONAL] Assigns a function to hand over finished background searches to the thread that must complete them
+ * @param cb Callback function pointer (NULL: searches are completed on the worker threads)
+ */
+static void ctune_Controller_setSearchJobCompleteEvent_cb( void(* cb)( ctune_NetworkJob_t * ) ) {
+    ctune_NetworkJobs.setCompletionCallback( cb );
+}
+
 
 /**
  * Constructor
  */
 const struct ctune_Controller_Instance ctune_Controller = {
-    .init     = &ctune_Controller_init,
-    .load     = &ctune_Controller_load,
-    .resizeUI = &ctune_Controller_resizeUI,
-    .free     = &ctune_Controller_free,
+    .init         = &ctune_Controller_init,
+    .initAudio    = &ctune_Controller_initAudio,
+    .probeMirrors = &ctune_Controller_probeMirrors,
+    .load         = &ctune_Controller_load,
+    .resizeUI     = &ctune_Controller_resizeUI,
+    .free         = &ctune_Controller_free,
 
     .playback = {
         .getPlaybackState    = &ctune_Controller_playback_getPlaybackState,
         .start               = &ctune_Controller_playback_startPlayback,
         .stop                = &ctune_Controller_playback_stopPlayback,
         .modifyVolume        = &ctune_Controller_playback_modifyVolume,
-        .testStream          = &ctune_Controller_playback_testStream,
+        .testStreamAsync     = &ctune_Controller_playback_testStreamAsync,
+        .cancelStreamTest    = &ctune_Controller_playback_cancelStreamTest,
         .validateURL         = &ctune_Controller_playback_validateURL,
     },
 
@@ -825,14 +2128,24 @@ const struct ctune_Controller_Instance ctune_Controller = {
     .search = {
       .getStations           = &ctune_Controller_search_getStations,
       .getStationsBy         = &ctune_Controller_search_getStationsBy,
+      .getStationsAsync      = &ctune_Controller_search_getStationsAsync,
+      .getStationsByAsync    = &ctune_Controller_search_getStationsByAsync,
+      .cancel                = &ctune_Controller_search_cancel,
+      .cancelAll             = &ctune_Controller_search_cancelAll,
+      .pending               = &ctune_Controller_search_pending,
+      .complete              = &ctune_Controller_search_complete,
       .getCategoryItems      = &ctune_Controller_search_getCategoryItems,
+      .quickSearch           = &ctune_Controller_search_quickSearch,
     },
 
     .cfg = {
         .toggleFavourite     = &ctune_Controller_cfg_toggleFavourite,
         .updateFavourite     = &ctune_Controller_cfg_updateFavourite,
+        .syncFavourites      = &ctune_Controller_cfg_syncFavourites,
+        .checkFavouriteStreams = &ctune_Controller_cfg_checkFavouriteStreams,
         .isFavourite         = &ctune_Controller_cfg_isFavourite,
         .isFavouriteUUID     = &ctune_Controller_cfg_isFavouriteUUID,
+        .favouritesGeneration = &ctune_Controller_cfg_favouritesGeneration,
         .saveFavourites      = &ctune_Controller_cfg_saveFavourites,
         .getListOfFavourites = &ctune_Controller_cfg_updateFavourites,
         .setFavouriteSorting = &ctune_Controller_cfg_setFavouriteSorting,
@@ -854,4 +2167,5 @@ const struct ctune_Controller_Instance ctune_Controller = {
     .setStationChangeEventCallback       = &ctune_Controller_setStationChangeEventCallback,
     .setPlaybackStateChangeEventCallback = &ctune_Controller_setPlaybackStateChangeEvent_cb,
     .setSearchStateChangeEventCallback   = &ctune_Controller_setSearchStateChangeEvent_cb,
+    .setSearchJobCompleteEventCallback   = &ctune_Controller_setSearchJobCompleteEvent_cb,
 };
\ No newline at end of file
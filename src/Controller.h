@@ -15,6 +15,7 @@
 #include "enum/SearchCtrl.h"
 #include "enum/ByCategory.h"
 #include "enum/ListCategory.h"
+#include "network/NetworkJobs.h"
 
 extern const struct ctune_Controller_Instance {
     /**
@@ -23,6 +24,18 @@ extern const struct ctune_Controller_Instance {
      */
     bool (* init)( void );
 
+    /**
+     * [THREAD SAFE] Links and initialises the selected sound server and player plugins (once)
+     * @return Success
+     */
+    bool (* initAudio)( void );
+
+    /**
+     * Probes the RadioBrowser API mirrors' latency and saves the results (blocking)
+     * @return Number of mirrors that responded
+     */
+    size_t (* probeMirrors)( void );
+
     /**
      * Loads controller level options and act on these
      * @param opts Options
@@ -68,13 +81,19 @@ extern const struct ctune_Controller_Instance {
         void (* modifyVolume)( int delta );
 
         /**
-         * Test a stream and get properties
-         * @param url     Stream URL
-         * @param codec   Pointer to store codec string value into
-         * @param bitrate Pointer to store bitrate value into
-         * @return Success
+         * [THREAD SAFE] Tests a stream and gets its properties in the background
+         * @param url  Stream URL
+         * @param cb   Completion callback (`job->success`: stream OK, `job->stream`: probed properties)
+         * @param data Data pointer to pass to the callback
+         * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure)
+         */
+        ctune_JobHandle_t (* testStreamAsync)( const char * url, ctune_NetworkJob_Callback_f cb, void * data );
+
+        /**
+         * [THREAD SAFE] Cancels a background stream test (its callback will not be called)
+         * @param handle Job handle
          */
-        bool (* testStream)( const char * url, String_t * codec, ulong * bitrate );
+        void (* cancelStreamTest)( ctune_JobHandle_t handle );
 
         /**
          * Tests the validity of a URL string
@@ -143,6 +162,48 @@ extern const struct ctune_Controller_Instance {
          */
         bool (* getStationsBy)( const ctune_ByCategory_e category, const char * search_term, Vector_t * stations );
 
+        /**
+         * [THREAD SAFE] Search in the background for all stations matching the criteria in filter
+         * @param filter Filter (copied)
+         * @param cb     Completion callback (called on the thread completing the search jobs)
+         * @param data   Data pointer to pass to the callback
+         * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure)
+         */
+        ctune_JobHandle_t (* getStationsAsync)( const ctune_RadioBrowserFilter_t * filter, ctune_NetworkJob_Callback_f cb, void * data );
+
+        /**
+         * [THREAD SAFE] Search in the background for all stations matching the criteria
+         * @param category    Category
+         * @param search_term Search term (optional; copied)
+         * @param cb          Completion callback (called on the thread completing the search jobs)
+         * @param data        Data pointer to pass to the callback
+         * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure)
+         */
+        ctune_JobHandle_t (* getStationsByAsync)( const ctune_ByCategory_e category, const char * search_term, ctune_NetworkJob_Callback_f cb, void * data );
+
+        /**
+         * [THREAD SAFE] Cancels a background search (its callback will not be called)
+         * @param handle Job handle
+         */
+        void (* cancel)( ctune_JobHandle_t handle );
+
+        /**
+         * [THREAD SAFE] Aborts all background searches and their in-flight transfers (callbacks are called with the failed job)
+         */
+        void (* cancelAll)( void );
+
+        /**
+         * [THREAD SAFE] Gets the number of background searches queued or running
+         * @return Number of searches
+         */
+        size_t (* pending)( void );
+
+        /**
+         * Completes a finished background search by calling its callback(s) (call from the thread that should run them)
+         * @param job Finished job as passed to the search job completion callback
+         */
+        void (* complete)( ctune_NetworkJob_t * job );
+
         /**
          * Download items within a specified category
          * @param category       Category for which to download items from
@@ -151,6 +212,18 @@ extern const struct ctune_Controller_Instance {
          */
         bool (* getCategoryItems)( const ctune_ListCategory_e category, const ctune_RadioBrowserFilter_t * filter, Vector_t * categories );
 
+        /**
+         * Searches the locally known stations (favourites and catalogue) by name, tags, country, language and codec
+         * -
+         * Note: UI thread only as a stale favourites index is rebuilt from the (unsynchronised) favourites view
+         * @param text        Free-text search (prefix and typo tolerant)
+         * @param limit       Maximum number of stations to get
+         * @param stations    Container for the best matching stations ordered by relevance
+         * @param match_count Pointer to store the total number of matches into (can be NULL)
+         * @return Success
+         */
+        bool (* quickSearch)( const char * text, size_t limit, Vector_t * stations, size_t * match_count );
+
     } search;
 
     /**
@@ -173,6 +246,27 @@ extern const struct ctune_Controller_Instance {
          */
         bool (* updateFavourite)( ctune_RadioStationInfo_t * rsi, ctune_StationSrc_e src );
 
+        /**
+         * Synchronises all favourites from RadioBrowser with their remote counterparts in the background
+         * -
+         * The callbacks are called on the thread completing the search jobs.
+         * @param progress Callback called as each batch completes with the number of batches done and the total (can be NULL)
+         * @param done     Callback called once finished with the success state, number of favourites updated and number not found remotely (can be NULL)
+         * @return Number of batches submitted (0: nothing to sync, sync already running or failure)
+         */
+        size_t (* syncFavourites)( void (* progress)( size_t done, size_t total ), void (* done)( bool success, size_t updated, size_t missing ) );
+
+        /**
+         * Checks the streams of all local favourites concurrently in the background and records the results
+         * -
+         * The callbacks are called on the thread completing the network jobs.
+         * @param progress Callback called as each stream test completes with the number done, the total, the station name and the finished job (can be NULL)
+         * @param done     Callback called once finished with the success state and the number of reachable and unreachable streams (can be NULL)
+         * @return Number of stream tests submitted (0: nothing to check, check already running or failure)
+         */
+        size_t (* checkFavouriteStreams)( void (* progress)( size_t done, size_t total, const char * name, const ctune_NetworkJob_t * job ),
+                                          void (* done)( bool success, size_t reachable, size_t unreachable ) );
+
         /**
          * Check if a station is in the list of favourites
          * @param rsi RadioStationInfo_t object
@@ -189,6 +283,12 @@ extern const struct ctune_Controller_Instance {
          */
         bool (* isFavouriteUUID)( const char * uuid, ctune_StationSrc_e src );
 
+        /**
+         * Gets the generation of the favourites list (changes whenever a station is added to or removed from it)
+         * @return Generation number
+         */
+        uint64_t (* favouritesGeneration)( void );
+
         /**
          * Saves the favourite stations to file
          * @return Success
@@ -296,6 +396,12 @@ extern const struct ctune_Controller_Instance {
      */
     void (* setSearchStateChangeEventCallback)( void(* cb)( bool ) );
 
+    /**
+     * [OPTIONAL] Assigns a function to hand over finished background searches to the thread that must complete them
+     * @param cb Callback function pointer (NULL: searches are completed on the worker threads)
+     */
+    void (* setSearchJobCompleteEventCallback)( void(* cb)( ctune_NetworkJob_t * ) );
+
 } ctune_Controller;
 
 #endif //CTUNE_UI_CONTROLLER_H
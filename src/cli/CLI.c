@@ -113,8 +113,11 @@ static const char * ctune_CLI_usage() {
                                     "   -f  --favourite      add station to favourites when used in conjunction with \"--play\"\n"
                                     "   -h  --help           display this help and exits\n"
                                     "   -p  --play \"UUID\"    plays the radio stream matching the RadioBrowser UUID\n"
+                                    "       --profile-startup\n"
+                                    "                        prints the duration of each startup stage on exit\n"
                                     "   -r  --resume         resumes station playback of the last session\n"
                                     "       --show-cursor    always visible cursor\n"
+                                    "       --trace          records trace messages in binary to \"ctune.trace\" (implies \"--debug\")\n"
                                     "   -v  --version        prints version information and exits\n";
     return usage_fmt;
 }
@@ -159,12 +162,18 @@ static bool ctune_CLI_parse( int argc, char *argv[], Vector_t * opts ) {
         } else if( strcmp( argv[i], "--debug" ) == 0 ) {
             curr_arg = CTUNE_CLI_ARG_DEBUG;
 
+        } else if( strcmp( argv[i], "--profile-startup" ) == 0 ) {
+            curr_arg = CTUNE_CLI_ARG_PROFILE_STARTUP;
+
         } else if( strcmp( argv[i], "--resume" ) == 0 || strcmp( argv[i], "-r" ) == 0 ) {
             curr_arg = CTUNE_CLI_ARG_RESUME_PLAYBACK;
 
         } else if( strcmp( argv[i], "--show-cursor" ) == 0 ) {
             curr_arg = CTUNE_CLI_ARG_SHOW_CURSOR;
 
+        } else if( strcmp( argv[i], "--trace" ) == 0 ) {
+            curr_arg = CTUNE_CLI_ARG_TRACE;
+
         } else if( strcmp( argv[i], "--version" ) == 0 || strcmp( argv[i], "-v" ) == 0 ) {
             curr_arg = CTUNE_CLI_ARG_VERSION;
 
@@ -250,8 +259,10 @@ static enum CTUNE_CLI_STATES ctune_CLI_processArgs( int argc, char * argv[] ) {
             case CTUNE_CLI_ARG_DEBUG:           //fallthrough
             case CTUNE_CLI_ARG_FAVOURITE:       //fallthrough
             case CTUNE_CLI_ARG_PLAY:            //fallthrough
+            case CTUNE_CLI_ARG_PROFILE_STARTUP: //fallthrough
             case CTUNE_CLI_ARG_RESUME_PLAYBACK: //fallthrough
-            case CTUNE_CLI_ARG_SHOW_CURSOR: {
+            case CTUNE_CLI_ARG_SHOW_CURSOR:     //fallthrough
+            case CTUNE_CLI_ARG_TRACE: {
                 ctune_ArgOption_t * el = Vector.emplace_back( &cli.actionable_options );
 
                 if( el != NULL ) {
@@ -16,8 +16,10 @@ enum CTUNE_CLI_ARG {
     CTUNE_CLI_ARG_FAVOURITE,
     CTUNE_CLI_ARG_HELP,
     CTUNE_CLI_ARG_PLAY,
+    CTUNE_CLI_ARG_PROFILE_STARTUP,
     CTUNE_CLI_ARG_RESUME_PLAYBACK,
     CTUNE_CLI_ARG_SHOW_CURSOR,
+    CTUNE_CLI_ARG_TRACE,
     CTUNE_CLI_ARG_VERSION,
 };
 
@@ -7,57 +7,46 @@
 
 #include "Vector.h"
 
-enum NodeColour {
-    BLACK = 0,
-    RED   = 1
-};
+#define HASHMAP_INIT_CAPACITY   16   //must be a power of 2 and >= HASHMAP_GROUP_WIDTH
+#define HASHMAP_MAX_LOAD_FACTOR 0.85
+#define HASHMAP_GROUP_WIDTH     16   //number of control bytes matched per probe step (SSE2 register width)
+#define HASHMAP_CTRL_EMPTY      0x80 //control byte of an empty slot (tags are 7 bits)
 
 /**
- * Bucket Item (linked-list nodes for collision purposes)
- * @param value Pointer to stored value
- * @param next  Pointer to next item in linked list
+ * Slot (open-addressing table cell)
+ * @param hashkey  Hashed item key
+ * @param distance Probe sequence length + 1 from the slot's ideal position (0 = empty slot)
+ * @param value    Pointer to stored value
  */
-typedef struct BucketItem {
-    void              * value;
-    struct BucketItem * next;
+typedef struct HashMapSlot {
+    uint64_t   hashkey;
+    uint32_t   distance;
+    void     * value;
 
-} BucketItem_t;
+} HashMapSlot_t;
 
 /**
- * Tree Node/Bucket
- * @param hashkey     Hashed item key
- * @param node_type   Node colour
- * @param parent      Node's parent
- * @param child_left  Left child node
- * @param child_right Right child node
- * @param items       Front pointer to linked list of bucket items where values matching the hashed key are stored
- * @param count       Item count of linked list
- */
-typedef struct Bucket {
-    uint64_t            hashkey;
-    enum NodeColour     colour;
-    struct Bucket     * parent;
-    struct Bucket     * child_left;
-    struct Bucket     * child_right;
-    struct BucketItem * items;
-    size_t              count;
-
-} Bucket_t;
-
-/**
- * HashMap object
- * @param _root       Root of the Red-Black tree data-structure used for the HashMap's buckets
- * @param _item_count Keeps track of the number of values stored in the data-structure
- * @param _node_count Keeps track of the number of buckets stored in the data-structure
+ * HashMap object (Robin Hood open-addressing hash table)
+ * -
+ * Each slot has a control byte holding a 7-bit tag of its hash (or `HASHMAP_CTRL_EMPTY`) in a separate
+ * array so that lookups can match a whole group of slots at once. The first `HASHMAP_GROUP_WIDTH - 1`
+ * control bytes are mirrored past the end of the array so that a group never needs to wrap around.
+ * @param _slots        Contiguous array of slots
+ * @param _ctrl         Control bytes (capacity + `HASHMAP_GROUP_WIDTH - 1`)
+ * @param _capacity     Number of slots allocated (power of 2 or 0 when not yet allocated)
+ * @param _item_count   Keeps track of the number of values stored in the data-structure
+ * @param _max_distance Upper bound of the slot distances in the table (only reset on re-hashing)
  * @param free_fn     Callback method to use for de-allocating value from map
  * @param copy_fn     Callback method to use for copying value to map
  * @param hash_fn     Callback method to use for hashing a value's key
  * @param equal_fn    Callback method to use for checking equivalence in a value and its key
  */
 typedef struct HashMap {
-    Bucket_t * _root;
-    size_t     _item_count;
-    size_t     _node_count;
+    HashMapSlot_t * _slots;
+    uint8_t       * _ctrl;
+    size_t          _capacity;
+    size_t          _item_count;
+    uint32_t        _max_distance;
 
     void     (* free_fn)( void * el );
     void *   (* copy_fn)( const void * el );
@@ -136,6 +125,14 @@ extern const struct ctune_HashMap_Namespace {
      */
     size_t (* export)( const HashMap_t * map, Vector_t * vector, void (* init_fn)( void * ), void (* cp_fn)( const void *, void * ) );
 
+    /**
+     * Calls a function on each of the values stored in the HashMap (in no particular order)
+     * @param map HashMap_t object
+     * @param fn  Function to call on each value (must not modify the map)
+     * @param arg Argument passed to each call of the function
+     */
+    void (* forEach)( const HashMap_t * map, void (* fn)( void * value, void * arg ), void * arg );
+
 } HashMap;
 
-#endif //CTUNE_DATASTRUCTURE_HASHMAP_H
\ No newline at end of file
+#endif //CTUNE_DATASTRUCTURE_HASHMAP_H
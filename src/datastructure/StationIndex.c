@@ -0,0 +1,771 @@
+#include "StationIndex.h"
+
+#include <string.h>
+#include <ctype.h>
+
+#include "logger/src/Logger.h"
+
+#define CTUNE_STATIONINDEX_MATCH_EXACT  4
+#define CTUNE_STATIONINDEX_MATCH_PREFIX 2
+#define CTUNE_STATIONINDEX_MATCH_FUZZY  1
+
+/**
+ * [PRIVATE] Build-time token occurrence
+ * @param str    Pointer to the token string (set once the pool stops growing)
+ * @param offset Offset of the token string in the pool
+ * @param doc    Station ID
+ * @param field  Field flag (ctune_StationIndex_Field_e)
+ */
+struct ctune_StationIndex_Entry {
+    const char * str;
+    size_t       offset;
+    uint32_t     doc;
+    uint8_t      field;
+};
+
+/**
+ * [PRIVATE] Dictionary term
+ * @param offset     Offset of the token string in the pool
+ * @param length     Length of the token string
+ * @param post_begin Index of the first posting for the term
+ * @param post_count Number of postings for the term
+ */
+struct ctune_StationIndex_Term {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t post_begin;
+    uint32_t post_count;
+};
+
+/**
+ * [PRIVATE] Posting
+ * @param doc    Station ID
+ * @param fields Bit-field of the ctune_StationIndex_Field_e the term appears in
+ */
+struct ctune_StationIndex_Posting {
+    uint32_t doc;
+    uint8_t  fields;
+};
+
+/**
+ * [PRIVATE] Ensures an array has capacity for a number of elements
+ * @param arr       Pointer to the array pointer
+ * @param capacity  Pointer to the array capacity
+ * @param required  Required number of elements
+ * @param elem_size Size of an element
+ * @return Success
+ */
+static bool ctune_StationIndex_reserve( void ** arr, size_t * capacity, size_t required, size_t elem_size ) {
+    if( required <= *capacity ) {
+        return true; //EARLY RETURN
+    }
+
+    size_t new_capacity = ( *capacity == 0 ? 64 : *capacity );
+
+    while( new_capacity < required ) {
+        new_capacity *= 2;
+    }
+
+    void * tmp = realloc( *arr, new_capacity * elem_size );
+
+    if( tmp == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    *arr      = tmp;
+    *capacity = new_capacity;
+    return true;
+}
+
+/**
+ * [PRIVATE] Checks if a byte is part of a token (ASCII alphanumerics and any multi-byte UTF-8 sequence)
+ * @param c Byte
+ * @return Token state
+ */
+static inline bool ctune_StationIndex_isTokenChar( unsigned char c ) {
+    return ( c >= 0x80 || isalnum( c ) );
+}
+
+/**
+ * [PRIVATE] Extracts the next normalised (lowercase) token from a string
+ * @param cursor Pointer to the current position in the string (moved past the token)
+ * @param token  Buffer for the token (size: `CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH + 1`)
+ * @return Length of the token (0 when there are no more tokens)
+ */
+static size_t ctune_StationIndex_nextToken( const char ** cursor, char * token ) {
+    const unsigned char * c      = (const unsigned char *) *cursor;
+    size_t                length = 0;
+
+    while( *c != '\0' && !ctune_StationIndex_isTokenChar( *c ) ) {
+        ++c;
+    }
+
+    for( ; *c != '\0' && ctune_StationIndex_isTokenChar( *c ); ++c ) {
+        if( length < CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH ) {
+            token[ length++ ] = (char) ( *c < 0x80 ? tolower( *c ) : *c );
+        }
+    }
+
+    //don't leave a truncated multi-byte UTF-8 sequence dangling
+    if( length == CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH ) {
+        size_t i = length;
+
+        while( i > 0 && ( (unsigned char) token[ i - 1 ] & 0xC0 ) == 0x80 ) {
+            --i;
+        }
+
+        if( i > 0 && (unsigned char) token[ i - 1 ] >= 0xC0 ) {
+            length = i - 1;
+        }
+    }
+
+    token[ length ] = '\0';
+    *cursor         = (const char *) c;
+
+    return length;
+}
+
+/**
+ * [PRIVATE] Tokenises a field and stores its token occurrences
+ * @param index Pointer to StationIndex object
+ * @param doc   Station ID
+ * @param field Field flag
+ * @param str   Field string (can be NULL)
+ * @return Success
+ */
+static bool ctune_StationIndex_addField( ctune_StationIndex_t * index, uint32_t doc, ctune_StationIndex_Field_e field, const char * str ) {
+    if( str == NULL ) {
+        return true; //EARLY RETURN
+    }
+
+    char   token[ CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH + 1 ];
+    size_t length = 0;
+
+    while( ( length = ctune_StationIndex_nextToken( &str, token ) ) > 0 ) {
+        if( !ctune_StationIndex_reserve( (void **) &index->pool.buffer, &index->pool.capacity, ( index->pool.size + length + 1 ), sizeof( char ) ) ||
+            !ctune_StationIndex_reserve( (void **) &index->entries.arr, &index->entries.capacity, ( index->entries.size + 1 ), sizeof( struct ctune_StationIndex_Entry ) ) )
+        {
+            return false; //EARLY RETURN
+        }
+
+        memcpy( &index->pool.buffer[ index->pool.size ], token, ( length + 1 ) );
+
+        index->entries.arr[ index->entries.size++ ] = (struct ctune_StationIndex_Entry) {
+            .str    = NULL,
+            .offset = index->pool.size,
+            .doc    = doc,
+            .field  = (uint8_t) field,
+        };
+
+        index->pool.size += ( length + 1 );
+    }
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Comparator for the build-time token occurrences (token, station)
+ * @param lhs Pointer to an entry
+ * @param rhs Pointer to an entry
+ * @return Comparison result
+ */
+static int ctune_StationIndex_compareEntries( const void * lhs, const void * rhs ) {
+    const struct ctune_StationIndex_Entry * a = lhs;
+    const struct ctune_StationIndex_Entry * b = rhs;
+
+    const int cmp = strcmp( a->str, b->str );
+
+    if( cmp != 0 ) {
+        return cmp;
+    }
+
+    return ( a->doc < b->doc ? -1 : ( a->doc > b->doc ? 1 : 0 ) );
+}
+
+/**
+ * [PRIVATE] Gets the relevance weight of the most significant field in a field mask
+ * @param fields Bit-field of ctune_StationIndex_Field_e
+ * @return Weight
+ */
+static inline uint16_t ctune_StationIndex_fieldWeight( uint8_t fields ) {
+    if( fields & CTUNE_STATIONINDEX_FIELD_NAME ) {
+        return 8;
+    }
+
+    if( fields & CTUNE_STATIONINDEX_FIELD_TAGS ) {
+        return 4;
+    }
+
+    if( fields & ( CTUNE_STATIONINDEX_FIELD_COUNTRY | CTUNE_STATIONINDEX_FIELD_LANGUAGE ) ) {
+        return 2;
+    }
+
+    return 1;
+}
+
+/**
+ * [PRIVATE] Gets the string of a dictionary term
+ * @param index Pointer to StationIndex object
+ * @param term  Index of the term
+ * @return Term string
+ */
+static inline const char * ctune_StationIndex_termStr( const ctune_StationIndex_t * index, size_t term ) {
+    return &index->pool.buffer[ index->terms.arr[ term ].offset ];
+}
+
+/**
+ * [PRIVATE] Finds the first term not less than a string
+ * @param index Pointer to StationIndex object
+ * @param str   String
+ * @return Term index (`terms.size` when all terms are less)
+ */
+static size_t ctune_StationIndex_lowerBound( const ctune_StationIndex_t * index, const char * str ) {
+    size_t lo = 0;
+    size_t hi = index->terms.size;
+
+    while( lo < hi ) {
+        const size_t mid = lo + ( hi - lo ) / 2;
+
+        if( strcmp( ctune_StationIndex_termStr( index, mid ), str ) < 0 ) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * [PRIVATE] Computes the smallest edit distance (optimal string alignment) between a query token and any prefix of a term
+ * @param query        Query token
+ * @param query_length Length of the query token
+ * @param term         Term
+ * @param term_length  Length of the term
+ * @param max_distance Distance after which to stop computing
+ * @return Distance (> `max_distance` when out of bounds)
+ */
+static int ctune_StationIndex_prefixDistance( const char * query, size_t query_length, const char * term, size_t term_length, int max_distance ) {
+    int rows[3][ CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH + 1 ];
+    int * pprev = rows[0];
+    int * prev  = rows[1];
+    int * curr  = rows[2];
+
+    for( size_t i = 0; i <= query_length; ++i ) {
+        prev[i] = (int) i;
+    }
+
+    int best = prev[ query_length ];
+
+    for( size_t j = 1; j <= term_length && j <= ( query_length + (size_t) max_distance ); ++j ) {
+        int row_min = curr[0] = (int) j;
+
+        for( size_t i = 1; i <= query_length; ++i ) {
+            const int cost = ( query[ i - 1 ] == term[ j - 1 ] ? 0 : 1 );
+            int       d    = prev[ i - 1 ] + cost;
+
+            if( prev[i] + 1 < d ) {
+                d = prev[i] + 1;
+            }
+
+            if( curr[ i - 1 ] + 1 < d ) {
+                d = curr[ i - 1 ] + 1;
+            }
+
+            if( i > 1 && j > 1 && query[ i - 1 ] == term[ j - 2 ] && query[ i - 2 ] == term[ j - 1 ] && pprev[ i - 2 ] + 1 < d ) {
+                d = pprev[ i - 2 ] + 1; //transposition
+            }
+
+            curr[i] = d;
+
+            if( d < row_min ) {
+                row_min = d;
+            }
+        }
+
+        if( curr[ query_length ] < best ) {
+            best = curr[ query_length ];
+        }
+
+        if( row_min > max_distance ) {
+            break;
+        }
+
+        int * tmp = pprev;
+        pprev = prev;
+        prev  = curr;
+        curr  = tmp;
+    }
+
+    return best;
+}
+
+/**
+ * [PRIVATE] Accumulates the scores of a term's postings for a query token
+ * @param index   Pointer to StationIndex object
+ * @param term    Term index
+ * @param match   Match type weight (CTUNE_STATIONINDEX_MATCH_*)
+ * @param round   Query token index
+ * @param touched Pointer to the count of stations that matched the query token so far
+ */
+static void ctune_StationIndex_scoreTerm( ctune_StationIndex_t * index, size_t term, uint16_t match, uint8_t round, size_t * touched ) {
+    const struct ctune_StationIndex_Term    * t          = &index->terms.arr[ term ];
+    const struct ctune_StationIndex_Posting * posting    = &index->postings.arr[ t->post_begin ];
+    const struct ctune_StationIndex_Posting * end        = posting + t->post_count;
+    const uint32_t                            generation = index->scratch.current;
+
+    for( ; posting != end; ++posting ) {
+        const uint32_t doc = posting->doc;
+
+        if( index->scratch.generation[ doc ] != generation ) {
+            if( round != 0 ) {
+                continue; //missed a previous query token
+            }
+
+            index->scratch.generation[ doc ] = generation;
+            index->scratch.round[ doc ]      = 0;
+            index->scratch.score[ doc ]      = 0;
+        }
+
+        const uint16_t score = (uint16_t) ( ctune_StationIndex_fieldWeight( posting->fields ) * match );
+
+        if( index->scratch.round[ doc ] == round ) { //first match for this query token
+            index->scratch.round[ doc ]         = (uint8_t) ( round + 1 );
+            index->scratch.best[ doc ]          = score;
+            index->scratch.score[ doc ]        += score;
+            index->scratch.touched[ (*touched)++ ] = doc;
+
+        } else if( index->scratch.round[ doc ] == ( round + 1 ) && score > index->scratch.best[ doc ] ) {
+            index->scratch.score[ doc ] += ( score - index->scratch.best[ doc ] );
+            index->scratch.best[ doc ]   = score;
+        }
+    }
+}
+
+/**
+ * [PRIVATE] Checks if a station ranks before another in the results
+ * @param index Pointer to StationIndex object
+ * @param a     Station ID
+ * @param b     Station ID
+ * @return `a` ranks before `b`
+ */
+static inline bool ctune_StationIndex_ranksBefore( const ctune_StationIndex_t * index, uint32_t a, uint32_t b ) {
+    if( index->scratch.score[ a ] != index->scratch.score[ b ] ) {
+        return ( index->scratch.score[ a ] > index->scratch.score[ b ] );
+    }
+
+    if( index->docs.arr[ a ].rank != index->docs.arr[ b ].rank ) {
+        return ( index->docs.arr[ a ].rank > index->docs.arr[ b ].rank );
+    }
+
+    return ( a < b );
+}
+
+/**
+ * [PRIVATE] Restores the heap property downwards from a node of a heap where the root ranks last
+ * @param index Pointer to StationIndex object
+ * @param heap  Heap array
+ * @param size  Heap size
+ * @param i     Node index
+ */
+static void ctune_StationIndex_siftDown( const ctune_StationIndex_t * index, uint32_t * heap, size_t size, size_t i ) {
+    for( ;; ) {
+        const size_t left  = ( 2 * i + 1 );
+        const size_t right = ( 2 * i + 2 );
+        size_t       last  = i;
+
+        if( left < size && ctune_StationIndex_ranksBefore( index, heap[ last ], heap[ left ] ) ) {
+            last = left;
+        }
+
+        if( right < size && ctune_StationIndex_ranksBefore( index, heap[ last ], heap[ right ] ) ) {
+            last = right;
+        }
+
+        if( last == i ) {
+            return; //EARLY RETURN
+        }
+
+        const uint32_t tmp = heap[ i ];
+        heap[ i ]    = heap[ last ];
+        heap[ last ] = tmp;
+        i            = last;
+    }
+}
+
+/**
+ * Initialises an empty index
+ * @return Empty StationIndex object
+ */
+static ctune_StationIndex_t ctune_StationIndex_init( void ) {
+    return (ctune_StationIndex_t) {
+        .finalised = false,
+        .docs      = { .arr = NULL, .size = 0, .capacity = 0 },
+        .pool      = { .buffer = NULL, .size = 0, .capacity = 0 },
+        .entries   = { .arr = NULL, .size = 0, .capacity = 0 },
+        .terms     = { .arr = NULL, .size = 0 },
+        .postings  = { .arr = NULL, .size = 0 },
+        .scratch   = { .generation = NULL, .score = NULL, .best = NULL, .round = NULL, .touched = NULL, .current = 0 },
+    };
+}
+
+/**
+ * Adds a station to the index (only valid before `finalise(..)`)
+ * @param index    Pointer to StationIndex object
+ * @param uuid     Station UUID
+ * @param src      Station provenance
+ * @param rank     Tie-breaking popularity value
+ * @param name     Station name (can be NULL)
+ * @param tags     Comma separated tags (can be NULL)
+ * @param country  Country (can be NULL)
+ * @param language Comma separated languages (can be NULL)
+ * @param codec    Codec (can be NULL)
+ * @return Success
+ */
+static bool ctune_StationIndex_add( ctune_StationIndex_t * index, const char * uuid, ctune_StationSrc_e src, ulong rank,
+                                    const char * name, const char * tags, const char * country, const char * language, const char * codec )
+{
+    if( index == NULL || uuid == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_add( %p, %p, ... )] NULL arg(s).", index, uuid );
+        return false; //EARLY RETURN
+    }
+
+    if( index->finalised || index->docs.size >= UINT32_MAX ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_StationIndex_add( %p, \"%s\", ... )] Index is closed to additions (finalised: %s, size: %lu).",
+                   index, uuid, ( index->finalised ? "true" : "false" ), index->docs.size
+        );
+
+        return false; //EARLY RETURN
+    }
+
+    if( !ctune_StationIndex_reserve( (void **) &index->docs.arr, &index->docs.capacity, ( index->docs.size + 1 ), sizeof( ctune_StationIndex_Doc_t ) ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_add( %p, \"%s\", ... )] Failed to allocate station.", index, uuid );
+        return false; //EARLY RETURN
+    }
+
+    const uint32_t             id  = (uint32_t) index->docs.size;
+    ctune_StationIndex_Doc_t * doc = &index->docs.arr[ id ];
+
+    doc->uuid = strdup( uuid );
+    doc->name = strdup( ( name != NULL ? name : "" ) );
+    doc->src  = src;
+    doc->rank = rank;
+
+    if( doc->uuid == NULL || doc->name == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_add( %p, \"%s\", ... )] Failed to copy station strings.", index, uuid );
+        free( doc->uuid );
+        free( doc->name );
+        return false; //EARLY RETURN
+    }
+
+    ++index->docs.size;
+
+    if( !ctune_StationIndex_addField( index, id, CTUNE_STATIONINDEX_FIELD_NAME, name )         ||
+        !ctune_StationIndex_addField( index, id, CTUNE_STATIONINDEX_FIELD_TAGS, tags )         ||
+        !ctune_StationIndex_addField( index, id, CTUNE_STATIONINDEX_FIELD_COUNTRY, country )   ||
+        !ctune_StationIndex_addField( index, id, CTUNE_STATIONINDEX_FIELD_LANGUAGE, language ) ||
+        !ctune_StationIndex_addField( index, id, CTUNE_STATIONINDEX_FIELD_CODEC, codec ) )
+    {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_add( %p, \"%s\", ... )] Failed to allocate tokens.", index, uuid );
+        return false; //EARLY RETURN
+    }
+
+    return true;
+}
+
+/**
+ * Builds the dictionary and posting lists from the added stations
+ * @param index Pointer to StationIndex object
+ * @return Success
+ */
+static bool ctune_StationIndex_finalise( ctune_StationIndex_t * index ) {
+    if( index == NULL || index->finalised ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_finalise( %p )] NULL arg or already finalised.", index );
+        return false; //EARLY RETURN
+    }
+
+    bool   error_state = false;
+    char * pool        = NULL;
+    size_t pool_size   = 0;
+
+    if( index->entries.size > UINT32_MAX || index->pool.size > UINT32_MAX ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_finalise( %p )] Too many tokens (%lu).", index, index->entries.size );
+        error_state = true;
+        goto end;
+    }
+
+    for( size_t i = 0; i < index->entries.size; ++i ) {
+        index->entries.arr[i].str = &index->pool.buffer[ index->entries.arr[i].offset ];
+    }
+
+    if( index->entries.size > 0 ) {
+        qsort( index->entries.arr, index->entries.size, sizeof( struct ctune_StationIndex_Entry ), ctune_StationIndex_compareEntries );
+
+        pool                = malloc( index->pool.size );
+        index->terms.arr    = malloc( index->entries.size * sizeof( struct ctune_StationIndex_Term ) );
+        index->postings.arr = malloc( index->entries.size * sizeof( struct ctune_StationIndex_Posting ) );
+
+        if( pool == NULL || index->terms.arr == NULL || index->postings.arr == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_finalise( %p )] Failed to allocate dictionary.", index );
+            error_state = true;
+            goto end;
+        }
+    }
+
+    for( size_t i = 0; i < index->entries.size; ++i ) {
+        const struct ctune_StationIndex_Entry * entry    = &index->entries.arr[i];
+        const bool                              new_term = ( i == 0 || strcmp( entry->str, index->entries.arr[ i - 1 ].str ) != 0 );
+
+        if( new_term ) {
+            const size_t length = strlen( entry->str );
+
+            memcpy( &pool[ pool_size ], entry->str, ( length + 1 ) );
+
+            index->terms.arr[ index->terms.size++ ] = (struct ctune_StationIndex_Term) {
+                .offset     = (uint32_t) pool_size,
+                .length     = (uint32_t) length,
+                .post_begin = (uint32_t) index->postings.size,
+                .post_count = 0,
+            };
+
+            pool_size += ( length + 1 );
+        }
+
+        struct ctune_StationIndex_Term * term = &index->terms.arr[ index->terms.size - 1 ];
+
+        if( !new_term && index->postings.arr[ index->postings.size - 1 ].doc == entry->doc ) {
+            index->postings.arr[ index->postings.size - 1 ].fields |= entry->field;
+
+        } else {
+            index->postings.arr[ index->postings.size++ ] = (struct ctune_StationIndex_Posting) {
+                .doc    = entry->doc,
+                .fields = entry->field,
+            };
+
+            ++term->post_count;
+        }
+    }
+
+    if( index->docs.size > 0 ) {
+        index->scratch.generation = calloc( index->docs.size, sizeof( uint32_t ) );
+        index->scratch.score      = calloc( index->docs.size, sizeof( uint32_t ) );
+        index->scratch.best       = calloc( index->docs.size, sizeof( uint16_t ) );
+        index->scratch.round      = calloc( index->docs.size, sizeof( uint8_t ) );
+        index->scratch.touched    = calloc( index->docs.size, sizeof( uint32_t ) );
+
+        if( index->scratch.generation == NULL || index->scratch.score == NULL || index->scratch.best == NULL ||
+            index->scratch.round == NULL || index->scratch.touched == NULL )
+        {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_finalise( %p )] Failed to allocate search space.", index );
+            error_state = true;
+            goto end;
+        }
+    }
+
+    free( index->entries.arr );
+    free( index->pool.buffer );
+
+    index->entries.arr      = NULL;
+    index->entries.size     = 0;
+    index->entries.capacity = 0;
+    index->pool.buffer      = pool;
+    index->pool.size        = pool_size;
+    index->pool.capacity    = pool_size;
+    index->scratch.current  = 0;
+    pool                    = NULL;
+
+    index->finalised = true;
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_StationIndex_finalise( %p )] Index built: %lu stations, %lu tokens, %lu postings.",
+               index, index->docs.size, index->terms.size, index->postings.size
+    );
+
+    end:
+        free( pool );
+        return !( error_state );
+}
+
+/**
+ * Gets the number of stations in the index
+ * @param index Pointer to StationIndex object
+ * @return Station count
+ */
+static size_t ctune_StationIndex_size( const ctune_StationIndex_t * index ) {
+    return ( index != NULL ? index->docs.size : 0 );
+}
+
+/**
+ * Gets the number of unique tokens in the index
+ * @param index Pointer to StationIndex object
+ * @return Token count (0 when not finalised)
+ */
+static size_t ctune_StationIndex_tokenCount( const ctune_StationIndex_t * index ) {
+    return ( index != NULL && index->finalised ? index->terms.size : 0 );
+}
+
+/**
+ * Searches the index
+ * -
+ * Every query token must match one of the station's tokens either exactly, as a prefix or, when
+ * the query token matches no indexed token at all, within a small edit distance (typo tolerance).
+ *
+ * @param index   Pointer to a finalised StationIndex object
+ * @param query   Free-text query
+ * @param limit   Maximum number of results to store
+ * @param results Container for the best `ctune_StationIndex_Result_t` matches ordered by relevance
+ * @return Total number of matching stations
+ */
+static size_t ctune_StationIndex_search( ctune_StationIndex_t * index, const char * query, size_t limit, Vector_t * results ) {
+    if( index == NULL || query == NULL || ( limit > 0 && results == NULL ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_search( %p, %p, %lu, %p )] NULL arg(s).", index, query, limit, results );
+        return 0; //EARLY RETURN
+    }
+
+    if( !index->finalised || index->terms.size == 0 ) {
+        return 0; //EARLY RETURN
+    }
+
+    char   tokens[ CTUNE_STATIONINDEX_MAX_QUERY_TOKENS ][ CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH + 1 ];
+    size_t lengths[ CTUNE_STATIONINDEX_MAX_QUERY_TOKENS ];
+    size_t token_count = 0;
+
+    while( token_count < CTUNE_STATIONINDEX_MAX_QUERY_TOKENS && ( lengths[ token_count ] = ctune_StationIndex_nextToken( &query, tokens[ token_count ] ) ) > 0 ) {
+        ++token_count;
+    }
+
+    if( token_count == 0 ) {
+        return 0; //EARLY RETURN
+    }
+
+    if( ++index->scratch.current == 0 ) { //generation counter wrapped around
+        memset( index->scratch.generation, 0, ( index->docs.size * sizeof( uint32_t ) ) );
+        index->scratch.current = 1;
+    }
+
+    size_t touched = 0;
+
+    for( size_t t = 0; t < token_count; ++t ) {
+        const char * token   = tokens[t];
+        const size_t length  = lengths[t];
+        bool         matched = false;
+
+        touched = 0;
+
+        for( size_t i = ctune_StationIndex_lowerBound( index, token );
+             i < index->terms.size && strncmp( ctune_StationIndex_termStr( index, i ), token, length ) == 0;
+             ++i )
+        {
+            const uint16_t match = ( index->terms.arr[i].length == length ? CTUNE_STATIONINDEX_MATCH_EXACT : CTUNE_STATIONINDEX_MATCH_PREFIX );
+            ctune_StationIndex_scoreTerm( index, i, match, (uint8_t) t, &touched );
+            matched = true;
+        }
+
+        //typo tolerance: only scans the terms sharing the first character of the token
+        if( !matched && length >= 3 ) {
+            const int  max_distance = ( length <= 5 ? 1 : 2 );
+            const char first[2]     = { token[0], '\0' };
+
+            for( size_t i = ctune_StationIndex_lowerBound( index, first );
+                 i < index->terms.size && ctune_StationIndex_termStr( index, i )[0] == token[0];
+                 ++i )
+            {
+                const size_t term_length = index->terms.arr[i].length;
+
+                if( term_length + (size_t) max_distance < length ) {
+                    continue;
+                }
+
+                if( ctune_StationIndex_prefixDistance( token, length, ctune_StationIndex_termStr( index, i ), term_length, max_distance ) <= max_distance ) {
+                    ctune_StationIndex_scoreTerm( index, i, CTUNE_STATIONINDEX_MATCH_FUZZY, (uint8_t) t, &touched );
+                }
+            }
+        }
+
+        if( touched == 0 ) {
+            return 0; //EARLY RETURN
+        }
+    }
+
+    //the stations first matched by the last query token are the ones that matched all of them
+    const size_t heap_size = ( limit < touched ? limit : touched );
+    uint32_t   * heap      = index->scratch.touched; //re-used in-place
+
+    if( heap_size == 0 ) {
+        return touched; //EARLY RETURN
+    }
+
+    for( size_t i = heap_size / 2; i-- > 0; ) {
+        ctune_StationIndex_siftDown( index, heap, heap_size, i );
+    }
+
+    for( size_t i = heap_size; i < touched; ++i ) {
+        if( ctune_StationIndex_ranksBefore( index, heap[i], heap[0] ) ) {
+            heap[0] = heap[i];
+            ctune_StationIndex_siftDown( index, heap, heap_size, 0 );
+        }
+    }
+
+    for( size_t n = heap_size; n > 1; --n ) { //heap-sort: last ranked towards the back
+        const uint32_t tmp = heap[0];
+        heap[0]       = heap[ n - 1 ];
+        heap[ n - 1 ] = tmp;
+        ctune_StationIndex_siftDown( index, heap, ( n - 1 ), 0 );
+    }
+
+    for( size_t i = 0; i < heap_size; ++i ) {
+        ctune_StationIndex_Result_t * result = Vector.emplace_back( results );
+
+        if( result == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationIndex_search( %p, %p, %lu, %p )] Failed to allocate result.", index, query, limit, results );
+            break;
+        }
+
+        result->doc   = &index->docs.arr[ heap[i] ];
+        result->score = index->scratch.score[ heap[i] ];
+    }
+
+    return touched;
+}
+
+/**
+ * De-allocates the content of an index
+ * @param index Pointer to StationIndex object
+ */
+static void ctune_StationIndex_free( ctune_StationIndex_t * index ) {
+    if( index == NULL ) {
+        return; //EARLY RETURN
+    }
+
+    for( size_t i = 0; i < index->docs.size; ++i ) {
+        free( index->docs.arr[i].uuid );
+        free( index->docs.arr[i].name );
+    }
+
+    free( index->docs.arr );
+    free( index->pool.buffer );
+    free( index->entries.arr );
+    free( index->terms.arr );
+    free( index->postings.arr );
+    free( index->scratch.generation );
+    free( index->scratch.score );
+    free( index->scratch.best );
+    free( index->scratch.round );
+    free( index->scratch.touched );
+
+    *index = ctune_StationIndex_init();
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_StationIndex_Namespace ctune_StationIndex = {
+    .init       = &ctune_StationIndex_init,
+    .add        = &ctune_StationIndex_add,
+    .finalise   = &ctune_StationIndex_finalise,
+    .size       = &ctune_StationIndex_size,
+    .tokenCount = &ctune_StationIndex_tokenCount,
+    .search     = &ctune_StationIndex_search,
+    .free       = &ctune_StationIndex_free,
+};
@@ -0,0 +1,181 @@
+#ifndef CTUNE_DATASTRUCTURE_STATIONINDEX_H
+#define CTUNE_DATASTRUCTURE_STATIONINDEX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+#include "Vector.h"
+#include "../enum/StationSrc.h"
+
+#define CTUNE_STATIONINDEX_MAX_TOKEN_LENGTH 32 //longer tokens are truncated
+#define CTUNE_STATIONINDEX_MAX_QUERY_TOKENS 8  //extra query tokens are ignored
+
+/**
+ * Indexed station fields (bit flags)
+ */
+typedef enum {
+    CTUNE_STATIONINDEX_FIELD_NAME     = 0x01,
+    CTUNE_STATIONINDEX_FIELD_TAGS     = 0x02,
+    CTUNE_STATIONINDEX_FIELD_COUNTRY  = 0x04,
+    CTUNE_STATIONINDEX_FIELD_LANGUAGE = 0x08,
+    CTUNE_STATIONINDEX_FIELD_CODEC    = 0x10,
+} ctune_StationIndex_Field_e;
+
+/**
+ * Indexed station
+ * @param uuid Station UUID
+ * @param name Station name
+ * @param src  Station provenance
+ * @param rank Tie-breaking popularity value (higher ranks first)
+ */
+typedef struct ctune_StationIndex_Doc {
+    char             * uuid;
+    char             * name;
+    ctune_StationSrc_e src;
+    ulong              rank;
+
+} ctune_StationIndex_Doc_t;
+
+/**
+ * Search result
+ * @param doc   Pointer to the matched station inside the index
+ * @param score Relevance score (higher is better)
+ */
+typedef struct ctune_StationIndex_Result {
+    const ctune_StationIndex_Doc_t * doc;
+    uint32_t                         score;
+
+} ctune_StationIndex_Result_t;
+
+struct ctune_StationIndex_Entry;
+struct ctune_StationIndex_Term;
+struct ctune_StationIndex_Posting;
+
+/**
+ * In-memory inverted index (token -> posting list of stations)
+ * -
+ * Stations are added with `add(..)` and become searchable once `finalise(..)` is called.
+ * The search uses scratch space inside the object so concurrent searches on the same index need external locking.
+ *
+ * @param finalised Flag set once the dictionary and posting lists are built
+ * @param docs      Indexed stations
+ * @param pool      Token string pool ('\0' separated)
+ * @param entries   Build-time (token, station, field) occurrences
+ * @param terms     Sorted token dictionary
+ * @param postings  Posting lists (contiguous per term)
+ * @param scratch   Per-station search accumulators
+ */
+typedef struct ctune_StationIndex {
+    bool finalised;
+
+    struct {
+        ctune_StationIndex_Doc_t * arr;
+        size_t                     size;
+        size_t                     capacity;
+    } docs;
+
+    struct {
+        char * buffer;
+        size_t size;
+        size_t capacity;
+    } pool;
+
+    struct {
+        struct ctune_StationIndex_Entry * arr;
+        size_t                            size;
+        size_t                            capacity;
+    } entries;
+
+    struct {
+        struct ctune_StationIndex_Term * arr;
+        size_t                           size;
+    } terms;
+
+    struct {
+        struct ctune_StationIndex_Posting * arr;
+        size_t                              size;
+    } postings;
+
+    struct {
+        uint32_t * generation;
+        uint32_t * score;
+        uint16_t * best;
+        uint8_t  * round;
+        uint32_t * touched;
+        uint32_t   current;
+    } scratch;
+
+} ctune_StationIndex_t;
+
+/**
+ * StationIndex namespace
+ */
+extern const struct ctune_StationIndex_Namespace {
+    /**
+     * Initialises an empty index
+     * @return Empty StationIndex object
+     */
+    ctune_StationIndex_t (* init)( void );
+
+    /**
+     * Adds a station to the index (only valid before `finalise(..)`)
+     * @param index    Pointer to StationIndex object
+     * @param uuid     Station UUID
+     * @param src      Station provenance
+     * @param rank     Tie-breaking popularity value
+     * @param name     Station name (can be NULL)
+     * @param tags     Comma separated tags (can be NULL)
+     * @param country  Country (can be NULL)
+     * @param language Comma separated languages (can be NULL)
+     * @param codec    Codec (can be NULL)
+     * @return Success
+     */
+    bool (* add)( ctune_StationIndex_t * index, const char * uuid, ctune_StationSrc_e src, ulong rank,
+                  const char * name, const char * tags, const char * country, const char * language, const char * codec );
+
+    /**
+     * Builds the dictionary and posting lists from the added stations
+     * @param index Pointer to StationIndex object
+     * @return Success
+     */
+    bool (* finalise)( ctune_StationIndex_t * index );
+
+    /**
+     * Gets the number of stations in the index
+     * @param index Pointer to StationIndex object
+     * @return Station count
+     */
+    size_t (* size)( const ctune_StationIndex_t * index );
+
+    /**
+     * Gets the number of unique tokens in the index
+     * @param index Pointer to StationIndex object
+     * @return Token count (0 when not finalised)
+     */
+    size_t (* tokenCount)( const ctune_StationIndex_t * index );
+
+    /**
+     * Searches the index
+     * -
+     * Every query token must match one of the station's tokens either exactly, as a prefix or, when
+     * the query token matches no indexed token at all, within a small edit distance (typo tolerance).
+     *
+     * @param index   Pointer to a finalised StationIndex object
+     * @param query   Free-text query
+     * @param limit   Maximum number of results to store
+     * @param results Container for the best `ctune_StationIndex_Result_t` matches ordered by relevance
+     * @return Total number of matching stations
+     */
+    size_t (* search)( ctune_StationIndex_t * index, const char * query, size_t limit, Vector_t * results );
+
+    /**
+     * De-allocates the content of an index
+     * @param index Pointer to StationIndex object
+     */
+    void (* free)( ctune_StationIndex_t * index );
+
+} ctune_StationIndex;
+
+#endif //CTUNE_DATASTRUCTURE_STATIONINDEX_H
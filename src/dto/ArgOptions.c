@@ -14,6 +14,12 @@ static void ctune_Options_sendToLogger( const char * caller, const ctune_ArgOpti
     if( opts->log_level > CTUNE_LOG_MSG )
         CTUNE_LOG( CTUNE_LOG_MSG, "[%s] CMD arg. option: debug on (lvl=%i)", caller, opts->log_level );
 
+    if( opts->binary_trace )
+        CTUNE_LOG( CTUNE_LOG_MSG, "[%s] CMD arg. option: binary trace", caller );
+
+    if( opts->profile_startup )
+        CTUNE_LOG( CTUNE_LOG_MSG, "[%s] CMD arg. option: profile startup", caller );
+
     if( opts->ui.show_cursor )
         CTUNE_LOG( CTUNE_LOG_MSG, "[%s] CMD arg, option: show cursor", caller );
 
@@ -11,6 +11,8 @@
  */
 struct ctune_ArgOptions {
     ctune_LogLevel_e log_level;
+    bool             profile_startup;
+    bool             binary_trace;
 
     struct {
         bool     show_cursor;
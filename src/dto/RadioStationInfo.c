@@ -45,6 +45,7 @@ static void ctune_RadioStationInfo_init( void * rsi ) {
     ( (struct ctune_RadioStationInfo *) rsi )->geo.longitude         = 0.0;
     ( (struct ctune_RadioStationInfo *) rsi )->geo.distance          = 0.0;
 
+    ( (struct ctune_RadioStationInfo *) rsi )->has_extended_info     = false;
     ( (struct ctune_RadioStationInfo *) rsi )->is_favourite          = false;
     ( (struct ctune_RadioStationInfo *) rsi )->station_src           = CTUNE_STATIONSRC_LOCAL;
 }
@@ -240,6 +241,24 @@ static bool ctune_RadioStationInfo_equalUUID( const void * lhs, const void * rhs
     return ( strcmp( rsi_a->station_uuid, rsi_b->station_uuid ) == 0 );
 }
 
+/**
+ * Checks a UUID string matches a RadioStationInfo_t object's UUID (i.e.: HashMap key/value equivalence)
+ * @param uuid_str UUID string
+ * @param rsi      RadioStationInfo_t object
+ * @return Match state
+ */
+static bool ctune_RadioStationInfo_matchUUID( const void * uuid_str, const void * rsi ) {
+    if( uuid_str == NULL || rsi == NULL )
+        return false;
+
+    const ctune_RadioStationInfo_t * station = (const struct ctune_RadioStationInfo *) rsi;
+
+    if( station->station_uuid == NULL )
+        return false;
+
+    return ( strcmp( (const char *) uuid_str, station->station_uuid ) == 0 );
+}
+
 /**
  * Checks equivalence of 2 RadioStationInfo_t objects (all field except internal ones)
  * @param lhs RadioStationInfo_t object
@@ -1557,6 +1576,7 @@ const struct ctune_RadioStationInfo_Namespace ctune_RadioStationInfo = {
     .dup                   = &ctune_RadioStationInfo_dup,
     .mindup                = &ctune_RadioStationInfo_mindup,
     .sameUUID              = &ctune_RadioStationInfo_equalUUID,
+    .matchUUID             = &ctune_RadioStationInfo_matchUUID,
     .equal                 = &ctune_RadioStationInfo_equal,
     .hash                  = &ctune_RadioStationInfo_hash,
     .clearChangeTimestamps = &ctune_RadioStationInfo_clearChangeTimestamps,
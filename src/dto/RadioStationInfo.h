@@ -150,6 +150,14 @@ extern const struct ctune_RadioStationInfo_Namespace {
      */
     bool (* sameUUID)( const void * lhs, const void * rhs );
 
+    /**
+     * Checks a UUID string matches a RadioStationInfo_t object's UUID (i.e.: HashMap key/value equivalence)
+     * @param uuid_str UUID string
+     * @param rsi      RadioStationInfo_t object
+     * @return Match state
+     */
+    bool (* matchUUID)( const void * uuid_str, const void * rsi );
+
     /**
      * Checks equivalence of 2 RadioStationInfo_t objects (all field except internal ones)
      * @param lhs RadioStationInfo_t object
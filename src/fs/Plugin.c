@@ -2,194 +2,605 @@
 
 #include <dlfcn.h>
 #include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "logger/src/Logger.h"
+#include "XDG.h"
 
+/**
+ * [PRIVATE] Plugin manifest entry (metadata of a plugin file)
+ * @param path        Plugin file path
+ * @param mtime       File modification time
+ * @param size        File size
+ * @param type        Plugin type
+ * @param abi_version Plugin ABI version
+ * @param name        Plugin name
+ * @param description Plugin description
+ * @param extension   File extension (recorder plugins)
+ * @param seen        Flag set when the file was found in the current scan
+ */
+typedef struct ctune_Plugin_Manifest {
+    String_t           path;
+    time_t             mtime;
+    off_t              size;
+    ctune_PluginType_e type;
+    unsigned int       abi_version;
+    String_t           name;
+    String_t           description;
+    String_t           extension;
+    bool               seen;
+
+} ctune_Plugin_Manifest_t;
+
+/**
+ * Private vars
+ * -
+ * Each plugin type has a `list` of plugin interfaces and a parallel `info` list of manifest entries.
+ * The interfaces stay unlinked (`handle == NULL`) until the plugin is first used.
+ */
 static struct {
-    bool initialised;
+    bool            initialised;
+    pthread_mutex_t lock; //guards the linking of plugins
+
+    struct {
+        const char * file_name;
+        Vector_t     entries;
+        bool         loaded;
+        bool         changed;
+    } manifest;
 
     struct {
         Vector_t         list;
+        Vector_t         info;
         ctune_Player_t * selected;
     } audio_players;
 
     struct {
         Vector_t           list;
+        Vector_t           info;
         ctune_AudioOut_t * selected;
     } audio_servers;
 
     struct {
         Vector_t          list;
+        Vector_t          info;
         ctune_FileOut_t * selected;
     } audio_recorders;
 
 } private = {
     .initialised              = false,
+    .lock                     = PTHREAD_MUTEX_INITIALIZER,
+    .manifest.file_name       = "plugins.manifest",
+    .manifest.loaded          = false,
+    .manifest.changed         = false,
     .audio_players.selected   = NULL,
     .audio_recorders.selected = NULL,
     .audio_servers.selected   = NULL,
 };
 
 /**
- * [PRIVATE] Loads a plugin
- * @param handle File handle
- * @return Name of plugin on success or NULL
+ * [PRIVATE] Initialises a manifest entry
+ * @param entry Pointer to ctune_Plugin_Manifest_t object
  */
-static const char * ctune_Plugin_loadPlugin( void * handle ) {
-    if( handle == NULL ) {
-        CTUNE_LOG( CTUNE_LOG_FATAL,
-                   "[ctune_Plugin_loadPlugin( %p )] NULL handle.",
-                   handle
-        );
+static void ctune_Plugin_initManifest( void * entry ) {
+    ctune_Plugin_Manifest_t * e = entry;
+
+    e->path        = String.init();
+    e->mtime       = 0;
+    e->size        = 0;
+    e->type        = CTUNE_PLUGIN_IN_STREAM_PLAYER;
+    e->abi_version = 0;
+    e->name        = String.init();
+    e->description = String.init();
+    e->extension   = String.init();
+    e->seen        = false;
+}
 
-        return NULL; //EARLY RETURN
+/**
+ * [PRIVATE] De-allocates the content of a manifest entry
+ * @param entry Pointer to ctune_Plugin_Manifest_t object
+ */
+static void ctune_Plugin_freeManifest( void * entry ) {
+    ctune_Plugin_Manifest_t * e = entry;
+
+    String.free( &e->path );
+    String.free( &e->name );
+    String.free( &e->description );
+    String.free( &e->extension );
+}
+
+/**
+ * [PRIVATE] Copies a manifest entry
+ * @param from Source entry
+ * @param to   Initialised target entry
+ */
+static void ctune_Plugin_copyManifest( const ctune_Plugin_Manifest_t * from, ctune_Plugin_Manifest_t * to ) {
+    String.set( &to->path, ctune_fallbackStr( from->path._raw, "" ) );
+    String.set( &to->name, ctune_fallbackStr( from->name._raw, "" ) );
+    String.set( &to->description, ctune_fallbackStr( from->description._raw, "" ) );
+    String.set( &to->extension, ctune_fallbackStr( from->extension._raw, "" ) );
+    to->mtime       = from->mtime;
+    to->size        = from->size;
+    to->type        = from->type;
+    to->abi_version = from->abi_version;
+    to->seen        = from->seen;
+}
+
+/**
+ * [PRIVATE] Reads the cached plugin manifest (one tab-separated entry per line)
+ */
+static void ctune_Plugin_readManifest( void ) {
+    String_t path = String.init();
+    FILE   * file = NULL;
+    char   * line = NULL;
+    size_t   size = 0;
+
+    private.manifest.loaded = true;
+
+    ctune_XDG.resolveCacheFilePath( private.manifest.file_name, &path );
+
+    if( ( file = fopen( path._raw, "r" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Plugin_readManifest()] No plugin manifest cached (\"%s\").", path._raw );
+        goto end;
+    }
+
+    while( getline( &line, &size, file ) > 0 ) {
+        char * fields[8] = { NULL };
+        char * cursor    = line;
+        size_t count     = 0;
+
+        line[ strcspn( line, "\n" ) ] = '\0';
+
+        while( count < 8 && cursor != NULL ) {
+            fields[ count++ ] = strsep( &cursor, "\t" );
+        }
+
+        if( count != 8 ) {
+            CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Plugin_readManifest()] Malformed entry in \"%s\": skipped.", path._raw );
+            continue;
+        }
+
+        ctune_Plugin_Manifest_t * entry = Vector.init_back( &private.manifest.entries, ctune_Plugin_initManifest );
+
+        if( entry == NULL ) {
+            break;
+        }
+
+        String.set( &entry->path, fields[0] );
+        entry->mtime       = (time_t) strtoll( fields[1], NULL, 10 );
+        entry->size        = (off_t) strtoll( fields[2], NULL, 10 );
+        entry->type        = (ctune_PluginType_e) strtol( fields[3], NULL, 10 );
+        entry->abi_version = (unsigned int) strtoul( fields[4], NULL, 10 );
+        String.set( &entry->name, fields[5] );
+        String.set( &entry->description, fields[6] );
+        String.set( &entry->extension, fields[7] );
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_Plugin_readManifest()] Loaded %lu cached plugin manifest entries from \"%s\".",
+               Vector.size( &private.manifest.entries ), path._raw
+    );
+
+    end:
+        if( file ) {
+            fclose( file );
+        }
+
+        free( line );
+        String.free( &path );
+}
+
+/**
+ * [PRIVATE] Writes the plugins found in the scans to the cached plugin manifest
+ */
+static void ctune_Plugin_writeManifest( void ) {
+    String_t path     = String.init();
+    String_t tmp_path = String.init();
+    FILE   * file     = NULL;
+
+    ctune_XDG.resolveCacheFilePath( private.manifest.file_name, &path );
+    String.set( &tmp_path, path._raw );
+    String.append_back( &tmp_path, ".tmp" );
+
+    if( ( file = fopen( tmp_path._raw, "w" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Plugin_writeManifest()] Failed to open \"%s\": %s", tmp_path._raw, strerror( errno ) );
+        goto end;
+    }
+
+    for( size_t i = 0; i < Vector.size( &private.manifest.entries ); ++i ) {
+        const ctune_Plugin_Manifest_t * entry = Vector.at( &private.manifest.entries, i );
+
+        if( entry->seen ) {
+            fprintf( file, "%s\t%lld\t%lld\t%d\t%u\t%s\t%s\t%s\n",
+                     entry->path._raw, (long long) entry->mtime, (long long) entry->size, (int) entry->type, entry->abi_version,
+                     ctune_fallbackStr( entry->name._raw, "" ),
+                     ctune_fallbackStr( entry->description._raw, "" ),
+                     ctune_fallbackStr( entry->extension._raw, "" ) );
+        }
+    }
+
+    if( fclose( file ) != 0 || rename( tmp_path._raw, path._raw ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Plugin_writeManifest()] Failed to write \"%s\".", path._raw );
+        unlink( tmp_path._raw );
+        goto end;
+    }
+
+    private.manifest.changed = false;
+
+    end:
+        String.free( &path );
+        String.free( &tmp_path );
+}
+
+/**
+ * [PRIVATE] Replaces newlines/tabs in a plugin string so that it fits in a manifest field
+ * @param str String to sanitise
+ */
+static void ctune_Plugin_sanitiseField( String_t * str ) {
+    for( size_t i = 0; i < str->_length; ++i ) {
+        if( str->_raw[i] == '\t' || str->_raw[i] == '\n' || str->_raw[i] == '\r' ) {
+            str->_raw[i] = ' ';
+        }
+    }
+}
+
+/**
+ * [PRIVATE] Reads a plugin file's metadata (the file is opened with lazy binding and closed straight after)
+ * -
+ * Note: the library is kept mapped after closing (RTLD_NODELETE) so that linking it later on does not
+ *       reload it and its dependencies. This only happens for new/changed files (i.e. cold scans).
+ * @param path  Plugin file path
+ * @param entry Manifest entry to fill
+ * @return Success
+ */
+static bool ctune_Plugin_inspect( const char * path, ctune_Plugin_Manifest_t * entry ) {
+    bool   error_state = false;
+    void * handle      = dlopen( path, RTLD_LAZY | RTLD_LOCAL | RTLD_NODELETE );
+
+    if( handle == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_Plugin_inspect( \"%s\", %p )] Failed to open: %s", path, entry, dlerror() );
+        return false; //EARLY RETURN
     }
 
-    const char               * plugin_name = NULL;
-    char                     * error       = NULL;
     const unsigned int       * abi_version = dlsym( handle, "abi_version" );
     const ctune_PluginType_e * plugin_type = dlsym( handle, "plugin_type" );
 
     if( plugin_type == NULL || abi_version == NULL ) {
         CTUNE_LOG( CTUNE_LOG_FATAL,
-                   "[ctune_Plugin_loadPlugin( %p )] NULL fields (abi_version: %p, plugin_type: %p).",
-                   handle, abi_version, plugin_type
+                   "[ctune_Plugin_inspect( \"%s\", %p )] NULL fields (abi_version: %p, plugin_type: %p).",
+                   path, entry, abi_version, plugin_type
         );
-        
-        return NULL;
+
+        error_state = true;
+        goto end;
     }
 
+    entry->type        = *plugin_type;
+    entry->abi_version = *abi_version;
+
     switch( *plugin_type ) {
         case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
-            if( *abi_version != CTUNE_PLAYER_ABI_VERSION ) {
-                CTUNE_LOG( CTUNE_LOG_FATAL,
-                           "[ctune_Plugin_loadPlugin( %p )] Player ABI version mismatch: plugin=%d, ctune=%d.",
-                           handle, *abi_version, CTUNE_PLAYER_ABI_VERSION
-                );
+            const ctune_Player_t * p = dlsym( handle, "ctune_Player" );
+
+            if( ( error_state = ( p == NULL ) ) == false ) {
+                String.set( &entry->name, p->name() );
+                String.set( &entry->description, p->description() );
+            }
+        } break;
+
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
+            const ctune_AudioOut_t * ao = dlsym( handle, "ctune_AudioOutput" );
+
+            if( ( error_state = ( ao == NULL ) ) == false ) {
+                String.set( &entry->name, ao->name() );
+                String.set( &entry->description, ao->description() );
+            }
+        } break;
+
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
+            const struct ctune_FileOut * fo = dlsym( handle, "ctune_FileOutput" );
 
-                return NULL; //EARLY RETURN
+            if( ( error_state = ( fo == NULL ) ) == false ) {
+                String.set( &entry->name, fo->name() );
+                String.set( &entry->description, fo->description() );
+                String.set( &entry->extension, fo->extension() );
             }
+        } break;
+
+        default: {
+            error_state = true;
+        } break;
+    }
+
+    if( error_state ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_Plugin_inspect( \"%s\", %p )] Failed to read interface ('%s').",
+                   path, entry, ctune_PluginType.str( *plugin_type )
+        );
+
+    } else {
+        ctune_Plugin_sanitiseField( &entry->name );
+        ctune_Plugin_sanitiseField( &entry->description );
+        ctune_Plugin_sanitiseField( &entry->extension );
+    }
+
+    end:
+        dlclose( handle );
+        return !( error_state );
+}
+
+/**
+ * [PRIVATE] Gets the manifest entry of a plugin file, inspecting the file when not cached or changed
+ * @param path Plugin file path
+ * @return Pointer to manifest entry or NULL on failure
+ */
+static ctune_Plugin_Manifest_t * ctune_Plugin_getManifest( const char * path ) {
+    struct stat               st    = { 0 };
+    ctune_Plugin_Manifest_t * entry = NULL;
+
+    if( stat( path, &st ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Plugin_getManifest( \"%s\" )] Failed stat: %s", path, strerror( errno ) );
+        return NULL; //EARLY RETURN
+    }
+
+    for( size_t i = 0; i < Vector.size( &private.manifest.entries ); ++i ) {
+        ctune_Plugin_Manifest_t * e = Vector.at( &private.manifest.entries, i );
+
+        if( strcmp( e->path._raw, path ) == 0 ) {
+            entry = e;
+            break;
+        }
+    }
+
+    if( entry && entry->mtime == st.st_mtime && entry->size == st.st_size ) {
+        entry->seen = true;
+        return entry; //EARLY RETURN
+    }
+
+    if( entry == NULL && ( entry = Vector.init_back( &private.manifest.entries, ctune_Plugin_initManifest ) ) == NULL ) {
+        return NULL; //EARLY RETURN
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Plugin_getManifest( \"%s\" )] Plugin not in manifest cache or changed: inspecting.", path );
+
+    String.set( &entry->path, path );
+    entry->mtime = st.st_mtime;
+    entry->size  = st.st_size;
+    entry->seen  = ctune_Plugin_inspect( path, entry ); //failed inspections are not cached
+
+    private.manifest.changed = true;
+
+    return ( entry->seen ? entry : NULL );
+}
+
+/**
+ * [PRIVATE] Opens and links a plugin to its interface (call with the lock held)
+ * @param type   Plugin type
+ * @param info   Manifest entry of the plugin
+ * @param plugin Pointer to the (unlinked) plugin interface of the matching type
+ * @return Success
+ */
+static bool ctune_Plugin_link( ctune_PluginType_e type, const ctune_Plugin_Manifest_t * info, void * plugin ) {
+    void               * handle      = dlopen( info->path._raw, RTLD_NOW );
+    char               * error       = NULL;
+    const unsigned int * abi_version = NULL;
 
-            ctune_Player_t * plugin = Vector.emplace_back( &private.audio_players.list );
+    if( handle == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_Plugin_link( '%s', %p, %p )] Failed to open \"%s\": %s",
+                   ctune_PluginType.str( type ), info, plugin, info->path._raw, dlerror()
+        );
 
-            if( plugin ) {
-                plugin->handle      = handle;
-                plugin->abi_version = abi_version;
-                plugin->plugin_type = plugin_type;
+        ctune_err.set( CTUNE_ERR_IO_PLUGIN_LINK );
+        return false; //EARLY RETURN
+    }
 
-                ctune_Player_t * p = dlsym( plugin->handle, "ctune_Player" );
+    const ctune_PluginType_e * plugin_type = dlsym( handle, "plugin_type" );
 
-                if( ( error = dlerror() ) != NULL ) {
-                    CTUNE_LOG( CTUNE_LOG_FATAL,
-                               "[ctune_Plugin_loadPlugin( %p )] Failed linking: %s ('%s')",
-                               handle, error, ctune_PluginType.str( *plugin_type )
-                    );
+    if( ( abi_version = dlsym( handle, "abi_version" ) ) == NULL || plugin_type == NULL || *abi_version != info->abi_version || *plugin_type != type ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_Plugin_link( '%s', %p, %p )] Plugin \"%s\" does not match its manifest.",
+                   ctune_PluginType.str( type ), info, plugin, info->path._raw
+        );
 
-                    ctune_err.set ( CTUNE_ERR_IO_PLUGIN_LINK );
-                    Vector.remove( &private.audio_recorders.list, Vector.size( &private.audio_players.list ) - 1 );
+        goto fail;
+    }
 
-                } else {
-                    plugin->name            = p->name;
-                    plugin->description     = p->description;
-                    plugin->init            = p->init;
-                    plugin->playRadioStream = p->playRadioStream;
-                    plugin->startRecording  = p->startRecording;
-                    plugin->stopRecording   = p->stopRecording;
-                    plugin->getError        = p->getError;
-                    plugin->testStream      = p->testStream;
+    switch( type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
+            ctune_Player_t * dst = plugin;
+            ctune_Player_t * p   = dlsym( handle, "ctune_Player" );
 
-                    plugin_name = plugin->name();
-                }
+            if( ( error = dlerror() ) != NULL || p == NULL ) {
+                break;
             }
+
+            dst->handle          = handle;
+            dst->abi_version     = abi_version;
+            dst->plugin_type     = plugin_type;
+            dst->name            = p->name;
+            dst->description     = p->description;
+            dst->init            = p->init;
+            dst->playRadioStream = p->playRadioStream;
+            dst->startRecording  = p->startRecording;
+            dst->stopRecording   = p->stopRecording;
+            dst->getError        = p->getError;
+            dst->testStream      = p->testStream;
         } break;
 
         case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
-            if( *abi_version != CTUNE_AUDIOOUT_ABI_VERSION ) {
-                CTUNE_LOG( CTUNE_LOG_FATAL,
-                           "[ctune_Plugin_loadPlugin( %p )] AudioOut ABI version mismatch: plugin=%d, ctune=%d.",
-                           handle, *abi_version, CTUNE_FILEOUT_ABI_VERSION
-                );
+            ctune_AudioOut_t * dst = plugin;
+            ctune_AudioOut_t * ao  = dlsym( handle, "ctune_AudioOutput" );
 
-                return NULL; //EARLY RETURN
+            if( ( error = dlerror() ) != NULL || ao == NULL ) {
+                break;
             }
 
-            ctune_AudioOut_t * plugin = Vector.emplace_back( &private.audio_servers.list );
-
-            if( plugin ) {
-                plugin->handle      = handle;
-                plugin->abi_version = abi_version;
-                plugin->plugin_type = plugin_type;
-
-                ctune_AudioOut_t * ao = dlsym( plugin->handle, "ctune_AudioOutput" );
-
-                if( ( error = dlerror() ) != NULL ) {
-                    CTUNE_LOG( CTUNE_LOG_FATAL,
-                               "[ctune_Plugin_loadPlugin( %p )] Failed linking: %s ('%s')",
-                               handle, error, ctune_PluginType.str( *plugin_type )
-                    );
-
-                    ctune_err.set ( CTUNE_ERR_IO_PLUGIN_LINK );
-                    Vector.remove( &private.audio_servers.list, Vector.size( &private.audio_servers.list ) - 1 );
-
-                } else {
-                    plugin->name                    = ao->name;
-                    plugin->description             = ao->description;
-                    plugin->init                    = ao->init;
-                    plugin->write                   = ao->write;
-                    plugin->setVolumeChangeCallback = ao->setVolumeChangeCallback;
-                    plugin->setVolume               = ao->setVolume;
-                    plugin->changeVolume            = ao->changeVolume;
-                    plugin->getVolume               = ao->getVolume;
-                    plugin->shutdown                = ao->shutdown;
-
-                    plugin_name = plugin->name();
-                }
-            }
+            dst->handle                  = handle;
+            dst->abi_version             = abi_version;
+            dst->plugin_type             = plugin_type;
+            dst->name                    = ao->name;
+            dst->description             = ao->description;
+            dst->init                    = ao->init;
+            dst->write                   = ao->write;
+            dst->setVolumeChangeCallback = ao->setVolumeChangeCallback;
+            dst->setVolume               = ao->setVolume;
+            dst->changeVolume            = ao->changeVolume;
+            dst->getVolume               = ao->getVolume;
+            dst->shutdown                = ao->shutdown;
         } break;
 
         case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
-            if( *abi_version != CTUNE_FILEOUT_ABI_VERSION ) {
-                CTUNE_LOG( CTUNE_LOG_FATAL,
-                           "[ctune_Plugin_loadPlugin( %p )] FileOut ABI version mismatch: plugin=%d, ctune=%d.",
-                           handle, *abi_version, CTUNE_AUDIOOUT_ABI_VERSION
-                );
+            ctune_FileOut_t      * dst = plugin;
+            struct ctune_FileOut * fo  = dlsym( handle, "ctune_FileOutput" );
 
-                return NULL; //EARLY RETURN
+            if( ( error = dlerror() ) != NULL || fo == NULL ) {
+                break;
             }
 
-            ctune_FileOut_t * plugin = Vector.emplace_back( &private.audio_recorders.list );
+            dst->handle      = handle;
+            dst->abi_version = abi_version;
+            dst->plugin_type = plugin_type;
+            dst->name        = fo->name;
+            dst->description = fo->description;
+            dst->extension   = fo->extension;
+            dst->init        = fo->init;
+            dst->write       = fo->write;
+            dst->close       = fo->close;
+        } break;
+
+        default: break;
+    }
 
-            if( plugin ) {
-                plugin->handle      = handle;
-                plugin->abi_version = abi_version;
-                plugin->plugin_type = plugin_type;
+    if( *(void **) plugin == handle ) { //i.e. `->handle` is the first field of all the interfaces
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_Plugin_link( '%s', %p, %p )] Plugin linked: %s (\"%s\")",
+                   ctune_PluginType.str( type ), info, plugin, info->name._raw, info->path._raw
+        );
 
-                struct ctune_FileOut * fo = dlsym( plugin->handle, "ctune_FileOutput" );
+        return true; //EARLY RETURN
+    }
 
-                if( ( error = dlerror() ) != NULL ) {
-                    CTUNE_LOG( CTUNE_LOG_FATAL,
-                               "[ctune_Plugin_loadPlugin( %p )] Failed linking: %s ('%s')",
-                               handle, error, ctune_PluginType.str( *plugin_type )
-                    );
+    CTUNE_LOG( CTUNE_LOG_FATAL,
+               "[ctune_Plugin_link( '%s', %p, %p )] Failed linking: %s (\"%s\")",
+               ctune_PluginType.str( type ), info, plugin, ( error ? error : "missing interface" ), info->path._raw
+    );
 
-                    ctune_err.set ( CTUNE_ERR_IO_PLUGIN_LINK );
-                    Vector.remove( &private.audio_recorders.list, Vector.size( &private.audio_recorders.list ) - 1 );
+    fail:
+        ctune_err.set( CTUNE_ERR_IO_PLUGIN_LINK );
+        dlclose( handle );
+        return false;
+}
 
-                } else {
-                    plugin->name        = fo->name;
-                    plugin->description = fo->description;
-                    plugin->extension   = fo->extension;
-                    plugin->init        = fo->init;
-                    plugin->write       = fo->write;
-                    plugin->close       = fo->close;
+/**
+ * [PRIVATE] Registers a plugin from its manifest entry (the plugin itself is linked on first use)
+ * @param entry Manifest entry
+ * @return Success
+ */
+static bool ctune_Plugin_register( const ctune_Plugin_Manifest_t * entry ) {
+    Vector_t   * list        = NULL;
+    Vector_t   * info        = NULL;
+    size_t       iface_size  = 0;
+    unsigned int abi_version = 0;
 
-                    plugin_name = plugin->name();
-                }
-            }
+    switch( entry->type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
+            list        = &private.audio_players.list;
+            info        = &private.audio_players.info;
+            iface_size  = sizeof( ctune_Player_t );
+            abi_version = CTUNE_PLAYER_ABI_VERSION;
+        } break;
+
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
+            list        = &private.audio_servers.list;
+            info        = &private.audio_servers.info;
+            iface_size  = sizeof( ctune_AudioOut_t );
+            abi_version = CTUNE_AUDIOOUT_ABI_VERSION;
+        } break;
+
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
+            list        = &private.audio_recorders.list;
+            info        = &private.audio_recorders.info;
+            iface_size  = sizeof( ctune_FileOut_t );
+            abi_version = CTUNE_FILEOUT_ABI_VERSION;
         } break;
+
+        default: {
+            CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_Plugin_register( %p )] Unknown plugin type (%i).", entry, entry->type );
+            return false; //EARLY RETURN
+        }
+    }
+
+    if( entry->abi_version != abi_version ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_Plugin_register( %p )] %s ABI version mismatch: plugin=%d, ctune=%d (\"%s\").",
+                   entry, ctune_PluginType.str( entry->type ), entry->abi_version, abi_version, entry->path._raw
+        );
+
+        return false; //EARLY RETURN
+    }
+
+    void                    * iface = Vector.emplace_back( list );
+    ctune_Plugin_Manifest_t * copy  = ( iface ? Vector.init_back( info, ctune_Plugin_initManifest ) : NULL );
+
+    if( copy == NULL ) {
+        if( iface ) {
+            Vector.remove( list, Vector.size( list ) - 1 );
+        }
+
+        ctune_err.set( CTUNE_ERR_MALLOC );
+        return false; //EARLY RETURN
     }
 
-    return plugin_name;
+    memset( iface, 0, iface_size ); //unlinked
+    ctune_Plugin_copyManifest( entry, copy );
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Makes sure a plugin is linked
+ * -
+ * Note: the linked state is checked under the lock too as `ctune_Plugin_link(..)` fills the interface field by field
+ * @param type   Plugin type enum
+ * @param plugin Pointer to a plugin interface inside the list of the type (can be NULL)
+ * @return Pointer to the linked plugin interface or NULL on failure
+ */
+static void * ctune_Plugin_ensureLinked( ctune_PluginType_e type, void * plugin ) {
+    Vector_t * list = NULL;
+    Vector_t * info = NULL;
+
+    if( plugin == NULL ) {
+        return NULL; //EARLY RETURN - nothing selected
+    }
+
+    switch( type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : { list = &private.audio_players.list;   info = &private.audio_players.info;   } break;
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : { list = &private.audio_servers.list;   info = &private.audio_servers.info;   } break;
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: { list = &private.audio_recorders.list; info = &private.audio_recorders.info; } break;
+        default                             : return NULL; //EARLY RETURN
+    }
+
+    void * linked = NULL;
+
+    pthread_mutex_lock( &private.lock );
+
+    for( size_t i = 0; i < Vector.size( list ); ++i ) {
+        if( Vector.at( list, i ) == plugin ) {
+            if( *(void **) plugin != NULL || ctune_Plugin_link( type, Vector.at( info, i ), plugin ) ) {
+                linked = plugin;
+            }
+
+            break;
+        }
+    }
+
+    pthread_mutex_unlock( &private.lock );
+
+    return linked;
 }
 
 /**
@@ -287,17 +698,110 @@ static const Vector_t * ctune_Plugin_getPluginList( ctune_PluginType_e type ) {
     }
 }
 
+/**
+ * [PRIVATE] Gets the manifest entries of the registered plugins of a specified type
+ * @param type Plugin type enum
+ * @return Pointer to internal manifest list of specified type (or NULL on error)
+ */
+static Vector_t * ctune_Plugin_getInfoList( ctune_PluginType_e type ) {
+    switch( type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : return &private.audio_players.info;
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : return &private.audio_servers.info;
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: return &private.audio_recorders.info;
+        default                             : return NULL;
+    }
+}
+
+/**
+ * [PRIVATE] Gets the list index of the currently selected plugin of a specified type
+ * @param type  Plugin type enum
+ * @param index Pointer to the index variable to set
+ * @return Selected state
+ */
+static bool ctune_Plugin_getSelectedIndex( ctune_PluginType_e type, size_t * index ) {
+    Vector_t   * list     = (Vector_t *) ctune_Plugin_getPluginList( type );
+    const void * selected = NULL;
+
+    switch( type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : selected = private.audio_players.selected;   break;
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : selected = private.audio_servers.selected;   break;
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: selected = private.audio_recorders.selected; break;
+        default                             : return false; //EARLY RETURN
+    }
+
+    for( size_t i = 0; selected != NULL && i < Vector.size( list ); ++i ) {
+        if( Vector.at( list, i ) == selected ) {
+            *index = i;
+            return true; //EARLY RETURN
+        }
+    }
+
+    return false;
+}
+
+/**
+ * [PRIVATE] Sets the plugin at a given index of its type list as 'selected'
+ * @param type  Plugin type enum
+ * @param index Index of the plugin in the list of the type
+ */
+static void ctune_Plugin_select( ctune_PluginType_e type, size_t index ) {
+    void * p = Vector.at( (Vector_t *) ctune_Plugin_getPluginList( type ), index );
+
+    switch( type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : private.audio_players.selected   = p; break;
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : private.audio_servers.selected   = p; break;
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: private.audio_recorders.selected = p; break;
+        default                             : break;
+    }
+}
+
+/**
+ * [PRIVATE] Finds a plugin by its name
+ * @param type  Plugin type enum
+ * @param name  Plugin name
+ * @param index Pointer to the index variable to set (can be NULL)
+ * @return Found state
+ */
+static bool ctune_Plugin_find( ctune_PluginType_e type, const char * name, size_t * index ) {
+    Vector_t * info = ctune_Plugin_getInfoList( type );
+
+    if( info == NULL || name == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    for( size_t i = 0; i < Vector.size( info ); ++i ) {
+        const ctune_Plugin_Manifest_t * e = Vector.at( info, i );
+
+        if( strcmp( e->name._raw, name ) == 0 ) {
+            if( index ) {
+                *index = i;
+            }
+
+            return true; //EARLY RETURN
+        }
+    }
+
+    return false;
+}
+
 /**
  * Initialises plugin engine
  */
 static void ctune_Plugin_init( void ) {
+    private.manifest.entries     = Vector.init( sizeof( ctune_Plugin_Manifest_t ), ctune_Plugin_freeManifest );
     private.audio_players.list   = Vector.init( sizeof( ctune_Player_t ), ctune_Plugin_freePlayer );
+    private.audio_players.info   = Vector.init( sizeof( ctune_Plugin_Manifest_t ), ctune_Plugin_freeManifest );
     private.audio_servers.list   = Vector.init( sizeof( ctune_AudioOut_t ), ctune_Plugin_freeAudioOut );
+    private.audio_servers.info   = Vector.init( sizeof( ctune_Plugin_Manifest_t ), ctune_Plugin_freeManifest );
     private.audio_recorders.list = Vector.init( sizeof( ctune_FileOut_t ), ctune_Plugin_freeSoundFileOutput );
+    private.audio_recorders.info = Vector.init( sizeof( ctune_Plugin_Manifest_t ), ctune_Plugin_freeManifest );
 }
 
 /**
  * Loads all compatible plugins found in a directory
+ * -
+ * Plugins are registered from the cached manifest (keyed on path, mtime and size) and only
+ * get linked on first use. Files that are new or changed since the last scan are inspected.
  * @param dir_path Directory path
  * @return Success
  */
@@ -311,12 +815,15 @@ bool ctune_Plugin_loadPlugins( const char * dir_path ) {
     DIR           * directory;
     struct dirent * directory_entry;
 
+    if( !private.manifest.loaded ) {
+        ctune_Plugin_readManifest();
+    }
+
     if( ( directory = opendir( dir_path ) ) == NULL ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
                    "[ctune_Plugin_loadPlugins( \"%s\" )] Failed to open directory.",
                    dir_path );
-        error_state = true;
-        goto end;
+        return false; //EARLY RETURN
     }
 
     size_t filename_ln = 0;
@@ -326,24 +833,22 @@ bool ctune_Plugin_loadPlugins( const char * dir_path ) {
             continue; //i.e. not a regular file and not enough chars in name for a '.so' extension
         }
 
-        const char * extension = ctune_substr( directory_entry->d_name, ( filename_ln - 3 ), 3 );
-
-        if( extension && strcmp( extension, ".so" ) == 0 ) {
+        if( strcmp( &directory_entry->d_name[ filename_ln - 3 ], ".so" ) == 0 ) {
             String_t filepath = String.init();
             String.append_back( &filepath, dir_path );
             String.append_back( &filepath, directory_entry->d_name );
 
-            const char * plugin_name = ctune_Plugin_loadPlugin( dlopen( filepath._raw, RTLD_NOW ) );
+            const ctune_Plugin_Manifest_t * entry = ctune_Plugin_getManifest( filepath._raw );
 
-            if( plugin_name ) {
+            if( entry && ctune_Plugin_register( entry ) ) {
                 CTUNE_LOG( CTUNE_LOG_MSG,
-                           "[ctune_Plugin_loadPlugins( \"%s\" )] Plugin loaded: %s",
-                           dir_path, plugin_name
+                           "[ctune_Plugin_loadPlugins( \"%s\" )] Plugin registered: %s",
+                           dir_path, entry->name._raw
                 );
 
             } else {
                 CTUNE_LOG( CTUNE_LOG_FATAL,
-                           "[ctune_Plugin_loadPlugins( \"%s\" )] Failed to link plugin '%s'.",
+                           "[ctune_Plugin_loadPlugins( \"%s\" )] Failed to register plugin '%s'.",
                            dir_path, directory_entry->d_name
                 );
 
@@ -354,9 +859,13 @@ bool ctune_Plugin_loadPlugins( const char * dir_path ) {
         }
     }
 
-    end:
-        closedir( directory );
-        return !( error_state );
+    closedir( directory );
+
+    if( private.manifest.changed ) {
+        ctune_Plugin_writeManifest();
+    }
+
+    return !( error_state );
 }
 
 /**
@@ -366,41 +875,7 @@ bool ctune_Plugin_loadPlugins( const char * dir_path ) {
  * @return Validation state
  */
 static bool ctune_Plugin_validate( ctune_PluginType_e type, const char * name ) {
-    switch( type ) {
-        case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
-            for( size_t i = 0; i < Vector.size( &private.audio_players.list ); ++i ) {
-                ctune_Player_t * p = Vector.at( &private.audio_players.list, i );
-
-                if( strcmp( p->name(), name ) == 0 ) {
-                    return true;
-                }
-            }
-        } break;
-
-        case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
-            for( size_t i = 0; i < Vector.size( &private.audio_servers.list ); ++i ) {
-                ctune_AudioOut_t * p = Vector.at( &private.audio_servers.list, i );
-
-                if( strcmp( p->name(), name ) == 0 ) {
-                    return true;
-                }
-            }
-        } break;
-
-        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
-            for( size_t i = 0; i < Vector.size( &private.audio_recorders.list ); ++i ) {
-                ctune_FileOut_t * p = Vector.at( &private.audio_recorders.list, i );
-
-                if( strcmp( p->name(), name ) == 0 ) {
-                    return true;
-                }
-            }
-        } break;
-
-        default: break;
-    }
-
-    return false;
+    return ctune_Plugin_find( type, name, NULL );
 }
 
 /**
@@ -410,56 +885,17 @@ static bool ctune_Plugin_validate( ctune_PluginType_e type, const char * name )
  * @return Success
  */
 static bool ctune_Plugin_setPluginByName( ctune_PluginType_e type, const char * name ) {
-    switch( type ) {
-        case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
-            for( size_t i = 0; i < Vector.size( &private.audio_players.list ); ++i ) {
-                ctune_Player_t * p = Vector.at( &private.audio_players.list, i );
-
-                if( strcmp( p->name(), name ) == 0 ) {
-                    CTUNE_LOG( CTUNE_LOG_DEBUG,
-                               "[ctune_Plugin_setPluginByName( '%s', \"%s\" )] Plugin set as selected: %p",
-                               ctune_PluginType.str( type ), name, p
-                    );
-
-                    private.audio_players.selected = p;
-                    return true;
-                }
-            }
-        } break;
+    size_t index = 0;
 
-        case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
-            for( size_t i = 0; i < Vector.size( &private.audio_servers.list ); ++i ) {
-                ctune_AudioOut_t * p = Vector.at( &private.audio_servers.list, i );
-
-                if( strcmp( p->name(), name ) == 0 ) {
-                    CTUNE_LOG( CTUNE_LOG_DEBUG,
-                               "[ctune_Plugin_setPluginByName( '%s', \"%s\" )] Plugin set as selected: %p",
-                               ctune_PluginType.str( type ), name, p
-                    );
-
-                    private.audio_servers.selected = p;
-                    return true;
-                }
-            }
-        } break;
+    if( ctune_Plugin_find( type, name, &index ) ) {
+        ctune_Plugin_select( type, index );
 
-        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
-            for( size_t i = 0; i < Vector.size( &private.audio_recorders.list ); ++i ) {
-                ctune_FileOut_t * p = Vector.at( &private.audio_recorders.list, i );
-
-                if( strcmp( p->name(), name ) == 0 ) {
-                    CTUNE_LOG( CTUNE_LOG_DEBUG,
-                               "[ctune_Plugin_setPluginByName( '%s', \"%s\" )] Plugin set as selected: %p",
-                               ctune_PluginType.str( type ), name, p
-                    );
-
-                    private.audio_recorders.selected = p;
-                    return true;
-                }
-            }
-        } break;
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_Plugin_setPluginByName( '%s', \"%s\" )] Plugin set as selected: #%lu",
+                   ctune_PluginType.str( type ), name, index
+        );
 
-        default: break;
+        return true; //EARLY RETURN
     }
 
     CTUNE_LOG( CTUNE_LOG_ERROR,
@@ -477,53 +913,19 @@ static bool ctune_Plugin_setPluginByName( ctune_PluginType_e type, const char *
  * @return Success
  */
 static bool ctune_Plugin_setPluginByID( ctune_PluginType_e type, size_t id ) {
-    switch( type ) {
-        case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
-            if( id < Vector.size( &private.audio_players.list ) ) {
-                ctune_Player_t * p = Vector.at( &private.audio_players.list, id );
-
-                private.audio_players.selected = p;
-
-                CTUNE_LOG( CTUNE_LOG_DEBUG,
-                           "[ctune_Plugin_setPluginByID( '%s', %lu )] Plugin '%s' set as selected: %p",
-                           ctune_PluginType.str( type ), id, p->name(), p
-                );
-
-                return true; //EARLY RETURN;
-            }
-        } break;
+    Vector_t * info = ctune_Plugin_getInfoList( type );
 
-        case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
-            if( id < Vector.size( &private.audio_servers.list ) ) {
-                ctune_AudioOut_t * p = Vector.at( &private.audio_servers.list, id );
-
-                private.audio_servers.selected = p;
-
-                CTUNE_LOG( CTUNE_LOG_DEBUG,
-                           "[ctune_Plugin_setPluginByID( '%s', %lu )] Plugin '%s' set as selected: %p",
-                           ctune_PluginType.str( type ), id, p->name(), p
-                );
-
-                return true; //EARLY RETURN;
-            }
-        } break;
+    if( info != NULL && id < Vector.size( info ) ) {
+        const ctune_Plugin_Manifest_t * e = Vector.at( info, id );
 
-        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
-            if( id < Vector.size( &private.audio_recorders.list ) ) {
-                ctune_FileOut_t * p = Vector.at( &private.audio_recorders.list, id );
+        ctune_Plugin_select( type, id );
 
-                private.audio_recorders.selected = p;
-
-                CTUNE_LOG( CTUNE_LOG_DEBUG,
-                           "[ctune_Plugin_setPluginByID( '%s', %lu )] Plugin '%s' set as selected: %p",
-                           ctune_PluginType.str( type ), id, p->name(), p
-                );
-
-                return true; //EARLY RETURN;
-            }
-        } break;
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_Plugin_setPluginByID( '%s', %lu )] Plugin '%s' set as selected.",
+                   ctune_PluginType.str( type ), id, e->name._raw
+        );
 
-        default: break;
+        return true; //EARLY RETURN;
     }
 
     CTUNE_LOG( CTUNE_LOG_ERROR,
@@ -540,10 +942,11 @@ static bool ctune_Plugin_setPluginByID( ctune_PluginType_e type, size_t id ) {
  * @return Allocated list (or NULL)
  */
 Vector_t * ctune_Plugin_getPluginInfoList( ctune_PluginType_e type ) {
-    const Vector_t * plugin_list = ctune_Plugin_getPluginList( type );
-    Vector_t       * v           = NULL;
+    Vector_t * info     = ctune_Plugin_getInfoList( type );
+    Vector_t * v        = NULL;
+    size_t     selected = 0;
 
-    if( plugin_list == NULL ) {
+    if( info == NULL ) {
         goto fail;
     }
 
@@ -553,54 +956,20 @@ Vector_t * ctune_Plugin_getPluginInfoList( ctune_PluginType_e type ) {
 
     (*v) = Vector.init( sizeof( ctune_PluginInfo_t ), NULL );
 
-    switch( type ) {
-        case CTUNE_PLUGIN_IN_STREAM_PLAYER: {
-            for( size_t i = 0; i < Vector.size( plugin_list ); ++i ) {
-                const ctune_Player_t * p = Vector.at( (Vector_t *) plugin_list, i );
-                ctune_PluginInfo_t   * e = Vector.emplace_back( v );
-
-                if( e ) {
-                    e->id          = i;
-                    e->type        = type,
-                    e->name        = p->name(),
-                    e->description = p->description();
-                    e->selected    = ( p == ctune_Plugin.getSelectedPlugin( type ) );
-                }
-            }
-        } break;
+    const bool has_selection = ctune_Plugin_getSelectedIndex( type, &selected );
 
-        case CTUNE_PLUGIN_OUT_AUDIO_SERVER: {
-            for( size_t i = 0; i < Vector.size( plugin_list ); ++i ) {
-                const ctune_AudioOut_t * p = Vector.at( (Vector_t *) plugin_list, i );
-                ctune_PluginInfo_t     * e = Vector.emplace_back( v );
-
-                if( e ) {
-                    e->id          = i;
-                    e->type        = type,
-                    e->name        = p->name(),
-                    e->description = p->description();
-                    e->selected    = ( p == ctune_Plugin.getSelectedPlugin( type ) );
-                }
-            }
-        } break;
+    for( size_t i = 0; i < Vector.size( info ); ++i ) {
+        const ctune_Plugin_Manifest_t * p = Vector.at( info, i );
+        ctune_PluginInfo_t            * e = Vector.emplace_back( v );
 
-        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: {
-            for( size_t i = 0; i < Vector.size( plugin_list ); ++i ) {
-                const ctune_FileOut_t * p = Vector.at( (Vector_t *) plugin_list, i );
-                ctune_PluginInfo_t    * e = Vector.emplace_back( v );
-
-                if( e ) {
-                    e->id          = i;
-                    e->type        = type,
-                    e->name        = p->name(),
-                    e->description = p->description();
-                    e->extension   = p->extension();
-                    e->selected    = ( p == ctune_Plugin.getSelectedPlugin( type ) );
-                }
-            }
-        } break;
-
-        default: goto fail;
+        if( e ) {
+            e->id          = i;
+            e->type        = type;
+            e->name        = p->name._raw;
+            e->description = p->description._raw;
+            e->extension   = ( type == CTUNE_PLUGIN_OUT_AUDIO_RECORDER ? p->extension._raw : NULL );
+            e->selected    = ( has_selection && selected == i );
+        }
     }
 
     return v;
@@ -618,15 +987,15 @@ Vector_t * ctune_Plugin_getPluginInfoList( ctune_PluginType_e type ) {
 }
 
 /**
- * Gets the currently selected plugin of a specified type
+ * Gets the currently selected plugin of a specified type (the plugin is linked on first call)
  * @param type Plugin type enum
  * @return Pointer to the selected plugin or NULL
  */
 static void * ctune_Plugin_getSelectedPlugin( ctune_PluginType_e type ) {
     switch( type ) {
-        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : return private.audio_players.selected;
-        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : return private.audio_servers.selected;
-        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: return private.audio_recorders.selected;
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : return ctune_Plugin_ensureLinked( type, private.audio_players.selected );
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : return ctune_Plugin_ensureLinked( type, private.audio_servers.selected );
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: return ctune_Plugin_ensureLinked( type, private.audio_recorders.selected );
         default                             : return NULL;
     }
 }
@@ -637,15 +1006,11 @@ static void * ctune_Plugin_getSelectedPlugin( ctune_PluginType_e type ) {
  * @return Name string or NULL
  */
 static const char * ctune_Plugin_getSelectedPluginName( ctune_PluginType_e type ) {
-    const void * p = ctune_Plugin.getSelectedPlugin( type );
-
-    if( p ) {
-        switch( type ) {
-            case CTUNE_PLUGIN_IN_STREAM_PLAYER  : return ((const ctune_Player_t   *) p )->name(); //EARLY RETURN
-            case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : return ((const ctune_AudioOut_t *) p )->name(); //EARLY RETURN
-            case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: return ((const ctune_FileOut_t  *) p )->name(); //EARLY RETURN
-            default                             : break;
-        }
+    size_t index = 0;
+
+    if( ctune_Plugin_getSelectedIndex( type, &index ) ) {
+        const ctune_Plugin_Manifest_t * e = Vector.at( ctune_Plugin_getInfoList( type ), index );
+        return e->name._raw; //EARLY RETURN
     }
 
     return NULL;
@@ -656,11 +1021,17 @@ static const char * ctune_Plugin_getSelectedPluginName( ctune_PluginType_e type
  */
 static void ctune_Plugin_free( void ) {
     Vector.clear_vector( &private.audio_players.list );
+    Vector.clear_vector( &private.audio_players.info );
     Vector.clear_vector( &private.audio_recorders.list );
+    Vector.clear_vector( &private.audio_recorders.info );
     Vector.clear_vector( &private.audio_servers.list );
+    Vector.clear_vector( &private.audio_servers.info );
+    Vector.clear_vector( &private.manifest.entries );
     private.audio_players.selected   = NULL;
     private.audio_recorders.selected = NULL;
     private.audio_servers.selected   = NULL;
+    private.manifest.loaded          = false;
+    private.manifest.changed         = false;
 
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Plugin_free()] Plugin(s) freed." );
 }
@@ -2,10 +2,14 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include "fs.h"
 #include "XDG.h"
 #include "Plugin.h"
+#include "StationFile.h"
 #include "../datastructure/HashMap.h"
 #include "logger/src/Logger.h"
 #include "../dto/RadioStationInfo.h"
@@ -14,16 +18,27 @@
 #include "../utils/utilities.h"
 #include "project_version.h"
 
+#define CTUNE_SETTINGS_FAV_JOURNAL_COMPACT_THRESHOLD 256 //number of journal records that triggers a snapshot compaction
+
 #define CFG_KEY_RESUME_VOL                      "Resume::Volume"
 #define CFG_KEY_LAST_STATION_PLAYED_UUID        "Resume::UUID"
 #define CFG_KEY_LAST_STATION_PLAYED_SRC         "Resume::SourceID"
+#define CFG_KEY_LAST_STATION_PLAYED_NAME        "Resume::Name"
+#define CFG_KEY_LAST_STATION_PLAYED_URL         "Resume::URL"
+#define CFG_KEY_LAST_STATION_PLAYED_URL_RES     "Resume::ResolvedURL"
+#define CFG_KEY_LAST_STATION_PLAYED_CODEC       "Resume::Codec"
+#define CFG_KEY_LAST_STATION_PLAYED_BITRATE     "Resume::Bitrate"
 #define CFG_KEY_INPUT_LIB                       "IO::Plugin::Player"
 #define CFG_KEY_OUTPUT_LIB                      "IO::Plugin::SoundServer"
 #define CFG_KEY_RECORD_LIB                      "IO::Plugin::Recorder"
 #define CFG_KEY_OVERWRITE_PLAYLOG               "IO::OverwritePlayLog"
 #define CFG_KEY_STREAM_TIMEOUT                  "IO::StreamTimeout"
 #define CFG_KEY_NETWORK_TIMEOUT                 "IO::NetworkTimeout"
+#define CFG_KEY_LOG_FLUSH_LATENCY               "IO::Log::FlushLatency"
 #define CFG_KEY_RECORDING_PATH                  "IO::Recording::Path"
+#define CFG_KEY_CATALOGUE_ENABLED               "Catalogue::Enabled"
+#define CFG_KEY_CATALOGUE_SYNC_INTERVAL         "Catalogue::SyncInterval"
+#define CFG_KEY_FAVOURITES_BINARY_STORE         "Favourites::BinaryStore"
 #define CFG_KEY_UI_MOUSE                        "UI::Mouse"
 #define CFG_KEY_UI_MOUSE_INTERVAL_PRESET        "UI::Mouse::IntervalPreset"
 #define CFG_KEY_UI_UNICODE_ICONS                "UI::UnicodeIcons"
@@ -58,8 +73,14 @@ static struct ctune_Settings_Cfg {
     bool         play_log_overwrite;
     int          timeout_stream_val;
     int          timeout_network_val;
+    int          log_flush_latency; //in milliseconds
     String_t     recording_path;
 
+    struct {
+        bool enabled;
+        int  sync_interval; //in hours
+    } catalogue;
+
     struct {
         const char * sys_lib_path;
         const char * input_plugin_dir;
@@ -85,33 +106,66 @@ static struct ctune_Settings_Cfg {
     ctune_UIConfig_t ui;
 
     struct {
+        pthread_mutex_t    lock;
         String_t           uuid;
         ctune_StationSrc_e src;
+        String_t           name;         //cached record for resuming without a lookup
+        String_t           url;          //cached record for resuming without a lookup
+        String_t           url_resolved; //cached record for resuming without a lookup
+        String_t           codec;        //cached record for resuming without a lookup
+        int                bitrate;      //cached record for resuming without a lookup
     } last_station;
 
 } config;
 
+/**
+ * Sorted favourites view entry
+ * @param key Cached sort key (leading bytes of the sorting attribute's string or its numeric value)
+ * @param rsi Pointer to the station inside the favourites HashMap collections
+ */
+typedef struct ctune_Settings_FavViewEntry {
+    uint64_t                         key;
+    const ctune_RadioStationInfo_t * rsi;
+
+} ctune_Settings_FavViewEntry_t;
+
 static struct ctune_Settings_Fav {
     const char * file_name;
     const char * backup_name;
-    HashMap_t    favs[CTUNE_STATIONSRC_COUNT];
-
-    ctune_RadioStationInfo_SortBy_e sort_id;
-} favourites;
+    const char * tmp_name;
+    HashMap_t    favs[CTUNE_STATIONSRC_COUNT];    //stations added/updated since the snapshot + materialised snapshot records
+
+    struct { /* BINARY SNAPSHOT (queried in-place) */
+        const char        * file_name;
+        const char        * backup_name;
+        bool                enabled;              //snapshot format to compact into
+        ctune_StationFile_t file;                 //mapped snapshot (closed when the JSON snapshot was loaded)
+        HashMap_t           removed[CTUNE_STATIONSRC_COUNT]; //stations removed from the mapped snapshot
+        bool                convert;              //loaded snapshot is not in the configured format
+    } store;
 
-/**
- * [PRIVATE] Gets the total number of favourites stations in the collections
- * @return Tally of all favourites
- */
-static size_t ctune_Settings_favouriteCount( void ) {
-    size_t count = 0;
+    struct {
+        const char * file_name;
+        FILE       * file;    //append handle (opened on first write)
+        size_t       records; //number of changes not yet compacted into the snapshot file
+    } journal;
 
-    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
-        count += HashMap.size( &favourites.favs[i] );
-    }
+    struct {
+        pthread_mutex_t lock;
+        bool            pending; //favourites file was loaded but not yet backed-up
+        bool            binary;  //loaded favourites file is the binary snapshot
+    } backup;
+
+    struct { /* SORTED VIEW (read-only index over the HashMap collections) */
+        ctune_Settings_FavViewEntry_t * entries;
+        size_t                          length;
+        size_t                          capacity;
+        bool                            built;    //false until first accessed (and after a change of sorting attribute)
+    } view;
 
-    return count;
-}
+    ctune_RadioStationInfo_SortBy_e sort_id;
+    uint64_t                        generation; //bumped on each change of the favourites' membership
+} favourites;
 
 /**
  * Initialises all the variables for the Settings instance
@@ -120,9 +174,17 @@ static void ctune_Settings_init( void ) {
     favourites = (struct ctune_Settings_Fav) {
         .file_name   = "ctune.fav",
         .backup_name = "ctune.fav.bck",
+        .tmp_name    = "ctune.fav.tmp",
+        .store       = { .file_name = "ctune.fav.bin", .backup_name = "ctune.fav.bin.bck", .enabled = false, .convert = false },
+        .journal     = { .file_name = "ctune.fav.journal", .file = NULL, .records = 0 },
+        .backup      = { .lock = PTHREAD_MUTEX_INITIALIZER, .pending = false, .binary = false },
+        .view        = { .entries = NULL, .length = 0, .capacity = 0, .built = false },
         .sort_id     = CTUNE_RADIOSTATIONINFO_SORTBY_NONE,
+        .generation  = 1,
     };
 
+    favourites.store.file = ctune_StationFile.init();
+
     config = (struct ctune_Settings_Cfg) {
         .loaded                 = false,
         .file_name              = "ctune.cfg",
@@ -130,8 +192,14 @@ static void ctune_Settings_init( void ) {
         .play_log_overwrite     = true,
         .timeout_stream_val     = 5, //in seconds
         .timeout_network_val    = 8, //in seconds
+        .log_flush_latency      = 200, //in milliseconds
         .recording_path         = String.init(),
 
+        .catalogue = {
+            .enabled            = false,
+            .sync_interval      = 24, //in hours
+        },
+
         .io_libs = {
             .sys_lib_path           = CTUNE_SYSLIB_PATH,
             .input_plugin_dir       = "/plugins/input/",
@@ -145,8 +213,14 @@ static void ctune_Settings_init( void ) {
         },
 
         .last_station = {
-            .uuid = String.init(),
-            .src  = CTUNE_STATIONSRC_LOCAL,
+            .lock         = PTHREAD_MUTEX_INITIALIZER,
+            .uuid         = String.init(),
+            .src          = CTUNE_STATIONSRC_LOCAL,
+            .name         = String.init(),
+            .url          = String.init(),
+            .url_resolved = String.init(),
+            .codec        = String.init(),
+            .bitrate      = 0,
         },
     };
 
@@ -164,12 +238,31 @@ static void ctune_Settings_free() {
     String.free( &config.io_libs.sound_server.name );
     String.free( &config.io_libs.recorder.name );
     String.free( &config.last_station.uuid );
+    String.free( &config.last_station.name );
+    String.free( &config.last_station.url );
+    String.free( &config.last_station.url_resolved );
+    String.free( &config.last_station.codec );
     String.free( &config.recording_path );
 
     ctune_Plugin.free();
 
     for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
         HashMap.clear( &favourites.favs[ i ] );
+        HashMap.clear( &favourites.store.removed[ i ] );
+    }
+
+    ++favourites.generation;
+    ctune_StationFile.close( &favourites.store.file );
+
+    free( favourites.view.entries );
+    favourites.view.entries  = NULL;
+    favourites.view.length   = 0;
+    favourites.view.capacity = 0;
+    favourites.view.built    = false;
+
+    if( favourites.journal.file != NULL ) {
+        fclose( favourites.journal.file );
+        favourites.journal.file = NULL;
     }
 
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_free()] Settings freed." );
@@ -262,6 +355,26 @@ static bool ctune_Settings_rtlock_unlock( void ) {
 }
 
 //===================================== CTUNE CONFIG ===============================================
+/**
+ * [PRIVATE] Copies a config value with its surrounding quotes removed
+ * @param val    Config value
+ * @param target String to copy the value into
+ * @return Success
+ */
+static bool ctune_Settings_unquote( const String_t * val, String_t * target ) {
+    const size_t ln = String.length( val );
+
+    if( ln >= 2 && val->_raw[0] == '\"' && val->_raw[ ln - 1 ] == '\"' ) {
+        char * substr = ctune_substr( val->_raw, 1, ( ln - 2 ) );
+        bool   ret    = ( substr != NULL && String.set( target, substr ) );
+
+        free( substr );
+        return ret; //EARLY RETURN
+    }
+
+    return String.copy( target, val );
+}
+
 /**
  * Loads the setting file
  * @return Success
@@ -313,6 +426,21 @@ static bool ctune_Settings_loadCfg() {
                     }
                 }
 
+            } else if( strcmp( CFG_KEY_LAST_STATION_PLAYED_NAME, key._raw ) == 0 ) { //quoted string
+                error = !ctune_Settings_unquote( &val, &config.last_station.name );
+
+            } else if( strcmp( CFG_KEY_LAST_STATION_PLAYED_URL, key._raw ) == 0 ) { //quoted string
+                error = !ctune_Settings_unquote( &val, &config.last_station.url );
+
+            } else if( strcmp( CFG_KEY_LAST_STATION_PLAYED_URL_RES, key._raw ) == 0 ) { //quoted string
+                error = !ctune_Settings_unquote( &val, &config.last_station.url_resolved );
+
+            } else if( strcmp( CFG_KEY_LAST_STATION_PLAYED_CODEC, key._raw ) == 0 ) { //quoted string
+                error = !ctune_Settings_unquote( &val, &config.last_station.codec );
+
+            } else if( strcmp( CFG_KEY_LAST_STATION_PLAYED_BITRATE, key._raw ) == 0 ) { //int
+                error = !ctune_Parser_KVPairs.validateInteger( &val, &config.last_station.bitrate );
+
             } else if( strcmp( CFG_KEY_RESUME_VOL, key._raw ) == 0 ) { //int
                 int vol = config.resume_volume;
 
@@ -416,6 +544,48 @@ static bool ctune_Settings_loadCfg() {
             } else if( strcmp( CFG_KEY_NETWORK_TIMEOUT, key._raw ) == 0 ) { //int
                 error = !ctune_Parser_KVPairs.validateInteger( &val, &config.timeout_network_val );
 
+            } else if( strcmp( CFG_KEY_LOG_FLUSH_LATENCY, key._raw ) == 0 ) { //int
+                int tmp_val = 0;
+                error = !ctune_Parser_KVPairs.validateInteger( &val, &tmp_val );
+
+                if( !error ) {
+                    if( tmp_val >= 0 ) {
+                        config.log_flush_latency = tmp_val;
+
+                    } else {
+                        error = true;
+
+                        CTUNE_LOG( CTUNE_LOG_ERROR,
+                                   "[ctune_Settings_loadCfg()] Line #%lu: value (%i) is not a valid log flush latency.",
+                                   n, tmp_val
+                        );
+                    }
+                }
+
+            } else if( strcmp( CFG_KEY_FAVOURITES_BINARY_STORE, key._raw ) == 0 ) { //bool
+                error = !ctune_Parser_KVPairs.validateBoolean( &val, &favourites.store.enabled );
+
+            } else if( strcmp( CFG_KEY_CATALOGUE_ENABLED, key._raw ) == 0 ) { //bool
+                error = !ctune_Parser_KVPairs.validateBoolean( &val, &config.catalogue.enabled );
+
+            } else if( strcmp( CFG_KEY_CATALOGUE_SYNC_INTERVAL, key._raw ) == 0 ) { //int
+                int tmp_val = 0;
+                error = !ctune_Parser_KVPairs.validateInteger( &val, &tmp_val );
+
+                if( !error ) {
+                    if( tmp_val > 0 ) {
+                        config.catalogue.sync_interval = tmp_val;
+
+                    } else {
+                        error = true;
+
+                        CTUNE_LOG( CTUNE_LOG_ERROR,
+                                   "[ctune_Settings_loadCfg()] Line #%lu: value (%i) is not a valid sync interval.",
+                                   n, tmp_val
+                        );
+                    }
+                }
+
             } else if( strcmp( CFG_KEY_RECORDING_PATH, key._raw ) == 0 ) { //string
                 if( !String.empty( &val ) ) {
                     size_t       ln     = String.length( &val );
@@ -567,49 +737,61 @@ static bool ctune_Settings_writeCfg() {
         goto end;
     }
 
-    int ret[33];
+    int ret[43];
 
+    pthread_mutex_lock( &config.last_station.lock );
     ret[ 0] = fprintf( file, "%s=%s\n", CFG_KEY_LAST_STATION_PLAYED_UUID, String.empty( &config.last_station.uuid ) ? "" : config.last_station.uuid._raw ) ;
     ret[ 1] = fprintf( file, "%s=%i\n", CFG_KEY_LAST_STATION_PLAYED_SRC, config.last_station.src );
-    ret[ 2] = fprintf( file, "%s=%d\n", CFG_KEY_RESUME_VOL, config.resume_volume );
-    ret[ 3] = fprintf( file, "%s=%s\n", CFG_KEY_INPUT_LIB, ( String.empty( &config.io_libs.player.name ) ? "" : config.io_libs.player.name._raw ) );
-    ret[ 4] = fprintf( file, "%s=%s\n", CFG_KEY_OUTPUT_LIB, ( String.empty( &config.io_libs.sound_server.name ) ? "" : config.io_libs.sound_server.name._raw ) );
-    ret[ 4] = fprintf( file, "%s=%s\n", CFG_KEY_RECORD_LIB, ( String.empty( &config.io_libs.recorder.name ) ? "" : config.io_libs.recorder.name._raw ) );
-    ret[ 5] = fprintf( file, "%s=%s\n", CFG_KEY_OVERWRITE_PLAYLOG, ( config.play_log_overwrite ? "true" : "false" ) );
-    ret[ 6] = fprintf( file, "%s=%d\n", CFG_KEY_STREAM_TIMEOUT, config.timeout_stream_val );
-    ret[ 7] = fprintf( file, "%s=%d\n", CFG_KEY_NETWORK_TIMEOUT, config.timeout_network_val );
-    ret[ 8] = fprintf( file, "%s=\"%s\"\n", CFG_KEY_RECORDING_PATH, ( String.empty( &config.recording_path ) ? "" : config.recording_path._raw ) );
-
-    ret[ 9] = fprintf( file, "%s=%s\n", CFG_KEY_UI_MOUSE, ( config.ui.mouse.enabled ? "true" : "false" ) );
-    ret[10] = fprintf( file, "%s=%i\n", CFG_KEY_UI_MOUSE_INTERVAL_PRESET, config.ui.mouse.interval_preset );
-    ret[11] = fprintf( file, "%s=%s\n", CFG_KEY_UI_UNICODE_ICONS, ( config.ui.unicode_icons ? "true" : "false" ) );
-    ret[12] = fprintf( file, "%s=%s\n", CFG_KEY_UI_FAVTAB_SHOW_THEMING, ( config.ui.fav_tab.theme_favourites ? "true" : "false" ) );
-    ret[13] = fprintf( file, "%s=%s\n", CFG_KEY_UI_FAVTAB_USE_CUSTOM_THEMING, ( config.ui.fav_tab.custom_theming ? "true" : "false" ) );
-    ret[14] = fprintf( file, "%s=%s\n", CFG_KEY_UI_FAVTAB_LRG, ( config.ui.fav_tab.large_rows ? "true" : "false" ) );
-    ret[15] = fprintf( file, "%s=%i\n", CFG_KEY_UI_FAVTAB_SORTBY, favourites.sort_id );
-    ret[16] = fprintf( file, "%s=%s\n", CFG_KEY_UI_SEARCHTAB_LRG, ( config.ui.search_tab.large_rows ? "true" : "false" ) );
-    ret[17] = fprintf( file, "%s=%s\n", CFG_KEY_UI_BROWSERTAB_LRG, ( config.ui.browse_tab.large_rows ? "true" : "false" ) );
-
-    ret[18] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_PRESET, ctune_UIPreset.str( config.ui.theme.preset ) );
-    ret[19] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME, ctune_ColourTheme.str( config.ui.theme.custom_pallet.foreground, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.background, true ) );
-    ret[20] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_ROW, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.foreground, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.background, true ) );
-    ret[21] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_ROW_SELECTED_FOCUSED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_focused_fg, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_focused_bg, true ) );
-    ret[22] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_ROW_SELECTED_UNFOCUSED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_unfocused_fg, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_unfocused_bg, true ) );
-    ret[23] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ROW_FAVOURITE_LOCAL, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.favourite_local_fg, true ) );
-    ret[24] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ROW_FAVOURITE_REMOTE, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.favourite_remote_fg, true ) );
-
-    ret[25] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_PLAYBACK_ON, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.playback_on, true ) );
-    ret[26] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_PLAYBACK_REC, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.playback_rec, true ) );
-    ret[27] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_PLAYBACK_OFF, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.playback_off, true ) );
-    ret[28] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_QUEUED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.queued_station, true ) );
-
-    ret[29] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_FIELD_INVALID, ctune_ColourTheme.str( config.ui.theme.custom_pallet.field.invalid_fg, true ) );
-
-    ret[30] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_BUTTON, ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.foreground, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.background, true ) );
-    ret[31] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_BUTTON_INVALID, ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.invalid_fg, true ) );
-    ret[32] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_BUTTON_VALIDATED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.validated_fg, true ) );
-
-    for( size_t item_no = 0; item_no < 16; ++item_no ) {
+    ret[ 2] = fprintf( file, "%s=\"%s\"\n", CFG_KEY_LAST_STATION_PLAYED_NAME, ctune_fallbackStr( config.last_station.name._raw, "" ) );
+    ret[ 3] = fprintf( file, "%s=\"%s\"\n", CFG_KEY_LAST_STATION_PLAYED_URL, ctune_fallbackStr( config.last_station.url._raw, "" ) );
+    ret[ 4] = fprintf( file, "%s=\"%s\"\n", CFG_KEY_LAST_STATION_PLAYED_URL_RES, ctune_fallbackStr( config.last_station.url_resolved._raw, "" ) );
+    ret[ 5] = fprintf( file, "%s=\"%s\"\n", CFG_KEY_LAST_STATION_PLAYED_CODEC, ctune_fallbackStr( config.last_station.codec._raw, "" ) );
+    ret[ 6] = fprintf( file, "%s=%d\n", CFG_KEY_LAST_STATION_PLAYED_BITRATE, config.last_station.bitrate );
+    pthread_mutex_unlock( &config.last_station.lock );
+    ret[ 7] = fprintf( file, "%s=%d\n", CFG_KEY_RESUME_VOL, config.resume_volume );
+    ret[ 8] = fprintf( file, "%s=%s\n", CFG_KEY_INPUT_LIB, ( String.empty( &config.io_libs.player.name ) ? "" : config.io_libs.player.name._raw ) );
+    ret[ 9] = fprintf( file, "%s=%s\n", CFG_KEY_OUTPUT_LIB, ( String.empty( &config.io_libs.sound_server.name ) ? "" : config.io_libs.sound_server.name._raw ) );
+    ret[10] = fprintf( file, "%s=%s\n", CFG_KEY_RECORD_LIB, ( String.empty( &config.io_libs.recorder.name ) ? "" : config.io_libs.recorder.name._raw ) );
+    ret[11] = fprintf( file, "%s=%s\n", CFG_KEY_OVERWRITE_PLAYLOG, ( config.play_log_overwrite ? "true" : "false" ) );
+    ret[12] = fprintf( file, "%s=%d\n", CFG_KEY_STREAM_TIMEOUT, config.timeout_stream_val );
+    ret[13] = fprintf( file, "%s=%d\n", CFG_KEY_NETWORK_TIMEOUT, config.timeout_network_val );
+    ret[14] = fprintf( file, "%s=%d\n", CFG_KEY_LOG_FLUSH_LATENCY, config.log_flush_latency );
+    ret[15] = fprintf( file, "%s=\"%s\"\n", CFG_KEY_RECORDING_PATH, ( String.empty( &config.recording_path ) ? "" : config.recording_path._raw ) );
+
+    ret[16] = fprintf( file, "%s=%s\n", CFG_KEY_UI_MOUSE, ( config.ui.mouse.enabled ? "true" : "false" ) );
+    ret[17] = fprintf( file, "%s=%i\n", CFG_KEY_UI_MOUSE_INTERVAL_PRESET, config.ui.mouse.interval_preset );
+    ret[18] = fprintf( file, "%s=%s\n", CFG_KEY_UI_UNICODE_ICONS, ( config.ui.unicode_icons ? "true" : "false" ) );
+    ret[19] = fprintf( file, "%s=%s\n", CFG_KEY_UI_FAVTAB_SHOW_THEMING, ( config.ui.fav_tab.theme_favourites ? "true" : "false" ) );
+    ret[20] = fprintf( file, "%s=%s\n", CFG_KEY_UI_FAVTAB_USE_CUSTOM_THEMING, ( config.ui.fav_tab.custom_theming ? "true" : "false" ) );
+    ret[21] = fprintf( file, "%s=%s\n", CFG_KEY_UI_FAVTAB_LRG, ( config.ui.fav_tab.large_rows ? "true" : "false" ) );
+    ret[22] = fprintf( file, "%s=%i\n", CFG_KEY_UI_FAVTAB_SORTBY, favourites.sort_id );
+    ret[23] = fprintf( file, "%s=%s\n", CFG_KEY_UI_SEARCHTAB_LRG, ( config.ui.search_tab.large_rows ? "true" : "false" ) );
+    ret[24] = fprintf( file, "%s=%s\n", CFG_KEY_UI_BROWSERTAB_LRG, ( config.ui.browse_tab.large_rows ? "true" : "false" ) );
+
+    ret[25] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_PRESET, ctune_UIPreset.str( config.ui.theme.preset ) );
+    ret[26] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME, ctune_ColourTheme.str( config.ui.theme.custom_pallet.foreground, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.background, true ) );
+    ret[27] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_ROW, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.foreground, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.background, true ) );
+    ret[28] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_ROW_SELECTED_FOCUSED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_focused_fg, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_focused_bg, true ) );
+    ret[29] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_ROW_SELECTED_UNFOCUSED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_unfocused_fg, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.selected_unfocused_bg, true ) );
+    ret[30] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ROW_FAVOURITE_LOCAL, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.favourite_local_fg, true ) );
+    ret[31] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ROW_FAVOURITE_REMOTE, ctune_ColourTheme.str( config.ui.theme.custom_pallet.rows.favourite_remote_fg, true ) );
+
+    ret[32] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_PLAYBACK_ON, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.playback_on, true ) );
+    ret[33] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_PLAYBACK_REC, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.playback_rec, true ) );
+    ret[34] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_PLAYBACK_OFF, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.playback_off, true ) );
+    ret[35] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_ICON_QUEUED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.icons.queued_station, true ) );
+
+    ret[36] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_FIELD_INVALID, ctune_ColourTheme.str( config.ui.theme.custom_pallet.field.invalid_fg, true ) );
+
+    ret[37] = fprintf( file, "%s={%s,%s}\n", CFG_KEY_UI_THEME_BUTTON, ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.foreground, true ), ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.background, true ) );
+    ret[38] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_BUTTON_INVALID, ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.invalid_fg, true ) );
+    ret[39] = fprintf( file, "%s=%s\n", CFG_KEY_UI_THEME_BUTTON_VALIDATED, ctune_ColourTheme.str( config.ui.theme.custom_pallet.button.validated_fg, true ) );
+
+    ret[40] = fprintf( file, "%s=%s\n", CFG_KEY_CATALOGUE_ENABLED, ( config.catalogue.enabled ? "true" : "false" ) );
+    ret[41] = fprintf( file, "%s=%d\n", CFG_KEY_CATALOGUE_SYNC_INTERVAL, config.catalogue.sync_interval );
+    ret[42] = fprintf( file, "%s=%s\n", CFG_KEY_FAVOURITES_BINARY_STORE, ( favourites.store.enabled ? "true" : "false" ) );
+
+    for( size_t item_no = 0; item_no < ( sizeof( ret ) / sizeof( ret[0] ) ); ++item_no ) {
         if( ret[item_no] < 0 ) {
             CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeCfg()] Error writing to configuration file (\"%s\"): item #%lu", file_path._raw, item_no );
             error_state = true;
@@ -617,8 +799,10 @@ static bool ctune_Settings_writeCfg() {
     }
 
     end:
-        if( file != NULL )
-            fclose( file );
+        if( file != NULL && fclose( file ) != 0 ) { //buffered writes (i.e. the last keys in the file) only fail here
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeCfg()] Error closing configuration file (\"%s\").", file_path._raw );
+            error_state = true;
+        }
 
         String.free( &file_path );
         return !( error_state );
@@ -668,13 +852,130 @@ static ctune_StationSrc_e ctune_Settings_getLastPlayedSrc( void ) {
 }
 
 /**
- * Sets the UUID of the last station played to be saved in the configuration
- * @param uuid Radio station UUID to save
- * @param src  Source for Station UUID
+ * [PRIVATE] Copies a station string field into a cached record field (cleared if it cannot be stored on a single config line)
+ * @param target Cached record field
+ * @param str    Station field value (can be NULL)
+ */
+static void ctune_Settings_cacheField( String_t * target, const char * str ) {
+    if( str == NULL || strpbrk( str, "\r\n\"" ) != NULL ) {
+        String.free( target );
+    } else {
+        String.set( target, str );
+    }
+}
+
+/**
+ * [PRIVATE] Copies the resume record fields of a station into the config (lock must be held by caller)
+ * @param rsi Radio station
+ */
+static void ctune_Settings_cacheStationRecord( const ctune_RadioStationInfo_t * rsi ) {
+    config.last_station.bitrate = (int) ctune_RadioStationInfo.get.bitrate( rsi );
+    ctune_Settings_cacheField( &config.last_station.name, ctune_RadioStationInfo.get.stationName( rsi ) );
+    ctune_Settings_cacheField( &config.last_station.url, ctune_RadioStationInfo.get.stationURL( rsi ) );
+    ctune_Settings_cacheField( &config.last_station.url_resolved, ctune_RadioStationInfo.get.resolvedURL( rsi ) );
+    ctune_Settings_cacheField( &config.last_station.codec, ctune_RadioStationInfo.get.codec( rsi ) );
+}
+
+/**
+ * [THREAD SAFE] Sets the last station played to be saved in the configuration (UUID, source and the record needed to resume it)
+ * @param rsi Radio station
+ */
+static void ctune_Settings_setLastPlayedStation( const ctune_RadioStationInfo_t * rsi ) {
+    if( rsi == NULL ) {
+        return; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &config.last_station.lock );
+
+    if( String.set( &config.last_station.uuid, ctune_fallbackStr( ctune_RadioStationInfo.get.stationUUID( rsi ), "" ) ) ) {
+        config.last_station.src = ctune_RadioStationInfo.get.stationSource( rsi );
+        ctune_Settings_cacheStationRecord( rsi );
+    }
+
+    pthread_mutex_unlock( &config.last_station.lock );
+}
+
+/**
+ * [THREAD SAFE] Updates the cached record of the last station played if it is still the same station
+ * @param rsi Refreshed radio station
+ * @return Updated state
+ */
+static bool ctune_Settings_refreshLastPlayedStation( const ctune_RadioStationInfo_t * rsi ) {
+    bool updated = false;
+
+    if( rsi == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &config.last_station.lock );
+
+    updated = ( config.last_station.src == ctune_RadioStationInfo.get.stationSource( rsi )
+             && !String.empty( &config.last_station.uuid )
+             && strcmp( config.last_station.uuid._raw, ctune_fallbackStr( ctune_RadioStationInfo.get.stationUUID( rsi ), "" ) ) == 0 );
+
+    if( updated ) { //UUID string is left untouched as it may be referenced via `getLastPlayedUUID()`
+        ctune_Settings_cacheStationRecord( rsi );
+    }
+
+    pthread_mutex_unlock( &config.last_station.lock );
+
+    return updated;
+}
+
+/**
+ * [THREAD SAFE] Checks if a station is the last station played
+ * @param uuid Station UUID
+ * @param src  Station source
+ * @return Match state
+ */
+static bool ctune_Settings_isLastPlayedStation( const char * uuid, ctune_StationSrc_e src ) {
+    bool match = false;
+
+    if( uuid == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &config.last_station.lock );
+
+    match = ( config.last_station.src == src
+           && !String.empty( &config.last_station.uuid )
+           && strcmp( config.last_station.uuid._raw, uuid ) == 0 );
+
+    pthread_mutex_unlock( &config.last_station.lock );
+
+    return match;
+}
+
+/**
+ * [THREAD SAFE] Gets the cached record of the last station played
+ * @param rsi Initialised radio station to fill
+ * @return Success (false if there is no cached stream URL)
  */
-static void ctune_Settings_setLastPlayedStation( const char * uuid, ctune_StationSrc_e src ) {
-    if( String.set( &config.last_station.uuid, uuid ) )
-        config.last_station.src = src;
+static bool ctune_Settings_getLastPlayedStation( ctune_RadioStationInfo_t * rsi ) {
+    bool cached = false;
+
+    if( rsi == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &config.last_station.lock );
+
+    cached = !String.empty( &config.last_station.uuid )
+          && ( !String.empty( &config.last_station.url ) || !String.empty( &config.last_station.url_resolved ) );
+
+    if( cached ) {
+        ctune_RadioStationInfo.set.stationUUID( rsi, strdup( config.last_station.uuid._raw ) );
+        ctune_RadioStationInfo.set.stationName( rsi, strdup( ctune_fallbackStr( config.last_station.name._raw, "" ) ) );
+        ctune_RadioStationInfo.set.stationURL( rsi, strdup( ctune_fallbackStr( config.last_station.url._raw, "" ) ) );
+        ctune_RadioStationInfo.set.resolvedURL( rsi, strdup( ctune_fallbackStr( config.last_station.url_resolved._raw, "" ) ) );
+        ctune_RadioStationInfo.set.codec( rsi, strdup( ctune_fallbackStr( config.last_station.codec._raw, "" ) ) );
+        ctune_RadioStationInfo.set.bitrate( rsi, (ulong) config.last_station.bitrate );
+        ctune_RadioStationInfo.set.stationSource( rsi, config.last_station.src );
+    }
+
+    pthread_mutex_unlock( &config.last_station.lock );
+
+    return cached;
 }
 
 /**
@@ -720,6 +1021,30 @@ static int ctune_Settings_getNetworkTimeoutVal( void ) {
     return config.timeout_network_val;
 }
 
+/**
+ * Gets the maximum time log messages can be buffered before being written to the log file
+ * @return Latency in milliseconds
+ */
+static int ctune_Settings_logFlushLatency( void ) {
+    return config.log_flush_latency;
+}
+
+/**
+ * Gets the local station catalogue preference
+ * @return Enabled flag
+ */
+static bool ctune_Settings_catalogueEnabled( void ) {
+    return config.catalogue.enabled;
+}
+
+/**
+ * Gets the interval between syncs of the local station catalogue
+ * @return Interval in hours
+ */
+static int ctune_Settings_catalogueSyncInterval( void ) {
+    return config.catalogue.sync_interval;
+}
+
 /**
  * Get the recording directory path
  * @return Directory path
@@ -792,13 +1117,13 @@ static bool ctune_Settings_setUIConfig( const ctune_UIConfig_t * cfg ) {
  * @param backup_path Target backup file path
  * @return Success
  */
-static bool ctune_Settings_backupFavourites( const char * fav_path, const char * backup_path ) {
+static bool ctune_Settings_createBackup( const char * fav_path, const char * backup_path ) {
     bool error_state = false;
 
     if( ctune_fs.getFileState( backup_path, NULL ) == CTUNE_FILE_FOUND ) {
         if( remove( backup_path ) != 0 ) {
             CTUNE_LOG( CTUNE_LOG_ERROR,
-                       "[ctune_Settings_backupFavourites()] Failed to remove old backup file (\"%s\"): %s",
+                       "[ctune_Settings_createBackup()] Failed to remove old backup file (\"%s\"): %s",
                        backup_path,
                        strerror( errno )
             );
@@ -807,9 +1132,18 @@ static bool ctune_Settings_backupFavourites( const char * fav_path, const char *
         }
     }
 
+    if( link( fav_path, backup_path ) == 0 ) { //snapshot is only ever replaced (never rewritten) so sharing the inode is safe
+        goto end;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_Settings_createBackup()] Failed to link favourites to backup file (%s) - falling back to a copy.",
+               strerror( errno )
+    );
+
     if( rename( fav_path, backup_path ) != 0 ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_Settings_backupFavourites()] Failed to rename favourites into backup file (\"%s\" -> \"%s\"): %s",
+                   "[ctune_Settings_createBackup()] Failed to rename favourites into backup file (\"%s\" -> \"%s\"): %s",
                    fav_path,
                    backup_path,
                    strerror( errno )
@@ -820,7 +1154,7 @@ static bool ctune_Settings_backupFavourites( const char * fav_path, const char *
 
     if( !ctune_fs.duplicateFile( backup_path, fav_path, 1024 ) ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_Settings_backupFavourites()] Failed to duplicate file: \"%s\" -> \"%s\"",
+                   "[ctune_Settings_createBackup()] Failed to duplicate file: \"%s\" -> \"%s\"",
                    backup_path,
                    fav_path
         );
@@ -828,7 +1162,7 @@ static bool ctune_Settings_backupFavourites( const char * fav_path, const char *
         //revert renaming
         if( rename( backup_path, fav_path ) != 0 ) {
             CTUNE_LOG( CTUNE_LOG_FATAL,
-                       "[ctune_Settings_backupFavourites()] Failed to rename backup file back to favourites (\"%s\" -> \"%s\"): %s",
+                       "[ctune_Settings_createBackup()] Failed to rename backup file back to favourites (\"%s\" -> \"%s\"): %s",
                        backup_path,
                        fav_path,
                        strerror( errno )
@@ -844,169 +1178,1041 @@ static bool ctune_Settings_backupFavourites( const char * fav_path, const char *
 }
 
 /**
- * Load favourite stations from file
+ * [THREAD SAFE] Backs up the favourites file loaded at startup (once, and always before it is overwritten)
  * @return Success
  */
-static bool ctune_Settings_loadFavourites() {
-    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
-        favourites.favs[i] = HashMap.init( ctune_RadioStationInfo.free,
-                                           ctune_RadioStationInfo.dup,
-                                           ctune_RadioStationInfo.hash,
-                                           ctune_RadioStationInfo.sameUUID );
-    }
-
-    bool     error_state  = false;
-    String_t file_path    = String.init();
-    String_t backup_path  = String.init();
-    String_t file_content = String.init();
-    Vector_t station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+static bool ctune_Settings_backupFavourites( void ) {
+    bool     error_state = false;
+    String_t file_path   = String.init();
+    String_t backup_path = String.init();
 
-    ctune_XDG.resolveCfgFilePath( favourites.file_name, &file_path );
-    ctune_XDG.resolveCfgFilePath( favourites.backup_name, &backup_path );
+    pthread_mutex_lock( &favourites.backup.lock );
 
-    if( !ctune_fs.readFile( file_path._raw, &file_content ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_loadFavourites()] Failed to load file content." );
-        error_state = true;
+    if( !favourites.backup.pending ) {
         goto end;
-
     }
 
-    if( !ctune_Settings_backupFavourites( file_path._raw, backup_path._raw ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_loadFavourites()] Failed create backup." );
-    } else {
-        CTUNE_LOG( CTUNE_LOG_MSG, "[ctune_Settings_loadFavourites()] Backup successful." );
-    }
+    ctune_XDG.resolveCfgFilePath( ( favourites.backup.binary ? favourites.store.file_name : favourites.file_name ), &file_path );
+    ctune_XDG.resolveCfgFilePath( ( favourites.backup.binary ? favourites.store.backup_name : favourites.backup_name ), &backup_path );
 
-    if( !ctune_parser_JSON.parseToRadioStationList( &file_content, &station_list ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_loadFavourites()] Error converting file content to collection of stations (\"%s\").", file_path._raw );
+    if( !ctune_Settings_createBackup( file_path._raw, backup_path._raw ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_backupFavourites()] Failed create backup." );
         error_state = true;
-        goto end;
-    }
-
-    size_t count[CTUNE_STATIONSRC_COUNT];
-    size_t tally = 0;
-
-    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i )
-        count[i] = 0;
-
-    for( size_t i = 0; i < Vector.size( &station_list ); ++i ) {
-        ctune_RadioStationInfo_t * station = (ctune_RadioStationInfo_t *) Vector.at( &station_list, i );
-        ctune_RadioStationInfo.set.favourite( station, true );
-
-        const ctune_StationSrc_e src = ctune_RadioStationInfo.get.stationSource( station );
-
-        if( HashMap.add( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( station ), station ) ) {
-            ++count[src];
-            ++tally;
-        }
-    }
-
-    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
-        CTUNE_LOG( CTUNE_LOG_MSG,
-                   "[ctune_Settings_loadFavourites()] Loaded %lu '%s' favourite stations.",
-                   count[i], ctune_StationSrc.str( i ) );
+    } else {
+        CTUNE_LOG( CTUNE_LOG_MSG, "[ctune_Settings_backupFavourites()] Backup successful." );
     }
 
-    CTUNE_LOG( CTUNE_LOG_MSG,
-               "[ctune_Settings_loadFavourites()] Loaded %lu/%lu favourite stations.",
-               tally, Vector.size( &station_list ) );
+    favourites.backup.pending = false; //i.e. don't retry over a file that may have been saved since
 
     end:
+        pthread_mutex_unlock( &favourites.backup.lock );
         String.free( &file_path );
         String.free( &backup_path );
-        String.free( &file_content );
-        Vector.clear_vector( &station_list );
         return !( error_state );
 }
 
 /**
- * Writes the current favourite radio stations to the favourites file
- * @return Success
+ * [PRIVATE] Gets a station's record in the mapped snapshot
+ * @param uuid Station UUID
+ * @param src  Radio station provenance
+ * @return Record or NULL if not in the snapshot (or removed from it since)
  */
-static bool ctune_Settings_saveFavourites() {
-    CTUNE_LOG( CTUNE_LOG_MSG,
-               "[ctune_Settings_saveFavourites()] Saving %lu favourite station(s) to file \"%s\".",
-               ctune_Settings_favouriteCount(), favourites.file_name
-    );
+static const ctune_StationFile_Record_t * ctune_Settings_findStored( const char * uuid, ctune_StationSrc_e src ) {
+    if( uuid == NULL || !ctune_StationFile.isOpen( &favourites.store.file ) ) {
+        return NULL; //EARLY RETURN
+    }
 
-    bool     error_state  = false;
-    String_t file_path    = String.init();
-    FILE *   file         = NULL;
-    String_t json         = String.init();
-    Vector_t station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    const ctune_StationFile_Record_t * record = ctune_StationFile.find( &favourites.store.file, uuid );
 
-    ctune_XDG.resolveCfgFilePath( favourites.file_name, &file_path );
+    if( record == NULL || record->station_src != (uint32_t) src || HashMap.at( &favourites.store.removed[src], uuid ) != NULL ) {
+        return NULL; //EARLY RETURN
+    }
 
-    file = fopen( file_path._raw , "w" );
+    return record;
+}
 
-    if( !file ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_saveFavourites()] Error opening file \"%s\": %s", file_path._raw, strerror( errno ) );
-        error_state = true;
-        goto end;
-    }
+/**
+ * [PRIVATE] Checks if a snapshot record is overridden by the in-memory collections (updated or removed)
+ * @param record Record in the mapped snapshot
+ * @return Shadowed state
+ */
+static bool ctune_Settings_isShadowed( const ctune_StationFile_Record_t * record ) {
+    const char * uuid = ctune_StationFile.str( &favourites.store.file, record, CTUNE_STATIONFILE_STR_STATION_UUID );
 
-    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
-        HashMap.export( &favourites.favs[ i ], &station_list, ctune_RadioStationInfo.init, ctune_RadioStationInfo.copy );
+    if( record->station_src >= CTUNE_STATIONSRC_COUNT ) {
+        return true; //EARLY RETURN
     }
 
-    if( !ctune_parser_JSON.parseRadioStationListToJSON( &station_list, &json ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_saveFavourites()] Failed to parse stations to JSON format." );
-        error_state = true;
-        goto end;
+    return ( HashMap.at( &favourites.favs[record->station_src], uuid ) != NULL
+          || HashMap.at( &favourites.store.removed[record->station_src], uuid ) != NULL );
+}
+
+/**
+ * [PRIVATE] Gets the total number of favourites stations in the collections
+ * @return Tally of all favourites
+ */
+static size_t ctune_Settings_favouriteCount( void ) {
+    size_t count = 0;
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        count += HashMap.size( &favourites.favs[i] );
     }
 
-    if( fprintf( file, "%s", json._raw ) < 0 ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_saveFavourites()] Error writing to file \"%s\": %s", favourites.file_name, strerror( errno ) );
-        error_state = true;
-        goto end;
+    for( size_t i = 0; i < ctune_StationFile.size( &favourites.store.file ); ++i ) {
+        if( !ctune_Settings_isShadowed( ctune_StationFile.at( &favourites.store.file, i ) ) ) {
+            ++count;
+        }
     }
 
-    end:
-        String.free( &file_path );
-        String.free( &json );
-        Vector.clear_vector( &station_list );
-        fclose( file );
-        return !( error_state );
+    return count;
 }
 
 /**
- * Syncs a collection used for display the internal map state
- * @param stations View container
+ * [PRIVATE] Copies all the favourite stations into a collection
+ * @param stations Collection of RadioStationInfo_t objects
  * @return Success
  */
-static bool ctune_Settings_refreshFavourites( Vector_t * stations ) {
-    if( !Vector.empty( stations ) ) {
-        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_refreshFavourites( %p )] Vector is not empty - clearing...", stations );
-
-        if( !Vector.reinit( stations ) ) {
-            CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_refreshFavourites( %p )] Failed re-initialisation of vector.", stations );
-            return false; //EARLY RETURN
-        }
+static bool ctune_Settings_exportFavourites( Vector_t * stations ) {
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        HashMap.export( &favourites.favs[ i ], stations, ctune_RadioStationInfo.init, ctune_RadioStationInfo.copy );
     }
 
-    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i )
-        HashMap.export( &favourites.favs[ i ], stations, ctune_RadioStationInfo.init, ctune_RadioStationInfo.copy );
+    for( size_t i = 0; i < ctune_StationFile.size( &favourites.store.file ); ++i ) {
+        const ctune_StationFile_Record_t * record = ctune_StationFile.at( &favourites.store.file, i );
+
+        if( ctune_Settings_isShadowed( record ) ) {
+            continue;
+        }
+
+        ctune_RadioStationInfo_t * rsi = Vector.init_back( stations, ctune_RadioStationInfo.init );
+
+        if( rsi == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_exportFavourites( %p )] Failed to allocate station.", stations );
+            return false; //EARLY RETURN
+        }
+
+        ctune_StationFile.materialise( &favourites.store.file, record, rsi );
+        ctune_RadioStationInfo.set.favourite( rsi, true );
+    }
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Materialises a snapshot record into the favourites HashMap collections
+ * @param record Record in the mapped snapshot
+ * @return Pointer to the station inside the collection or NULL if it failed
+ */
+static const ctune_RadioStationInfo_t * ctune_Settings_materialiseStored( const ctune_StationFile_Record_t * record ) {
+    const ctune_RadioStationInfo_t * rsi = NULL;
+    ctune_RadioStationInfo_t         station;
+
+    ctune_RadioStationInfo.init( &station );
+    ctune_StationFile.materialise( &favourites.store.file, record, &station );
+    ctune_RadioStationInfo.set.favourite( &station, true );
+
+    const ctune_StationSrc_e src  = ctune_RadioStationInfo.get.stationSource( &station );
+    const char             * uuid = ctune_RadioStationInfo.get.stationUUID( &station );
+
+    if( (int) src >= 0 && (int) src < CTUNE_STATIONSRC_COUNT && uuid != NULL && HashMap.add( &favourites.favs[src], uuid, &station ) ) {
+        rsi = HashMap.at( &favourites.favs[src], uuid );
+    }
+
+    ctune_RadioStationInfo.freeContent( &station );
+    return rsi;
+}
+
+/**
+ * [PRIVATE] Packs the first 8 bytes of a string into a sort key (keys compare like `strcmp` when they differ)
+ * @param str String
+ * @return Sort key (NULL strings are given the max value so they sort last)
+ */
+static uint64_t ctune_Settings_strSortKey( const char * str ) {
+    if( str == NULL ) {
+        return UINT64_MAX; //EARLY RETURN
+    }
+
+    uint64_t key = 0;
+    bool     end = false;
+
+    for( size_t i = 0; i < sizeof( key ); ++i ) {
+        end = ( end || str[i] == '\0' );
+        key = ( key << 8 ) | ( end ? 0 : (unsigned char) str[i] );
+    }
+
+    return key;
+}
+
+/**
+ * [PRIVATE] Checks if the current sorting attribute is in descending order
+ * @return Descending state
+ */
+static bool ctune_Settings_viewSortDesc( void ) {
+    switch( favourites.sort_id ) {
+        case CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE_DESC     : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_NAME_DESC       : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_TAGS_DESC       : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_COUNTRY_DESC    : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_COUNTRYCODE_DESC: //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_STATE_DESC      : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_LANGUAGE_DESC   : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_CODEC_DESC      : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_BITRATE_DESC    : return true;
+        default                                            : return false;
+    }
+}
+
+/**
+ * [PRIVATE] Gets the string field of a station the current sorting attribute is based on
+ * @param rsi Radio station
+ * @return String (NULL if not set or if the sorting attribute is not a string field)
+ */
+static const char * ctune_Settings_viewSortStr( const ctune_RadioStationInfo_t * rsi ) {
+    switch( favourites.sort_id ) {
+        case CTUNE_RADIOSTATIONINFO_SORTBY_NAME            : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_NAME_DESC       : return ctune_RadioStationInfo.get.stationName( rsi );
+        case CTUNE_RADIOSTATIONINFO_SORTBY_TAGS            : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_TAGS_DESC       : return ctune_RadioStationInfo.get.tags( rsi );
+        case CTUNE_RADIOSTATIONINFO_SORTBY_COUNTRY         : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_COUNTRY_DESC    : return ctune_RadioStationInfo.get.country( rsi );
+        case CTUNE_RADIOSTATIONINFO_SORTBY_COUNTRYCODE     : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_COUNTRYCODE_DESC: return ctune_RadioStationInfo.get.countryCode( rsi );
+        case CTUNE_RADIOSTATIONINFO_SORTBY_STATE           : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_STATE_DESC      : return ctune_RadioStationInfo.get.state( rsi );
+        case CTUNE_RADIOSTATIONINFO_SORTBY_CODEC           : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_CODEC_DESC      : return ctune_RadioStationInfo.get.codec( rsi );
+        default                                            : return NULL;
+    }
+}
+
+/**
+ * [PRIVATE] Compares 2 strings with NULLs sorted last
+ * @param lhs String
+ * @param rhs String
+ * @return Result of comparison (<0: less, 0: equal, >0: greater)
+ */
+static int ctune_Settings_compareViewStr( const char * lhs, const char * rhs ) {
+    if( lhs == NULL || rhs == NULL ) {
+        return ( lhs == rhs ? 0 : ( lhs == NULL ? +1 : -1 ) ); //EARLY RETURN
+    }
+
+    return strcmp( lhs, rhs );
+}
+
+/**
+ * [PRIVATE] Computes the cached sort key of a station for the current sorting attribute
+ * -
+ * Only the primary attribute is cached; stations with equal keys are compared in full.
+ * @param rsi Radio station
+ * @return Sort key
+ */
+static uint64_t ctune_Settings_viewSortKey( const ctune_RadioStationInfo_t * rsi ) {
+    uint64_t key = 0;
+
+    switch( favourites.sort_id ) {
+        case CTUNE_RADIOSTATIONINFO_SORTBY_NONE         : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_LANGUAGE     : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_LANGUAGE_DESC: return 0; //i.e.: full comparison only
+
+        case CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE       : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE_DESC  : {
+            key = (uint64_t) ctune_RadioStationInfo.get.stationSource( rsi );
+        } break;
+
+        case CTUNE_RADIOSTATIONINFO_SORTBY_BITRATE      : //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_BITRATE_DESC : {
+            key = (uint64_t) ctune_RadioStationInfo.get.bitrate( rsi );
+        } break;
+
+        default: {
+            key = ctune_Settings_strSortKey( ctune_Settings_viewSortStr( rsi ) );
+        } break;
+    }
+
+    return ( ctune_Settings_viewSortDesc() ? ~key : key );
+}
+
+/**
+ * [PRIVATE] Compares two view entries (cached key, then full attribute, then address so the order is total)
+ * -
+ * Ties on the name (or the source) are broken on the bitrate like with `ctune_RadioStationInfo.compareBy(..)`.
+ * @param lhs Pointer to a ctune_Settings_FavViewEntry_t object
+ * @param rhs Pointer to a ctune_Settings_FavViewEntry_t object
+ * @return Result of comparison (-1: less, 0: equal, +1: greater)
+ */
+static int ctune_Settings_compareViewEntries( const void * lhs, const void * rhs ) {
+    const ctune_Settings_FavViewEntry_t * a    = lhs;
+    const ctune_Settings_FavViewEntry_t * b    = rhs;
+    int                                   comp = 0;
+
+    if( a->key != b->key ) {
+        return ( a->key < b->key ? -1 : +1 ); //EARLY RETURN
+    }
+
+    switch( favourites.sort_id ) {
+        case CTUNE_RADIOSTATIONINFO_SORTBY_NONE: break;
+
+        case CTUNE_RADIOSTATIONINFO_SORTBY_LANGUAGE: //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_LANGUAGE_DESC: {
+            comp = ctune_RadioStationInfo.compareBy( a->rsi, b->rsi, favourites.sort_id );
+        } break;
+
+        case CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE: //fallthrough
+        case CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE_DESC: {
+            comp = ctune_Settings_compareViewStr( ctune_RadioStationInfo.get.stationName( a->rsi ), ctune_RadioStationInfo.get.stationName( b->rsi ) );
+        } break;
+
+        default: {
+            comp = ctune_Settings_compareViewStr( ctune_Settings_viewSortStr( a->rsi ), ctune_Settings_viewSortStr( b->rsi ) );
+            comp = ( ctune_Settings_viewSortDesc() ? -comp : comp );
+        } break;
+    }
+
+    const bool by_name = ( favourites.sort_id == CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE || favourites.sort_id == CTUNE_RADIOSTATIONINFO_SORTBY_SOURCE_DESC
+                        || favourites.sort_id == CTUNE_RADIOSTATIONINFO_SORTBY_NAME   || favourites.sort_id == CTUNE_RADIOSTATIONINFO_SORTBY_NAME_DESC );
+
+    if( comp == 0 && by_name ) {
+        comp = ctune_RadioStationInfo.compareBy( a->rsi, b->rsi, CTUNE_RADIOSTATIONINFO_SORTBY_BITRATE );
+    }
+
+    if( comp != 0 ) {
+        return comp; //EARLY RETURN
+    }
+
+    return ( (uintptr_t) a->rsi < (uintptr_t) b->rsi ? -1 : ( (uintptr_t) a->rsi > (uintptr_t) b->rsi ? +1 : 0 ) );
+}
+
+/**
+ * [PRIVATE] Gets the position of a station in the sorted view (binary search)
+ * @param rsi Pointer to the station inside the favourites HashMap collections
+ * @return Position of the station or where it would be inserted if not in the view
+ */
+static size_t ctune_Settings_viewFind( const ctune_RadioStationInfo_t * rsi ) {
+    const ctune_Settings_FavViewEntry_t probe = { .key = ctune_Settings_viewSortKey( rsi ), .rsi = rsi };
+
+    size_t lo = 0;
+    size_t hi = favourites.view.length;
+
+    while( lo < hi ) {
+        const size_t mid = lo + ( hi - lo ) / 2;
+
+        if( ctune_Settings_compareViewEntries( &favourites.view.entries[mid], &probe ) < 0 ) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * [PRIVATE] Inserts a station in the sorted view (no-op when the view is not built)
+ * @param rsi Pointer to the station inside the favourites HashMap collections
+ */
+static void ctune_Settings_viewInsert( const ctune_RadioStationInfo_t * rsi ) {
+    if( !favourites.view.built || rsi == NULL ) {
+        return; //EARLY RETURN
+    }
+
+    if( favourites.view.length == favourites.view.capacity ) {
+        const size_t                    capacity = ( favourites.view.capacity == 0 ? 64 : favourites.view.capacity * 2 );
+        ctune_Settings_FavViewEntry_t * entries  = realloc( favourites.view.entries, capacity * sizeof( ctune_Settings_FavViewEntry_t ) );
+
+        if( entries == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_viewInsert( %p )] Failed to grow the view - rebuilding on next access.", rsi );
+            favourites.view.built = false;
+            return; //EARLY RETURN
+        }
+
+        favourites.view.entries  = entries;
+        favourites.view.capacity = capacity;
+    }
+
+    const size_t pos = ctune_Settings_viewFind( rsi );
+
+    if( pos < favourites.view.length && favourites.view.entries[pos].rsi == rsi ) {
+        return; //EARLY RETURN (already in view)
+    }
+
+    memmove( &favourites.view.entries[pos + 1], &favourites.view.entries[pos], ( favourites.view.length - pos ) * sizeof( ctune_Settings_FavViewEntry_t ) );
+
+    favourites.view.entries[pos] = (ctune_Settings_FavViewEntry_t) { .key = ctune_Settings_viewSortKey( rsi ), .rsi = rsi };
+    favourites.view.length      += 1;
+}
+
+/**
+ * [PRIVATE] Removes a station from the sorted view (no-op when the view is not built)
+ * @param rsi Pointer to the station inside the favourites HashMap collections
+ */
+static void ctune_Settings_viewRemove( const ctune_RadioStationInfo_t * rsi ) {
+    if( !favourites.view.built || rsi == NULL ) {
+        return; //EARLY RETURN
+    }
+
+    size_t pos = ctune_Settings_viewFind( rsi );
+
+    if( pos >= favourites.view.length || favourites.view.entries[pos].rsi != rsi ) { //i.e.: sort key fields changed in-place since insertion
+        for( pos = 0; pos < favourites.view.length && favourites.view.entries[pos].rsi != rsi; ++pos );
+    }
+
+    if( pos < favourites.view.length ) {
+        memmove( &favourites.view.entries[pos], &favourites.view.entries[pos + 1], ( favourites.view.length - pos - 1 ) * sizeof( ctune_Settings_FavViewEntry_t ) );
+        favourites.view.length -= 1;
+    }
+}
+
+/**
+ * [PRIVATE] Appends a station to the end of the view's entries (HashMap.forEach callback)
+ * @param value Pointer to the station inside the favourites HashMap collections
+ * @param arg   (unused)
+ */
+static void ctune_Settings_appendViewEntry( void * value, void * arg ) {
+    (void) arg;
+
+    favourites.view.entries[ favourites.view.length++ ] = (ctune_Settings_FavViewEntry_t) {
+        .key = ctune_Settings_viewSortKey( value ),
+        .rsi = value,
+    };
+}
+
+/**
+ * [PRIVATE] Builds the sorted view from scratch
+ * -
+ * Snapshot records not yet in the HashMap collections are materialised so that every favourite has a stable address.
+ * @return Success
+ */
+static bool ctune_Settings_buildView( void ) {
+    size_t count = 0;
+
+    for( size_t i = 0; i < ctune_StationFile.size( &favourites.store.file ); ++i ) {
+        const ctune_StationFile_Record_t * record = ctune_StationFile.at( &favourites.store.file, i );
+
+        if( !ctune_Settings_isShadowed( record ) && ctune_Settings_materialiseStored( record ) == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_buildView()] Failed to materialise snapshot record #%lu.", i );
+            return false; //EARLY RETURN
+        }
+    }
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        count += HashMap.size( &favourites.favs[i] );
+    }
+
+    if( count > favourites.view.capacity ) {
+        ctune_Settings_FavViewEntry_t * entries = realloc( favourites.view.entries, count * sizeof( ctune_Settings_FavViewEntry_t ) );
+
+        if( entries == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_buildView()] Failed to allocate view (%lu stations).", count );
+            return false; //EARLY RETURN
+        }
+
+        favourites.view.entries  = entries;
+        favourites.view.capacity = count;
+    }
+
+    favourites.view.length = 0;
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        HashMap.forEach( &favourites.favs[i], ctune_Settings_appendViewEntry, NULL );
+    }
+
+    qsort( favourites.view.entries, favourites.view.length, sizeof( ctune_Settings_FavViewEntry_t ), ctune_Settings_compareViewEntries );
+
+    favourites.view.built = true;
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_Settings_buildView()] Built view of %lu favourites (sorting: %s).",
+               favourites.view.length, ctune_RadioStationInfo.sortAttrStr( favourites.sort_id )
+    );
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Adds or replaces a station in the favourites collections
+ * @param station Pointer to a RadioStationInfo_t DTO
+ * @return Success
+ */
+static bool ctune_Settings_putFavourite( ctune_RadioStationInfo_t * station ) {
+    const ctune_StationSrc_e src  = ctune_RadioStationInfo.get.stationSource( station );
+    const char             * uuid = ctune_RadioStationInfo.get.stationUUID( station );
+
+    if( (int) src < 0 || (int) src >= CTUNE_STATIONSRC_COUNT || uuid == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    ctune_RadioStationInfo.set.favourite( station, true );
+    HashMap.remove( &favourites.store.removed[src], uuid );
+    ctune_Settings_viewRemove( HashMap.at( &favourites.favs[src], uuid ) );
+    HashMap.remove( &favourites.favs[src], uuid );
+
+    if( !HashMap.add( &favourites.favs[src], uuid, station ) ) {
+        return false; //EARLY RETURN
+    }
+
+    ctune_Settings_viewInsert( HashMap.at( &favourites.favs[src], uuid ) );
+    ++favourites.generation;
+    return true;
+}
+
+/**
+ * [PRIVATE] Removes a station from the favourites collections
+ * @param rsi Pointer to a RadioStationInfo_t DTO (only the UUID is required)
+ * @param src Radio station provenance
+ * @return Success (false if not a favourite)
+ */
+static bool ctune_Settings_dropFavourite( const ctune_RadioStationInfo_t * rsi, ctune_StationSrc_e src ) {
+    const char * uuid    = ctune_RadioStationInfo.get.stationUUID( rsi );
+    const bool   stored  = ( ctune_Settings_findStored( uuid, src ) != NULL );
+
+    ctune_Settings_viewRemove( HashMap.at( &favourites.favs[src], uuid ) );
+
+    const bool   removed = HashMap.remove( &favourites.favs[src], uuid );
+
+    if( stored ) {
+        HashMap.add( &favourites.store.removed[src], uuid, rsi );
+    }
+
+    ++favourites.generation;
+    return ( stored || removed );
+}
+
+/**
+ * [PRIVATE] Replays the favourites journal over the loaded snapshot
+ * -
+ * Records are single lines: '+ [<station JSON>]' for an addition/update and '- <source ID> <UUID>' for a removal.
+ * A malformed line (e.g.: torn write from a crash) is skipped.
+ * @return Number of records replayed
+ */
+static size_t ctune_Settings_replayJournal( void ) {
+    String_t file_path    = String.init();
+    String_t file_content = String.init();
+    String_t json         = String.init();
+    Vector_t station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    size_t   replayed     = 0;
+    size_t   skipped      = 0;
+    char   * save_ptr     = NULL;
+
+    ctune_XDG.resolveCfgFilePath( favourites.journal.file_name, &file_path );
+
+    if( ctune_fs.getFileState( file_path._raw, NULL ) != CTUNE_FILE_FOUND || !ctune_fs.readFile( file_path._raw, &file_content ) ) {
+        goto end;
+    }
+
+    for( char * line = strtok_r( file_content._raw, "\n", &save_ptr ); line != NULL; line = strtok_r( NULL, "\n", &save_ptr ) ) {
+        bool ok = false;
+
+        if( line[0] == '+' && line[1] == ' ' ) {
+            ok = ( String.set( &json, &line[2] )
+                && Vector.reinit( &station_list )
+                && ctune_parser_JSON.parseToRadioStationList( &json, &station_list ) );
+
+            for( size_t i = 0; ok && i < Vector.size( &station_list ); ++i ) {
+                ok = ctune_Settings_putFavourite( Vector.at( &station_list, i ) );
+            }
+
+        } else if( line[0] == '-' && line[1] == ' ' ) {
+            char * uuid = NULL;
+            long   src  = strtol( &line[2], &uuid, 10 );
+
+            if( ( ok = ( uuid != &line[2] && *uuid == ' ' && src >= 0 && src < CTUNE_STATIONSRC_COUNT ) ) ) {
+                ctune_RadioStationInfo_t rsi;
+                ctune_RadioStationInfo.init( &rsi );
+                ctune_RadioStationInfo.set.stationUUID( &rsi, strdup( ++uuid ) );
+                ctune_Settings_dropFavourite( &rsi, (ctune_StationSrc_e) src );
+                ctune_RadioStationInfo.freeContent( &rsi );
+            }
+        }
+
+        if( ok ) {
+            ++replayed;
+        } else {
+            ++skipped;
+        }
+    }
+
+    if( skipped > 0 ) {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Settings_replayJournal()] Skipped %lu malformed journal record(s).", skipped );
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_replayJournal()] Replayed %lu journal record(s).", replayed );
+
+    end:
+        favourites.journal.records = ( replayed + skipped );
+        String.free( &file_path );
+        String.free( &file_content );
+        String.free( &json );
+        Vector.clear_vector( &station_list );
+        return replayed;
+}
+
+/**
+ * [PRIVATE] Writes a record to the end of the favourites journal and flushes it to disk
+ * @param record Record line (without the line feed)
+ * @return Success
+ */
+static bool ctune_Settings_appendJournal( const char * record ) {
+    if( favourites.journal.file == NULL ) {
+        String_t file_path = String.init();
+
+        ctune_XDG.resolveCfgFilePath( favourites.journal.file_name, &file_path );
+        favourites.journal.file = fopen( file_path._raw, "a" );
+
+        if( favourites.journal.file == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_Settings_appendJournal( %p )] Error opening file \"%s\": %s",
+                       record, file_path._raw, strerror( errno )
+            );
+        }
+
+        String.free( &file_path );
+
+        if( favourites.journal.file == NULL ) {
+            return false; //EARLY RETURN
+        }
+    }
+
+    if( fprintf( favourites.journal.file, "%s\n", record ) < 0
+     || fflush( favourites.journal.file ) != 0
+     || fsync( fileno( favourites.journal.file ) ) != 0 )
+    {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_Settings_appendJournal( %p )] Error writing to file \"%s\": %s",
+                   record, favourites.journal.file_name, strerror( errno )
+        );
+
+        return false; //EARLY RETURN
+    }
+
+    ++favourites.journal.records;
+    return true;
+}
+
+/**
+ * [PRIVATE] Writes a journal record and compacts the journal into the snapshot once it gets too long
+ * @param record Record line (NULL when it could not be created: compacts straight away instead)
+ * @return Success of writing the record
+ */
+static bool ctune_Settings_commitJournalRecord( const char * record ) {
+    if( record == NULL || !ctune_Settings_appendJournal( record ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_commitJournalRecord( %p )] Failed to journal change - compacting now instead.", record );
+        ctune_Settings.favs.saveFavourites();
+        return false; //EARLY RETURN
+    }
+
+    if( favourites.journal.records >= CTUNE_SETTINGS_FAV_JOURNAL_COMPACT_THRESHOLD ) {
+        ctune_Settings.favs.saveFavourites();
+    }
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Journals a favourites change and compacts the journal into the snapshot once it gets too long
+ * @param rsi    Pointer to a RadioStationInfo_t DTO
+ * @param src    Radio station provenance
+ * @param remove Flag to record a removal (addition/update otherwise)
+ */
+static void ctune_Settings_journalChange( const ctune_RadioStationInfo_t * rsi, ctune_StationSrc_e src, bool remove ) {
+    String_t record       = String.init();
+    String_t json         = String.init();
+    Vector_t station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    bool     error_state  = false;
+
+    if( remove ) {
+        char prefix[16];
+        snprintf( prefix, sizeof( prefix ), "- %d ", (int) src );
+
+        error_state = !( String.set( &record, prefix )
+                      && String.append_back( &record, ctune_RadioStationInfo.get.stationUUID( rsi ) ) );
+
+    } else {
+        ctune_RadioStationInfo_t * copy = Vector.init_back( &station_list, ctune_RadioStationInfo.init );
+
+        if( copy != NULL ) {
+            ctune_RadioStationInfo.copy( rsi, copy );
+            ctune_RadioStationInfo.set.stationSource( copy, src );
+        }
+
+        error_state = !( copy != NULL
+                      && ctune_parser_JSON.parseRadioStationListToJSON( &station_list, &json )
+                      && String.set( &record, "+ " )
+                      && String.append_back( &record, json._raw ) );
+    }
+
+    ctune_Settings_commitJournalRecord( error_state ? NULL : record._raw );
+
+    String.free( &record );
+    String.free( &json );
+    Vector.clear_vector( &station_list );
+}
+
+/**
+ * [PRIVATE] Checks which favourites snapshot file to load (the most recently written one)
+ * @param json_path   JSON snapshot file path
+ * @param binary_path Binary snapshot file path
+ * @return Binary snapshot flag
+ */
+static bool ctune_Settings_isBinarySnapshotLatest( const char * json_path, const char * binary_path ) {
+    struct stat json_stat;
+    struct stat binary_stat;
+
+    if( stat( binary_path, &binary_stat ) != 0 ) {
+        return false; //EARLY RETURN
+    }
+
+    if( stat( json_path, &json_stat ) != 0 ) {
+        return true; //EARLY RETURN
+    }
+
+    return ( binary_stat.st_mtim.tv_sec > json_stat.st_mtim.tv_sec
+          || ( binary_stat.st_mtim.tv_sec == json_stat.st_mtim.tv_sec && binary_stat.st_mtim.tv_nsec > json_stat.st_mtim.tv_nsec ) );
+}
+
+/**
+ * [PRIVATE] Writes the favourites into the binary snapshot and maps it in place of the current one
+ * @param file_path Binary snapshot file path
+ * @return Success
+ */
+static bool ctune_Settings_writeBinarySnapshot( const char * file_path ) {
+    bool                error_state  = false;
+    bool                merge        = ctune_StationFile.isOpen( &favourites.store.file );
+    ctune_StationFile_t snapshot     = ctune_StationFile.init();
+    Vector_t            station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        merge = ( merge && HashMap.empty( &favourites.store.removed[i] ) );
+    }
+
+    if( merge ) { //only the stations changed since the mapped snapshot need materialising
+        for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+            HashMap.export( &favourites.favs[ i ], &station_list, ctune_RadioStationInfo.init, ctune_RadioStationInfo.copy );
+        }
+
+    } else if( !ctune_Settings_exportFavourites( &station_list ) ) {
+        error_state = true;
+        goto end;
+    }
+
+    if( !ctune_StationFile.write( file_path, ( merge ? &favourites.store.file : NULL ), &station_list, "favourites" ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeBinarySnapshot( \"%s\" )] Failed to write snapshot.", file_path );
+        error_state = true;
+        goto end;
+    }
+
+    if( !ctune_StationFile.open( file_path, &snapshot ) ) { //previous mapping stays valid until then
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeBinarySnapshot( \"%s\" )] Failed to map new snapshot.", file_path );
+        error_state = true;
+        goto end;
+    }
+
+    ctune_StationFile.close( &favourites.store.file );
+    favourites.store.file = snapshot;
 
-    int (*sort_fn)( const void *, const void * ) = ctune_RadioStationInfo.getComparator( favourites.sort_id );
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        HashMap.clear( &favourites.store.removed[ i ] );
+    }
 
-    if( favourites.sort_id != CTUNE_RADIOSTATIONINFO_SORTBY_NONE && sort_fn != NULL ) {
-        CTUNE_LOG( CTUNE_LOG_DEBUG,
-                   "[ctune_Settings_refreshFavourites( %p )] Sorting called (%i): %s",
-                   stations, favourites.sort_id, ctune_RadioStationInfo.sortAttrStr( favourites.sort_id )
+    end:
+        Vector.clear_vector( &station_list );
+        return !( error_state );
+}
+
+/**
+ * [PRIVATE] Writes the favourites into the JSON snapshot (temporary file + fsync + rename)
+ * @param file_path JSON snapshot file path
+ * @return Success
+ */
+static bool ctune_Settings_writeJSONSnapshot( const char * file_path ) {
+    bool     error_state  = false;
+    String_t tmp_path     = String.init();
+    FILE *   file         = NULL;
+    String_t json         = String.init();
+    Vector_t station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+
+    ctune_XDG.resolveCfgFilePath( favourites.tmp_name, &tmp_path );
+
+    if( !ctune_Settings_exportFavourites( &station_list ) ) {
+        error_state = true;
+        goto end;
+    }
+
+    if( Vector.empty( &station_list ) ) {
+        String.set( &json, "[]" );
+
+    } else if( !ctune_parser_JSON.parseRadioStationListToJSON( &station_list, &json ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeJSONSnapshot( \"%s\" )] Failed to parse stations to JSON format.", file_path );
+        error_state = true;
+        goto end;
+    }
+
+    file = fopen( tmp_path._raw , "w" );
+
+    if( !file ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeJSONSnapshot( \"%s\" )] Error opening file \"%s\": %s", file_path, tmp_path._raw, strerror( errno ) );
+        error_state = true;
+        goto end;
+    }
+
+    if( fprintf( file, "%s", json._raw ) < 0 || fflush( file ) != 0 || fsync( fileno( file ) ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_writeJSONSnapshot( \"%s\" )] Error writing to file \"%s\": %s", file_path, favourites.tmp_name, strerror( errno ) );
+        error_state = true;
+        goto end;
+    }
+
+    fclose( file );
+    file = NULL;
+
+    if( rename( tmp_path._raw, file_path ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_Settings_writeJSONSnapshot( \"%s\" )] Failed to rename snapshot (\"%s\" -> \"%s\"): %s",
+                   file_path, tmp_path._raw, file_path, strerror( errno )
         );
 
-        Vector.sort( stations, sort_fn );
+        error_state = true;
+        goto end;
+    }
+
+    end:
+        if( file != NULL ) {
+            fclose( file );
+            remove( tmp_path._raw );
+        }
+
+        String.free( &tmp_path );
+        String.free( &json );
+        Vector.clear_vector( &station_list );
+        return !( error_state );
+}
+
+/**
+ * Load favourite stations from file (the backup is deferred to `ctune_Settings.favs.backupFavourites()`)
+ * -
+ * The binary snapshot is mapped and queried in-place whereas the JSON one gets loaded into memory.
+ * @return Success
+ */
+static bool ctune_Settings_loadFavourites() {
+    favourites.view.length = 0;
+    favourites.view.built  = false;
+    ++favourites.generation;
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        favourites.favs[i] = HashMap.init( ctune_RadioStationInfo.free,
+                                           ctune_RadioStationInfo.dup,
+                                           ctune_RadioStationInfo.hash,
+                                           ctune_RadioStationInfo.matchUUID );
+
+        favourites.store.removed[i] = HashMap.init( ctune_RadioStationInfo.free,
+                                                    ctune_RadioStationInfo.mindup,
+                                                    ctune_RadioStationInfo.hash,
+                                                    ctune_RadioStationInfo.matchUUID );
+    }
+
+    bool     error_state  = false;
+    String_t file_path    = String.init();
+    String_t binary_path  = String.init();
+    String_t file_content = String.init();
+    Vector_t station_list = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+
+    ctune_XDG.resolveCfgFilePath( favourites.file_name, &file_path );
+    ctune_XDG.resolveCfgFilePath( favourites.store.file_name, &binary_path );
+
+    if( ctune_Settings_isBinarySnapshotLatest( file_path._raw, binary_path._raw ) ) {
+        if( !ctune_StationFile.open( binary_path._raw, &favourites.store.file ) ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_loadFavourites()] Failed to map binary snapshot (\"%s\").", binary_path._raw );
+            error_state = ( ctune_Settings_replayJournal() == 0 );
+            goto end;
+        }
+
+        pthread_mutex_lock( &favourites.backup.lock );
+        favourites.backup.pending = true;
+        favourites.backup.binary  = true;
+        pthread_mutex_unlock( &favourites.backup.lock );
+
+        favourites.store.convert = !favourites.store.enabled;
+
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_Settings_loadFavourites()] Mapped %lu favourite stations.",
+                   ctune_StationFile.size( &favourites.store.file ) );
+
+        ctune_Settings_replayJournal();
+        goto end;
+    }
+
+    if( !ctune_fs.readFile( file_path._raw, &file_content ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_loadFavourites()] Failed to load file content." );
+        error_state = ( ctune_Settings_replayJournal() == 0 );
+        goto end;
+
+    }
+
+    pthread_mutex_lock( &favourites.backup.lock );
+    favourites.backup.pending = true;
+    pthread_mutex_unlock( &favourites.backup.lock );
+
+    favourites.store.convert = favourites.store.enabled;
+
+    if( !ctune_parser_JSON.parseToRadioStationList( &file_content, &station_list ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_loadFavourites()] Error converting file content to collection of stations (\"%s\").", file_path._raw );
+        error_state = true;
+        goto end;
+    }
+
+    size_t count[CTUNE_STATIONSRC_COUNT];
+    size_t tally = 0;
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i )
+        count[i] = 0;
+
+    for( size_t i = 0; i < Vector.size( &station_list ); ++i ) {
+        ctune_RadioStationInfo_t * station = (ctune_RadioStationInfo_t *) Vector.at( &station_list, i );
+        ctune_RadioStationInfo.set.favourite( station, true );
+
+        const ctune_StationSrc_e src = ctune_RadioStationInfo.get.stationSource( station );
+
+        if( HashMap.add( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( station ), station ) ) {
+            ++count[src];
+            ++tally;
+        }
+    }
+
+    for( int i = 0; i < CTUNE_STATIONSRC_COUNT; ++i ) {
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_Settings_loadFavourites()] Loaded %lu '%s' favourite stations.",
+                   count[i], ctune_StationSrc.str( i ) );
+    }
+
+    CTUNE_LOG( CTUNE_LOG_MSG,
+               "[ctune_Settings_loadFavourites()] Loaded %lu/%lu favourite stations.",
+               tally, Vector.size( &station_list ) );
+
+    ctune_Settings_replayJournal();
+
+    end:
+        String.free( &file_path );
+        String.free( &binary_path );
+        String.free( &file_content );
+        Vector.clear_vector( &station_list );
+        return !( error_state );
+}
+
+/**
+ * Compacts the favourite radio stations into the snapshot file (JSON or binary based on the configuration) and empties the journal
+ * @return Success
+ */
+static bool ctune_Settings_saveFavourites() {
+    bool       error_state  = false;
+    String_t   file_path    = String.init();
+    String_t   journal_path = String.init();
+    const bool binary       = favourites.store.enabled;
+
+    ctune_XDG.resolveCfgFilePath( ( binary ? favourites.store.file_name : favourites.file_name ), &file_path );
+    ctune_XDG.resolveCfgFilePath( favourites.journal.file_name, &journal_path );
+
+    if( favourites.journal.records == 0 && !favourites.store.convert && ctune_fs.getFileState( file_path._raw, NULL ) == CTUNE_FILE_FOUND ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_saveFavourites()] No changes since last snapshot." );
+        goto end;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_MSG,
+               "[ctune_Settings_saveFavourites()] Saving %lu favourite station(s) to file \"%s\".",
+               ctune_Settings_favouriteCount(), ( binary ? favourites.store.file_name : favourites.file_name )
+    );
+
+    ctune_Settings_backupFavourites(); //in case the deferred backup has not run yet
+
+    if( !( binary ? ctune_Settings_writeBinarySnapshot( file_path._raw ) : ctune_Settings_writeJSONSnapshot( file_path._raw ) ) ) {
+        error_state = true;
+        goto end;
+    }
+
+    //a crash before this point just replays the journal again over the new snapshot (records are idempotent)
+    if( favourites.journal.file != NULL ) {
+        fclose( favourites.journal.file );
+        favourites.journal.file = NULL;
+    }
+
+    if( remove( journal_path._raw ) != 0 && errno != ENOENT ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_saveFavourites()] Failed to remove journal \"%s\": %s", journal_path._raw, strerror( errno ) );
+    }
+
+    favourites.journal.records = 0;
+    favourites.store.convert   = false;
+
+    end:
+        String.free( &file_path );
+        String.free( &journal_path );
+        return !( error_state );
+}
+
+/**
+ * Syncs a collection used for display the internal map state (copied in order from the sorted view)
+ * @param stations View container
+ * @return Success
+ */
+static bool ctune_Settings_refreshFavourites( Vector_t * stations ) {
+    if( !Vector.empty( stations ) ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_refreshFavourites( %p )] Vector is not empty - clearing...", stations );
+
+        if( !Vector.reinit( stations ) ) {
+            CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Settings_refreshFavourites( %p )] Failed re-initialisation of vector.", stations );
+            return false; //EARLY RETURN
+        }
+    }
+
+    if( !favourites.view.built && !ctune_Settings_buildView() ) {
+        return false; //EARLY RETURN
+    }
+
+    for( size_t i = 0; i < favourites.view.length; ++i ) {
+        ctune_RadioStationInfo_t * copy = Vector.init_back( stations, ctune_RadioStationInfo.init );
+
+        if( copy == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_refreshFavourites( %p )] Failed to allocate station (i=%lu).", stations, i );
+            return false; //EARLY RETURN
+        }
+
+        ctune_RadioStationInfo.copy( favourites.view.entries[i].rsi, copy );
     }
 
     return true;
 }
 
+/**
+ * Gets the number of stations in the sorted view of the favourites
+ * @return Station count
+ */
+static size_t ctune_Settings_viewSize( void ) {
+    if( !favourites.view.built && !ctune_Settings_buildView() ) {
+        return 0; //EARLY RETURN
+    }
+
+    return favourites.view.length;
+}
+
+/**
+ * Gets a station in the sorted view of the favourites
+ * @param pos Position in the view
+ * @return Pointer to radio station object or NULL if out of range
+ */
+static const ctune_RadioStationInfo_t * ctune_Settings_viewAt( size_t pos ) {
+    if( pos >= ctune_Settings_viewSize() ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_viewAt( %lu )] Position out of range (size = %lu).", pos, favourites.view.length );
+        return NULL; //EARLY RETURN
+    }
+
+    return favourites.view.entries[pos].rsi;
+}
+
 /**
  * Sets the sorting attribute for the display list
  * @param attr ctune_RadioStationInfo_SortBy_e ID
  */
 static void ctune_Settings_setSortingAttribute( ctune_RadioStationInfo_SortBy_e attr ) {
-    favourites.sort_id = attr;
+    if( attr != favourites.sort_id ) {
+        favourites.sort_id    = attr;
+        favourites.view.built = false; //re-sorted on next access
+    }
 }
 
 /**
@@ -1016,17 +2222,36 @@ static void ctune_Settings_setSortingAttribute( ctune_RadioStationInfo_SortBy_e
  * @return Favourite state
  */
 static bool ctune_Settings_isFavourite( const char * uuid, ctune_StationSrc_e src ) {
-    return ( HashMap.at( &favourites.favs[src], uuid ) != NULL );
+    return ( HashMap.at( &favourites.favs[src], uuid ) != NULL || ctune_Settings_findStored( uuid, src ) != NULL );
 }
 
 /**
- * Gets the pointer to a favourite RSI inside the HashMap collection
+ * Gets the generation of the favourites list
+ * -
+ * The number changes whenever a station is added to or removed from the favourites so that callers can cache
+ * `isFavourite(..)` results and only re-query when it differs from the one they were cached under.
+ * @return Generation number
+ */
+static uint64_t ctune_Settings_generation( void ) {
+    return favourites.generation;
+}
+
+/**
+ * Gets the pointer to a favourite RSI inside the HashMap collection (snapshot records are materialised into it on first access)
  * @param uuid UUID of the RSI
  * @param src  Radio station provenance
  * @return Pointer to radio station object
  */
 static const ctune_RadioStationInfo_t * ctune_Settings_getFavourite( const char * uuid, ctune_StationSrc_e src ) {
-    return HashMap.at( &favourites.favs[src], uuid );
+    const ctune_RadioStationInfo_t   * rsi    = HashMap.at( &favourites.favs[src], uuid );
+    const ctune_StationFile_Record_t * record = NULL;
+
+    if( rsi == NULL && ( record = ctune_Settings_findStored( uuid, src ) ) != NULL ) {
+        rsi = ctune_Settings_materialiseStored( record );
+        ctune_Settings_viewInsert( rsi );
+    }
+
+    return rsi;
 }
 
 /**
@@ -1042,7 +2267,20 @@ static bool ctune_Settings_addStation( const ctune_RadioStationInfo_t * rsi, ctu
                rsi, src, ( rsi != NULL ? ctune_RadioStationInfo.get.stationUUID( rsi ) : "NULL" )
     );
 
-    return HashMap.add( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( rsi ), rsi );
+    if( ctune_Settings_isFavourite( ctune_RadioStationInfo.get.stationUUID( rsi ), src ) ) {
+        return false; //EARLY RETURN
+    }
+
+    HashMap.remove( &favourites.store.removed[src], ctune_RadioStationInfo.get.stationUUID( rsi ) );
+
+    if( !HashMap.add( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( rsi ), rsi ) ) {
+        return false; //EARLY RETURN
+    }
+
+    ctune_Settings_viewInsert( HashMap.at( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( rsi ) ) );
+    ++favourites.generation;
+    ctune_Settings_journalChange( rsi, src, false );
+    return true;
 }
 
 /**
@@ -1058,7 +2296,93 @@ static bool ctune_Settings_removeStation( const ctune_RadioStationInfo_t * rsi,
                rsi, src, ctune_StationSrc.str( src ), ( rsi != NULL ? ctune_RadioStationInfo.get.stationUUID( rsi ) : "NULL" )
     );
 
-    return HashMap.remove( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( rsi ) );
+    if( rsi != NULL && (int) src >= 0 && (int) src < CTUNE_STATIONSRC_COUNT
+        && rsi == HashMap.at( &favourites.favs[src], ctune_RadioStationInfo.get.stationUUID( rsi ) ) )
+    { //i.e.: pointer from the view/`getFavourite(..)` which gets freed on removal
+        ctune_RadioStationInfo_t station;
+        ctune_RadioStationInfo.init( &station );
+        ctune_RadioStationInfo.mincopy( rsi, &station );
+
+        const bool removed = ctune_Settings_removeStation( &station, src );
+
+        ctune_RadioStationInfo.freeContent( &station );
+        return removed; //EARLY RETURN
+    }
+
+    if( !ctune_Settings_dropFavourite( rsi, src ) ) {
+        return false; //EARLY RETURN
+    }
+
+    ctune_Settings_journalChange( rsi, src, true );
+    return true;
+}
+
+/**
+ * Updates a batch of favourite stations in one go (a single journal record so the batch is applied whole or not at all)
+ * -
+ * Stations that are not favourites are ignored. The sorted view is rebuilt once on its next access.
+ * @param stations Collection of RadioStationInfo_t DTOs with the up-to-date information
+ * @param src      Radio station provenance
+ * @return Number of favourites updated
+ */
+static size_t ctune_Settings_updateStations( const Vector_t * stations, ctune_StationSrc_e src ) {
+    String_t record  = String.init();
+    String_t json    = String.init();
+    Vector_t updates = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    size_t   updated = 0;
+
+    if( stations == NULL || (int) src < 0 || (int) src >= CTUNE_STATIONSRC_COUNT ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_updateStations( %p, %i )] Invalid arg(s).", stations, src );
+        goto end;
+    }
+
+    for( size_t i = 0; i < Vector.size( stations ); ++i ) {
+        const ctune_RadioStationInfo_t * rsi = Vector.at( (Vector_t *) stations, i );
+
+        if( !ctune_Settings_isFavourite( ctune_RadioStationInfo.get.stationUUID( rsi ), src ) ) {
+            continue;
+        }
+
+        ctune_RadioStationInfo_t * copy = Vector.init_back( &updates, ctune_RadioStationInfo.init );
+
+        if( copy == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Settings_updateStations( %p, %i )] Failed to copy station #%lu.", stations, src, i );
+            goto end;
+        }
+
+        ctune_RadioStationInfo.copy( rsi, copy );
+        ctune_RadioStationInfo.set.stationSource( copy, src );
+        ctune_RadioStationInfo.set.favourite( copy, true );
+    }
+
+    if( Vector.empty( &updates ) ) {
+        goto end;
+    }
+
+    favourites.view.built = false; //cheaper to re-sort once than to move each station in the view
+
+    for( size_t i = 0; i < Vector.size( &updates ); ++i ) {
+        if( ctune_Settings_putFavourite( Vector.at( &updates, i ) ) ) {
+            ++updated;
+        }
+    }
+
+    const bool serialised = ( ctune_parser_JSON.parseRadioStationListToJSON( &updates, &json )
+                           && String.set( &record, "+ " )
+                           && String.append_back( &record, json._raw ) );
+
+    ctune_Settings_commitJournalRecord( serialised ? record._raw : NULL );
+
+    CTUNE_LOG( CTUNE_LOG_MSG,
+               "[ctune_Settings_updateStations( %p, %i )] Updated %lu/%lu '%s' favourites.",
+               stations, src, updated, Vector.size( stations ), ctune_StationSrc.str( src )
+    );
+
+    end:
+        String.free( &record );
+        String.free( &json );
+        Vector.clear_vector( &updates );
+        return updated;
 }
 
 /**
@@ -1135,6 +2459,29 @@ static void * ctune_Settings_plugin_getPlugin( ctune_PluginType_e type ) {
     return plugin;
 }
 
+/**
+ * Checks that the plugin of a given type to be used is available (without linking it)
+ * @param type Plugin type enum
+ * @return Availability state
+ */
+static bool ctune_Settings_plugin_hasPlugin( ctune_PluginType_e type ) {
+    const String_t * name = NULL;
+    const char     * dflt = NULL;
+
+    if( ctune_Plugin.getSelectedPluginName( type ) != NULL ) {
+        return true; //EARLY RETURN
+    }
+
+    switch( type ) {
+        case CTUNE_PLUGIN_IN_STREAM_PLAYER  : { name = &config.io_libs.player.name;       dflt = config.io_libs.player.dflt_name;       } break;
+        case CTUNE_PLUGIN_OUT_AUDIO_SERVER  : { name = &config.io_libs.sound_server.name; dflt = config.io_libs.sound_server.dflt_name; } break;
+        case CTUNE_PLUGIN_OUT_AUDIO_RECORDER: { name = &config.io_libs.recorder.name;     dflt = config.io_libs.recorder.dflt_name;     } break;
+        default                             : return false; //EARLY RETURN
+    }
+
+    return ctune_Plugin.validate( type, ( String.empty( name ) ? dflt : name->_raw ) );
+}
+
 /**
  * Sets a plugin as 'selected'
  * @param type Plugin type enum
@@ -1192,12 +2539,17 @@ const struct ctune_Settings_Instance ctune_Settings = {
     .favs = {
         .loadFavourites        = &ctune_Settings_loadFavourites,
         .saveFavourites        = &ctune_Settings_saveFavourites,
+        .backupFavourites      = &ctune_Settings_backupFavourites,
         .isFavourite           = &ctune_Settings_isFavourite,
+        .generation            = &ctune_Settings_generation,
         .getFavourite          = &ctune_Settings_getFavourite,
         .refreshView           = &ctune_Settings_refreshFavourites,
+        .viewSize              = &ctune_Settings_viewSize,
+        .viewAt                = &ctune_Settings_viewAt,
         .setSortingAttribute   = &ctune_Settings_setSortingAttribute,
         .addStation            = &ctune_Settings_addStation,
-        .removeStation         = &ctune_Settings_removeStation
+        .removeStation         = &ctune_Settings_removeStation,
+        .updateStations        = &ctune_Settings_updateStations
     },
 
     .cfg = {
@@ -1210,10 +2562,16 @@ const struct ctune_Settings_Instance ctune_Settings = {
         .getLastPlayedUUID     = &ctune_Settings_getLastPlayedUUID,
         .getLastPlayedSrc      = &ctune_Settings_getLastPlayedSrc,
         .setLastPlayedStation  = &ctune_Settings_setLastPlayedStation,
+        .refreshLastPlayedStation = &ctune_Settings_refreshLastPlayedStation,
+        .isLastPlayedStation   = &ctune_Settings_isLastPlayedStation,
+        .getLastPlayedStation  = &ctune_Settings_getLastPlayedStation,
         .playbackLogOverwrite  = &ctune_Settings_playbackLogOverwrite,
         .getStreamTimeoutVal   = &ctune_Settings_getStreamTimeoutVal,
         .setStreamTimeoutVal   = &ctune_Settings_setStreamTimeoutVal,
         .getNetworkTimeoutVal  = &ctune_Settings_getNetworkTimeoutVal,
+        .logFlushLatency       = &ctune_Settings_logFlushLatency,
+        .catalogueEnabled      = &ctune_Settings_catalogueEnabled,
+        .catalogueSyncInterval = &ctune_Settings_catalogueSyncInterval,
         .recordingDirectory    = &ctune_Settings_recordingDir,
         .setRecordingDirectory = &ctune_Settings_setRecordingDir,
         .getUIConfig           = &ctune_Settings_getUIConfig,
@@ -1224,6 +2582,7 @@ const struct ctune_Settings_Instance ctune_Settings = {
         .loadPlugins           = &ctune_Settings_plugin_loadPlugins,
         .setPlugin             = &ctune_Settings_plugin_setPlugin,
         .getPlugin             = &ctune_Settings_plugin_getPlugin,
+        .hasPlugin             = &ctune_Settings_plugin_hasPlugin,
         .getPluginList         = &ctune_Settings_plugin_getPluginList,
     },
 };
\ No newline at end of file
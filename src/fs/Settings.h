@@ -2,6 +2,7 @@
 #define CTUNE_FS_SETTINGS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "../enum/StationSrc.h"
 #include "../datastructure/String.h"
@@ -46,11 +47,17 @@ extern const struct ctune_Settings_Instance {
         bool (* loadFavourites)( void );
 
         /**
-         * Exports a collection of favourite stations to the file
+         * Compacts the favourite stations into the snapshot file and empties the journal (no-op when nothing changed)
          * @return Success
          */
         bool (* saveFavourites)( void );
 
+        /**
+         * [THREAD SAFE] Backs up the favourites file loaded at startup (once, and always before it is overwritten)
+         * @return Success
+         */
+        bool (* backupFavourites)( void );
+
         /**
          * Syncs a collection used for display the internal map state
          * @param stations View container
@@ -58,6 +65,21 @@ extern const struct ctune_Settings_Instance {
          */
         bool (* refreshView)( Vector_t * stations );
 
+        /**
+         * Gets the number of stations in the sorted view of the favourites
+         * @return Station count
+         */
+        size_t (* viewSize)( void );
+
+        /**
+         * Gets a station in the sorted view of the favourites (read-only and no copy)
+         * -
+         * The pointer is only valid until the next change to the favourites or to their sorting attribute.
+         * @param pos Position in the view
+         * @return Pointer to radio station object or NULL if out of range
+         */
+        const ctune_RadioStationInfo_t * (* viewAt)( size_t pos );
+
         /**
          * Sets the sorting attribute for the display list
          * @param attr ctune_RadioStationInfo_SortBy_e ID
@@ -72,6 +94,12 @@ extern const struct ctune_Settings_Instance {
          */
         bool (* isFavourite)( const char * uuid, ctune_StationSrc_e src );
 
+        /**
+         * Gets the generation of the favourites list (changes whenever a station is added to or removed from it)
+         * @return Generation number
+         */
+        uint64_t (* generation)( void );
+
         /**
          * Gets the pointer to a favourite RSI inside the HashMap collection
          * @param uuid UUID of the RSI
@@ -81,7 +109,7 @@ extern const struct ctune_Settings_Instance {
         const ctune_RadioStationInfo_t * (* getFavourite)( const char * uuid, ctune_StationSrc_e src );
 
         /**
-         * Adds a new station to the 'favourites' list
+         * Adds a new station to the 'favourites' list (recorded in the favourites journal)
          * @param rsi Pointer to a RadioStationInfo_t DTO
          * @param src  Radio station provenance
          * @return Success
@@ -89,13 +117,21 @@ extern const struct ctune_Settings_Instance {
         bool (* addStation)( const ctune_RadioStationInfo_t * rsi, ctune_StationSrc_e src );
 
         /**
-         * Removes a station from the 'favourites' list
+         * Removes a station from the 'favourites' list (recorded in the favourites journal)
          * @param rsi Pointer to a RadioStationInfo_t DTO
          * @param src  Radio station provenance
          * @return Success
          */
         bool (* removeStation)( const ctune_RadioStationInfo_t * rsi, ctune_StationSrc_e src );
 
+        /**
+         * Updates a batch of favourite stations in one go (recorded as a single entry in the favourites journal)
+         * @param stations Collection of RadioStationInfo_t DTOs with the up-to-date information (non-favourites are ignored)
+         * @param src      Radio station provenance
+         * @return Number of favourites updated
+         */
+        size_t (* updateStations)( const Vector_t * stations, ctune_StationSrc_e src );
+
     } favs;
 
     struct { /* Application configuration */
@@ -149,11 +185,32 @@ extern const struct ctune_Settings_Instance {
         ctune_StationSrc_e (* getLastPlayedSrc)( void );
 
         /**
-         * Sets the UUID of the last station played to be saved in the configuration
-         * @param uuid Radio station UUID to save
-         * @param src  Source for Station UUID
+         * [THREAD SAFE] Sets the last station played to be saved in the configuration (UUID, source and the record needed to resume it)
+         * @param rsi Radio station
+         */
+        void (* setLastPlayedStation)( const ctune_RadioStationInfo_t * rsi );
+
+        /**
+         * [THREAD SAFE] Updates the cached record of the last station played if it is still the same station
+         * @param rsi Refreshed radio station
+         * @return Updated state
          */
-        void (* setLastPlayedStation)( const char *, ctune_StationSrc_e );
+        bool (* refreshLastPlayedStation)( const ctune_RadioStationInfo_t * rsi );
+
+        /**
+         * [THREAD SAFE] Checks if a station is the last station played
+         * @param uuid Station UUID
+         * @param src  Station source
+         * @return Match state
+         */
+        bool (* isLastPlayedStation)( const char * uuid, ctune_StationSrc_e src );
+
+        /**
+         * [THREAD SAFE] Gets the cached record of the last station played
+         * @param rsi Initialised radio station to fill
+         * @return Success (false if there is no cached stream URL)
+         */
+        bool (* getLastPlayedStation)( ctune_RadioStationInfo_t * rsi );
 
         /**
          * Gets the playback log file overwrite preference
@@ -180,6 +237,24 @@ extern const struct ctune_Settings_Instance {
          */
         int (* getNetworkTimeoutVal)( void );
 
+        /**
+         * Gets the maximum time log messages can be buffered before being written to the log file
+         * @return Latency in milliseconds
+         */
+        int (* logFlushLatency)( void );
+
+        /**
+         * Gets the local station catalogue preference
+         * @return Enabled flag
+         */
+        bool (* catalogueEnabled)( void );
+
+        /**
+         * Gets the interval between syncs of the local station catalogue
+         * @return Interval in hours
+         */
+        int (* catalogueSyncInterval)( void );
+
         /**
          * Get the recording directory path
          * @return Directory path
@@ -222,6 +297,13 @@ extern const struct ctune_Settings_Instance {
          */
         void * (* getPlugin)( ctune_PluginType_e type );
 
+        /**
+         * Checks that the plugin of a given type to be used is available (without linking it)
+         * @param type Plugin type enum
+         * @return Availability state
+         */
+        bool (* hasPlugin)( ctune_PluginType_e type );
+
         /**
          * Sets a plugin as 'selected'
          * @param type Plugin type enum
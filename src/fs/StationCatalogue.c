@@ -0,0 +1,922 @@
+#include "StationCatalogue.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <limits.h>
+
+#include "logger/src/Logger.h"
+#include "XDG.h"
+#include "StationFile.h"
+
+/**
+ * [PRIVATE] Station query criteria
+ */
+typedef struct ctune_StationCatalogue_Query {
+    const char      * name;
+    bool              name_exact;
+    const char      * country;
+    bool              country_exact;
+    const char      * countrycode;
+    const char      * state;
+    bool              state_exact;
+    const char      * language;
+    bool              language_exact;
+    const char      * tag;
+    bool              tag_exact;
+    const StrList_t * tag_list;
+    const char      * codec;
+    bool              codec_exact;
+    const char      * url;
+    ulong             bitrate_min;
+    ulong             bitrate_max;
+
+} ctune_StationCatalogue_Query_t;
+
+/**
+ * [PRIVATE] Matched record with its sorting key
+ */
+typedef struct ctune_StationCatalogue_Match {
+    const ctune_StationFile_Record_t * record;
+    const char                       * key_str;
+    double                             key_num;
+
+} ctune_StationCatalogue_Match_t;
+
+/**
+ * [PRIVATE] Category token (points inside the mapped string table)
+ */
+typedef struct ctune_StationCatalogue_Token {
+    const char * str;
+    size_t       length;
+    const char * data;
+
+} ctune_StationCatalogue_Token_t;
+
+/**
+ * Private vars
+ */
+static struct {
+    const char        * file_name;
+    String_t            file_path;
+    ctune_StationFile_t file;
+    pthread_rwlock_t    lock;   //guards `file`
+    pthread_mutex_t     update; //serialises writers
+
+} catalogue = {
+    .file_name = "stations.cat",
+    .file_path = { ._raw = NULL, ._length = 0 }, //i.e. String.init()
+    .file      = { .map = NULL, .map_size = 0, .header = NULL, .records = NULL, .strtab = NULL },
+    .lock      = PTHREAD_RWLOCK_INITIALIZER,
+    .update    = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/**
+ * [PRIVATE] Creates a query that matches everything
+ * @return Query
+ */
+static ctune_StationCatalogue_Query_t ctune_StationCatalogue_initQuery( void ) {
+    return (ctune_StationCatalogue_Query_t) {
+        .name        = NULL,
+        .country     = NULL,
+        .countrycode = NULL,
+        .state       = NULL,
+        .language    = NULL,
+        .tag         = NULL,
+        .tag_list    = NULL,
+        .codec       = NULL,
+        .url         = NULL,
+        .bitrate_min = 0,
+        .bitrate_max = ULONG_MAX,
+    };
+}
+
+/**
+ * [PRIVATE] Case-insensitive sub-string search
+ * @param haystack String to search in
+ * @param needle   String to search for
+ * @return Found state
+ */
+static bool ctune_StationCatalogue_containsNoCase( const char * haystack, const char * needle ) {
+    const size_t length = strlen( needle );
+    const int    first  = tolower( (unsigned char) needle[0] );
+
+    if( length == 0 ) {
+        return true; //EARLY RETURN
+    }
+
+    for( ; *haystack != '\0'; ++haystack ) {
+        if( tolower( (unsigned char) *haystack ) == first && strncasecmp( haystack, needle, length ) == 0 ) {
+            return true; //EARLY RETURN
+        }
+    }
+
+    return false;
+}
+
+/**
+ * [PRIVATE] Matches a field against a search term
+ * @param field Field value
+ * @param term  Search term
+ * @param exact Flag for whole-field matching (otherwise sub-string)
+ * @return Match state
+ */
+static bool ctune_StationCatalogue_matchText( const char * field, const char * term, bool exact ) {
+    return ( exact ? ( strcasecmp( field, term ) == 0 ) : ctune_StationCatalogue_containsNoCase( field, term ) );
+}
+
+/**
+ * [PRIVATE] Matches a comma-separated list field against a search term
+ * @param list  Comma-separated list value
+ * @param term  Search term
+ * @param exact Flag for whole-item matching (otherwise sub-string on the whole list)
+ * @return Match state
+ */
+static bool ctune_StationCatalogue_matchList( const char * list, const char * term, bool exact ) {
+    if( !exact ) {
+        return ctune_StationCatalogue_containsNoCase( list, term ); //EARLY RETURN
+    }
+
+    const size_t length = strlen( term );
+
+    while( *list != '\0' ) {
+        while( *list == ' ' || *list == ',' ) {
+            ++list;
+        }
+
+        const char * end = list;
+
+        while( *end != '\0' && *end != ',' ) {
+            ++end;
+        }
+
+        const char * last = end;
+
+        while( last > list && *( last - 1 ) == ' ' ) {
+            --last;
+        }
+
+        if( (size_t) ( last - list ) == length && length > 0 && strncasecmp( list, term, length ) == 0 ) {
+            return true; //EARLY RETURN
+        }
+
+        list = end;
+    }
+
+    return false;
+}
+
+/**
+ * [PRIVATE] Checks a record against a query
+ * @param query  Query
+ * @param record Record
+ * @return Match state
+ */
+static bool ctune_StationCatalogue_matches( const ctune_StationCatalogue_Query_t * query, const ctune_StationFile_Record_t * record ) {
+    const ctune_StationFile_t * file = &catalogue.file;
+
+    if( record->bitrate < query->bitrate_min || record->bitrate > query->bitrate_max ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->name && !ctune_StationCatalogue_matchText( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_NAME ), query->name, query->name_exact ) ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->country && !ctune_StationCatalogue_matchText( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_COUNTRY ), query->country, query->country_exact ) ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->countrycode && strcasecmp( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_ISO3166_1 ), query->countrycode ) != 0 ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->state && !ctune_StationCatalogue_matchText( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_STATE ), query->state, query->state_exact ) ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->language && !ctune_StationCatalogue_matchList( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_LANGUAGE ), query->language, query->language_exact ) ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->codec && !ctune_StationCatalogue_matchText( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_CODEC ), query->codec, query->codec_exact ) ) {
+        return false; //EARLY RETURN
+    }
+
+    if( query->url && strcmp( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_URL ), query->url ) != 0
+                   && strcmp( ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_URL_RESOLVED ), query->url ) != 0 )
+    {
+        return false; //EARLY RETURN
+    }
+
+    if( query->tag || query->tag_list ) {
+        const char * tags = ctune_StationFile.str( file, record, CTUNE_STATIONFILE_STR_TAGS );
+
+        if( query->tag && !ctune_StationCatalogue_matchList( tags, query->tag, query->tag_exact ) ) {
+            return false; //EARLY RETURN
+        }
+
+        if( query->tag_list ) { //all tags in list have to match
+            for( const struct StrListNode * curr = query->tag_list->_front; curr != NULL; curr = curr->next ) {
+                if( !ctune_StationCatalogue_matchList( tags, curr->data, true ) ) {
+                    return false; //EARLY RETURN
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Compares matches on their string key
+ * @param lhs Pointer to a ctune_StationCatalogue_Match_t object
+ * @param rhs Pointer to a ctune_StationCatalogue_Match_t object
+ * @return Result of comparison
+ */
+static int ctune_StationCatalogue_compareStrKey( const void * lhs, const void * rhs ) {
+    const ctune_StationCatalogue_Match_t * a   = lhs;
+    const ctune_StationCatalogue_Match_t * b   = rhs;
+    const int                              cmp = strcasecmp( a->key_str, b->key_str );
+
+    if( cmp != 0 ) {
+        return cmp; //EARLY RETURN
+    }
+
+    return ( a->record < b->record ? -1 : ( a->record > b->record ? +1 : 0 ) );
+}
+
+/**
+ * [PRIVATE] Compares matches on their numeric key
+ * @param lhs Pointer to a ctune_StationCatalogue_Match_t object
+ * @param rhs Pointer to a ctune_StationCatalogue_Match_t object
+ * @return Result of comparison
+ */
+static int ctune_StationCatalogue_compareNumKey( const void * lhs, const void * rhs ) {
+    const ctune_StationCatalogue_Match_t * a = lhs;
+    const ctune_StationCatalogue_Match_t * b = rhs;
+
+    if( a->key_num != b->key_num ) {
+        return ( a->key_num < b->key_num ? -1 : +1 ); //EARLY RETURN
+    }
+
+    return ( a->record < b->record ? -1 : ( a->record > b->record ? +1 : 0 ) );
+}
+
+/**
+ * [PRIVATE] Sorts matches the way the remote API would order them
+ * @param matches Array of matches
+ * @param count   Number of matches
+ * @param order   Sorting attribute
+ * @param reverse Reverse order flag
+ */
+static void ctune_StationCatalogue_sortMatches( ctune_StationCatalogue_Match_t * matches, size_t count, ctune_StationAttr_e order, bool reverse ) {
+    ctune_StationFile_Str_e str_key = CTUNE_STATIONFILE_STR_NAME;
+    bool                    numeric = false;
+
+    switch( order ) {
+        case STATION_ATTR_URL            : str_key = CTUNE_STATIONFILE_STR_URL;                      break;
+        case STATION_ATTR_HOMEPAGE       : str_key = CTUNE_STATIONFILE_STR_HOMEPAGE;                 break;
+        case STATION_ATTR_FAVICON        : str_key = CTUNE_STATIONFILE_STR_FAVICON_URL;              break;
+        case STATION_ATTR_TAGS           : str_key = CTUNE_STATIONFILE_STR_TAGS;                     break;
+        case STATION_ATTR_COUNTRY        : str_key = CTUNE_STATIONFILE_STR_COUNTRY;                  break;
+        case STATION_ATTR_STATE          : str_key = CTUNE_STATIONFILE_STR_STATE;                    break;
+        case STATION_ATTR_LANGUAGE       : str_key = CTUNE_STATIONFILE_STR_LANGUAGE;                 break;
+        case STATION_ATTR_CODEC          : str_key = CTUNE_STATIONFILE_STR_CODEC;                    break;
+        case STATION_ATTR_LASTCHECKTIME  : str_key = CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_TIME;  break;
+        case STATION_ATTR_CLICKTIMESTAMP : str_key = CTUNE_STATIONFILE_STR_ISO8601_CLICK_TIMESTAMP;  break;
+        case STATION_ATTR_CHANGETIMESTAMP: str_key = CTUNE_STATIONFILE_STR_ISO8601_LAST_CHANGE_TIME; break;
+        case STATION_ATTR_VOTES          : //fallthrough
+        case STATION_ATTR_BITRATE        :
+        case STATION_ATTR_LASTCHECKOK    :
+        case STATION_ATTR_CLICKCOUNT     :
+        case STATION_ATTR_CLICKTREND     : numeric = true; break;
+
+        case STATION_ATTR_RANDOM: {
+            for( size_t k = count; k > 1; --k ) {
+                const size_t                   pick = (size_t) rand() % k;
+                ctune_StationCatalogue_Match_t tmp  = matches[ k - 1 ];
+
+                matches[ k - 1 ] = matches[ pick ];
+                matches[ pick  ] = tmp;
+            }
+        } return; //EARLY RETURN
+
+        default: break; //name
+    }
+
+    for( size_t i = 0; i < count; ++i ) {
+        const ctune_StationFile_Record_t * rec = matches[i].record;
+
+        switch( order ) {
+            case STATION_ATTR_VOTES      : matches[i].key_num = (double) rec->votes;                                                break;
+            case STATION_ATTR_BITRATE    : matches[i].key_num = (double) rec->bitrate;                                              break;
+            case STATION_ATTR_LASTCHECKOK: matches[i].key_num = ( ( rec->flags & CTUNE_STATIONFILE_FLAG_LAST_CHECK_OK ) ? 1 : 0 ); break;
+            case STATION_ATTR_CLICKCOUNT : matches[i].key_num = (double) rec->clickcount;                                           break;
+            case STATION_ATTR_CLICKTREND : matches[i].key_num = (double) rec->clicktrend;                                           break;
+            default                      : matches[i].key_str = ctune_StationFile.str( &catalogue.file, rec, str_key );            break;
+        }
+    }
+
+    qsort( matches, count, sizeof( ctune_StationCatalogue_Match_t ), ( numeric ? ctune_StationCatalogue_compareNumKey : ctune_StationCatalogue_compareStrKey ) );
+
+    if( reverse ) {
+        for( size_t i = 0, j = count; i + 1 < j; ++i, --j ) {
+            ctune_StationCatalogue_Match_t tmp = matches[i];
+            matches[i]     = matches[j - 1];
+            matches[j - 1] = tmp;
+        }
+    }
+}
+
+/**
+ * [PRIVATE] Appends a copy of a record to a collection of stations
+ * @param record   Record
+ * @param stations Collection of RadioStationInfo_t objects
+ * @return Success
+ */
+static bool ctune_StationCatalogue_materialise( const ctune_StationFile_Record_t * record, Vector_t * stations ) {
+    ctune_RadioStationInfo_t * rsi = Vector.init_back( stations, ctune_RadioStationInfo.init );
+
+    if( rsi == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    ctune_StationFile.materialise( &catalogue.file, record, rsi );
+    return true;
+}
+
+/**
+ * [PRIVATE] Runs a query on the catalogue
+ * @param query    Query
+ * @param order    Sorting attribute
+ * @param reverse  Reverse order flag
+ * @param offset   Offset of the first result to return
+ * @param limit    Maximum number of results to return (0 for all)
+ * @param stations Container for the resulting RadioStationInfo_t objects
+ * @return Success
+ */
+static bool ctune_StationCatalogue_select( const ctune_StationCatalogue_Query_t * query,
+                                           ctune_StationAttr_e                    order,
+                                           bool                                   reverse,
+                                           size_t                                 offset,
+                                           size_t                                 limit,
+                                           Vector_t                             * stations )
+{
+    bool                             error_state = false;
+    size_t                           count       = 0;
+    ctune_StationCatalogue_Match_t * matches     = NULL;
+
+    pthread_rwlock_rdlock( &catalogue.lock );
+
+    const size_t size = ctune_StationFile.size( &catalogue.file );
+
+    if( size == 0 ) {
+        error_state = true;
+        goto end;
+    }
+
+    if( ( matches = malloc( size * sizeof( ctune_StationCatalogue_Match_t ) ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_select( %p, %i, %i, %lu, %lu, %p )] Failed to allocate match buffer.",
+                   query, order, reverse, offset, limit, stations
+        );
+
+        error_state = true;
+        goto end;
+    }
+
+    for( size_t i = 0; i < size; ++i ) {
+        const ctune_StationFile_Record_t * record = ctune_StationFile.at( &catalogue.file, i );
+
+        if( ctune_StationCatalogue_matches( query, record ) ) {
+            matches[ count++ ] = (ctune_StationCatalogue_Match_t) { .record = record, .key_str = "", .key_num = 0 };
+        }
+    }
+
+    ctune_StationCatalogue_sortMatches( matches, count, order, reverse );
+
+    const size_t last = ( limit == 0 || ( offset + limit ) > count ? count : ( offset + limit ) );
+
+    for( size_t i = offset; i < last; ++i ) {
+        if( !ctune_StationCatalogue_materialise( matches[i].record, stations ) ) {
+            error_state = true;
+            break;
+        }
+    }
+
+    CTUNE_LOG( CTUNE_LOG_TRACE,
+               "[ctune_StationCatalogue_select( %p, %i, %i, %lu, %lu, %p )] %lu/%lu records matched.",
+               query, order, reverse, offset, limit, stations, count, size
+    );
+
+    end:
+        pthread_rwlock_unlock( &catalogue.lock );
+        free( matches );
+        return !( error_state );
+}
+
+/**
+ * [PRIVATE] Compares category tokens
+ * @param lhs Pointer to a ctune_StationCatalogue_Token_t object
+ * @param rhs Pointer to a ctune_StationCatalogue_Token_t object
+ * @return Result of comparison
+ */
+static int ctune_StationCatalogue_compareTokens( const void * lhs, const void * rhs ) {
+    const ctune_StationCatalogue_Token_t * a   = lhs;
+    const ctune_StationCatalogue_Token_t * b   = rhs;
+    const int                              cmp = strncmp( a->str, b->str, ( a->length < b->length ? a->length : b->length ) );
+
+    if( cmp != 0 ) {
+        return cmp; //EARLY RETURN
+    }
+
+    if( a->length != b->length ) {
+        return ( a->length < b->length ? -1 : +1 ); //EARLY RETURN
+    }
+
+    return strcmp( ( a->data ? a->data : "" ), ( b->data ? b->data : "" ) );
+}
+
+/**
+ * [PRIVATE] Appends a token to a buffer
+ * @param tokens   Pointer to token buffer
+ * @param count    Pointer to token count
+ * @param capacity Pointer to token buffer capacity
+ * @param token    Token to append
+ * @return Success
+ */
+static bool ctune_StationCatalogue_pushToken( ctune_StationCatalogue_Token_t ** tokens, size_t * count, size_t * capacity, ctune_StationCatalogue_Token_t token ) {
+    if( token.length == 0 ) {
+        return true; //EARLY RETURN
+    }
+
+    if( *count == *capacity ) {
+        const size_t                     new_capacity = ( *capacity == 0 ? 1024 : *capacity * 2 );
+        ctune_StationCatalogue_Token_t * buffer       = realloc( *tokens, new_capacity * sizeof( ctune_StationCatalogue_Token_t ) );
+
+        if( buffer == NULL ) {
+            return false; //EARLY RETURN
+        }
+
+        *tokens   = buffer;
+        *capacity = new_capacity;
+    }
+
+    ( *tokens )[ ( *count )++ ] = token;
+    return true;
+}
+
+/**
+ * Maps the catalogue file if there is one
+ * @return Loaded state
+ */
+static bool ctune_StationCatalogue_init( void ) {
+    bool loaded = false;
+
+    pthread_rwlock_wrlock( &catalogue.lock );
+
+    if( String.empty( &catalogue.file_path ) ) {
+        ctune_XDG.resolveCacheFilePath( catalogue.file_name, &catalogue.file_path );
+    }
+
+    if( !( loaded = ctune_StationFile.isOpen( &catalogue.file ) ) ) {
+        loaded = ctune_StationFile.open( catalogue.file_path._raw, &catalogue.file );
+    }
+
+    CTUNE_LOG( CTUNE_LOG_MSG,
+               "[ctune_StationCatalogue_init()] Station catalogue (\"%s\"): %s (%lu stations).",
+               catalogue.file_path._raw, ( loaded ? "loaded" : "not available" ), ctune_StationFile.size( &catalogue.file )
+    );
+
+    pthread_rwlock_unlock( &catalogue.lock );
+
+    return loaded;
+}
+
+/**
+ * [THREAD SAFE] Checks if a catalogue is loaded
+ * @return Loaded state
+ */
+static bool ctune_StationCatalogue_isLoaded( void ) {
+    pthread_rwlock_rdlock( &catalogue.lock );
+    const bool loaded = ctune_StationFile.isOpen( &catalogue.file );
+    pthread_rwlock_unlock( &catalogue.lock );
+    return loaded;
+}
+
+/**
+ * [THREAD SAFE] Gets the number of stations in the catalogue
+ * @return Station count
+ */
+static size_t ctune_StationCatalogue_size( void ) {
+    pthread_rwlock_rdlock( &catalogue.lock );
+    const size_t size = ctune_StationFile.size( &catalogue.file );
+    pthread_rwlock_unlock( &catalogue.lock );
+    return size;
+}
+
+/**
+ * [THREAD SAFE] Gets the timestamp of the last complete rebuild of the catalogue
+ * @return Timestamp (0 if not loaded)
+ */
+static time_t ctune_StationCatalogue_lastFullSync( void ) {
+    pthread_rwlock_rdlock( &catalogue.lock );
+    const time_t ts = ctune_StationFile.created( &catalogue.file );
+    pthread_rwlock_unlock( &catalogue.lock );
+    return ts;
+}
+
+/**
+ * [THREAD SAFE] Gets the timestamp of the last update to the catalogue
+ * @return Timestamp (0 if not loaded)
+ */
+static time_t ctune_StationCatalogue_lastSync( void ) {
+    pthread_rwlock_rdlock( &catalogue.lock );
+    const time_t ts = ctune_StationFile.modified( &catalogue.file );
+    pthread_rwlock_unlock( &catalogue.lock );
+    return ts;
+}
+
+/**
+ * [THREAD SAFE] Gets the most recent 'lastchangetime_iso8601' value in the catalogue
+ * @param ts String to store the timestamp into
+ * @return Success (false if not loaded or unknown)
+ */
+static bool ctune_StationCatalogue_lastChangeTimestamp( String_t * ts ) {
+    bool ret = false;
+
+    pthread_rwlock_rdlock( &catalogue.lock );
+
+    const char * marker = ctune_StationFile.marker( &catalogue.file );
+
+    if( marker[0] != '\0' ) {
+        ret = String.set( ts, marker );
+    }
+
+    pthread_rwlock_unlock( &catalogue.lock );
+
+    return ret;
+}
+
+/**
+ * [THREAD SAFE] Updates the catalogue with a collection of stations
+ * @param stations Collection of RadioStationInfo_t objects (gets sorted in-place)
+ * @param full     Flag to replace the whole catalogue (otherwise stations are merged in)
+ * @return Success
+ */
+static bool ctune_StationCatalogue_update( Vector_t * stations, bool full ) {
+    if( stations == NULL || ( full && Vector.empty( stations ) ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_update( %p, %i )] No stations to build catalogue from.", stations, full );
+        return false; //EARLY RETURN
+    }
+
+    bool     error_state = false;
+    String_t marker      = String.init();
+
+    pthread_mutex_lock( &catalogue.update );
+    pthread_rwlock_rdlock( &catalogue.lock ); //only this thread replaces the mapping so reading from it whilst writing is safe
+
+    if( String.empty( &catalogue.file_path ) ) {
+        ctune_XDG.resolveCacheFilePath( catalogue.file_name, &catalogue.file_path );
+    }
+
+    if( !full ) {
+        String.set( &marker, ctune_StationFile.marker( &catalogue.file ) );
+    }
+
+    for( size_t i = 0; i < Vector.size( stations ); ++i ) {
+        const ctune_RadioStationInfo_t * rsi = Vector.at( stations, i );
+
+        if( rsi->iso8601.last_change_time != NULL && ( String.empty( &marker ) || strcmp( rsi->iso8601.last_change_time, marker._raw ) > 0 ) ) {
+            String.set( &marker, rsi->iso8601.last_change_time );
+        }
+    }
+
+    error_state = !ctune_StationFile.write( catalogue.file_path._raw,
+                                            ( full ? NULL : &catalogue.file ),
+                                            stations,
+                                            ( String.empty( &marker ) ? "" : marker._raw ) );
+
+    pthread_rwlock_unlock( &catalogue.lock );
+
+    if( !error_state ) {
+        pthread_rwlock_wrlock( &catalogue.lock );
+
+        ctune_StationFile.close( &catalogue.file );
+        error_state = !ctune_StationFile.open( catalogue.file_path._raw, &catalogue.file );
+
+        CTUNE_LOG( CTUNE_LOG_MSG,
+                   "[ctune_StationCatalogue_update( %p, %i )] Catalogue %s with %lu stations: %lu total (last change: %s).",
+                   stations, full, ( full ? "rebuilt" : "updated" ), Vector.size( stations ),
+                   ctune_StationFile.size( &catalogue.file ), ctune_StationFile.marker( &catalogue.file )
+        );
+
+        pthread_rwlock_unlock( &catalogue.lock );
+    }
+
+    pthread_mutex_unlock( &catalogue.update );
+
+    String.free( &marker );
+    return !( error_state );
+}
+
+/**
+ * [THREAD SAFE] Search for all stations matching the criteria in filter
+ * @param filter   Filter
+ * @param stations RadioStationInfo container
+ * @return Success
+ */
+static bool ctune_StationCatalogue_getStations( const ctune_RadioBrowserFilter_t * filter, Vector_t * stations ) {
+    if( filter == NULL || stations == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_getStations( %p, %p )] NULL arg(s).", filter, stations );
+        return false; //EARLY RETURN
+    }
+
+    ctune_StationCatalogue_Query_t query = ctune_StationCatalogue_initQuery();
+
+    query.name           = filter->name;
+    query.name_exact     = filter->nameExact;
+    query.country        = filter->country;
+    query.country_exact  = filter->countryExact;
+    query.countrycode    = ( filter->countrycode[0] != ' ' && filter->countrycode[1] != ' ' ? filter->countrycode : NULL );
+    query.state          = filter->state;
+    query.state_exact    = filter->stateExact;
+    query.language       = filter->language;
+    query.language_exact = filter->languageExact;
+    query.tag            = filter->tag;
+    query.tag_exact      = filter->tagExact;
+    query.tag_list       = ( StrList.empty( &filter->tagList ) ? NULL : &filter->tagList );
+    query.codec          = filter->codec;
+    query.codec_exact    = true;
+    query.bitrate_min    = filter->bitrateMin;
+    query.bitrate_max    = filter->bitrateMax;
+
+    return ctune_StationCatalogue_select( &query, filter->order, filter->reverse, filter->offset, filter->limit, stations );
+}
+
+/**
+ * [THREAD SAFE] Search for all stations matching the criteria
+ * @param category    Category
+ * @param search_term Search term (optional for the clicks/votes/recent categories)
+ * @param stations    Container for stations
+ * @return Success
+ */
+static bool ctune_StationCatalogue_getStationsBy( ctune_ByCategory_e category, const char * search_term, Vector_t * stations ) {
+    ctune_StationCatalogue_Query_t query   = ctune_StationCatalogue_initQuery();
+    ctune_StationAttr_e            order   = STATION_ATTR_NAME;
+    bool                           reverse = false;
+    size_t                         limit   = 0;
+
+    if( stations == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_getStationsBy( %i, %p, %p )] NULL station container.", category, search_term, stations );
+        return false; //EARLY RETURN
+    }
+
+    switch( category ) {
+        case RADIOBROWSER_STATION_BY_CLICKS:
+            order = STATION_ATTR_CLICKCOUNT;      reverse = true; limit = CTUNE_RADIOBROSWERFILTER_LIMIT_DFLT; break;
+        case RADIOBROWSER_STATION_BY_VOTES:
+            order = STATION_ATTR_VOTES;           reverse = true; limit = CTUNE_RADIOBROSWERFILTER_LIMIT_DFLT; break;
+        case RADIOBROWSER_STATION_BY_RECENT_CLICKS:
+            order = STATION_ATTR_CLICKTIMESTAMP;  reverse = true; limit = CTUNE_RADIOBROSWERFILTER_LIMIT_DFLT; break;
+        case RADIOBROWSER_STATION_BY_RECENT_ADD_OR_MOD:
+            order = STATION_ATTR_CHANGETIMESTAMP; reverse = true; limit = CTUNE_RADIOBROSWERFILTER_LIMIT_DFLT; break;
+
+        default: {
+            if( search_term == NULL ) {
+                CTUNE_LOG( CTUNE_LOG_ERROR,
+                           "[ctune_StationCatalogue_getStationsBy( %i, %p, %p )] Search term required for category '%s'.",
+                           category, search_term, stations, ctune_ByCategory.str( category )
+                );
+
+                return false; //EARLY RETURN
+            }
+        } break;
+    }
+
+    switch( category ) {
+        case RADIOBROWSER_STATION_BY_UUID: {
+            bool found = false;
+
+            pthread_rwlock_rdlock( &catalogue.lock );
+
+            const ctune_StationFile_Record_t * record = ctune_StationFile.find( &catalogue.file, search_term );
+
+            if( record != NULL ) {
+                found = ctune_StationCatalogue_materialise( record, stations );
+            }
+
+            pthread_rwlock_unlock( &catalogue.lock );
+
+            return found; //EARLY RETURN
+        }
+
+        case RADIOBROWSER_STATION_BY_NAME               : query.name     = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_NAME_EXACT         : query.name     = search_term; query.name_exact     = true; break;
+        case RADIOBROWSER_STATION_BY_CODEC              : query.codec    = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_CODEC_EXACT        : query.codec    = search_term; query.codec_exact    = true; break;
+        case RADIOBROWSER_STATION_BY_COUNTRY            : query.country  = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_COUNTRY_EXACT      : query.country  = search_term; query.country_exact  = true; break;
+        case RADIOBROWSER_STATION_BY_COUNTRY_CODE_EXACT : query.countrycode = search_term;                          break;
+        case RADIOBROWSER_STATION_BY_STATE              : query.state    = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_STATE_EXACT        : query.state    = search_term; query.state_exact    = true; break;
+        case RADIOBROWSER_STATION_BY_LANGUAGE           : query.language = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_LANGUAGE_EXACT     : query.language = search_term; query.language_exact = true; break;
+        case RADIOBROWSER_STATION_BY_TAG                : query.tag      = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_TAG_EXACT          : query.tag      = search_term; query.tag_exact      = true; break;
+        case RADIOBROWSER_STATION_BY_URL                : query.url      = search_term;                             break;
+        case RADIOBROWSER_STATION_BY_CLICKS             : //fallthrough
+        case RADIOBROWSER_STATION_BY_VOTES              :
+        case RADIOBROWSER_STATION_BY_RECENT_CLICKS      :
+        case RADIOBROWSER_STATION_BY_RECENT_ADD_OR_MOD  : break;
+
+        default: {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_StationCatalogue_getStationsBy( %i, %p, %p )] Category not supported.",
+                       category, search_term, stations
+            );
+        } return false; //EARLY RETURN
+    }
+
+    return ctune_StationCatalogue_select( &query, order, reverse, 0, limit, stations );
+}
+
+/**
+ * [THREAD SAFE] Aggregates the items within a category
+ * @param category       Category
+ * @param category_items Container for the category items (`ctune_CategoryItem_t`)
+ * @return Success
+ */
+static bool ctune_StationCatalogue_getCategoryItems( ctune_ListCategory_e category, Vector_t * category_items ) {
+    ctune_StationFile_Str_e          field       = CTUNE_STATIONFILE_STR_COUNTRY;
+    bool                             list_field  = false;
+    bool                             error_state = false;
+    ctune_StationCatalogue_Token_t * tokens      = NULL;
+    size_t                           count       = 0;
+    size_t                           capacity    = 0;
+
+    switch( category ) {
+        case RADIOBROWSER_CATEGORY_COUNTRIES   : field = CTUNE_STATIONFILE_STR_COUNTRY;                     break;
+        case RADIOBROWSER_CATEGORY_COUNTRYCODES: field = CTUNE_STATIONFILE_STR_ISO3166_1;                   break;
+        case RADIOBROWSER_CATEGORY_CODECS      : field = CTUNE_STATIONFILE_STR_CODEC;                       break;
+        case RADIOBROWSER_CATEGORY_STATES      : field = CTUNE_STATIONFILE_STR_STATE;                       break;
+        case RADIOBROWSER_CATEGORY_LANGUAGES   : field = CTUNE_STATIONFILE_STR_LANGUAGE; list_field = true; break;
+        case RADIOBROWSER_CATEGORY_TAGS        : field = CTUNE_STATIONFILE_STR_TAGS;     list_field = true; break;
+        default: {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_getCategoryItems( %i, %p )] Category not supported.", category, category_items );
+        } return false; //EARLY RETURN
+    }
+
+    pthread_rwlock_rdlock( &catalogue.lock );
+
+    const size_t size = ctune_StationFile.size( &catalogue.file );
+
+    if( size == 0 ) {
+        error_state = true;
+        goto end;
+    }
+
+    for( size_t i = 0; i < size && !error_state; ++i ) {
+        const ctune_StationFile_Record_t * record = ctune_StationFile.at( &catalogue.file, i );
+        const char                       * value  = ctune_StationFile.str( &catalogue.file, record, field );
+        const char                       * data   = ( category == RADIOBROWSER_CATEGORY_STATES
+                                                      ? ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_COUNTRY )
+                                                      : NULL );
+
+        if( !list_field ) {
+            ctune_StationCatalogue_Token_t token = { .str = value, .length = strlen( value ), .data = data };
+            error_state = !ctune_StationCatalogue_pushToken( &tokens, &count, &capacity, token );
+            continue;
+        }
+
+        while( *value != '\0' && !error_state ) { //split comma-separated list
+            while( *value == ' ' || *value == ',' ) {
+                ++value;
+            }
+
+            const char * end = value;
+
+            while( *end != '\0' && *end != ',' ) {
+                ++end;
+            }
+
+            const char * last = end;
+
+            while( last > value && *( last - 1 ) == ' ' ) {
+                --last;
+            }
+
+            ctune_StationCatalogue_Token_t token = { .str = value, .length = (size_t) ( last - value ), .data = NULL };
+            error_state = !ctune_StationCatalogue_pushToken( &tokens, &count, &capacity, token );
+            value       = end;
+        }
+    }
+
+    if( error_state ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_getCategoryItems( %i, %p )] Failed to allocate token buffer.", category, category_items );
+        goto end;
+    }
+
+    qsort( tokens, count, sizeof( ctune_StationCatalogue_Token_t ), ctune_StationCatalogue_compareTokens );
+
+    for( size_t i = 0; i < count; ) { //run-length count of the sorted tokens
+        size_t j = i + 1;
+
+        while( j < count && ctune_StationCatalogue_compareTokens( &tokens[i], &tokens[j] ) == 0 ) {
+            ++j;
+        }
+
+        ctune_CategoryItem_t * item = Vector.init_back( category_items, ctune_CategoryItem.init );
+
+        if( item == NULL || ( item->name = malloc( tokens[i].length + 1 ) ) == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_getCategoryItems( %i, %p )] Failed to allocate category item.", category, category_items );
+            error_state = true;
+            goto end;
+        }
+
+        memcpy( item->name, tokens[i].str, tokens[i].length );
+        item->name[ tokens[i].length ] = '\0';
+        item->stationcount             = (ulong) ( j - i );
+        item->data                     = ( tokens[i].data && tokens[i].data[0] != '\0' ? strdup( tokens[i].data ) : NULL );
+
+        i = j;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_TRACE,
+               "[ctune_StationCatalogue_getCategoryItems( %i, %p )] %lu items aggregated from %lu stations.",
+               category, category_items, Vector.size( category_items ), size
+    );
+
+    end:
+        pthread_rwlock_unlock( &catalogue.lock );
+        free( tokens );
+        return !( error_state );
+}
+
+/**
+ * [THREAD SAFE] Adds all the stations in the catalogue to a search index
+ * @param index Un-finalised StationIndex object
+ * @return Success (false if not loaded)
+ */
+static bool ctune_StationCatalogue_buildIndex( ctune_StationIndex_t * index ) {
+    if( index == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationCatalogue_buildIndex( %p )] NULL arg.", index );
+        return false; //EARLY RETURN
+    }
+
+    bool error_state = false;
+
+    pthread_rwlock_rdlock( &catalogue.lock );
+
+    if( !ctune_StationFile.isOpen( &catalogue.file ) ) {
+        error_state = true;
+        goto end;
+    }
+
+    for( size_t i = 0; i < ctune_StationFile.size( &catalogue.file ) && !error_state; ++i ) {
+        const ctune_StationFile_Record_t * record = ctune_StationFile.at( &catalogue.file, i );
+
+        error_state = !ctune_StationIndex.add( index,
+                                               ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_STATION_UUID ),
+                                               CTUNE_STATIONSRC_RADIOBROWSER,
+                                               (ulong) record->clickcount,
+                                               ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_NAME ),
+                                               ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_TAGS ),
+                                               ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_COUNTRY ),
+                                               ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_LANGUAGE ),
+                                               ctune_StationFile.str( &catalogue.file, record, CTUNE_STATIONFILE_STR_CODEC ) );
+    }
+
+    end:
+        pthread_rwlock_unlock( &catalogue.lock );
+        return !( error_state );
+}
+
+/**
+ * De-allocates resources
+ */
+static void ctune_StationCatalogue_free( void ) {
+    pthread_rwlock_wrlock( &catalogue.lock );
+    ctune_StationFile.close( &catalogue.file );
+    String.free( &catalogue.file_path );
+    pthread_rwlock_unlock( &catalogue.lock );
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_StationCatalogue_Instance ctune_StationCatalogue = {
+    .init                = &ctune_StationCatalogue_init,
+    .isLoaded            = &ctune_StationCatalogue_isLoaded,
+    .size                = &ctune_StationCatalogue_size,
+    .lastFullSync        = &ctune_StationCatalogue_lastFullSync,
+    .lastSync            = &ctune_StationCatalogue_lastSync,
+    .lastChangeTimestamp = &ctune_StationCatalogue_lastChangeTimestamp,
+    .update              = &ctune_StationCatalogue_update,
+    .getStations         = &ctune_StationCatalogue_getStations,
+    .getStationsBy       = &ctune_StationCatalogue_getStationsBy,
+    .getCategoryItems    = &ctune_StationCatalogue_getCategoryItems,
+    .buildIndex          = &ctune_StationCatalogue_buildIndex,
+    .free                = &ctune_StationCatalogue_free,
+};
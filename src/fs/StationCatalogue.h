@@ -0,0 +1,110 @@
+#ifndef CTUNE_FS_STATIONCATALOGUE_H
+#define CTUNE_FS_STATIONCATALOGUE_H
+
+#include <stdbool.h>
+#include <time.h>
+
+#include "../datastructure/Vector.h"
+#include "../datastructure/String.h"
+#include "../datastructure/StationIndex.h"
+#include "../dto/RadioBrowserFilter.h"
+#include "../dto/RadioStationInfo.h"
+#include "../dto/CategoryItem.h"
+#include "../enum/ByCategory.h"
+#include "../enum/ListCategory.h"
+
+#define CTUNE_STATIONCATALOGUE_SYNC_PAGE_SIZE  10000
+#define CTUNE_STATIONCATALOGUE_FULL_RESYNC_AGE ( 7 * 24 * 60 * 60 ) //in seconds
+
+/**
+ * Local snapshot of the remote station list kept in the XDG cache directory
+ * -
+ * Note: the delta sync (`update(..)` with `full = false`) only picks up added/modified stations.
+ *       Removed stations are only dropped on the next complete rebuild.
+ */
+extern const struct ctune_StationCatalogue_Instance {
+    /**
+     * Maps the catalogue file if there is one
+     * @return Loaded state
+     */
+    bool (* init)( void );
+
+    /**
+     * [THREAD SAFE] Checks if a catalogue is loaded
+     * @return Loaded state
+     */
+    bool (* isLoaded)( void );
+
+    /**
+     * [THREAD SAFE] Gets the number of stations in the catalogue
+     * @return Station count
+     */
+    size_t (* size)( void );
+
+    /**
+     * [THREAD SAFE] Gets the timestamp of the last complete rebuild of the catalogue
+     * @return Timestamp (0 if not loaded)
+     */
+    time_t (* lastFullSync)( void );
+
+    /**
+     * [THREAD SAFE] Gets the timestamp of the last update to the catalogue
+     * @return Timestamp (0 if not loaded)
+     */
+    time_t (* lastSync)( void );
+
+    /**
+     * [THREAD SAFE] Gets the most recent 'lastchangetime_iso8601' value in the catalogue
+     * @param ts String to store the timestamp into
+     * @return Success (false if not loaded or unknown)
+     */
+    bool (* lastChangeTimestamp)( String_t * ts );
+
+    /**
+     * [THREAD SAFE] Updates the catalogue with a collection of stations
+     * @param stations Collection of RadioStationInfo_t objects (gets sorted in-place)
+     * @param full     Flag to replace the whole catalogue (otherwise stations are merged in)
+     * @return Success
+     */
+    bool (* update)( Vector_t * stations, bool full );
+
+    /**
+     * [THREAD SAFE] Search for all stations matching the criteria in filter
+     * @param filter   Filter
+     * @param stations RadioStationInfo container
+     * @return Success
+     */
+    bool (* getStations)( const ctune_RadioBrowserFilter_t * filter, Vector_t * stations );
+
+    /**
+     * [THREAD SAFE] Search for all stations matching the criteria
+     * @param category    Category
+     * @param search_term Search term (optional for the clicks/votes/recent categories)
+     * @param stations    Container for stations
+     * @return Success
+     */
+    bool (* getStationsBy)( ctune_ByCategory_e category, const char * search_term, Vector_t * stations );
+
+    /**
+     * [THREAD SAFE] Aggregates the items within a category
+     * @param category       Category
+     * @param category_items Container for the category items (`ctune_CategoryItem_t`)
+     * @return Success
+     */
+    bool (* getCategoryItems)( ctune_ListCategory_e category, Vector_t * category_items );
+
+    /**
+     * [THREAD SAFE] Adds all the stations in the catalogue to a search index
+     * @param index Un-finalised StationIndex object
+     * @return Success (false if not loaded)
+     */
+    bool (* buildIndex)( ctune_StationIndex_t * index );
+
+    /**
+     * De-allocates resources
+     */
+    void (* free)( void );
+
+} ctune_StationCatalogue;
+
+#endif //CTUNE_FS_STATIONCATALOGUE_H
@@ -0,0 +1,611 @@
+#include "StationFile.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "logger/src/Logger.h"
+
+#define CTUNE_STATIONFILE_MAGIC      "CTSF"
+#define CTUNE_STATIONFILE_BYTE_ORDER 0x01020304
+
+/**
+ * [PRIVATE] Growable string table used when writing a file
+ * @param data     Buffer
+ * @param size     Used size in bytes
+ * @param capacity Allocated size in bytes
+ * @param error    Error flag (allocation failure/offset overflow)
+ */
+typedef struct ctune_StationFile_StrTab {
+    char * data;
+    size_t size;
+    size_t capacity;
+    bool   error;
+
+} ctune_StationFile_StrTab_t;
+
+/**
+ * [PRIVATE] Appends a string to a string table
+ * @param tab String table
+ * @param str String to append
+ * @return Offset of the string in the table (0 for NULL/empty strings and on error)
+ */
+static uint32_t ctune_StationFile_appendStr( ctune_StationFile_StrTab_t * tab, const char * str ) {
+    if( str == NULL || str[0] == '\0' || tab->error ) {
+        return 0; //EARLY RETURN
+    }
+
+    const size_t length = strlen( str ) + 1;
+
+    if( ( tab->size + length ) > UINT32_MAX ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationFile_appendStr( %p, %p )] String table is full.", tab, str );
+        tab->error = true;
+        return 0; //EARLY RETURN
+    }
+
+    if( ( tab->size + length ) > tab->capacity ) {
+        size_t new_capacity = ( tab->capacity == 0 ? 4096 : tab->capacity );
+
+        while( new_capacity < ( tab->size + length ) ) {
+            new_capacity *= 2;
+        }
+
+        char * data = realloc( tab->data, new_capacity );
+
+        if( data == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_StationFile_appendStr( %p, %p )] Failed reallocation of string table (%lu -> %lu bytes).",
+                       tab, str, tab->capacity, new_capacity
+            );
+
+            tab->error = true;
+            return 0; //EARLY RETURN
+        }
+
+        tab->data     = data;
+        tab->capacity = new_capacity;
+    }
+
+    const uint32_t offset = (uint32_t) tab->size;
+
+    memcpy( &tab->data[ tab->size ], str, length );
+    tab->size += length;
+
+    return offset;
+}
+
+/**
+ * [PRIVATE] Packs a RadioStationInfo DTO into a record
+ * @param tab    String table
+ * @param rsi    RadioStationInfo DTO
+ * @param record Record to pack into
+ */
+static void ctune_StationFile_packRSI( ctune_StationFile_StrTab_t * tab, const ctune_RadioStationInfo_t * rsi, ctune_StationFile_Record_t * record ) {
+    const char * fields[CTUNE_STATIONFILE_STR_COUNT] = {
+        [CTUNE_STATIONFILE_STR_STATION_UUID                 ] = rsi->station_uuid,
+        [CTUNE_STATIONFILE_STR_CHANGE_UUID                  ] = rsi->change_uuid,
+        [CTUNE_STATIONFILE_STR_SERVER_UUID                  ] = rsi->server_uuid,
+        [CTUNE_STATIONFILE_STR_NAME                         ] = rsi->name,
+        [CTUNE_STATIONFILE_STR_URL                          ] = rsi->url,
+        [CTUNE_STATIONFILE_STR_URL_RESOLVED                 ] = rsi->url_resolved,
+        [CTUNE_STATIONFILE_STR_HOMEPAGE                     ] = rsi->homepage,
+        [CTUNE_STATIONFILE_STR_FAVICON_URL                  ] = rsi->favicon_url,
+        [CTUNE_STATIONFILE_STR_TAGS                         ] = rsi->tags,
+        [CTUNE_STATIONFILE_STR_COUNTRY                      ] = rsi->country,
+        [CTUNE_STATIONFILE_STR_ISO3166_1                    ] = rsi->country_code.iso3166_1,
+        [CTUNE_STATIONFILE_STR_ISO3166_2                    ] = rsi->country_code.iso3166_2,
+        [CTUNE_STATIONFILE_STR_STATE                        ] = rsi->state,
+        [CTUNE_STATIONFILE_STR_LANGUAGE                     ] = rsi->language,
+        [CTUNE_STATIONFILE_STR_LANGUAGE_CODES               ] = rsi->language_codes,
+        [CTUNE_STATIONFILE_STR_CODEC                        ] = rsi->codec,
+        [CTUNE_STATIONFILE_STR_LAST_CHANGE_TIME             ] = rsi->last_change_time,
+        [CTUNE_STATIONFILE_STR_LAST_CHECK_TIME              ] = rsi->last_check_time,
+        [CTUNE_STATIONFILE_STR_LAST_CHECK_OK_TIME           ] = rsi->last_check_ok_time,
+        [CTUNE_STATIONFILE_STR_LAST_LOCAL_CHECK_TIME        ] = rsi->last_local_check_time,
+        [CTUNE_STATIONFILE_STR_CLICK_TIMESTAMP              ] = rsi->click_timestamp,
+        [CTUNE_STATIONFILE_STR_ISO8601_LAST_CHANGE_TIME     ] = rsi->iso8601.last_change_time,
+        [CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_TIME      ] = rsi->iso8601.last_check_time,
+        [CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_OK_TIME   ] = rsi->iso8601.last_check_ok_time,
+        [CTUNE_STATIONFILE_STR_ISO8601_LAST_LOCAL_CHECK_TIME] = rsi->iso8601.last_local_check_time,
+        [CTUNE_STATIONFILE_STR_ISO8601_CLICK_TIMESTAMP      ] = rsi->iso8601.click_timestamp,
+    };
+
+    for( size_t i = 0; i < CTUNE_STATIONFILE_STR_COUNT; ++i ) {
+        record->str[i] = ctune_StationFile_appendStr( tab, fields[i] );
+    }
+
+    record->votes       = rsi->votes;
+    record->clickcount  = rsi->clickcount;
+    record->bitrate     = rsi->bitrate;
+    record->clicktrend  = rsi->clicktrend;
+    record->ssl_error   = rsi->ssl_error;
+    record->latitude    = rsi->geo.latitude;
+    record->longitude   = rsi->geo.longitude;
+    record->station_src = (uint32_t) rsi->station_src;
+    record->flags       = ( rsi->hls               ? CTUNE_STATIONFILE_FLAG_HLS           : 0 )
+                        | ( rsi->last_check_ok     ? CTUNE_STATIONFILE_FLAG_LAST_CHECK_OK : 0 )
+                        | ( rsi->broken            ? CTUNE_STATIONFILE_FLAG_BROKEN        : 0 )
+                        | ( rsi->has_extended_info ? CTUNE_STATIONFILE_FLAG_EXTENDED_INFO : 0 );
+}
+
+/**
+ * [PRIVATE] Re-packs a record from a mapped file into a record for a new file
+ * @param tab    String table of the new file
+ * @param base   Mapped file
+ * @param from   Record in the mapped file
+ * @param record Record to pack into
+ */
+static void ctune_StationFile_packRecord( ctune_StationFile_StrTab_t * tab, const ctune_StationFile_t * base, const ctune_StationFile_Record_t * from, ctune_StationFile_Record_t * record ) {
+    *record = *from;
+
+    for( size_t i = 0; i < CTUNE_STATIONFILE_STR_COUNT; ++i ) {
+        record->str[i] = ctune_StationFile_appendStr( tab, ctune_StationFile.str( base, from, i ) );
+    }
+}
+
+/**
+ * [PRIVATE] Compares RadioStationInfo_t objects based on their station UUID
+ * @param lhs Pointer to a RadioStationInfo_t object
+ * @param rhs Pointer to a RadioStationInfo_t object
+ * @return Result of comparison
+ */
+static int ctune_StationFile_compareUUID( const void * lhs, const void * rhs ) {
+    const char * a = ( (const ctune_RadioStationInfo_t *) lhs )->station_uuid;
+    const char * b = ( (const ctune_RadioStationInfo_t *) rhs )->station_uuid;
+
+    return strcmp( ( a ? a : "" ), ( b ? b : "" ) );
+}
+
+/**
+ * [PRIVATE] Duplicates a string field or returns NULL when empty
+ * @param str String
+ * @return Allocated copy or NULL
+ */
+static char * ctune_StationFile_dupField( const char * str ) {
+    return ( str == NULL || str[0] == '\0' ) ? NULL : strdup( str );
+}
+
+/**
+ * Initialises a StationFile object
+ * @return Initialised (closed) StationFile
+ */
+static ctune_StationFile_t ctune_StationFile_init( void ) {
+    return (ctune_StationFile_t) {
+        .map      = NULL,
+        .map_size = 0,
+        .header   = NULL,
+        .records  = NULL,
+        .strtab   = NULL,
+    };
+}
+
+/**
+ * Maps a station file into memory and validates its layout
+ * @param file_path File path
+ * @param file      StationFile object to map into (assumed to be closed)
+ * @return Success
+ */
+static bool ctune_StationFile_open( const char * file_path, ctune_StationFile_t * file ) {
+    struct stat file_stat;
+    const char * err_msg = NULL;
+    int          fd      = open( file_path, O_RDONLY );
+
+    if( fd < 0 ) {
+        if( errno != ENOENT ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_StationFile_open( \"%s\", %p )] Failed to open file: %s",
+                       file_path, file, strerror( errno )
+            );
+        }
+
+        return false; //EARLY RETURN
+    }
+
+    if( fstat( fd, &file_stat ) != 0 || file_stat.st_size < (off_t) sizeof( ctune_StationFile_Header_t ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationFile_open( \"%s\", %p )] File is too small or not accessible.", file_path, file );
+        close( fd );
+        return false; //EARLY RETURN
+    }
+
+    void * map = mmap( NULL, (size_t) file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+    close( fd ); //mapping stays valid
+
+    if( map == MAP_FAILED ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationFile_open( \"%s\", %p )] Failed to map file: %s", file_path, file, strerror( errno ) );
+        return false; //EARLY RETURN
+    }
+
+    const size_t                       map_size = (size_t) file_stat.st_size;
+    const ctune_StationFile_Header_t * header   = map;
+    const size_t                       max_recs = ( map_size - sizeof( ctune_StationFile_Header_t ) ) / sizeof( ctune_StationFile_Record_t );
+
+    if( memcmp( header->magic, CTUNE_STATIONFILE_MAGIC, sizeof( header->magic ) ) != 0 ) {
+        err_msg = "bad signature";
+    } else if( header->version != CTUNE_STATIONFILE_VERSION ) {
+        err_msg = "unsupported version";
+    } else if( header->byte_order != CTUNE_STATIONFILE_BYTE_ORDER ) {
+        err_msg = "foreign byte order";
+    } else if( header->record_size != sizeof( ctune_StationFile_Record_t ) ) {
+        err_msg = "record size mismatch";
+    } else if( header->record_count > max_recs ) {
+        err_msg = "record count out of bounds";
+    } else if( header->strtab_offset != ( sizeof( ctune_StationFile_Header_t ) + header->record_count * sizeof( ctune_StationFile_Record_t ) ) ) {
+        err_msg = "bad string table offset";
+    } else if( header->strtab_size == 0 || header->strtab_size != ( map_size - header->strtab_offset ) ) {
+        err_msg = "bad string table size";
+    } else if( ( (const char *) map )[ header->strtab_offset ] != '\0' || ( (const char *) map )[ map_size - 1 ] != '\0' ) {
+        err_msg = "unterminated string table";
+    } else if( header->marker[ CTUNE_STATIONFILE_MARKER_SIZE - 1 ] != '\0' ) {
+        err_msg = "unterminated marker";
+    }
+
+    if( err_msg ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_StationFile_open( \"%s\", %p )] Invalid file: %s.", file_path, file, err_msg );
+        munmap( map, map_size );
+        return false; //EARLY RETURN
+    }
+
+    file->map      = map;
+    file->map_size = map_size;
+    file->header   = header;
+    file->records  = (const ctune_StationFile_Record_t *) ( (const char *) map + sizeof( ctune_StationFile_Header_t ) );
+    file->strtab   = (const char *) map + header->strtab_offset;
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_StationFile_open( \"%s\", %p )] Mapped %lu records (%lu bytes).",
+               file_path, file, header->record_count, map_size
+    );
+
+    return true;
+}
+
+/**
+ * Checks if a StationFile object is currently mapped
+ * @param file StationFile object
+ * @return Open state
+ */
+static bool ctune_StationFile_isOpen( const ctune_StationFile_t * file ) {
+    return ( file != NULL && file->map != NULL );
+}
+
+/**
+ * Unmaps a station file
+ * @param file StationFile object
+ */
+static void ctune_StationFile_close( ctune_StationFile_t * file ) {
+    if( ctune_StationFile_isOpen( file ) ) {
+        munmap( file->map, file->map_size );
+        *file = ctune_StationFile_init();
+    }
+}
+
+/**
+ * Gets the number of records in a station file
+ * @param file StationFile object
+ * @return Record count
+ */
+static size_t ctune_StationFile_size( const ctune_StationFile_t * file ) {
+    return ( ctune_StationFile_isOpen( file ) ? (size_t) file->header->record_count : 0 );
+}
+
+/**
+ * Gets the timestamp of the last complete rebuild of the file
+ * @param file StationFile object
+ * @return Timestamp (0 when not open)
+ */
+static time_t ctune_StationFile_created( const ctune_StationFile_t * file ) {
+    return ( ctune_StationFile_isOpen( file ) ? (time_t) file->header->created : 0 );
+}
+
+/**
+ * Gets the timestamp of the last write to the file
+ * @param file StationFile object
+ * @return Timestamp (0 when not open)
+ */
+static time_t ctune_StationFile_modified( const ctune_StationFile_t * file ) {
+    return ( ctune_StationFile_isOpen( file ) ? (time_t) file->header->modified : 0 );
+}
+
+/**
+ * Gets the user-defined marker string stored in the header
+ * @param file StationFile object
+ * @return Marker string (empty when not open)
+ */
+static const char * ctune_StationFile_marker( const ctune_StationFile_t * file ) {
+    return ( ctune_StationFile_isOpen( file ) ? file->header->marker : "" );
+}
+
+/**
+ * Gets a record
+ * @param file StationFile object
+ * @param i    Record index
+ * @return Pointer to record inside the mapping or NULL if out of range
+ */
+static const ctune_StationFile_Record_t * ctune_StationFile_at( const ctune_StationFile_t * file, size_t i ) {
+    return ( i < ctune_StationFile_size( file ) ? &file->records[i] : NULL );
+}
+
+/**
+ * Gets a string field of a record
+ * @param file   StationFile object
+ * @param record Record
+ * @param field  String field ID
+ * @return Pointer to the string inside the mapping ("" for empty/invalid fields)
+ */
+static const char * ctune_StationFile_str( const ctune_StationFile_t * file, const ctune_StationFile_Record_t * record, ctune_StationFile_Str_e field ) {
+    if( record == NULL || field >= CTUNE_STATIONFILE_STR_COUNT || record->str[field] >= file->header->strtab_size ) {
+        return ""; //EARLY RETURN
+    }
+
+    return &file->strtab[ record->str[field] ];
+}
+
+/**
+ * Binary searches the records for a station UUID
+ * @param file StationFile object
+ * @param uuid Station UUID
+ * @return Pointer to the record or NULL if not found
+ */
+static const ctune_StationFile_Record_t * ctune_StationFile_find( const ctune_StationFile_t * file, const char * uuid ) {
+    if( uuid == NULL ) {
+        return NULL; //EARLY RETURN
+    }
+
+    size_t lo = 0;
+    size_t hi = ctune_StationFile_size( file );
+
+    while( lo < hi ) {
+        const size_t mid = lo + ( hi - lo ) / 2;
+        const int    cmp = strcmp( uuid, ctune_StationFile_str( file, &file->records[mid], CTUNE_STATIONFILE_STR_STATION_UUID ) );
+
+        if( cmp == 0 ) {
+            return &file->records[mid]; //EARLY RETURN
+        } else if( cmp < 0 ) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Copies a record into a RadioStationInfo DTO
+ * @param file   StationFile object
+ * @param record Record
+ * @param rsi    Initialised RadioStationInfo DTO
+ */
+static void ctune_StationFile_materialise( const ctune_StationFile_t * file, const ctune_StationFile_Record_t * record, ctune_RadioStationInfo_t * rsi ) {
+    rsi->station_uuid                  = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_STATION_UUID ) );
+    rsi->change_uuid                   = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_CHANGE_UUID ) );
+    rsi->server_uuid                   = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_SERVER_UUID ) );
+    rsi->name                          = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_NAME ) );
+    rsi->url                           = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_URL ) );
+    rsi->url_resolved                  = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_URL_RESOLVED ) );
+    rsi->homepage                      = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_HOMEPAGE ) );
+    rsi->favicon_url                   = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_FAVICON_URL ) );
+    rsi->tags                          = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_TAGS ) );
+    rsi->country                       = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_COUNTRY ) );
+    rsi->country_code.iso3166_1        = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO3166_1 ) );
+    rsi->country_code.iso3166_2        = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO3166_2 ) );
+    rsi->state                         = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_STATE ) );
+    rsi->language                      = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_LANGUAGE ) );
+    rsi->language_codes                = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_LANGUAGE_CODES ) );
+    rsi->codec                         = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_CODEC ) );
+    rsi->last_change_time              = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_LAST_CHANGE_TIME ) );
+    rsi->last_check_time               = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_LAST_CHECK_TIME ) );
+    rsi->last_check_ok_time            = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_LAST_CHECK_OK_TIME ) );
+    rsi->last_local_check_time         = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_LAST_LOCAL_CHECK_TIME ) );
+    rsi->click_timestamp               = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_CLICK_TIMESTAMP ) );
+    rsi->iso8601.last_change_time      = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO8601_LAST_CHANGE_TIME ) );
+    rsi->iso8601.last_check_time       = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_TIME ) );
+    rsi->iso8601.last_check_ok_time    = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_OK_TIME ) );
+    rsi->iso8601.last_local_check_time = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO8601_LAST_LOCAL_CHECK_TIME ) );
+    rsi->iso8601.click_timestamp       = ctune_StationFile_dupField( ctune_StationFile_str( file, record, CTUNE_STATIONFILE_STR_ISO8601_CLICK_TIMESTAMP ) );
+
+    rsi->votes             = (ulong) record->votes;
+    rsi->clickcount        = (ulong) record->clickcount;
+    rsi->bitrate           = (ulong) record->bitrate;
+    rsi->clicktrend        = (long) record->clicktrend;
+    rsi->ssl_error         = (long) record->ssl_error;
+    rsi->geo.latitude      = record->latitude;
+    rsi->geo.longitude     = record->longitude;
+    rsi->hls               = ( record->flags & CTUNE_STATIONFILE_FLAG_HLS );
+    rsi->last_check_ok     = ( record->flags & CTUNE_STATIONFILE_FLAG_LAST_CHECK_OK );
+    rsi->broken            = ( record->flags & CTUNE_STATIONFILE_FLAG_BROKEN );
+    rsi->has_extended_info = ( record->flags & CTUNE_STATIONFILE_FLAG_EXTENDED_INFO );
+    rsi->station_src       = ( record->station_src < CTUNE_STATIONSRC_COUNT ? (ctune_StationSrc_e) record->station_src : CTUNE_STATIONSRC_LOCAL );
+}
+
+/**
+ * Writes a station file atomically (temporary file + fsync + rename)
+ * @param file_path File path
+ * @param base      Mapped file to merge with (NULL for a complete rebuild)
+ * @param stations  Collection of RadioStationInfo_t objects overriding same-UUID records in `base` (sorted in-place by UUID)
+ * @param marker    Marker string to store in the header (truncated to fit)
+ * @return Success
+ */
+static bool ctune_StationFile_write( const char * file_path, const ctune_StationFile_t * base, Vector_t * stations, const char * marker ) {
+    bool                         error_state = false;
+    String_t                     tmp_path    = String.init();
+    FILE                       * file        = NULL;
+    const size_t                 base_count  = ctune_StationFile_size( base );
+    const size_t                 rsi_count   = ( stations ? Vector.size( stations ) : 0 );
+    size_t                       rec_count   = 0;
+    ctune_StationFile_Record_t * records     = NULL;
+    ctune_StationFile_StrTab_t   strtab      = { .data = NULL, .size = 0, .capacity = 0, .error = false };
+
+    if( ( base_count + rsi_count ) > 0 ) {
+        records = malloc( ( base_count + rsi_count ) * sizeof( ctune_StationFile_Record_t ) );
+
+        if( records == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_StationFile_write( \"%s\", %p, %p, \"%s\" )] Failed to allocate %lu records.",
+                       file_path, base, stations, marker, ( base_count + rsi_count )
+            );
+
+            error_state = true;
+            goto end;
+        }
+    }
+
+    { //offset 0 is reserved for empty strings
+        strtab.data = malloc( 4096 );
+
+        if( strtab.data == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_StationFile_write( \"%s\", %p, %p, \"%s\" )] Failed to allocate string table.",
+                       file_path, base, stations, marker
+            );
+
+            error_state = true;
+            goto end;
+        }
+
+        strtab.data[0]  = '\0';
+        strtab.size     = 1;
+        strtab.capacity = 4096;
+    }
+
+    if( rsi_count > 1 ) {
+        Vector.sort( stations, ctune_StationFile_compareUUID );
+    }
+
+    { //merge-join on UUID (both collections are sorted)
+        size_t       i         = 0;
+        size_t       j         = 0;
+        const char * last_uuid = NULL;
+
+        while( i < base_count || j < rsi_count ) {
+            const ctune_StationFile_Record_t * b_rec  = ( i < base_count ? &base->records[i] : NULL );
+            const ctune_RadioStationInfo_t   * rsi    = ( j < rsi_count  ? Vector.at( stations, j ) : NULL );
+            const char                       * b_uuid = ( b_rec ? ctune_StationFile_str( base, b_rec, CTUNE_STATIONFILE_STR_STATION_UUID ) : NULL );
+            const char                       * r_uuid = ( rsi   ? ( rsi->station_uuid ? rsi->station_uuid : "" ) : NULL );
+
+            if( r_uuid != NULL && ( r_uuid[0] == '\0' || ( last_uuid != NULL && strcmp( r_uuid, last_uuid ) == 0 ) ) ) {
+                ++j; //skip UUID-less stations and duplicates
+                continue;
+            }
+
+            const int cmp = ( b_uuid == NULL ? 1 : ( r_uuid == NULL ? -1 : strcmp( b_uuid, r_uuid ) ) );
+
+            if( cmp < 0 ) {
+                ctune_StationFile_packRecord( &strtab, base, b_rec, &records[ rec_count++ ] );
+                ++i;
+
+            } else {
+                ctune_StationFile_packRSI( &strtab, rsi, &records[ rec_count++ ] );
+                last_uuid = r_uuid;
+                ++j;
+
+                if( cmp == 0 ) {
+                    ++i; //override base record
+                }
+            }
+        }
+    }
+
+    if( strtab.error ) {
+        error_state = true;
+        goto end;
+    }
+
+    const time_t now = time( NULL );
+
+    ctune_StationFile_Header_t header = {
+        .version       = CTUNE_STATIONFILE_VERSION,
+        .byte_order    = CTUNE_STATIONFILE_BYTE_ORDER,
+        .record_size   = sizeof( ctune_StationFile_Record_t ),
+        .record_count  = rec_count,
+        .strtab_offset = sizeof( ctune_StationFile_Header_t ) + rec_count * sizeof( ctune_StationFile_Record_t ),
+        .strtab_size   = strtab.size,
+        .created       = ( ctune_StationFile_isOpen( base ) ? base->header->created : now ),
+        .modified      = now,
+    };
+
+    memcpy( header.magic, CTUNE_STATIONFILE_MAGIC, sizeof( header.magic ) );
+
+    if( marker != NULL ) {
+        strncpy( header.marker, marker, CTUNE_STATIONFILE_MARKER_SIZE - 1 );
+    }
+
+    String.set( &tmp_path, file_path );
+    String.append_back( &tmp_path, ".tmp" );
+
+    if( ( file = fopen( tmp_path._raw, "wb" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_StationFile_write( \"%s\", %p, %p, \"%s\" )] Failed to open temporary file \"%s\": %s",
+                   file_path, base, stations, marker, tmp_path._raw, strerror( errno )
+        );
+
+        error_state = true;
+        goto end;
+    }
+
+    if( fwrite( &header, sizeof( header ), 1, file ) != 1
+        || ( rec_count > 0 && fwrite( records, sizeof( ctune_StationFile_Record_t ), rec_count, file ) != rec_count )
+        || fwrite( strtab.data, 1, strtab.size, file ) != strtab.size
+        || fflush( file ) != 0
+        || fsync( fileno( file ) ) != 0 )
+    {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_StationFile_write( \"%s\", %p, %p, \"%s\" )] Failed to write temporary file \"%s\": %s",
+                   file_path, base, stations, marker, tmp_path._raw, strerror( errno )
+        );
+
+        error_state = true;
+    }
+
+    if( fclose( file ) != 0 ) {
+        error_state = true;
+    }
+
+    file = NULL;
+
+    if( error_state || rename( tmp_path._raw, file_path ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_StationFile_write( \"%s\", %p, %p, \"%s\" )] Failed to replace file with \"%s\".",
+                   file_path, base, stations, marker, tmp_path._raw
+        );
+
+        unlink( tmp_path._raw );
+        error_state = true;
+        goto end;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_StationFile_write( \"%s\", %p, %p, \"%s\" )] Wrote %lu records (%lu base, %lu new/updated).",
+               file_path, base, stations, marker, rec_count, base_count, rsi_count
+    );
+
+    end:
+        free( records );
+        free( strtab.data );
+        String.free( &tmp_path );
+        return !( error_state );
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_StationFile_Namespace ctune_StationFile = {
+    .init        = &ctune_StationFile_init,
+    .open        = &ctune_StationFile_open,
+    .isOpen      = &ctune_StationFile_isOpen,
+    .close       = &ctune_StationFile_close,
+    .size        = &ctune_StationFile_size,
+    .created     = &ctune_StationFile_created,
+    .modified    = &ctune_StationFile_modified,
+    .marker      = &ctune_StationFile_marker,
+    .at          = &ctune_StationFile_at,
+    .str         = &ctune_StationFile_str,
+    .find        = &ctune_StationFile_find,
+    .materialise = &ctune_StationFile_materialise,
+    .write       = &ctune_StationFile_write,
+};
@@ -0,0 +1,222 @@
+#ifndef CTUNE_FS_STATIONFILE_H
+#define CTUNE_FS_STATIONFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "../datastructure/Vector.h"
+#include "../dto/RadioStationInfo.h"
+
+#define CTUNE_STATIONFILE_VERSION 1
+#define CTUNE_STATIONFILE_MARKER_SIZE 32
+
+/**
+ * String field IDs of a station record
+ */
+typedef enum {
+    CTUNE_STATIONFILE_STR_STATION_UUID = 0, //records are sorted on this field
+    CTUNE_STATIONFILE_STR_CHANGE_UUID,
+    CTUNE_STATIONFILE_STR_SERVER_UUID,
+    CTUNE_STATIONFILE_STR_NAME,
+    CTUNE_STATIONFILE_STR_URL,
+    CTUNE_STATIONFILE_STR_URL_RESOLVED,
+    CTUNE_STATIONFILE_STR_HOMEPAGE,
+    CTUNE_STATIONFILE_STR_FAVICON_URL,
+    CTUNE_STATIONFILE_STR_TAGS,
+    CTUNE_STATIONFILE_STR_COUNTRY,
+    CTUNE_STATIONFILE_STR_ISO3166_1,
+    CTUNE_STATIONFILE_STR_ISO3166_2,
+    CTUNE_STATIONFILE_STR_STATE,
+    CTUNE_STATIONFILE_STR_LANGUAGE,
+    CTUNE_STATIONFILE_STR_LANGUAGE_CODES,
+    CTUNE_STATIONFILE_STR_CODEC,
+    CTUNE_STATIONFILE_STR_LAST_CHANGE_TIME,
+    CTUNE_STATIONFILE_STR_LAST_CHECK_TIME,
+    CTUNE_STATIONFILE_STR_LAST_CHECK_OK_TIME,
+    CTUNE_STATIONFILE_STR_LAST_LOCAL_CHECK_TIME,
+    CTUNE_STATIONFILE_STR_CLICK_TIMESTAMP,
+    CTUNE_STATIONFILE_STR_ISO8601_LAST_CHANGE_TIME,
+    CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_TIME,
+    CTUNE_STATIONFILE_STR_ISO8601_LAST_CHECK_OK_TIME,
+    CTUNE_STATIONFILE_STR_ISO8601_LAST_LOCAL_CHECK_TIME,
+    CTUNE_STATIONFILE_STR_ISO8601_CLICK_TIMESTAMP,
+
+    CTUNE_STATIONFILE_STR_COUNT
+} ctune_StationFile_Str_e;
+
+/**
+ * Boolean flags of a station record
+ */
+typedef enum {
+    CTUNE_STATIONFILE_FLAG_HLS           = 0x01,
+    CTUNE_STATIONFILE_FLAG_LAST_CHECK_OK = 0x02,
+    CTUNE_STATIONFILE_FLAG_BROKEN        = 0x04,
+    CTUNE_STATIONFILE_FLAG_EXTENDED_INFO = 0x08,
+} ctune_StationFile_Flag_e;
+
+/**
+ * File header (native byte order - the file is a local cache, not an exchange format)
+ * @param magic         File signature ("CTSF")
+ * @param version       Format version
+ * @param byte_order    Byte-order marker written as 0x01020304
+ * @param record_size   Size of a record in bytes
+ * @param record_count  Number of records
+ * @param strtab_offset Offset of the string table from the start of the file
+ * @param strtab_size   Size of the string table in bytes
+ * @param created       Timestamp of the last complete rebuild (i.e.: a write without a base)
+ * @param modified      Timestamp of the last write
+ * @param marker        User-defined '\0' terminated marker string
+ */
+typedef struct ctune_StationFile_Header {
+    char     magic[4];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t record_size;
+    uint64_t record_count;
+    uint64_t strtab_offset;
+    uint64_t strtab_size;
+    int64_t  created;
+    int64_t  modified;
+    char     marker[CTUNE_STATIONFILE_MARKER_SIZE];
+
+} ctune_StationFile_Header_t;
+
+/**
+ * Fixed-width station record
+ * @param str  Offsets into the string table for each of the string fields (0: empty/NULL)
+ * @param flags Bit-field of ctune_StationFile_Flag_e
+ */
+typedef struct ctune_StationFile_Record {
+    uint32_t str[CTUNE_STATIONFILE_STR_COUNT];
+    uint64_t votes;
+    uint64_t clickcount;
+    uint64_t bitrate;
+    int64_t  clicktrend;
+    int64_t  ssl_error;
+    double   latitude;
+    double   longitude;
+    uint32_t flags;
+    uint32_t station_src;
+
+} ctune_StationFile_Record_t;
+
+/**
+ * Memory-mapped station file
+ * @param map      Start of the read-only mapping
+ * @param map_size Size of the mapping
+ * @param header   Pointer to the file header inside the mapping
+ * @param records  Pointer to the first record inside the mapping
+ * @param strtab   Pointer to the string table inside the mapping
+ */
+typedef struct ctune_StationFile {
+    void                             * map;
+    size_t                             map_size;
+    const ctune_StationFile_Header_t * header;
+    const ctune_StationFile_Record_t * records;
+    const char                       * strtab;
+
+} ctune_StationFile_t;
+
+extern const struct ctune_StationFile_Namespace {
+    /**
+     * Initialises a StationFile object
+     * @return Initialised (closed) StationFile
+     */
+    ctune_StationFile_t (* init)( void );
+
+    /**
+     * Maps a station file into memory and validates its layout
+     * @param file_path File path
+     * @param file      StationFile object to map into (assumed to be closed)
+     * @return Success
+     */
+    bool (* open)( const char * file_path, ctune_StationFile_t * file );
+
+    /**
+     * Checks if a StationFile object is currently mapped
+     * @param file StationFile object
+     * @return Open state
+     */
+    bool (* isOpen)( const ctune_StationFile_t * file );
+
+    /**
+     * Unmaps a station file
+     * @param file StationFile object
+     */
+    void (* close)( ctune_StationFile_t * file );
+
+    /**
+     * Gets the number of records in a station file
+     * @param file StationFile object
+     * @return Record count
+     */
+    size_t (* size)( const ctune_StationFile_t * file );
+
+    /**
+     * Gets the timestamp of the last complete rebuild of the file
+     * @param file StationFile object
+     * @return Timestamp (0 when not open)
+     */
+    time_t (* created)( const ctune_StationFile_t * file );
+
+    /**
+     * Gets the timestamp of the last write to the file
+     * @param file StationFile object
+     * @return Timestamp (0 when not open)
+     */
+    time_t (* modified)( const ctune_StationFile_t * file );
+
+    /**
+     * Gets the user-defined marker string stored in the header
+     * @param file StationFile object
+     * @return Marker string (empty when not open)
+     */
+    const char * (* marker)( const ctune_StationFile_t * file );
+
+    /**
+     * Gets a record
+     * @param file StationFile object
+     * @param i    Record index
+     * @return Pointer to record inside the mapping or NULL if out of range
+     */
+    const ctune_StationFile_Record_t * (* at)( const ctune_StationFile_t * file, size_t i );
+
+    /**
+     * Gets a string field of a record
+     * @param file   StationFile object
+     * @param record Record
+     * @param field  String field ID
+     * @return Pointer to the string inside the mapping ("" for empty/invalid fields)
+     */
+    const char * (* str)( const ctune_StationFile_t * file, const ctune_StationFile_Record_t * record, ctune_StationFile_Str_e field );
+
+    /**
+     * Binary searches the records for a station UUID
+     * @param file StationFile object
+     * @param uuid Station UUID
+     * @return Pointer to the record or NULL if not found
+     */
+    const ctune_StationFile_Record_t * (* find)( const ctune_StationFile_t * file, const char * uuid );
+
+    /**
+     * Copies a record into a RadioStationInfo DTO
+     * @param file   StationFile object
+     * @param record Record
+     * @param rsi    Initialised RadioStationInfo DTO
+     */
+    void (* materialise)( const ctune_StationFile_t * file, const ctune_StationFile_Record_t * record, ctune_RadioStationInfo_t * rsi );
+
+    /**
+     * Writes a station file atomically (temporary file + fsync + rename)
+     * @param file_path File path
+     * @param base      Mapped file to merge with (NULL for a complete rebuild)
+     * @param stations  Collection of RadioStationInfo_t objects overriding same-UUID records in `base` (sorted in-place by UUID)
+     * @param marker    Marker string to store in the header (truncated to fit)
+     * @return Success
+     */
+    bool (* write)( const char * file_path, const ctune_StationFile_t * base, Vector_t * stations, const char * marker );
+
+} ctune_StationFile;
+
+#endif //CTUNE_FS_STATIONFILE_H
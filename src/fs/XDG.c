@@ -11,17 +11,21 @@ static struct ctune_Settings_XDG {
     const char * ctune_directory_name;
     const char * fallback_data_path;
     const char * fallback_cfg_path;
+    const char * fallback_cache_path;
     const char * fallback_rec_path;
     String_t     resolved_data_path;
     String_t     resolved_cfg_path;
+    String_t     resolved_cache_path;
     String_t     resolved_rec_path;
 } xdg = {
     .ctune_directory_name = "ctune/",
     .fallback_data_path   = ".local/share/",
     .fallback_cfg_path    = ".config/",
+    .fallback_cache_path  = ".cache/",
     .fallback_rec_path    = "Music/",
     .resolved_data_path   = { ._raw = NULL, ._length = 0 }, //i.e. String.init()
     .resolved_cfg_path    = { ._raw = NULL, ._length = 0 }, //i.e. String.init()
+    .resolved_cache_path  = { ._raw = NULL, ._length = 0 }, //i.e. String.init()
     .resolved_rec_path    = { ._raw = NULL, ._length = 0 }, //i.e. String.init()
 };
 
@@ -103,6 +107,45 @@ static bool ctune_XDG_getDataBaseDir( String_t * path_str ) {
     return !( error_state );
 }
 
+/**
+ * [PRIVATE] Gets the XDG or fallback cache directory path for the application
+ * @param path_str String container
+ * @return Success
+ */
+static bool ctune_XDG_getCacheBaseDir( String_t * path_str ) {
+    const char * xdg_cache_home = getenv( "XDG_CACHE_HOME" );
+    bool         error_state    = false;
+
+    if( xdg_cache_home != NULL && strlen( xdg_cache_home ) > 0 ) {
+        String.append_back( path_str, xdg_cache_home );
+        String.append_back( path_str, "/" );
+
+    } else {
+        CTUNE_LOG( CTUNE_LOG_WARNING,
+                   "[ctune_XDG_getCacheBaseDir( String_t * )] "
+                   "Env. variable 'XDG_CACHE_HOME' not set, using default (${HOME}/%s%s).",
+                   xdg.fallback_cache_path, xdg.ctune_directory_name
+        );
+
+        char * home_dir = getenv( "HOME" );
+
+        if( home_dir == NULL || strlen( home_dir ) <= 0 ) { //place in running directory as fallback
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_XDG_getCacheBaseDir( String_t * )] Env. variable 'HOME' not found.\"" )
+            error_state = true;
+
+        } else {
+            String.append_back( path_str, home_dir );
+            String.append_back( path_str, "/" );
+            String.append_back( path_str, xdg.fallback_cache_path );
+        }
+    }
+
+    String.append_back( path_str, xdg.ctune_directory_name );
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_XDG_getCacheBaseDir( String_t * )] Base cache dir set as: %s", path_str->_raw );
+
+    return !( error_state );
+}
+
 /**
  * [PRIVATE] Gets the XDG or fallback 'Music' directory for the application
  * @param path_str String container
@@ -206,6 +249,38 @@ static void ctune_XDG_resolveDataFilePath( const char * file_name, String_t * re
     }
 }
 
+/**
+ * Resolves the application cache directory path and append given filename to it
+ * @param file_name     File name to resolve on the application's cache directory
+ * @param resolved_path Container for the resolved file path to be stored in
+ */
+static void ctune_XDG_resolveCacheFilePath( const char * file_name, String_t * resolved_path ) {
+    bool error_state = false;
+
+    if( String.empty( &xdg.resolved_cache_path ) ) {
+        //cache path never been resolved
+        if( !ctune_XDG_getCacheBaseDir( &xdg.resolved_cache_path ) ) {
+            CTUNE_LOG( CTUNE_LOG_WARNING,
+                       "[ctune_XDG_resolveCacheFilePath( \"%s\", %p )] "
+                       "Failed to resolve cache data path: using current directory as base.",
+                       file_name, resolved_path
+            );
+
+            error_state = true;
+        }
+    }
+
+    ctune_fs.createDirectory( &xdg.resolved_cache_path );
+
+    //copy resolved ${cache dir path}/${file_name}
+    String.set( resolved_path, xdg.resolved_cache_path._raw );
+    String.append_back( resolved_path, file_name );
+
+    if( error_state ) {
+        String.free( &xdg.resolved_cache_path );
+    }
+}
+
 /**
  * Resolves the current user's recording output directory path
  * @param resolved_path Container for the resolved file path to be stored in
@@ -242,6 +317,7 @@ static void ctune_XDG_resolveMusicOutputFilePath( String_t * resolved_path ) {
 static void ctune_XDG_free( void ) {
     String.free( &xdg.resolved_cfg_path );
     String.free( &xdg.resolved_data_path );
+    String.free( &xdg.resolved_cache_path );
 }
 
 
@@ -251,6 +327,7 @@ static void ctune_XDG_free( void ) {
 const struct ctune_XDG_Instance ctune_XDG = {
     .resolveCfgFilePath         = &ctune_XDG_resolveCfgFilePath,
     .resolveDataFilePath        = &ctune_XDG_resolveDataFilePath,
+    .resolveCacheFilePath       = &ctune_XDG_resolveCacheFilePath,
     .resolveMusicOutputFilePath = &ctune_XDG_resolveMusicOutputFilePath,
     .free                       = &ctune_XDG_free,
 };
\ No newline at end of file
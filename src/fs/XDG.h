@@ -18,6 +18,13 @@ extern const struct ctune_XDG_Instance {
      */
     void (* resolveDataFilePath)( const char * file_name, String_t * resolved_path );
 
+    /**
+     * Resolves the application cache directory path and append given filename to it
+     * @param file_name     File name to resolve on the application's cache directory
+     * @param resolved_path Container for the resolved file path to be stored in
+     */
+    void (* resolveCacheFilePath)( const char * file_name, String_t * resolved_path );
+
     /**
      * Resolves the current user's recording output directory path
      * @param resolved_path Container for the resolved file path to be stored in
@@ -2,6 +2,8 @@
 #include <string.h>
 #include <locale.h>
 #include <langinfo.h>
+#include <pthread.h>
+#include <time.h>
 
 #include "logger/src/Logger.h"
 #include "ctune_err.h"
@@ -18,8 +20,75 @@
 //                            + must auto refresh on view
 //                            + ability to view station info (cache it?)
 
+/**
+ * Startup stages
+ */
+typedef enum ctune_StartupStage {
+    CTUNE_STARTUP_SETTINGS = 0, //settings + logger
+    CTUNE_STARTUP_PLUGINS,      //plugin manifest scan
+    CTUNE_STARTUP_CONFIG,
+    CTUNE_STARTUP_FAVOURITES,   //concurrent with PLAYLOG, CONTROLLER and UI
+    CTUNE_STARTUP_PLAYLOG,
+    CTUNE_STARTUP_CONTROLLER,
+    CTUNE_STARTUP_UI,
+    CTUNE_STARTUP_LOAD,         //CLI playback options
+    CTUNE_STARTUP_AUDIO,        //deferred (background)
+    CTUNE_STARTUP_FAV_BACKUP,   //deferred (background)
+    CTUNE_STARTUP_MIRRORS,      //deferred (background)
+
+    CTUNE_STARTUP_STAGE_COUNT
+} ctune_StartupStage_e;
+
+/**
+ * Startup scheduler variables
+ * @param profile Flag to print out the stage timings on exit
+ * @param origin  Start time of the initialisation
+ * @param stages  Per-stage state and timings (milliseconds from origin)
+ */
+static struct {
+    bool            profile;
+    struct timespec origin;
+
+    struct {
+        const char * name;
+        bool      (* run)( void );
+        pthread_t    thread;
+        bool         threaded;
+        bool         started;
+        bool         success;
+        double       begin;
+        double       end;
+    } stages[CTUNE_STARTUP_STAGE_COUNT];
+
+} startup = {
+    .profile = false,
+    .stages  = {
+        [CTUNE_STARTUP_SETTINGS  ] = { .name = "settings"   },
+        [CTUNE_STARTUP_PLUGINS   ] = { .name = "plugins"    },
+        [CTUNE_STARTUP_CONFIG    ] = { .name = "config"     },
+        [CTUNE_STARTUP_FAVOURITES] = { .name = "favourites" },
+        [CTUNE_STARTUP_PLAYLOG   ] = { .name = "playlog"    },
+        [CTUNE_STARTUP_CONTROLLER] = { .name = "controller" },
+        [CTUNE_STARTUP_UI        ] = { .name = "ui"         },
+        [CTUNE_STARTUP_LOAD      ] = { .name = "cli-load"   },
+        [CTUNE_STARTUP_AUDIO     ] = { .name = "audio"      },
+        [CTUNE_STARTUP_FAV_BACKUP] = { .name = "fav-backup" },
+        [CTUNE_STARTUP_MIRRORS   ] = { .name = "mirrors"    },
+    },
+};
+
+/* startup scheduler */
+static double ctune_startup_elapsed( void );
+static void ctune_startup_begin( ctune_StartupStage_e stage );
+static void ctune_startup_end( ctune_StartupStage_e stage, bool success );
+static void ctune_startup_launch( ctune_StartupStage_e stage, bool (* run)( void ) );
+static bool ctune_startup_await( ctune_StartupStage_e stage );
+static void ctune_startup_report( void );
+
 /* setup/teardown and system */
 static bool ctune_init( const ctune_ArgOptions_t * options );
+static void ctune_deferInit();
+static bool ctune_deferredProbe( void );
 static void ctune_shutdown();
 static void ctune_setupSigHandler();
 static void ctune_handleSignal( int signo, siginfo_t * info, void * context );
@@ -42,6 +111,9 @@ int main( int argc, char * argv[] ) {
             .log_level         = CTUNE_LOG_MSG,
         #endif
 
+        .profile_startup       = false,
+        .binary_trace          = false,
+
         .ui = {
             .show_cursor       = false,
         },
@@ -75,6 +147,13 @@ int main( int argc, char * argv[] ) {
                 if( opt->arg == CTUNE_CLI_ARG_DEBUG ) {
                     options.log_level = CTUNE_LOG_TRACE;
 
+                } else if( opt->arg == CTUNE_CLI_ARG_TRACE ) {
+                    options.log_level    = CTUNE_LOG_TRACE;
+                    options.binary_trace = true;
+
+                } else if( opt->arg == CTUNE_CLI_ARG_PROFILE_STARTUP ) {
+                    options.profile_startup = true;
+
                 } else if( opt->arg == CTUNE_CLI_ARG_SHOW_CURSOR ) {
                     options.ui.show_cursor = true;
 
@@ -118,8 +197,12 @@ int main( int argc, char * argv[] ) {
     }
 
     ctune_setupSigHandler();
+    ctune_deferInit(); //audio init overlaps with any station lookup in `ctune_Controller.load(..)`
 
+    ctune_startup_begin( CTUNE_STARTUP_LOAD );
     ctune_Controller.load( &options );
+    ctune_startup_end( CTUNE_STARTUP_LOAD, true );
+
     ctune_ArgOptions.freeContent( &options );
     ctune_UI.start(); //(UI loop)
 
@@ -135,70 +218,111 @@ int main( int argc, char * argv[] ) {
 static bool ctune_init( const ctune_ArgOptions_t * options ) {
     bool     error_state       = false;
     String_t err_log_path      = String.init();
+    String_t trace_path        = String.init();
     String_t playback_log_path = String.init();
 
+    startup.profile = options->profile_startup;
+    clock_gettime( CLOCK_MONOTONIC, &startup.origin );
+
     CTUNE_LOG( CTUNE_LOG_TRACE, "[INIT] cTune initialising..." );
 
     /* ERROR LOG */
+    ctune_startup_begin( CTUNE_STARTUP_SETTINGS );
     ctune_Settings.init();
     ctune_XDG.resolveDataFilePath( "ctune.log", &err_log_path );
 
     if( !ctune_Logger.init( err_log_path._raw, "w", options->log_level ) ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to initialise the logger." );
         error_state = true;
+
+    } else if( options->binary_trace ) {
+        ctune_XDG.resolveDataFilePath( "ctune.trace", &trace_path );
+
+        if( !ctune_Logger.openTrace( trace_path._raw ) ) //not fatal: trace messages go to the log instead
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to open the binary trace file '%s'.", trace_path._raw );
     }
 
+    ctune_startup_end( CTUNE_STARTUP_SETTINGS, !error_state );
+
     /* Print the args passed */
     ctune_ArgOptions.sendToLogger( "INIT", options );
 
+    ctune_startup_begin( CTUNE_STARTUP_PLUGINS );
+
     if( !ctune_Settings.plugins.loadPlugins() ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to load all available plugins." );
+        ctune_startup_end( CTUNE_STARTUP_PLUGINS, false );
+    } else {
+        ctune_startup_end( CTUNE_STARTUP_PLUGINS, true );
     }
 
-    /* CONFIGURATION */
+    /* CONFIGURATION (needs the plugins to validate its plugin choices) */
+    ctune_startup_begin( CTUNE_STARTUP_CONFIG );
+
     if( !ctune_Settings.cfg.loadCfg() ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to load configuration file - using defaults." );
+        ctune_startup_end( CTUNE_STARTUP_CONFIG, false );
+    } else {
+        ctune_startup_end( CTUNE_STARTUP_CONFIG, true );
     }
 
-    /* FAVOURITES */
-    if( !ctune_Settings.favs.loadFavourites() ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to load favourites." );
-    }
+    ctune_Logger.setFlushLatency( (unsigned) ctune_Settings.cfg.logFlushLatency() );
+
+    /* FAVOURITES (nothing touches them until `ctune_Controller.load(..)` and the first frame) */
+    ctune_startup_launch( CTUNE_STARTUP_FAVOURITES, ctune_Settings.favs.loadFavourites );
 
     /* PLAY LOG */
+    ctune_startup_begin( CTUNE_STARTUP_PLAYLOG );
     ctune_XDG.resolveDataFilePath( "playlog.txt", &playback_log_path );
 
     if( !ctune_PlaybackLog.open( playback_log_path._raw, ctune_Settings.cfg.playbackLogOverwrite() ) ) {
         ctune_err.set( CTUNE_ERR_IO_PLAYLOG_OPEN );
         CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Error: %s", ctune_err.strerror() );
+        ctune_startup_end( CTUNE_STARTUP_PLAYLOG, false );
+    } else {
+        ctune_startup_end( CTUNE_STARTUP_PLAYLOG, true );
     }
 
-    /* CONTROLLER */
+    /* CONTROLLER (audio plugins and mirror probing are deferred to `ctune_deferInit()`) */
+    ctune_startup_begin( CTUNE_STARTUP_CONTROLLER );
+
     if( !ctune_Controller.init() ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to initialise the controller." );
         error_state = true;
     }
 
+    ctune_startup_end( CTUNE_STARTUP_CONTROLLER, !error_state );
+
     ctune_Controller.setStationChangeEventCallback( ctune_UI.setCurrStation );
     ctune_Controller.setSongChangeEventCallback( ctune_UI.printSongInfo );
     ctune_Controller.setVolumeChangeEventCallback( ctune_UI.printVolume );
     ctune_Controller.setPlaybackStateChangeEventCallback( ctune_UI.printPlaybackState );
     ctune_Controller.setSearchStateChangeEventCallback( ctune_UI.printSearchingState );
+    ctune_Controller.setSearchJobCompleteEventCallback( ctune_UI.completeSearchJob );
     ctune_Controller.setResizeUIEventCallback( ctune_UI_Resizer.requestResizing );
 
     /* UI */
+    ctune_startup_begin( CTUNE_STARTUP_UI );
+
     if( !ctune_UI.setup( options->ui.show_cursor ) ) {
         CTUNE_LOG( CTUNE_LOG_FATAL, "[INIT] Failed to setup the UI." );
         error_state = true;
     }
 
+    ctune_startup_end( CTUNE_STARTUP_UI, !error_state );
+
     ctune_UI.setQuietVolChangeCallback( ctune_Settings.cfg.modVolume ); //used when playback is off and access to the audio server is not available
     ctune_UI.printVolume( ctune_Settings.cfg.getVolume() ); //to get the initial volume to display in the UI
 
     ctune_err.setPrintErrCallback( ctune_UI.printError );
 
+    if( !ctune_startup_await( CTUNE_STARTUP_FAVOURITES ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[INIT] Failed to load favourites." );
+    }
+
     String.free( &playback_log_path );
     String.free( &err_log_path );
+    String.free( &trace_path );
 
     if( !error_state )
         CTUNE_LOG( CTUNE_LOG_TRACE, "[INIT] cTune initialisation complete." );
@@ -206,6 +330,23 @@ static bool ctune_init( const ctune_ArgOptions_t * options ) {
     return !( error_state );
 }
 
+/**
+ * Launches the initialisation stages that are not needed for the first frame (background)
+ */
+static void ctune_deferInit() {
+    ctune_startup_launch( CTUNE_STARTUP_AUDIO, ctune_Controller.initAudio );
+    ctune_startup_launch( CTUNE_STARTUP_FAV_BACKUP, ctune_Settings.favs.backupFavourites );
+    ctune_startup_launch( CTUNE_STARTUP_MIRRORS, ctune_deferredProbe );
+}
+
+/**
+ * Probes the API mirrors (deferred stage wrapper)
+ * @return Success (at least one mirror responded)
+ */
+static bool ctune_deferredProbe( void ) {
+    return ( ctune_Controller.probeMirrors() > 0 );
+}
+
 /**
  * Shutdown and cleanup cTune
  */
@@ -223,13 +364,21 @@ static void ctune_shutdown() {
 
     initiated = true;
 
+    for( int i = 0; i < CTUNE_STARTUP_STAGE_COUNT; ++i ) {
+        ctune_startup_await( i );
+    }
+
     ctune_Controller.playback.stop();
     ctune_Controller.free();
     ctune_PlaybackLog.close();
     ctune_UI.teardown();
-    ctune_Settings.cfg.writeCfg();
+    if( !ctune_Settings.cfg.writeCfg() ) { //settings changed during the session would otherwise be lost without a trace
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_shutdown()] Failed to save the configuration." );
+    }
+
     ctune_Settings.rtlock.unlock();
     ctune_Settings.free();
+    ctune_startup_report();
 
     if( ctune_err.number() != CTUNE_ERR_NONE ) {
         CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_shutdown()] cTune encountered an error: %s", ctune_err.strerror() );
@@ -295,4 +444,130 @@ void ctune_handleSignal( int signo, siginfo_t * info, void * context ) {
     shutdown:
         ctune_shutdown();
         exit_curses( exit_state );
-}
\ No newline at end of file
+}
+/**
+ * [THREAD SAFE] Gets the time elapsed since the start of the initialisation
+ * @return Elapsed time in milliseconds
+ */
+static double ctune_startup_elapsed( void ) {
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return ( (double) ( now.tv_sec - startup.origin.tv_sec ) * 1e3 )
+         + ( (double) ( now.tv_nsec - startup.origin.tv_nsec ) / 1e6 );
+}
+
+/**
+ * Marks the start of a startup stage
+ * @param stage Startup stage
+ */
+static void ctune_startup_begin( ctune_StartupStage_e stage ) {
+    startup.stages[stage].begin = ctune_startup_elapsed();
+}
+
+/**
+ * Marks the end of a startup stage
+ * @param stage   Startup stage
+ * @param success Outcome of the stage
+ */
+static void ctune_startup_end( ctune_StartupStage_e stage, bool success ) {
+    startup.stages[stage].end     = ctune_startup_elapsed();
+    startup.stages[stage].success = success;
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[INIT] Stage '%s' %s in %.2fms.",
+               startup.stages[stage].name,
+               ( success ? "completed" : "failed" ),
+               ( startup.stages[stage].end - startup.stages[stage].begin )
+    );
+}
+
+/**
+ * [PRIVATE] Runs a startup stage (thread)
+ * @param arg Pointer to the stage enum
+ * @return NULL
+ */
+static void * ctune_startup_worker( void * arg ) {
+    const ctune_StartupStage_e stage = *(ctune_StartupStage_e *) arg;
+
+    ctune_startup_begin( stage );
+    ctune_startup_end( stage, startup.stages[stage].run() );
+
+    return NULL;
+}
+
+/**
+ * Runs a startup stage in its own thread (or in the calling thread as a fallback)
+ * @param stage Startup stage
+ * @param run   Stage method
+ */
+static void ctune_startup_launch( ctune_StartupStage_e stage, bool (* run)( void ) ) {
+    static ctune_StartupStage_e ids[CTUNE_STARTUP_STAGE_COUNT];
+
+    ids[stage]                 = stage;
+    startup.stages[stage].run  = run;
+
+    if( pthread_create( &startup.stages[stage].thread, NULL, ctune_startup_worker, &ids[stage] ) == 0 ) {
+        startup.stages[stage].threaded = true;
+
+    } else {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[INIT] Failed to create thread for stage '%s' - running in-line.",
+                   startup.stages[stage].name
+        );
+
+        ctune_startup_worker( &ids[stage] );
+    }
+
+    startup.stages[stage].started = true;
+}
+
+/**
+ * Waits on a launched startup stage to complete
+ * @param stage Startup stage
+ * @return Success of the stage (true when not launched)
+ */
+static bool ctune_startup_await( ctune_StartupStage_e stage ) {
+    if( !startup.stages[stage].started ) {
+        return true; //EARLY RETURN
+    }
+
+    if( startup.stages[stage].threaded ) {
+        pthread_join( startup.stages[stage].thread, NULL );
+        startup.stages[stage].threaded = false;
+    }
+
+    return startup.stages[stage].success;
+}
+
+/**
+ * Prints the startup stage timings to `stderr` (when profiling is enabled)
+ */
+static void ctune_startup_report( void ) {
+    if( !startup.profile ) {
+        return; //EARLY RETURN
+    }
+
+    fprintf( stderr, "cTune startup profile (ms since init start):\n" );
+    fprintf( stderr, "  %-12s %10s %10s %10s  %s\n", "stage", "begin", "end", "duration", "" );
+
+    for( int i = 0; i < CTUNE_STARTUP_STAGE_COUNT; ++i ) {
+        const char * name  = startup.stages[i].name;
+        const double begin = startup.stages[i].begin;
+        const double end   = startup.stages[i].end;
+
+        if( end <= 0 ) {
+            fprintf( stderr, "  %-12s %10s %10s %10s  %s\n", name, "-", "-", "-", "(did not run)" );
+            continue;
+        }
+
+        fprintf( stderr,
+                 "  %-12s %10.2f %10.2f %10.2f  %s%s\n",
+                 name, begin, end, ( end - begin ),
+                 ( startup.stages[i].run != NULL ? "background" : "main" ),
+                 ( startup.stages[i].success ? "" : " (failed)" )
+        );
+    }
+
+    fprintf( stderr, "  UI loop started after %.2fms.\n", startup.stages[CTUNE_STARTUP_LOAD].end );
+}
@@ -0,0 +1,562 @@
+#include "MirrorStats.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "logger/src/Logger.h"
+#include "../fs/XDG.h"
+
+#define CTUNE_MIRRORSTATS_HOSTNAME_SIZE 256
+
+/**
+ * [PRIVATE] Mirror measurements
+ * @param hostname     Mirror hostname
+ * @param rtt_ms       Smoothed TCP connect time (milliseconds, 0 when unknown)
+ * @param latency_ms   Smoothed request time (milliseconds, 0 when unknown)
+ * @param error_rate   Smoothed request error rate (0..1)
+ * @param samples      Number of recorded requests
+ * @param last_failure Timestamp of the last failed request/probe
+ */
+typedef struct ctune_MirrorStats_Entry {
+    char     hostname[CTUNE_MIRRORSTATS_HOSTNAME_SIZE];
+    double   rtt_ms;
+    double   latency_ms;
+    double   error_rate;
+    unsigned samples;
+    time_t   last_failure;
+
+} ctune_MirrorStats_Entry_t;
+
+/**
+ * [PRIVATE] Ranking helper
+ * @param node     Server node
+ * @param score    Score of the node's mirror
+ * @param position Original position of the node in the list
+ */
+typedef struct ctune_MirrorStats_Rank {
+    ServerListNode * node;
+    double           score;
+    size_t           position;
+
+} ctune_MirrorStats_Rank_t;
+
+/**
+ * Private vars
+ */
+static struct {
+    pthread_mutex_t           lock;
+    ctune_MirrorStats_Entry_t entries[CTUNE_MIRRORSTATS_MAX_MIRRORS];
+    size_t                    count;
+    bool                      changed;
+
+} stats = {
+    .lock    = PTHREAD_MUTEX_INITIALIZER,
+    .count   = 0,
+    .changed = false,
+};
+
+/**
+ * [PRIVATE] Gets the current monotonic time
+ * @return Time in milliseconds
+ */
+static double ctune_MirrorStats_now( void ) {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( (double) ts.tv_sec * 1000.0 + (double) ts.tv_nsec / 1000000.0 );
+}
+
+/**
+ * [PRIVATE] Folds a sample into a moving average
+ * @param average Current average (0 when no samples yet)
+ * @param sample  New sample
+ * @return Updated average
+ */
+static double ctune_MirrorStats_smooth( double average, double sample ) {
+    return ( average <= 0.0 ? sample : ( average + CTUNE_MIRRORSTATS_SMOOTHING * ( sample - average ) ) );
+}
+
+/**
+ * [PRIVATE] Finds the entry of a mirror (call with the lock held)
+ * @param hostname Mirror hostname
+ * @param create   Flag to create the entry when missing (replaces the least used one when full)
+ * @return Pointer to entry or NULL
+ */
+static ctune_MirrorStats_Entry_t * ctune_MirrorStats_find( const char * hostname, bool create ) {
+    ctune_MirrorStats_Entry_t * least_used = NULL;
+
+    if( hostname == NULL ) {
+        return NULL; //EARLY RETURN
+    }
+
+    for( size_t i = 0; i < stats.count; ++i ) {
+        if( strcmp( stats.entries[i].hostname, hostname ) == 0 ) {
+            return &stats.entries[i]; //EARLY RETURN
+        }
+
+        if( least_used == NULL || stats.entries[i].samples < least_used->samples ) {
+            least_used = &stats.entries[i];
+        }
+    }
+
+    if( !create ) {
+        return NULL; //EARLY RETURN
+    }
+
+    ctune_MirrorStats_Entry_t * entry = ( stats.count < CTUNE_MIRRORSTATS_MAX_MIRRORS ? &stats.entries[ stats.count++ ] : least_used );
+
+    memset( entry, 0, sizeof( ctune_MirrorStats_Entry_t ) );
+    strncpy( entry->hostname, hostname, CTUNE_MIRRORSTATS_HOSTNAME_SIZE - 1 );
+
+    return entry;
+}
+
+/**
+ * [PRIVATE] Calculates the score of a mirror (call with the lock held)
+ * @param entry Mirror entry (NULL for an unknown mirror)
+ * @param now   Current timestamp
+ * @return Score (lower is better)
+ */
+static double ctune_MirrorStats_calcScore( const ctune_MirrorStats_Entry_t * entry, time_t now ) {
+    if( entry == NULL ) {
+        return CTUNE_MIRRORSTATS_DEFAULT_LATENCY; //EARLY RETURN
+    }
+
+    double expected = CTUNE_MIRRORSTATS_DEFAULT_LATENCY;
+
+    if( entry->latency_ms > 0.0 ) {
+        expected = entry->latency_ms;
+
+    } else if( entry->rtt_ms > 0.0 ) {
+        expected = entry->rtt_ms * 4; //TCP + TLS handshakes and the request itself are ~4 round-trips
+    }
+
+    expected *= ( 1.0 + 4.0 * entry->error_rate );
+
+    if( entry->last_failure > 0 && ( now - entry->last_failure ) < CTUNE_MIRRORSTATS_FAILURE_COOLDOWN ) {
+        expected += 10000.0;
+    }
+
+    return expected;
+}
+
+/**
+ * [PRIVATE] Records the round-trip time of a probe
+ * @param hostname Mirror hostname
+ * @param rtt_ms   Round-trip time (milliseconds) or a negative value when the probe failed
+ */
+static void ctune_MirrorStats_recordProbe( const char * hostname, double rtt_ms ) {
+    pthread_mutex_lock( &stats.lock );
+
+    ctune_MirrorStats_Entry_t * entry = ctune_MirrorStats_find( hostname, true );
+
+    if( entry ) {
+        if( rtt_ms < 0.0 ) {
+            entry->last_failure = time( NULL );
+        } else {
+            entry->rtt_ms = ctune_MirrorStats_smooth( entry->rtt_ms, rtt_ms );
+        }
+
+        stats.changed = true;
+    }
+
+    pthread_mutex_unlock( &stats.lock );
+}
+
+/**
+ * [PRIVATE] Comparator for the ranking (score then original position)
+ * @param lhs Pointer to ctune_MirrorStats_Rank_t
+ * @param rhs Pointer to ctune_MirrorStats_Rank_t
+ * @return Order
+ */
+static int ctune_MirrorStats_compareRank( const void * lhs, const void * rhs ) {
+    const ctune_MirrorStats_Rank_t * a = lhs;
+    const ctune_MirrorStats_Rank_t * b = rhs;
+
+    if( a->score != b->score ) {
+        return ( a->score < b->score ? -1 : 1 );
+    }
+
+    return ( a->position < b->position ? -1 : ( a->position > b->position ? 1 : 0 ) );
+}
+
+/**
+ * [THREAD SAFE] Loads the persisted scores from the cache directory
+ * @return Success
+ */
+static bool ctune_MirrorStats_load( void ) {
+    String_t path   = String.init();
+    FILE   * file   = NULL;
+    size_t   loaded = 0;
+
+    ctune_XDG.resolveCacheFilePath( CTUNE_MIRRORSTATS_FILE_NAME, &path );
+
+    if( ( file = fopen( path._raw, "r" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_MirrorStats_load()] No mirror stats found (\"%s\").", path._raw );
+        String.free( &path );
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &stats.lock );
+
+    stats.count = 0;
+
+    while( stats.count < CTUNE_MIRRORSTATS_MAX_MIRRORS ) {
+        ctune_MirrorStats_Entry_t * entry        = &stats.entries[ stats.count ];
+        long long                   last_failure = 0;
+
+        memset( entry, 0, sizeof( ctune_MirrorStats_Entry_t ) );
+
+        const int ret = fscanf( file, "%255s %lf %lf %lf %u %lld",
+                                entry->hostname, &entry->rtt_ms, &entry->latency_ms, &entry->error_rate, &entry->samples, &last_failure );
+
+        if( ret == EOF ) {
+            break;
+        }
+
+        if( ret != 6 ) {
+            CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_MirrorStats_load()] Malformed line in \"%s\": remaining lines ignored.", path._raw );
+            break;
+        }
+
+        entry->last_failure = (time_t) last_failure;
+        ++stats.count;
+        ++loaded;
+    }
+
+    stats.changed = false;
+
+    pthread_mutex_unlock( &stats.lock );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_MirrorStats_load()] Loaded stats for %lu mirror(s) from \"%s\".", loaded, path._raw );
+
+    fclose( file );
+    String.free( &path );
+    return true;
+}
+
+/**
+ * [THREAD SAFE] Persists the scores to the cache directory
+ * @return Success
+ */
+static bool ctune_MirrorStats_save( void ) {
+    bool     error_state = false;
+    String_t path        = String.init();
+    String_t tmp_path    = String.init();
+    FILE   * file        = NULL;
+
+    pthread_mutex_lock( &stats.lock );
+
+    if( !stats.changed ) {
+        goto end;
+    }
+
+    ctune_XDG.resolveCacheFilePath( CTUNE_MIRRORSTATS_FILE_NAME, &path );
+    String.set( &tmp_path, path._raw );
+    String.append_back( &tmp_path, ".tmp" );
+
+    if( ( file = fopen( tmp_path._raw, "w" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_MirrorStats_save()] Failed to open \"%s\": %s", tmp_path._raw, strerror( errno ) );
+        error_state = true;
+        goto end;
+    }
+
+    for( size_t i = 0; i < stats.count; ++i ) {
+        const ctune_MirrorStats_Entry_t * entry = &stats.entries[i];
+
+        fprintf( file, "%s %.3f %.3f %.4f %u %lld\n",
+                 entry->hostname, entry->rtt_ms, entry->latency_ms, entry->error_rate, entry->samples, (long long) entry->last_failure );
+    }
+
+    if( fclose( file ) != 0 || rename( tmp_path._raw, path._raw ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_MirrorStats_save()] Failed to write \"%s\".", path._raw );
+        unlink( tmp_path._raw );
+        error_state = true;
+        goto end;
+    }
+
+    stats.changed = false;
+
+    end:
+        pthread_mutex_unlock( &stats.lock );
+        String.free( &path );
+        String.free( &tmp_path );
+        return !( error_state );
+}
+
+/**
+ * [THREAD SAFE] Records the outcome of a request to a mirror
+ * @param hostname   Mirror hostname
+ * @param latency_ms Total time taken by the request (milliseconds)
+ * @param success    Success flag
+ */
+static void ctune_MirrorStats_recordRequest( const char * hostname, double latency_ms, bool success ) {
+    pthread_mutex_lock( &stats.lock );
+
+    ctune_MirrorStats_Entry_t * entry = ctune_MirrorStats_find( hostname, true );
+
+    if( entry ) {
+        if( success ) {
+            entry->latency_ms = ctune_MirrorStats_smooth( entry->latency_ms, latency_ms );
+        } else {
+            entry->last_failure = time( NULL );
+        }
+
+        entry->error_rate += CTUNE_MIRRORSTATS_SMOOTHING * ( ( success ? 0.0 : 1.0 ) - entry->error_rate );
+        entry->samples    += 1;
+        stats.changed      = true;
+    }
+
+    pthread_mutex_unlock( &stats.lock );
+}
+
+/**
+ * [THREAD SAFE] Records a lower bound of a mirror's request latency (request cancelled before it completed)
+ * @param hostname   Mirror hostname
+ * @param latency_ms Time the request was pending for when cancelled (milliseconds)
+ */
+static void ctune_MirrorStats_recordLatencyBound( const char * hostname, double latency_ms ) {
+    pthread_mutex_lock( &stats.lock );
+
+    ctune_MirrorStats_Entry_t * entry = ctune_MirrorStats_find( hostname, true );
+
+    if( entry && entry->latency_ms < latency_ms ) {
+        entry->latency_ms = ctune_MirrorStats_smooth( entry->latency_ms, latency_ms );
+        stats.changed     = true;
+    }
+
+    pthread_mutex_unlock( &stats.lock );
+}
+
+/**
+ * [THREAD SAFE] Gets the expected request latency of a mirror with penalties for errors and recent failures
+ * @param hostname Mirror hostname
+ * @return Score (lower is better)
+ */
+static double ctune_MirrorStats_score( const char * hostname ) {
+    pthread_mutex_lock( &stats.lock );
+    const double score = ctune_MirrorStats_calcScore( ctune_MirrorStats_find( hostname, false ), time( NULL ) );
+    pthread_mutex_unlock( &stats.lock );
+    return score;
+}
+
+/**
+ * [THREAD SAFE] Gets the time to wait on a mirror before sending a hedged request to another
+ * @param hostname Mirror hostname
+ * @return Delay in milliseconds
+ */
+static long ctune_MirrorStats_hedgeDelay( const char * hostname ) {
+    double expected = CTUNE_MIRRORSTATS_DEFAULT_LATENCY;
+
+    pthread_mutex_lock( &stats.lock );
+
+    const ctune_MirrorStats_Entry_t * entry = ctune_MirrorStats_find( hostname, false );
+
+    if( entry && entry->latency_ms > 0.0 ) {
+        expected = entry->latency_ms;
+    } else if( entry && entry->rtt_ms > 0.0 ) {
+        expected = entry->rtt_ms * 4;
+    }
+
+    pthread_mutex_unlock( &stats.lock );
+
+    const long delay = (long) ( expected * 2 ); //i.e. clearly slower than usual
+
+    if( delay < CTUNE_MIRRORSTATS_HEDGE_MIN_DELAY ) {
+        return CTUNE_MIRRORSTATS_HEDGE_MIN_DELAY;
+    }
+
+    return ( delay > CTUNE_MIRRORSTATS_HEDGE_MAX_DELAY ? CTUNE_MIRRORSTATS_HEDGE_MAX_DELAY : delay );
+}
+
+/**
+ * [THREAD SAFE] Orders a server list from best to worst score
+ * @param server_list ServerList instance
+ */
+static void ctune_MirrorStats_rank( ctune_ServerList_t * server_list ) {
+    const size_t count = ctune_ServerList.size( server_list );
+
+    if( count < 2 ) {
+        return; //EARLY RETURN
+    }
+
+    ctune_MirrorStats_Rank_t * ranks = malloc( count * sizeof( ctune_MirrorStats_Rank_t ) );
+
+    if( ranks == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_MirrorStats_rank( %p )] Failed to allocate ranking array.", server_list );
+        return; //EARLY RETURN
+    }
+
+    { //score
+        const time_t     now  = time( NULL );
+        ServerListNode * node = server_list->_front;
+        size_t           i    = 0;
+
+        pthread_mutex_lock( &stats.lock );
+
+        while( node && i < count ) {
+            ranks[i] = (ctune_MirrorStats_Rank_t) {
+                .node     = node,
+                .score    = ctune_MirrorStats_calcScore( ctune_MirrorStats_find( node->hostname, false ), now ),
+                .position = i,
+            };
+
+            node = node->next;
+            ++i;
+        }
+
+        pthread_mutex_unlock( &stats.lock );
+    }
+
+    qsort( ranks, count, sizeof( ctune_MirrorStats_Rank_t ), ctune_MirrorStats_compareRank );
+
+    for( size_t i = 0; i < count; ++i ) {
+        ctune_ServerList.emplace_back( server_list, ctune_ServerList.extract_node( server_list, ranks[i].node ) );
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_MirrorStats_rank( %p )] Best mirror: %s (score: %.1f)",
+               server_list, ranks[0].node->hostname, ranks[0].score
+    );
+
+    free( ranks );
+}
+
+/**
+ * [THREAD SAFE] Probes all the mirrors in a list in parallel (TCP connect) and records their round-trip times
+ * @param server_list ServerList instance
+ * @param timeout_ms  Probe timeout (milliseconds)
+ * @return Number of mirrors that responded
+ */
+static size_t ctune_MirrorStats_probe( const ctune_ServerList_t * server_list, long timeout_ms ) {
+    const size_t     count     = ctune_ServerList.size( server_list );
+    size_t           responded = 0;
+    size_t           pending   = 0;
+    struct pollfd  * fds       = NULL;
+    ServerListNode * node      = NULL;
+    double         * started   = NULL;
+
+    if( count == 0 ) {
+        return 0; //EARLY RETURN
+    }
+
+    fds     = malloc( count * sizeof( struct pollfd ) );
+    started = malloc( count * sizeof( double ) );
+
+    if( fds == NULL || started == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_MirrorStats_probe( %p, %ld )] Failed to allocate probe arrays.", server_list, timeout_ms );
+        goto end;
+    }
+
+    node = server_list->_front;
+
+    for( size_t i = 0; i < count && node; ++i, node = node->next ) { //start all the connections
+        fds[i] = (struct pollfd) { .fd = -1, .events = POLLOUT, .revents = 0 };
+
+        const int fd = socket( node->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, node->ai_protocol );
+
+        if( fd < 0 ) {
+            continue;
+        }
+
+        started[i] = ctune_MirrorStats_now();
+
+        if( connect( fd, (struct sockaddr *) node->ai_addr, node->ai_addrlen ) == 0 ) {
+            ctune_MirrorStats_recordProbe( node->hostname, ( ctune_MirrorStats_now() - started[i] ) );
+            ++responded;
+            close( fd );
+
+        } else if( errno == EINPROGRESS ) {
+            fds[i].fd = fd;
+            ++pending;
+
+        } else {
+            ctune_MirrorStats_recordProbe( node->hostname, -1 );
+            close( fd );
+        }
+    }
+
+    const double deadline = ctune_MirrorStats_now() + (double) timeout_ms;
+
+    while( pending > 0 ) {
+        const double remaining = deadline - ctune_MirrorStats_now();
+
+        if( remaining <= 0 || poll( fds, count, (int) remaining ) <= 0 ) {
+            break;
+        }
+
+        const double now = ctune_MirrorStats_now();
+
+        node = server_list->_front;
+
+        for( size_t i = 0; i < count && node; ++i, node = node->next ) {
+            if( fds[i].fd < 0 || fds[i].revents == 0 ) {
+                continue;
+            }
+
+            int       err     = 0;
+            socklen_t err_len = sizeof( err );
+
+            if( getsockopt( fds[i].fd, SOL_SOCKET, SO_ERROR, &err, &err_len ) == 0 && err == 0 ) {
+                ctune_MirrorStats_recordProbe( node->hostname, ( now - started[i] ) );
+                ++responded;
+            } else {
+                ctune_MirrorStats_recordProbe( node->hostname, -1 );
+            }
+
+            close( fds[i].fd );
+            fds[i].fd = -1;
+            --pending;
+        }
+    }
+
+    node = server_list->_front;
+
+    for( size_t i = 0; i < count && node; ++i, node = node->next ) { //timed out
+        if( fds[i].fd >= 0 ) {
+            ctune_MirrorStats_recordProbe( node->hostname, -1 );
+            close( fds[i].fd );
+        }
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_MirrorStats_probe( %p, %ld )] %lu/%lu mirror(s) responded.",
+               server_list, timeout_ms, responded, count
+    );
+
+    end:
+        free( fds );
+        free( started );
+        return responded;
+}
+
+/**
+ * De-allocates resources
+ */
+static void ctune_MirrorStats_free( void ) {
+    pthread_mutex_lock( &stats.lock );
+    stats.count   = 0;
+    stats.changed = false;
+    pthread_mutex_unlock( &stats.lock );
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_MirrorStats_Instance ctune_MirrorStats = {
+    .load               = &ctune_MirrorStats_load,
+    .save               = &ctune_MirrorStats_save,
+    .recordRequest      = &ctune_MirrorStats_recordRequest,
+    .recordLatencyBound = &ctune_MirrorStats_recordLatencyBound,
+    .score              = &ctune_MirrorStats_score,
+    .hedgeDelay         = &ctune_MirrorStats_hedgeDelay,
+    .rank               = &ctune_MirrorStats_rank,
+    .probe              = &ctune_MirrorStats_probe,
+    .free               = &ctune_MirrorStats_free,
+};
@@ -0,0 +1,88 @@
+#ifndef CTUNE_NETWORK_MIRRORSTATS_H
+#define CTUNE_NETWORK_MIRRORSTATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../datastructure/ServerList.h"
+
+#define CTUNE_MIRRORSTATS_FILE_NAME        "mirrors.stats" //file in the XDG cache directory
+#define CTUNE_MIRRORSTATS_MAX_MIRRORS      64              //max number of tracked mirrors
+#define CTUNE_MIRRORSTATS_DEFAULT_LATENCY  500.0           //in milliseconds (assumed for mirrors without any measurements)
+#define CTUNE_MIRRORSTATS_SMOOTHING        0.25            //weight of a new sample in the moving averages
+#define CTUNE_MIRRORSTATS_FAILURE_COOLDOWN 120             //in seconds (time a failed mirror gets pushed back for)
+#define CTUNE_MIRRORSTATS_HEDGE_MIN_DELAY  150             //in milliseconds
+#define CTUNE_MIRRORSTATS_HEDGE_MAX_DELAY  2000            //in milliseconds
+
+/**
+ * Per-mirror latency/health tracker used to pick the RadioBrowser API mirror to query
+ * -
+ * Latencies come from two sources: TCP connect probes (round-trip time) and the total time of actual
+ * requests. Both are kept as exponentially weighted moving averages along with an error rate.
+ */
+extern const struct ctune_MirrorStats_Instance {
+    /**
+     * [THREAD SAFE] Loads the persisted scores from the cache directory
+     * @return Success
+     */
+    bool (* load)( void );
+
+    /**
+     * [THREAD SAFE] Persists the scores to the cache directory
+     * @return Success
+     */
+    bool (* save)( void );
+
+    /**
+     * [THREAD SAFE] Records the outcome of a request to a mirror
+     * @param hostname   Mirror hostname
+     * @param latency_ms Total time taken by the request (milliseconds)
+     * @param success    Success flag
+     */
+    void (* recordRequest)( const char * hostname, double latency_ms, bool success );
+
+    /**
+     * [THREAD SAFE] Records a lower bound of a mirror's request latency (request cancelled before it completed)
+     * -
+     * Only raises the latency average when it is under the bound. The error rate is left untouched.
+     * @param hostname   Mirror hostname
+     * @param latency_ms Time the request was pending for when cancelled (milliseconds)
+     */
+    void (* recordLatencyBound)( const char * hostname, double latency_ms );
+
+    /**
+     * [THREAD SAFE] Gets the expected request latency of a mirror with penalties for errors and recent failures
+     * @param hostname Mirror hostname
+     * @return Score (lower is better)
+     */
+    double (* score)( const char * hostname );
+
+    /**
+     * [THREAD SAFE] Gets the time to wait on a mirror before sending a hedged request to another
+     * @param hostname Mirror hostname
+     * @return Delay in milliseconds
+     */
+    long (* hedgeDelay)( const char * hostname );
+
+    /**
+     * [THREAD SAFE] Orders a server list from best to worst score
+     * @param server_list ServerList instance
+     */
+    void (* rank)( ctune_ServerList_t * server_list );
+
+    /**
+     * [THREAD SAFE] Probes all the mirrors in a list in parallel (TCP connect) and records their round-trip times
+     * @param server_list ServerList instance
+     * @param timeout_ms  Probe timeout (milliseconds)
+     * @return Number of mirrors that responded
+     */
+    size_t (* probe)( const ctune_ServerList_t * server_list, long timeout_ms );
+
+    /**
+     * De-allocates resources
+     */
+    void (* free)( void );
+
+} ctune_MirrorStats;
+
+#endif //CTUNE_NETWORK_MIRRORSTATS_H
@@ -0,0 +1,643 @@
+#include "NetworkJobs.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "logger/src/Logger.h"
+#include "../ctune_err.h"
+#include "../dto/RadioStationInfo.h"
+#include "NetworkUtils.h"
+
+#define CTUNE_NETWORKJOBS_MAX_WORKERS 8
+
+/**
+ * [PRIVATE] Submission waiting on a job
+ * @param handle    Job handle given to the submitter
+ * @param cb        Completion callback
+ * @param data      Data pointer to pass to the callback
+ * @param cancelled Cancelled flag
+ */
+typedef struct ctune_NetworkJob_Subscriber {
+    ctune_JobHandle_t           handle;
+    ctune_NetworkJob_Callback_f cb;
+    void                      * data;
+    bool                        cancelled;
+
+} ctune_NetworkJob_Subscriber_t;
+
+/**
+ * [PRIVATE] Worker pool variables
+ * @param lock         Lock guarding the job list and counters
+ * @param queued       Condition signalled when a job is queued or the pool stops
+ * @param workers      Worker threads
+ * @param worker_count Number of worker threads started
+ * @param running      Running state of the pool
+ * @param front        First job in the list of live (queued/running/done) jobs in submission order
+ * @param back         Last job in the list
+ * @param pending      Number of jobs queued or running
+ * @param bulk         Number of bulk jobs running
+ * @param last_handle  Last handle given out
+ * @param cb           Callback methods
+ */
+static struct {
+    pthread_mutex_t      lock;
+    pthread_cond_t       queued;
+    pthread_t            workers[CTUNE_NETWORKJOBS_MAX_WORKERS];
+    size_t               worker_count;
+    bool                 running;
+    ctune_NetworkJob_t * front;
+    ctune_NetworkJob_t * back;
+    size_t               pending;
+    size_t               bulk;
+    ctune_JobHandle_t    last_handle;
+
+    struct {
+        bool (* run)( ctune_NetworkJob_t * job, ctune_ServerList_t * servers );
+        void (* busy)( bool );
+        void (* completion)( ctune_NetworkJob_t * job );
+    } cb;
+
+} jobs = {
+    .lock         = PTHREAD_MUTEX_INITIALIZER,
+    .queued       = PTHREAD_COND_INITIALIZER,
+    .worker_count = 0,
+    .running      = false,
+    .front        = NULL,
+    .back         = NULL,
+    .pending      = 0,
+    .bulk         = 0,
+    .last_handle  = CTUNE_NETWORKJOBS_HANDLE_NONE,
+    .cb = {
+        .run        = NULL,
+        .busy       = NULL,
+        .completion = NULL,
+    },
+};
+
+/**
+ * [PRIVATE] Creates the key identifying duplicate requests
+ * @param type     Job type
+ * @param filter   Search filter
+ * @param category Search category
+ * @param term     Search term
+ * @param key      String to write the key into
+ */
+static void ctune_NetworkJobs_createKey( ctune_NetworkJob_Type_e type, const ctune_RadioBrowserFilter_t * filter, ctune_ByCategory_e category, const char * term, String_t * key ) {
+    ctune_utos( type, key );
+    String.append_back( key, ":" );
+
+    if( type == CTUNE_NETWORKJOB_STATIONS ) {
+        ctune_RadioBrowserFilter.parameteriseFields( filter, key );
+
+    } else {
+        ctune_utos( category, key );
+        String.append_back( key, ":" );
+        String.append_back( key, ( term ? term : "" ) );
+    }
+}
+
+/**
+ * [PRIVATE] Creates a job
+ * @param type     Job type
+ * @param filter   Search filter (can be NULL)
+ * @param category Search category
+ * @param term     Search term (can be NULL)
+ * @param key      Key of the job (moved into the job)
+ * @return Pointer to the allocated job or NULL on failure
+ */
+static ctune_NetworkJob_t * ctune_NetworkJobs_createJob( ctune_NetworkJob_Type_e type, const ctune_RadioBrowserFilter_t * filter, ctune_ByCategory_e category, const char * term, String_t * key ) {
+    ctune_NetworkJob_t * job = malloc( sizeof( ctune_NetworkJob_t ) );
+
+    if( job == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_NetworkJobs_createJob( %i, %p, %i, \"%s\", %p )] Failed to allocate job.",
+                   type, filter, category, ( term ? term : "" ), key
+        );
+
+        ctune_err.set( CTUNE_ERR_MALLOC );
+        return NULL; //EARLY RETURN
+    }
+
+    job->type              = type;
+    job->key               = *key; //move ownership
+    job->filter            = ctune_RadioBrowserFilter.init();
+    job->category          = category;
+    job->term              = String.init();
+    job->results           = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    job->success           = false;
+    job->stream.codec      = String.init();
+    job->stream.bitrate    = 0;
+    job->stream.latency_ms = 0;
+    job->state             = CTUNE_NETWORKJOB_QUEUED;
+    job->subscribers       = Vector.init( sizeof( ctune_NetworkJob_Subscriber_t ), NULL );
+    job->next              = NULL;
+    *key                   = String.init();
+
+    atomic_init( &job->cancel, false );
+
+    if( filter ) {
+        ctune_RadioBrowserFilter.copy( filter, &job->filter );
+    }
+
+    if( term ) {
+        String.set( &job->term, term );
+    }
+
+    return job;
+}
+
+/**
+ * [PRIVATE] De-allocates a job
+ * @param job Job
+ */
+static void ctune_NetworkJobs_freeJob( ctune_NetworkJob_t * job ) {
+    if( job ) {
+        String.free( &job->key );
+        ctune_RadioBrowserFilter.freeContent( &job->filter );
+        String.free( &job->term );
+        Vector.clear_vector( &job->results );
+        String.free( &job->stream.codec );
+        Vector.clear_vector( &job->subscribers );
+        free( job );
+    }
+}
+
+/**
+ * [PRIVATE] Removes a job from the list (lock must be held)
+ * @param job Job
+ */
+static void ctune_NetworkJobs_unlink( ctune_NetworkJob_t * job ) {
+    ctune_NetworkJob_t * prev = NULL;
+    ctune_NetworkJob_t * curr = jobs.front;
+
+    while( curr != NULL && curr != job ) {
+        prev = curr;
+        curr = curr->next;
+    }
+
+    if( curr == NULL ) {
+        return; //EARLY RETURN - not in the list
+    }
+
+    if( prev ) {
+        prev->next = job->next;
+    } else {
+        jobs.front = job->next;
+    }
+
+    if( jobs.back == job ) {
+        jobs.back = prev;
+    }
+
+    job->next = NULL;
+}
+
+/**
+ * [PRIVATE] Marks a job's submissions as cancelled and aborts it (lock must be held)
+ * @param job Job
+ */
+static void ctune_NetworkJobs_abort( ctune_NetworkJob_t * job ) {
+    for( size_t i = 0; i < Vector.size( &job->subscribers ); ++i ) {
+        ( (ctune_NetworkJob_Subscriber_t *) Vector.at( &job->subscribers, i ) )->cancelled = true;
+    }
+
+    atomic_store( &job->cancel, true );
+}
+
+/**
+ * [PRIVATE] Checks if a job is a bulk request (background priority)
+ * @param job Job
+ * @return Bulk state
+ */
+static bool ctune_NetworkJobs_isBulk( const ctune_NetworkJob_t * job ) {
+    return ( job->type == CTUNE_NETWORKJOB_STATIONS_BY_UUIDS || job->type == CTUNE_NETWORKJOB_STREAM_TEST_BULK );
+}
+
+/**
+ * [PRIVATE] Picks the next job to run (lock must be held)
+ * -
+ * Queued interactive jobs go first. Bulk jobs are run in submission order on all but one of the workers.
+ * @return Next job or NULL if there are none that can be run now
+ */
+static ctune_NetworkJob_t * ctune_NetworkJobs_next( void ) {
+    const size_t         max_bulk = ( jobs.worker_count > 0 ? jobs.worker_count - 1 : 0 );
+    ctune_NetworkJob_t * bulk     = NULL;
+
+    for( ctune_NetworkJob_t * job = jobs.front; job != NULL; job = job->next ) {
+        if( job->state != CTUNE_NETWORKJOB_QUEUED ) {
+            continue;
+        }
+
+        if( !ctune_NetworkJobs_isBulk( job ) ) {
+            return job; //EARLY RETURN
+        }
+
+        if( bulk == NULL ) {
+            bulk = job;
+        }
+    }
+
+    return ( jobs.bulk < max_bulk ? bulk : NULL );
+}
+
+/**
+ * [PRIVATE] Worker thread
+ * @param arg Unused
+ * @return NULL
+ */
+static void * ctune_NetworkJobs_worker( void * arg ) {
+    ctune_ServerList_t servers = ctune_ServerList.init(); //separate list as mirrors failing are removed from it
+
+    pthread_mutex_lock( &jobs.lock );
+
+    for(;;) {
+        ctune_NetworkJob_t * job = NULL;
+
+        while( jobs.running ) {
+            if( ( job = ctune_NetworkJobs_next() ) != NULL ) {
+                break;
+            }
+
+            pthread_cond_wait( &jobs.queued, &jobs.lock );
+        }
+
+        if( job == NULL ) {
+            break; //stopped
+        }
+
+        job->state = CTUNE_NETWORKJOB_RUNNING;
+
+        if( ctune_NetworkJobs_isBulk( job ) ) {
+            ++jobs.bulk;
+        }
+
+        pthread_mutex_unlock( &jobs.lock );
+
+        if( !atomic_load( &job->cancel ) ) {
+            ctune_NetworkUtils.setAbortFlag( &job->cancel );
+            job->success = jobs.cb.run( job, &servers );
+            ctune_NetworkUtils.setAbortFlag( NULL );
+        }
+
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_NetworkJobs_worker( %p )] Job %p \"%s\" %s (%lu results).",
+                   arg, job, job->key._raw,
+                   ( atomic_load( &job->cancel ) ? "cancelled" : ( job->success ? "succeeded" : "failed" ) ),
+                   Vector.size( &job->results )
+        );
+
+        pthread_mutex_lock( &jobs.lock );
+
+        job->state = CTUNE_NETWORKJOB_DONE;
+
+        if( ctune_NetworkJobs_isBulk( job ) ) {
+            --jobs.bulk;
+            pthread_cond_signal( &jobs.queued ); //another bulk job may be let through now
+        }
+
+        if( --jobs.pending == 0 && jobs.cb.busy ) {
+            jobs.cb.busy( false );
+        }
+
+        void (* completion)( ctune_NetworkJob_t * ) = jobs.cb.completion;
+
+        pthread_mutex_unlock( &jobs.lock );
+
+        if( completion ) {
+            completion( job );
+        } else {
+            ctune_NetworkJobs.complete( job );
+        }
+
+        pthread_mutex_lock( &jobs.lock );
+    }
+
+    pthread_mutex_unlock( &jobs.lock );
+
+    ctune_ServerList.freeServerList( &servers );
+    return NULL;
+}
+
+/**
+ * Starts the worker pool
+ * @param workers Number of worker threads
+ * @param run     Method doing the work of a job on a worker thread using the worker's own server list
+ * @param busy    Callback for when the pool goes from idle to busy and back (can be NULL)
+ * @return Success
+ */
+static bool ctune_NetworkJobs_init( size_t workers, bool (* run)( ctune_NetworkJob_t * job, ctune_ServerList_t * servers ), void (* busy)( bool ) ) {
+    if( run == NULL || workers == 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_NetworkJobs_init( %lu, %p, %p )] Invalid arg(s).", workers, run, busy );
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &jobs.lock );
+
+    if( jobs.running ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_NetworkJobs_init( %lu, %p, %p )] Worker pool already running.", workers, run, busy );
+        pthread_mutex_unlock( &jobs.lock );
+        return false; //EARLY RETURN
+    }
+
+    jobs.cb.run  = run;
+    jobs.cb.busy = busy;
+    jobs.running = true;
+
+    if( workers > CTUNE_NETWORKJOBS_MAX_WORKERS ) {
+        workers = CTUNE_NETWORKJOBS_MAX_WORKERS;
+    }
+
+    while( jobs.worker_count < workers ) {
+        if( pthread_create( &jobs.workers[ jobs.worker_count ], NULL, ctune_NetworkJobs_worker, NULL ) != 0 ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_NetworkJobs_init( %lu, %p, %p )] Failed to create worker thread #%lu.",
+                       workers, run, busy, jobs.worker_count
+            );
+
+            ctune_err.set( CTUNE_ERR_THREAD_CREATE );
+            break;
+        }
+
+        ++jobs.worker_count;
+    }
+
+    jobs.running = ( jobs.worker_count > 0 );
+
+    if( jobs.worker_count == 1 ) {
+        CTUNE_LOG( CTUNE_LOG_WARNING,
+                   "[ctune_NetworkJobs_init( %lu, %p, %p )] Single worker: bulk jobs will be refused.",
+                   workers, run, busy
+        );
+    }
+
+    pthread_mutex_unlock( &jobs.lock );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_NetworkJobs_init( %lu, %p, %p )] %lu worker(s) started.", workers, run, busy, jobs.worker_count );
+
+    return jobs.running;
+}
+
+/**
+ * [THREAD SAFE] Sets the callback to hand over finished jobs to the thread that must complete them
+ * @param cb Callback method (NULL to complete jobs on the worker threads)
+ */
+static void ctune_NetworkJobs_setCompletionCallback( void (* cb)( ctune_NetworkJob_t * job ) ) {
+    pthread_mutex_lock( &jobs.lock );
+    jobs.cb.completion = cb;
+    pthread_mutex_unlock( &jobs.lock );
+}
+
+/**
+ * [THREAD SAFE] Submits a job or joins an identical one already queued/running
+ * @param type     Job type
+ * @param filter   Search filter (CTUNE_NETWORKJOB_STATIONS)
+ * @param category Search category (CTUNE_NETWORKJOB_STATIONS_BY)
+ * @param term     Search term (CTUNE_NETWORKJOB_STATIONS_BY, can be NULL)
+ * @param cb       Completion callback
+ * @param data     Data pointer to pass to the callback
+ * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure or for bulk jobs when there is only 1 worker)
+ */
+static ctune_JobHandle_t ctune_NetworkJobs_submit( ctune_NetworkJob_Type_e type,
+                                                   const ctune_RadioBrowserFilter_t * filter,
+                                                   ctune_ByCategory_e category,
+                                                   const char * term,
+                                                   ctune_NetworkJob_Callback_f cb,
+                                                   void * data )
+{
+    const bool is_stream_test = ( type == CTUNE_NETWORKJOB_STREAM_TEST || type == CTUNE_NETWORKJOB_STREAM_TEST_BULK );
+
+    if( cb == NULL || ( type == CTUNE_NETWORKJOB_STATIONS && filter == NULL ) || ( is_stream_test && term == NULL ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_NetworkJobs_submit( %i, %p, %i, \"%s\", %p, %p )] Invalid arg(s).",
+                   type, filter, category, ( term ? term : "" ), cb, data
+        );
+
+        return CTUNE_NETWORKJOBS_HANDLE_NONE; //EARLY RETURN
+    }
+
+    ctune_JobHandle_t               handle     = CTUNE_NETWORKJOBS_HANDLE_NONE;
+    ctune_NetworkJob_t            * job        = NULL;
+    ctune_NetworkJob_Subscriber_t * subscriber = NULL;
+    String_t                        key        = String.init();
+
+    ctune_NetworkJobs_createKey( type, filter, category, term, &key );
+
+    pthread_mutex_lock( &jobs.lock );
+
+    if( !jobs.running ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_NetworkJobs_submit( %i, %p, %i, \"%s\", %p, %p )] Worker pool is not running.",
+                   type, filter, category, ( term ? term : "" ), cb, data
+        );
+
+        goto end;
+    }
+
+    if( type == CTUNE_NETWORKJOB_STATIONS_BY_UUIDS || type == CTUNE_NETWORKJOB_STREAM_TEST_BULK ) {
+        if( jobs.worker_count < 2 ) { //bulk jobs would take up the only worker
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_NetworkJobs_submit( %i, %p, %i, \"%s\", %p, %p )] Bulk jobs need at least 2 workers (%lu running).",
+                       type, filter, category, ( term ? term : "" ), cb, data, jobs.worker_count
+            );
+
+            goto end;
+        }
+    }
+
+    for( job = jobs.front; job != NULL; job = job->next ) { //coalesce with an identical live request
+        if( job->state != CTUNE_NETWORKJOB_DONE && !atomic_load( &job->cancel ) && strcmp( job->key._raw, key._raw ) == 0 ) {
+            CTUNE_LOG( CTUNE_LOG_DEBUG,
+                       "[ctune_NetworkJobs_submit( %i, %p, %i, \"%s\", %p, %p )] Joining job %p (\"%s\").",
+                       type, filter, category, ( term ? term : "" ), cb, data, job, job->key._raw
+            );
+
+            break;
+        }
+    }
+
+    if( job == NULL ) {
+        if( ( job = ctune_NetworkJobs_createJob( type, filter, category, term, &key ) ) == NULL ) {
+            goto end;
+        }
+
+        if( jobs.back ) {
+            jobs.back->next = job;
+        } else {
+            jobs.front = job;
+        }
+
+        jobs.back = job;
+
+        if( jobs.pending++ == 0 && jobs.cb.busy ) {
+            jobs.cb.busy( true );
+        }
+
+        pthread_cond_signal( &jobs.queued );
+    }
+
+    if( ( subscriber = Vector.emplace_back( &job->subscribers ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_NetworkJobs_submit( %i, %p, %i, \"%s\", %p, %p )] Failed to add subscriber to job %p.",
+                   type, filter, category, ( term ? term : "" ), cb, data, job
+        );
+
+        if( Vector.empty( &job->subscribers ) ) {
+            atomic_store( &job->cancel, true );
+        }
+
+        goto end;
+    }
+
+    subscriber->handle    = handle = ++jobs.last_handle;
+    subscriber->cb        = cb;
+    subscriber->data      = data;
+    subscriber->cancelled = false;
+
+    end:
+        pthread_mutex_unlock( &jobs.lock );
+        String.free( &key );
+        return handle;
+}
+
+/**
+ * [THREAD SAFE] Cancels a submission (the job itself is aborted once all its submissions are cancelled)
+ * @param handle Job handle
+ */
+static void ctune_NetworkJobs_cancel( ctune_JobHandle_t handle ) {
+    if( handle == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
+        return; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &jobs.lock );
+
+    for( ctune_NetworkJob_t * job = jobs.front; job != NULL; job = job->next ) {
+        bool found = false;
+        bool live  = false;
+
+        for( size_t i = 0; i < Vector.size( &job->subscribers ); ++i ) {
+            ctune_NetworkJob_Subscriber_t * subscriber = Vector.at( &job->subscribers, i );
+
+            if( subscriber->handle == handle ) {
+                subscriber->cancelled = true;
+                found                 = true;
+            }
+
+            live |= !subscriber->cancelled;
+        }
+
+        if( found ) {
+            if( !live && job->state != CTUNE_NETWORKJOB_DONE ) {
+                CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_NetworkJobs_cancel( %lu )] Aborting job %p (\"%s\").", handle, job, job->key._raw );
+                atomic_store( &job->cancel, true );
+            }
+
+            break;
+        }
+    }
+
+    pthread_mutex_unlock( &jobs.lock );
+}
+
+/**
+ * [THREAD SAFE] Aborts all jobs (their callbacks are still called so that submitters can reset their state)
+ */
+static void ctune_NetworkJobs_cancelAll( void ) {
+    pthread_mutex_lock( &jobs.lock );
+
+    for( ctune_NetworkJob_t * job = jobs.front; job != NULL; job = job->next ) {
+        if( job->state != CTUNE_NETWORKJOB_DONE ) {
+            atomic_store( &job->cancel, true );
+        }
+    }
+
+    pthread_mutex_unlock( &jobs.lock );
+}
+
+/**
+ * [THREAD SAFE] Gets the number of jobs queued or running
+ * @return Number of jobs
+ */
+static size_t ctune_NetworkJobs_pending( void ) {
+    pthread_mutex_lock( &jobs.lock );
+    const size_t pending = jobs.pending;
+    pthread_mutex_unlock( &jobs.lock );
+
+    return pending;
+}
+
+/**
+ * [THREAD SAFE] Calls the callbacks of a finished job's live submissions and frees the job
+ * @param job Finished job (as passed to the completion callback)
+ */
+static void ctune_NetworkJobs_complete( ctune_NetworkJob_t * job ) {
+    if( job == NULL ) {
+        return; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &jobs.lock );
+    ctune_NetworkJobs_unlink( job ); //from here on the submissions can't be cancelled anymore
+    pthread_mutex_unlock( &jobs.lock );
+
+    for( size_t i = 0; i < Vector.size( &job->subscribers ); ++i ) {
+        ctune_NetworkJob_Subscriber_t * subscriber = Vector.at( &job->subscribers, i );
+
+        if( !subscriber->cancelled ) {
+            subscriber->cb( job, subscriber->data );
+        }
+    }
+
+    ctune_NetworkJobs_freeJob( job );
+}
+
+/**
+ * Aborts all jobs and stops the worker pool
+ */
+static void ctune_NetworkJobs_shutdown( void ) {
+    pthread_mutex_lock( &jobs.lock );
+
+    jobs.running       = false;
+    jobs.cb.completion = NULL; //whoever was completing the jobs may be gone already
+
+    for( ctune_NetworkJob_t * job = jobs.front; job != NULL; job = job->next ) {
+        ctune_NetworkJobs_abort( job );
+    }
+
+    pthread_cond_broadcast( &jobs.queued );
+    pthread_mutex_unlock( &jobs.lock );
+
+    for( size_t i = 0; i < jobs.worker_count; ++i ) {
+        pthread_join( jobs.workers[i], NULL );
+    }
+
+    pthread_mutex_lock( &jobs.lock );
+
+    while( jobs.front != NULL ) { //jobs never picked up or never completed
+        ctune_NetworkJob_t * job = jobs.front;
+        jobs.front = job->next;
+        ctune_NetworkJobs_freeJob( job );
+    }
+
+    jobs.back         = NULL;
+    jobs.pending      = 0;
+    jobs.worker_count = 0;
+    jobs.cb.busy      = NULL;
+
+    pthread_mutex_unlock( &jobs.lock );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_NetworkJobs_shutdown()] Worker pool stopped." );
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_NetworkJobs_Instance ctune_NetworkJobs = {
+    .init                  = &ctune_NetworkJobs_init,
+    .setCompletionCallback = &ctune_NetworkJobs_setCompletionCallback,
+    .submit                = &ctune_NetworkJobs_submit,
+    .cancel                = &ctune_NetworkJobs_cancel,
+    .cancelAll             = &ctune_NetworkJobs_cancelAll,
+    .pending               = &ctune_NetworkJobs_pending,
+    .complete              = &ctune_NetworkJobs_complete,
+    .shutdown              = &ctune_NetworkJobs_shutdown,
+};
@@ -0,0 +1,155 @@
+#ifndef CTUNE_NETWORK_NETWORKJOBS_H
+#define CTUNE_NETWORK_NETWORKJOBS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "../datastructure/String.h"
+#include "../datastructure/Vector.h"
+#include "../datastructure/ServerList.h"
+#include "../dto/RadioBrowserFilter.h"
+#include "../enum/ByCategory.h"
+
+#define CTUNE_NETWORKJOBS_WORKER_COUNT 4 //number of worker threads in the pool
+#define CTUNE_NETWORKJOBS_HANDLE_NONE  0 //invalid job handle
+
+/**
+ * Job handle (one per submission - i.e. coalesced submissions get their own handle)
+ */
+typedef uint64_t ctune_JobHandle_t;
+
+/**
+ * Job types
+ */
+typedef enum {
+    CTUNE_NETWORKJOB_STATIONS = 0,      //stations matching a filter
+    CTUNE_NETWORKJOB_STATIONS_BY,       //stations matching a category and term
+    CTUNE_NETWORKJOB_STATIONS_BY_UUIDS, //stations matching a comma separated list of UUIDs in term (bulk: background priority)
+    CTUNE_NETWORKJOB_STREAM_TEST,       //probe of the stream at the URL in term
+    CTUNE_NETWORKJOB_STREAM_TEST_BULK,  //probe of the stream at the URL in term (bulk: background priority)
+} ctune_NetworkJob_Type_e;
+
+/**
+ * Job states
+ */
+typedef enum {
+    CTUNE_NETWORKJOB_QUEUED = 0, //waiting for a worker
+    CTUNE_NETWORKJOB_RUNNING,    //being worked on
+    CTUNE_NETWORKJOB_DONE,       //finished and waiting to be completed
+} ctune_NetworkJob_State_e;
+
+struct ctune_NetworkJob;
+
+/**
+ * Completion callback
+ * @param job  Finished job (freed after the callbacks return: copy what is needed)
+ * @param data Data pointer passed on submission
+ */
+typedef void (* ctune_NetworkJob_Callback_f)( struct ctune_NetworkJob * job, void * data );
+
+/**
+ * Network job
+ * @param type        Job type
+ * @param key         Key identifying duplicate requests
+ * @param filter      Search filter (CTUNE_NETWORKJOB_STATIONS)
+ * @param category    Search category (CTUNE_NETWORKJOB_STATIONS_BY)
+ * @param term        Search term (CTUNE_NETWORKJOB_STATIONS_BY), UUID list (CTUNE_NETWORKJOB_STATIONS_BY_UUIDS) or stream URL (CTUNE_NETWORKJOB_STREAM_TEST*)
+ * @param results     Collection of RadioStationInfo_t objects fetched
+ * @param success     Success state
+ * @param stream      Stream properties probed (CTUNE_NETWORKJOB_STREAM_TEST*: codec, bitrate in kbps and time taken to connect/probe in ms)
+ * @param cancel      Abort flag (aborts in-flight transfers; set on finished jobs that were aborted)
+ * @param state       Job state
+ * @param subscribers Submissions waiting on the job (`ctune_NetworkJob_Subscriber_t`)
+ * @param next        Next job in the list
+ */
+typedef struct ctune_NetworkJob {
+    ctune_NetworkJob_Type_e    type;
+    String_t                   key;
+    ctune_RadioBrowserFilter_t filter;
+    ctune_ByCategory_e         category;
+    String_t                   term;
+    Vector_t                   results;
+    bool                       success;
+
+    struct {
+        String_t               codec;
+        ulong                  bitrate;
+        double                 latency_ms;
+    } stream;
+
+    atomic_bool                cancel;
+    ctune_NetworkJob_State_e   state;
+    Vector_t                   subscribers;
+    struct ctune_NetworkJob  * next;
+
+} ctune_NetworkJob_t;
+
+/**
+ * Background worker pool for RadioBrowser requests
+ */
+extern const struct ctune_NetworkJobs_Instance {
+    /**
+     * Starts the worker pool (bulk jobs never take up the last free worker so that other jobs are not stuck behind them
+     * which means that they are refused when there is only 1 worker)
+     * @param workers Number of worker threads
+     * @param run     Method doing the work of a job on a worker thread using the worker's own server list
+     * @param busy    Callback for when the pool goes from idle to busy and back (can be NULL)
+     * @return Success
+     */
+    bool (* init)( size_t workers, bool (* run)( ctune_NetworkJob_t * job, ctune_ServerList_t * servers ), void (* busy)( bool ) );
+
+    /**
+     * [THREAD SAFE] Sets the callback to hand over finished jobs to the thread that must complete them
+     * @param cb Callback method (NULL to complete jobs on the worker threads)
+     */
+    void (* setCompletionCallback)( void (* cb)( ctune_NetworkJob_t * job ) );
+
+    /**
+     * [THREAD SAFE] Submits a job or joins an identical one already queued/running
+     * @param type     Job type
+     * @param filter   Search filter (CTUNE_NETWORKJOB_STATIONS)
+     * @param category Search category (CTUNE_NETWORKJOB_STATIONS_BY)
+     * @param term     Search term (CTUNE_NETWORKJOB_STATIONS_BY, can be NULL), UUID list (CTUNE_NETWORKJOB_STATIONS_BY_UUIDS) or stream URL (CTUNE_NETWORKJOB_STREAM_TEST*)
+     * @param cb       Completion callback
+     * @param data     Data pointer to pass to the callback
+     * @return Job handle (`CTUNE_NETWORKJOBS_HANDLE_NONE` on failure or for bulk jobs when there is only 1 worker)
+     */
+    ctune_JobHandle_t (* submit)( ctune_NetworkJob_Type_e type,
+                                  const ctune_RadioBrowserFilter_t * filter,
+                                  ctune_ByCategory_e category,
+                                  const char * term,
+                                  ctune_NetworkJob_Callback_f cb,
+                                  void * data );
+
+    /**
+     * [THREAD SAFE] Cancels a submission (the job itself is aborted once all its submissions are cancelled)
+     * @param handle Job handle
+     */
+    void (* cancel)( ctune_JobHandle_t handle );
+
+    /**
+     * [THREAD SAFE] Aborts all jobs (their callbacks are still called so that submitters can reset their state)
+     */
+    void (* cancelAll)( void );
+
+    /**
+     * [THREAD SAFE] Gets the number of jobs queued or running
+     * @return Number of jobs
+     */
+    size_t (* pending)( void );
+
+    /**
+     * [THREAD SAFE] Calls the callbacks of a finished job's live submissions and frees the job
+     * @param job Finished job (as passed to the completion callback)
+     */
+    void (* complete)( ctune_NetworkJob_t * job );
+
+    /**
+     * Aborts all jobs and stops the worker pool
+     */
+    void (* shutdown)( void );
+
+} ctune_NetworkJobs;
+
+#endif //CTUNE_NETWORK_NETWORKJOBS_H
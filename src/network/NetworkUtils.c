@@ -1,6 +1,8 @@
 #include "NetworkUtils.h"
 
 #include <string.h>
+#include <strings.h>
+#include <time.h>
 
 #include <sys/socket.h>
 #include <arpa/inet.h>
@@ -8,8 +10,26 @@
 
 #include "logger/src/Logger.h"
 #include "../ctune_err.h"
+#include "ResponseCache.h"
+#include "MirrorStats.h"
 #include "project_version.h"
 
+/**
+ * [PRIVATE] HTTP cache validators of a response
+ * @param etag          'ETag' header value
+ * @param last_modified 'Last-Modified' header value
+ */
+typedef struct ctune_NetworkUtils_Validators {
+    String_t etag;
+    String_t last_modified;
+
+} ctune_NetworkUtils_Validators_t;
+
+/**
+ * [PRIVATE] Abort flag checked by the transfers of the current thread (NULL when not set)
+ */
+static __thread const atomic_bool * abort_flag = NULL;
+
 /**
  * NS lookup on a hostname
  * @param hostname Hostname
@@ -104,62 +124,212 @@ static size_t ctune_NetworkUtils_curlWrite_cb( char * contents, size_t size, siz
 }
 
 /**
- * Curl fetch over HTTPS
- * @param host    Host information
- * @param path    Path
- * @param timeout Socket timeout value to use (seconds)
- * @param answer  String container for the data fetched
+ * [PRIVATE] Curl header callback function (captures the cache validators)
+ * @param buffer   Header line (not null terminated)
+ * @param size     Always 1
+ * @param nitems   Size of the header line
+ * @param userdata Pointer to a ctune_NetworkUtils_Validators_t object
+ * @return Number of bytes processed
+ */
+static size_t ctune_NetworkUtils_curlHeader_cb( char * buffer, size_t size, size_t nitems, void * userdata ) {
+    const size_t                      real_size  = size * nitems;
+    ctune_NetworkUtils_Validators_t * validators = (ctune_NetworkUtils_Validators_t *) userdata;
+    String_t                        * target     = NULL;
+    size_t                            offset     = 0;
+
+    if( real_size > 5 && strncasecmp( buffer, "ETag:", 5 ) == 0 ) {
+        target = &validators->etag;
+        offset = 5;
+
+    } else if( real_size > 14 && strncasecmp( buffer, "Last-Modified:", 14 ) == 0 ) {
+        target = &validators->last_modified;
+        offset = 14;
+    }
+
+    if( target ) {
+        size_t end = real_size;
+
+        while( offset < end && ( buffer[offset] == ' ' || buffer[offset] == '\t' ) ) {
+            ++offset;
+        }
+
+        while( end > offset && ( buffer[end - 1] == '\r' || buffer[end - 1] == '\n' || buffer[end - 1] == ' ' ) ) {
+            --end;
+        }
+
+        char * value = strndup( &buffer[offset], ( end - offset ) );
+
+        if( value ) {
+            String.set( target, value );
+            free( value );
+        }
+    }
+
+    return real_size;
+}
+
+/**
+ * [PRIVATE] Curl transfer progress callback function (aborts the transfer when the abort flag is raised)
+ * @param clientp Pointer to the abort flag
+ * @param dltotal Total number of bytes expected to be downloaded (unused)
+ * @param dlnow   Number of bytes downloaded so far (unused)
+ * @param ultotal Total number of bytes expected to be uploaded (unused)
+ * @param ulnow   Number of bytes uploaded so far (unused)
+ * @return 0 to continue, 1 to abort
+ */
+static int ctune_NetworkUtils_curlProgress_cb( void * clientp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow ) {
+    (void) dltotal;
+    (void) dlnow;
+    (void) ultotal;
+    (void) ulnow;
+
+    return ( atomic_load( (const atomic_bool *) clientp ) ? 1 : 0 );
+}
+
+/**
+ * [PRIVATE] Creates a curl handle for a GET request over HTTPS
+ * @param host       Host information
+ * @param path       Path
+ * @param timeout    Socket timeout value to use (seconds)
+ * @param conditions Validators to send as conditional request headers (can be NULL)
+ * @param received   Container for the validators sent back by the server (can be NULL)
+ * @param answer     String container for the data fetched
+ * @param headers    Pointer to store the request header list into (to free with `curl_slist_free_all(..)` after the transfer)
+ * @return Curl handle or NULL on failure
+ */
+static CURL * ctune_NetworkUtils_createHandle( const ServerListNode * host,
+                                               const char * path,
+                                               long timeout,
+                                               const ctune_NetworkUtils_Validators_t * conditions,
+                                               ctune_NetworkUtils_Validators_t * received,
+                                               struct String * answer,
+                                               struct curl_slist ** headers )
+{
+    CURL * curl = curl_easy_init();
+
+    if( curl == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_NetworkUtils_createHandle( %p, \"%s\", %ld, %p, %p, %p, %p )] Could not initialize curl",
+                   host, path, timeout, conditions, received, answer, headers
+        );
+
+        ctune_err.set( CTUNE_ERR_CURL_INIT );
+        return NULL; //EARLY RETURN
+    }
+
+    String_t url    = String.init();
+    String_t header = String.init();
+
+    String.append_back( &url, "https://" );
+    String.append_back( &url, host->hostname );
+    String.append_back( &url, path );
+
+    curl_easy_setopt( curl, CURLOPT_URL, url._raw );
+    curl_easy_setopt( curl, CURLOPT_TIMEOUT, timeout );
+    curl_easy_setopt( curl, CURLOPT_WRITEFUNCTION, ctune_NetworkUtils_curlWrite_cb );
+    curl_easy_setopt( curl, CURLOPT_WRITEDATA, answer );
+    curl_easy_setopt( curl, CURLOPT_USERAGENT, CTUNE_USERAGENT );
+
+    *headers = curl_slist_append( *headers, "Content-type: application/json; charset=utf-8" );
+
+    if( conditions && !String.empty( &conditions->etag ) ) {
+        String.set( &header, "If-None-Match: " );
+        String.append_back( &header, conditions->etag._raw );
+        *headers = curl_slist_append( *headers, header._raw );
+    }
+
+    if( conditions && !String.empty( &conditions->last_modified ) ) {
+        String.set( &header, "If-Modified-Since: " );
+        String.append_back( &header, conditions->last_modified._raw );
+        *headers = curl_slist_append( *headers, header._raw );
+    }
+
+    curl_easy_setopt( curl, CURLOPT_HTTPHEADER, *headers );
+
+    if( received ) {
+        curl_easy_setopt( curl, CURLOPT_HEADERFUNCTION, ctune_NetworkUtils_curlHeader_cb );
+        curl_easy_setopt( curl, CURLOPT_HEADERDATA, received );
+    }
+
+    if( abort_flag ) {
+        curl_easy_setopt( curl, CURLOPT_NOPROGRESS, 0L );
+        curl_easy_setopt( curl, CURLOPT_XFERINFOFUNCTION, ctune_NetworkUtils_curlProgress_cb );
+        curl_easy_setopt( curl, CURLOPT_XFERINFODATA, abort_flag );
+    }
+
+    String.free( &url );
+    String.free( &header );
+
+    return curl;
+}
+
+/**
+ * [PRIVATE] Curl fetch over HTTPS
+ * @param host       Host information
+ * @param path       Path
+ * @param timeout    Socket timeout value to use (seconds)
+ * @param conditions Validators to send as conditional request headers (can be NULL)
+ * @param received   Container for the validators sent back by the server (can be NULL)
+ * @param answer     String container for the data fetched
  * @return HTTP code
  */
-static long ctune_NetworkUtils_curlSecureFetch( const ServerListNode * host, const char * path, long timeout, struct String * answer ) {
-    CURL              * curl      = curl_easy_init();
+static long ctune_NetworkUtils_curlFetch( const ServerListNode * host,
+                                          const char * path,
+                                          long timeout,
+                                          const ctune_NetworkUtils_Validators_t * conditions,
+                                          ctune_NetworkUtils_Validators_t * received,
+                                          struct String * answer )
+{
     struct curl_slist * list      = NULL;
+    CURL              * curl      = ctune_NetworkUtils_createHandle( host, path, timeout, conditions, received, answer, &list );
     CURLcode            curl_code = CURLE_OK;
     long                http_code = 0;
+    bool                aborted   = false;
 
     if( curl ) {
-        String_t url = String.init();
-
-        String.append_back( &url, "https://" );
-        String.append_back( &url, host->hostname );
-        String.append_back( &url, path );
-
-        curl_easy_setopt( curl, CURLOPT_URL, url._raw );
-        curl_easy_setopt( curl, CURLOPT_TIMEOUT, timeout );
-        curl_easy_setopt( curl, CURLOPT_WRITEFUNCTION, ctune_NetworkUtils_curlWrite_cb );
-        curl_easy_setopt( curl, CURLOPT_WRITEDATA, answer );
-        curl_easy_setopt( curl, CURLOPT_USERAGENT, CTUNE_USERAGENT );
-
-        list = curl_slist_append(list, "Content-type: application/json; charset=utf-8");
+        double total_time = 0;
 
         curl_code = curl_easy_perform ( curl );
+        aborted   = ( curl_code == CURLE_ABORTED_BY_CALLBACK && ctune_NetworkUtils.abortRequested() );
         curl_easy_getinfo( curl, CURLINFO_RESPONSE_CODE, &http_code );
+        curl_easy_getinfo( curl, CURLINFO_TOTAL_TIME, &total_time );
+
+        if( !aborted ) { //a cancelled transfer says nothing about the mirror
+            ctune_MirrorStats.recordRequest( host->hostname,
+                                             ( total_time * 1000 ),
+                                             ( curl_code == CURLE_OK && ( http_code == 200 || http_code == 304 ) ) );
+        }
 
-        String.free( &url );
         curl_easy_cleanup( curl );
         curl_slist_free_all( list );
+    }
 
-    } else {
-        CTUNE_LOG( CTUNE_LOG_FATAL,
-                   "[ctune_NetworkUtils_curlSecureFetch( %p, \"%s\", %d, %p )] Failed to fetch: could not initialize curl",
-                   host, path, timeout, answer
+    if( aborted ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_NetworkUtils_curlFetch( %p, \"%s\", %d, %p, %p, %p )] Transfer cancelled.",
+                   host, path, timeout, conditions, received, answer
         );
 
-        ctune_err.set( CTUNE_ERR_CURL_INIT );
-    }
+        http_code = 0;
 
-    if( curl_code == CURLE_ABORTED_BY_CALLBACK ) {
+    } else if( curl_code == CURLE_ABORTED_BY_CALLBACK ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_NetworkUtils_curlSecureFetch( %p, \"%s\", %d, %p )] Failed to fetch: aborted by callback print function",
-                   host, path, timeout, answer
+                   "[ctune_NetworkUtils_curlFetch( %p, \"%s\", %d, %p, %p, %p )] Failed to fetch: aborted by callback print function",
+                   host, path, timeout, conditions, received, answer
         );
 
         ctune_err.set( CTUNE_ERR_CURL_WRITE_CALLBACK );
 
+    } else if( curl_code == CURLE_OK && http_code == 304 && conditions != NULL ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_NetworkUtils_curlFetch( %p, \"%s\", %d, %p, %p, %p )] Not modified.",
+                   host, path, timeout, conditions, received, answer
+        );
+
     } else if( curl_code != CURLE_OK || http_code != 200 ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_NetworkUtils_curlSecureFetch( %p, \"%s\", %d, %p )] Failed to fetch: Curl %s / HTTP code %ld",
-                   host, path, timeout, answer, ( curl_code == CURLE_OK ? "OK" : "KO" ), http_code
+                   "[ctune_NetworkUtils_curlFetch( %p, \"%s\", %d, %p, %p, %p )] Failed to fetch: Curl %s / HTTP code %ld",
+                   host, path, timeout, conditions, received, answer, ( curl_code == CURLE_OK ? "OK" : "KO" ), http_code
         );
 
         ctune_err.set( CTUNE_ERR_HTTP_GET );
@@ -169,6 +339,329 @@ static long ctune_NetworkUtils_curlSecureFetch( const ServerListNode * host, con
     return http_code;
 }
 
+/**
+ * Curl fetch over HTTPS
+ * @param host    Host information
+ * @param path    Path
+ * @param timeout Socket timeout value to use (seconds)
+ * @param answer  String container for the data fetched
+ * @return HTTP code
+ */
+static long ctune_NetworkUtils_curlSecureFetch( const ServerListNode * host, const char * path, long timeout, struct String * answer ) {
+    return ctune_NetworkUtils_curlFetch( host, path, timeout, NULL, NULL, answer );
+}
+
+/**
+ * Curl fetch over HTTPS with a hedged request
+ * -
+ * The request is sent to the primary host first. If it has not completed after `hedge_delay` milliseconds
+ * (or it fails before that) the same request is sent to the secondary host and the first successful answer
+ * is used. The other transfer is then cancelled.
+ *
+ * @param primary     Primary host information
+ * @param secondary   Secondary host information (can be NULL)
+ * @param path        Path
+ * @param timeout     Socket timeout value to use (seconds)
+ * @param hedge_delay Time to wait for the primary host before sending the hedged request (milliseconds)
+ * @param answer      String container for the data fetched
+ * @param result      Container for the per-host outcome (can be NULL)
+ * @return HTTP code of the answer used (or of the last failure)
+ */
+static long ctune_NetworkUtils_curlHedgedFetch( const ServerListNode * primary,
+                                                const ServerListNode * secondary,
+                                                const char * path,
+                                                long timeout,
+                                                long hedge_delay,
+                                                struct String * answer,
+                                                ctune_NetworkUtils_HedgeResult_t * result )
+{
+    struct {
+        const ServerListNode * host;
+        CURL                 * curl;
+        struct curl_slist    * headers;
+        String_t               buffer;
+        bool                   active;
+        bool                   failed;
+        long                   http_code;
+    } req[2] = {
+        { .host = primary,   .curl = NULL, .headers = NULL, .buffer = String.init(), .active = false, .failed = false, .http_code = 0 },
+        { .host = secondary, .curl = NULL, .headers = NULL, .buffer = String.init(), .active = false, .failed = false, .http_code = 0 },
+    };
+
+    CURLM           * multi     = NULL;
+    struct timespec   start     = { 0 };
+    int               winner    = -1;
+    long              last_code = 0;
+    bool              hedged    = false;
+
+    if( secondary == NULL ) {
+        last_code = ctune_NetworkUtils_curlFetch( primary, path, timeout, NULL, NULL, answer );
+
+        if( result ) {
+            result->responder    = ( last_code == 200 ? primary : NULL );
+            result->http_code[0] = last_code;
+            result->http_code[1] = 0;
+            result->failed[0]    = ( last_code != 200 );
+            result->failed[1]    = false;
+        }
+
+        return last_code; //EARLY RETURN
+    }
+
+    if( ( multi = curl_multi_init() ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_NetworkUtils_curlHedgedFetch( %p, %p, \"%s\", %ld, %ld, %p, %p )] Could not initialize curl multi handle.",
+                   primary, secondary, path, timeout, hedge_delay, answer, result
+        );
+
+        ctune_err.set( CTUNE_ERR_CURL_INIT );
+        goto end;
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+
+    for( int i = 0; i < 2; ++i ) {
+        if( i == 1 ) { //wait for the primary to complete or for the hedge delay to run out
+            long elapsed = 0;
+
+            while( winner < 0 && req[0].active && elapsed < hedge_delay ) {
+                int       running = 0;
+                CURLMsg * msg     = NULL;
+                int       queued  = 0;
+
+                curl_multi_perform( multi, &running );
+
+                while( ( msg = curl_multi_info_read( multi, &queued ) ) != NULL ) {
+                    if( msg->msg == CURLMSG_DONE ) {
+                        curl_easy_getinfo( msg->easy_handle, CURLINFO_RESPONSE_CODE, &req[0].http_code );
+                        req[0].active = false;
+                        req[0].failed = ( msg->data.result != CURLE_OK || req[0].http_code != 200 );
+
+                        if( !req[0].failed ) {
+                            winner = 0;
+                        }
+                    }
+                }
+
+                struct timespec now;
+                clock_gettime( CLOCK_MONOTONIC, &now );
+                elapsed = ( now.tv_sec - start.tv_sec ) * 1000 + ( now.tv_nsec - start.tv_nsec ) / 1000000;
+
+                if( winner < 0 && req[0].active && elapsed < hedge_delay ) {
+                    curl_multi_poll( multi, NULL, 0, (int) ( hedge_delay - elapsed ), NULL );
+                }
+            }
+
+            if( winner >= 0 || ctune_NetworkUtils.abortRequested() ) {
+                break;
+            }
+
+            hedged = true;
+
+            CTUNE_LOG( CTUNE_LOG_DEBUG,
+                       "[ctune_NetworkUtils_curlHedgedFetch( %p, %p, \"%s\", %ld, %ld, %p, %p )] "
+                       "Primary (%s) %s after %ldms: sending hedged request to %s.",
+                       primary, secondary, path, timeout, hedge_delay, answer, result,
+                       primary->hostname, ( req[0].active ? "still pending" : "failed" ), elapsed, secondary->hostname
+            );
+        }
+
+        if( ( req[i].curl = ctune_NetworkUtils_createHandle( req[i].host, path, timeout, NULL, NULL, &req[i].buffer, &req[i].headers ) ) != NULL ) {
+            curl_multi_add_handle( multi, req[i].curl );
+            req[i].active = true;
+        }
+    }
+
+    while( winner < 0 && ( req[0].active || req[1].active ) ) { //race the remaining transfers
+        int       running = 0;
+        CURLMsg * msg     = NULL;
+        int       queued  = 0;
+
+        curl_multi_perform( multi, &running );
+
+        while( ( msg = curl_multi_info_read( multi, &queued ) ) != NULL ) {
+            if( msg->msg == CURLMSG_DONE ) {
+                const int i = ( msg->easy_handle == req[0].curl ? 0 : 1 );
+
+                curl_easy_getinfo( msg->easy_handle, CURLINFO_RESPONSE_CODE, &req[i].http_code );
+                req[i].active = false;
+                req[i].failed = ( msg->data.result != CURLE_OK || req[i].http_code != 200 );
+
+                if( winner < 0 && !req[i].failed ) {
+                    winner = i;
+                }
+            }
+        }
+
+        if( winner < 0 && ( req[0].active || req[1].active ) ) {
+            curl_multi_poll( multi, NULL, 0, 1000, NULL );
+        }
+    }
+
+    const bool aborted = ctune_NetworkUtils.abortRequested();
+
+    for( int i = 0; i < 2; ++i ) {
+        if( req[i].curl == NULL ) {
+            continue;
+        }
+
+        if( aborted ) { //a cancelled transfer says nothing about the mirror
+            req[i].http_code = 0;
+
+        } else if( req[i].active ) { //cancelled: not a success nor a failure but it took at least as long as the winner
+            struct timespec now;
+            clock_gettime( CLOCK_MONOTONIC, &now );
+
+            ctune_MirrorStats.recordLatencyBound( req[i].host->hostname,
+                                                  (double) ( now.tv_sec - start.tv_sec ) * 1000.0 + (double) ( now.tv_nsec - start.tv_nsec ) / 1000000.0 );
+            req[i].http_code = 0;
+
+        } else {
+            double total_time = 0;
+            curl_easy_getinfo( req[i].curl, CURLINFO_TOTAL_TIME, &total_time );
+            ctune_MirrorStats.recordRequest( req[i].host->hostname, ( total_time * 1000 ), !req[i].failed );
+
+            if( req[i].failed ) {
+                CTUNE_LOG( CTUNE_LOG_ERROR,
+                           "[ctune_NetworkUtils_curlHedgedFetch( %p, %p, \"%s\", %ld, %ld, %p, %p )] Failed to fetch on %s: HTTP code %ld",
+                           primary, secondary, path, timeout, hedge_delay, answer, result, req[i].host->hostname, req[i].http_code
+                );
+
+                last_code = req[i].http_code;
+            }
+        }
+
+        curl_multi_remove_handle( multi, req[i].curl );
+        curl_easy_cleanup( req[i].curl );
+        curl_slist_free_all( req[i].headers );
+    }
+
+    if( winner >= 0 ) {
+        String.free( answer );
+        *answer            = req[winner].buffer; //move ownership
+        req[winner].buffer = String.init();
+        last_code          = 200;
+
+        CTUNE_LOG( CTUNE_LOG_TRACE,
+                   "[ctune_NetworkUtils_curlHedgedFetch( %p, %p, \"%s\", %ld, %ld, %p, %p )] Answer from %s (%s).",
+                   primary, secondary, path, timeout, hedge_delay, answer, result,
+                   req[winner].host->hostname, ( hedged ? "hedged" : "not hedged" )
+        );
+
+    } else if( aborted ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_NetworkUtils_curlHedgedFetch( %p, %p, \"%s\", %ld, %ld, %p, %p )] Transfer cancelled.",
+                   primary, secondary, path, timeout, hedge_delay, answer, result
+        );
+
+        last_code = 0;
+
+    } else {
+        ctune_err.set( CTUNE_ERR_HTTP_GET );
+    }
+
+    end:
+        if( result ) {
+            result->responder    = ( winner >= 0 ? req[winner].host : NULL );
+            result->http_code[0] = req[0].http_code;
+            result->http_code[1] = req[1].http_code;
+            result->failed[0]    = req[0].failed;
+            result->failed[1]    = req[1].failed;
+        }
+
+        curl_multi_cleanup( multi );
+        String.free( &req[0].buffer );
+        String.free( &req[1].buffer );
+        return last_code;
+}
+
+/**
+ * Curl fetch over HTTPS through the response cache
+ * -
+ * Fresh cached responses are returned without network access. Stale ones are revalidated with
+ * a conditional request ('If-None-Match'/'If-Modified-Since') and re-used on a '304 Not Modified'.
+ *
+ * @param host    Host information
+ * @param path    Path (including query; used as the host-independent cache key)
+ * @param timeout Socket timeout value to use (seconds)
+ * @param ttl     Time-to-live (seconds) to give the cached response
+ * @param answer  String container for the data fetched
+ * @return HTTP code (200 when served from the cache)
+ */
+static long ctune_NetworkUtils_curlCachedFetch( const ServerListNode * host, const char * path, long timeout, long ttl, struct String * answer ) {
+    long                            http_code = 0;
+    ctune_ResponseCache_Entry_t     cached;
+    ctune_NetworkUtils_Validators_t received  = { .etag = String.init(), .last_modified = String.init() };
+
+    ctune_ResponseCache.initEntry( &cached );
+
+    const ctune_ResponseCache_State_e state = ctune_ResponseCache.lookup( path, &cached );
+
+    if( state == CTUNE_RESPONSECACHE_FRESH ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_NetworkUtils_curlCachedFetch( %p, \"%s\", %ld, %ld, %p )] Served from cache.",
+                   host, path, timeout, ttl, answer
+        );
+
+        String.set( answer, cached.body._raw );
+        http_code = 200;
+        goto end;
+    }
+
+    if( state == CTUNE_RESPONSECACHE_STALE ) {
+        const ctune_NetworkUtils_Validators_t conditions = { .etag = cached.etag, .last_modified = cached.last_modified };
+
+        http_code = ctune_NetworkUtils_curlFetch( host, path, timeout, &conditions, &received, answer );
+
+    } else {
+        http_code = ctune_NetworkUtils_curlFetch( host, path, timeout, NULL, &received, answer );
+    }
+
+    if( http_code == 304 && state == CTUNE_RESPONSECACHE_STALE ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG,
+                   "[ctune_NetworkUtils_curlCachedFetch( %p, \"%s\", %ld, %ld, %p )] Cached response revalidated.",
+                   host, path, timeout, ttl, answer
+        );
+
+        ctune_ResponseCache.revalidate( path, ttl );
+        String.set( answer, cached.body._raw );
+        http_code = 200;
+
+    } else if( http_code == 200 && answer->_raw != NULL ) {
+        ctune_ResponseCache.store( path, answer->_raw, received.etag._raw, received.last_modified._raw, ttl );
+    }
+
+    end:
+        ctune_ResponseCache.freeEntry( &cached );
+        String.free( &received.etag );
+        String.free( &received.last_modified );
+        return http_code;
+}
+
+/**
+ * Gets a response from the cache
+ * @param path        Path (including query) of the request
+ * @param allow_stale Flag to accept an expired response (e.g. when all servers are unreachable)
+ * @param answer      String container for the cached data
+ * @return Success (false if not cached or expired when `allow_stale` is false)
+ */
+static bool ctune_NetworkUtils_cachedResponse( const char * path, bool allow_stale, struct String * answer ) {
+    bool                        found = false;
+    ctune_ResponseCache_Entry_t cached;
+
+    ctune_ResponseCache.initEntry( &cached );
+
+    const ctune_ResponseCache_State_e state = ctune_ResponseCache.lookup( path, &cached );
+
+    if( state == CTUNE_RESPONSECACHE_FRESH || ( allow_stale && state == CTUNE_RESPONSECACHE_STALE ) ) {
+        found = String.set( answer, cached.body._raw );
+    }
+
+    ctune_ResponseCache.freeEntry( &cached );
+
+    return found;
+}
+
 /**
  * Validates a URL
  * @param url URL string
@@ -199,8 +692,29 @@ static bool ctune_NetworkUtils_validateURL( const char * url ) {
     return is_valid;
 }
 
+/**
+ * [THREAD LOCAL] Sets the flag checked by the transfers of the calling thread to abort early
+ * @param flag Pointer to the abort flag (NULL to unset)
+ */
+static void ctune_NetworkUtils_setAbortFlag( const atomic_bool * flag ) {
+    abort_flag = flag;
+}
+
+/**
+ * [THREAD LOCAL] Checks if the transfers of the calling thread were asked to abort
+ * @return Abort request state
+ */
+static bool ctune_NetworkUtils_abortRequested( void ) {
+    return ( abort_flag != NULL && atomic_load( abort_flag ) );
+}
+
 ctune_NetworkUtils_Namespace const ctune_NetworkUtils = {
     .nslookup        = &ctune_NetworkUtils_nslookup,
     .curlSecureFetch = &ctune_NetworkUtils_curlSecureFetch,
+    .curlHedgedFetch = &ctune_NetworkUtils_curlHedgedFetch,
+    .curlCachedFetch = &ctune_NetworkUtils_curlCachedFetch,
+    .cachedResponse  = &ctune_NetworkUtils_cachedResponse,
     .validateURL     = &ctune_NetworkUtils_validateURL,
+    .setAbortFlag    = &ctune_NetworkUtils_setAbortFlag,
+    .abortRequested  = &ctune_NetworkUtils_abortRequested,
 };
\ No newline at end of file
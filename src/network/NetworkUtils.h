@@ -2,11 +2,25 @@
 #define CTUNE_NETWORK_NETWORKUTILS_H
 
 #include <netdb.h>
+#include <stdatomic.h>
 
 #include "../datastructure/StrList.h"
 #include "../datastructure/ServerList.h"
 #include "../datastructure/String.h"
 
+/**
+ * Outcome of a hedged request
+ * @param responder Host that provided the answer (NULL if none did)
+ * @param http_code HTTP code per host ([0]: primary, [1]: secondary; 0 when not sent, cancelled or unreachable)
+ * @param failed    Failure flag per host (request completed without a usable answer)
+ */
+typedef struct ctune_NetworkUtils_HedgeResult {
+    const ServerListNode * responder;
+    long                   http_code[2];
+    bool                   failed[2];
+
+} ctune_NetworkUtils_HedgeResult_t;
+
 typedef struct {
     /**
      * NS lookup on a hostname
@@ -26,6 +40,39 @@ typedef struct {
      */
     long (* curlSecureFetch)( const ServerListNode * host, const char * path, long timeout, struct String * answer );
 
+    /**
+     * Curl fetch over HTTPS with a hedged request to a second host when the first is slow or fails
+     * @param primary     Primary host information
+     * @param secondary   Secondary host information (can be NULL)
+     * @param path        Path
+     * @param timeout     Socket timeout value to use (seconds)
+     * @param hedge_delay Time to wait for the primary host before sending the hedged request (milliseconds)
+     * @param answer      String container for the data fetched
+     * @param result      Container for the per-host outcome (can be NULL)
+     * @return HTTP code of the answer used (or of the last failure)
+     */
+    long (* curlHedgedFetch)( const ServerListNode * primary, const ServerListNode * secondary, const char * path, long timeout, long hedge_delay, struct String * answer, ctune_NetworkUtils_HedgeResult_t * result );
+
+    /**
+     * Curl fetch over HTTPS through the response cache
+     * @param host    Host information
+     * @param path    Path (including query; used as the host-independent cache key)
+     * @param timeout Socket timeout value to use (seconds)
+     * @param ttl     Time-to-live (seconds) to give the cached response
+     * @param answer  String container for the data fetched
+     * @return HTTP code (200 when served from the cache)
+     */
+    long (* curlCachedFetch)( const ServerListNode * host, const char * path, long timeout, long ttl, struct String * answer );
+
+    /**
+     * Gets a response from the cache
+     * @param path        Path (including query) of the request
+     * @param allow_stale Flag to accept an expired response (e.g. when all servers are unreachable)
+     * @param answer      String container for the cached data
+     * @return Success (false if not cached or expired when `allow_stale` is false)
+     */
+    bool (* cachedResponse)( const char * path, bool allow_stale, struct String * answer );
+
     /**
      * Validates a URL
      * @param url URL string
@@ -33,6 +80,18 @@ typedef struct {
      */
     bool (* validateURL)( const char * url );
 
+    /**
+     * [THREAD LOCAL] Sets the flag checked by the transfers of the calling thread to abort early
+     * @param flag Pointer to the abort flag (NULL to unset)
+     */
+    void (* setAbortFlag)( const atomic_bool * flag );
+
+    /**
+     * [THREAD LOCAL] Checks if the transfers of the calling thread were asked to abort
+     * @return Abort request state
+     */
+    bool (* abortRequested)( void );
+
 } ctune_NetworkUtils_Namespace;
 
 extern ctune_NetworkUtils_Namespace const ctune_NetworkUtils;
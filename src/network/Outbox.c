@@ -0,0 +1,462 @@
+#include "Outbox.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "logger/src/Logger.h"
+#include "../ctune_err.h"
+#include "../datastructure/String.h"
+#include "../fs/XDG.h"
+#include "NetworkUtils.h"
+
+/**
+ * [PRIVATE] Outbox variables
+ * @param lock     Lock guarding the queue
+ * @param changed  Condition signalled when an item is queued or the sender stops
+ * @param sender   Sender thread
+ * @param started  Sender thread started flag
+ * @param running  Running state of the sender
+ * @param abort    Abort flag for the in-flight delivery
+ * @param items    Queued items in order of submission
+ * @param count    Number of queued items
+ * @param dirty    Flag for when the queue differs from what was persisted
+ * @param revision Change counter of the queue (to spot changes made while the lock was released)
+ * @param snapshot Copy of the queue being persisted (sender thread only)
+ * @param send     Delivery method
+ */
+static struct {
+    pthread_mutex_t     lock;
+    pthread_cond_t      changed;
+    pthread_t           sender;
+    bool                started;
+    bool                running;
+    atomic_bool         abort;
+    ctune_Outbox_Item_t items[CTUNE_OUTBOX_MAX_ITEMS];
+    size_t              count;
+    bool                dirty;
+    size_t              revision;
+    ctune_Outbox_Item_t snapshot[CTUNE_OUTBOX_MAX_ITEMS];
+    bool             (* send)( const ctune_Outbox_Item_t * item, ctune_ServerList_t * servers );
+
+} outbox = {
+    .lock     = PTHREAD_MUTEX_INITIALIZER,
+    .changed  = PTHREAD_COND_INITIALIZER,
+    .started  = false,
+    .running  = false,
+    .abort    = false,
+    .count    = 0,
+    .dirty    = false,
+    .revision = 0,
+    .send     = NULL,
+};
+
+/**
+ * [PRIVATE] Gets the string representation of an action
+ * @param action Request type
+ * @return String
+ */
+static const char * ctune_Outbox_actionStr( ctune_Outbox_Action_e action ) {
+    switch( action ) {
+        case CTUNE_OUTBOX_CLICK: return "click";
+        case CTUNE_OUTBOX_VOTE : return "vote";
+        default                : return "?";
+    }
+}
+
+/**
+ * [PRIVATE] Removes an item from the queue (lock must be held)
+ * @param i Item index
+ */
+static void ctune_Outbox_remove( size_t i ) {
+    memmove( &outbox.items[i], &outbox.items[ i + 1 ], ( outbox.count - i - 1 ) * sizeof( ctune_Outbox_Item_t ) );
+    --outbox.count;
+    ++outbox.revision;
+    outbox.dirty = true;
+}
+
+/**
+ * [PRIVATE] Gets the retry delay after a number of failed attempts
+ * @param attempts Number of failed delivery attempts
+ * @return Delay in seconds
+ */
+static time_t ctune_Outbox_retryDelay( unsigned attempts ) {
+    time_t delay = CTUNE_OUTBOX_RETRY_DELAY;
+
+    while( attempts-- > 1 && delay < CTUNE_OUTBOX_RETRY_MAX ) {
+        delay *= 2;
+    }
+
+    return ( delay < CTUNE_OUTBOX_RETRY_MAX ? delay : CTUNE_OUTBOX_RETRY_MAX );
+}
+
+/**
+ * [PRIVATE] Persists the queue to the cache directory (sender thread only)
+ * -
+ * The lock must be held. It is released while the file is written so that `post(..)` is not held up by the disk.
+ * @return Success
+ */
+static bool ctune_Outbox_save( void ) {
+    bool         error_state = false;
+    String_t     path        = String.init();
+    String_t     tmp_path    = String.init();
+    FILE       * file        = NULL;
+    const size_t count       = outbox.count;
+
+    memcpy( outbox.snapshot, outbox.items, count * sizeof( ctune_Outbox_Item_t ) );
+    outbox.dirty = false; //set again if the write fails or if the queue changes in the meantime
+
+    pthread_mutex_unlock( &outbox.lock );
+
+    ctune_XDG.resolveCacheFilePath( CTUNE_OUTBOX_FILE_NAME, &path );
+
+    if( count == 0 ) { //nothing left to deliver
+        if( unlink( path._raw ) != 0 && errno != ENOENT ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_save()] Failed to remove \"%s\": %s", path._raw, strerror( errno ) );
+            error_state = true;
+        }
+
+        goto end;
+    }
+
+    String.set( &tmp_path, path._raw );
+    String.append_back( &tmp_path, ".tmp" );
+
+    if( ( file = fopen( tmp_path._raw, "w" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_save()] Failed to open \"%s\": %s", tmp_path._raw, strerror( errno ) );
+        error_state = true;
+        goto end;
+    }
+
+    for( size_t i = 0; i < count; ++i ) {
+        const ctune_Outbox_Item_t * item = &outbox.snapshot[i];
+        fprintf( file, "%d %s %lld %u\n", (int) item->action, item->uuid, (long long) item->queued, item->attempts );
+    }
+
+    if( fclose( file ) != 0 || rename( tmp_path._raw, path._raw ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_save()] Failed to write \"%s\".", path._raw );
+        unlink( tmp_path._raw );
+        error_state = true;
+        goto end;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Outbox_save()] %lu undelivered item(s) saved to \"%s\".", count, path._raw );
+
+    end:
+        String.free( &path );
+        String.free( &tmp_path );
+
+        pthread_mutex_lock( &outbox.lock );
+
+        if( error_state ) {
+            outbox.dirty = true;
+        }
+
+        return !( error_state );
+}
+
+/**
+ * [PRIVATE] Loads the items persisted from a previous session (lock must be held)
+ */
+static void ctune_Outbox_load( void ) {
+    String_t     path = String.init();
+    FILE       * file = NULL;
+    const time_t now  = time( NULL );
+
+    ctune_XDG.resolveCacheFilePath( CTUNE_OUTBOX_FILE_NAME, &path );
+
+    if( ( file = fopen( path._raw, "r" ) ) == NULL ) {
+        String.free( &path );
+        return; //EARLY RETURN - nothing was left undelivered
+    }
+
+    while( outbox.count < CTUNE_OUTBOX_MAX_ITEMS ) {
+        ctune_Outbox_Item_t * item   = &outbox.items[ outbox.count ];
+        int                   action = 0;
+        long long             queued = 0;
+
+        memset( item, 0, sizeof( ctune_Outbox_Item_t ) );
+
+        const int ret = fscanf( file, "%d %63s %lld %u", &action, item->uuid, &queued, &item->attempts );
+
+        if( ret == EOF ) {
+            break;
+        }
+
+        if( ret != 4 || action < 0 || action >= CTUNE_OUTBOX_ACTION_COUNT ) {
+            CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_Outbox_load()] Malformed line in \"%s\": remaining lines ignored.", path._raw );
+            break;
+        }
+
+        item->action   = (ctune_Outbox_Action_e) action;
+        item->queued   = (time_t) queued;
+        item->next_try = now; //new session: worth trying again straight away
+
+        if( ( now - item->queued ) <= CTUNE_OUTBOX_MAX_AGE ) {
+            ++outbox.count;
+        }
+    }
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Outbox_load()] %lu undelivered item(s) loaded from \"%s\".", outbox.count, path._raw );
+
+    fclose( file );
+    String.free( &path );
+}
+
+/**
+ * [PRIVATE] Sender thread
+ * @param arg Unused
+ * @return NULL
+ */
+static void * ctune_Outbox_sender( void * arg ) {
+    ctune_ServerList_t  servers = ctune_ServerList.init(); //separate list as mirrors failing are removed from it
+    ctune_Outbox_Item_t batch[CTUNE_OUTBOX_BATCH_SIZE];
+
+    ctune_NetworkUtils.setAbortFlag( &outbox.abort );
+
+    pthread_mutex_lock( &outbox.lock );
+
+    while( outbox.running ) {
+        const time_t now        = time( NULL );
+        time_t       wake_up    = 0;
+        size_t       batch_size = 0;
+
+        for( size_t i = 0; i < outbox.count; ) {
+            ctune_Outbox_Item_t * item = &outbox.items[i];
+
+            if( ( now - item->queued ) > CTUNE_OUTBOX_MAX_AGE ) {
+                CTUNE_LOG( CTUNE_LOG_WARNING,
+                           "[ctune_Outbox_sender( %p )] Dropping expired %s request for station \"%s\" (%u failed attempts).",
+                           arg, ctune_Outbox_actionStr( item->action ), item->uuid, item->attempts
+                );
+
+                ctune_Outbox_remove( i );
+                continue;
+            }
+
+            if( item->next_try <= now ) {
+                if( batch_size < CTUNE_OUTBOX_BATCH_SIZE ) {
+                    batch[ batch_size++ ] = *item;
+                    ctune_Outbox_remove( i );
+                    continue;
+                }
+
+            } else if( wake_up == 0 || item->next_try < wake_up ) {
+                wake_up = item->next_try;
+            }
+
+            ++i;
+        }
+
+        if( batch_size == 0 ) {
+            if( outbox.dirty ) {
+                const size_t revision = outbox.revision;
+
+                ctune_Outbox_save();
+
+                if( outbox.revision != revision ) {
+                    continue; //changed while the file was written (its signal was missed)
+                }
+            }
+
+            if( wake_up == 0 ) {
+                pthread_cond_wait( &outbox.changed, &outbox.lock );
+            } else {
+                struct timespec ts = { .tv_sec = wake_up, .tv_nsec = 0 };
+                pthread_cond_timedwait( &outbox.changed, &outbox.lock, &ts );
+            }
+
+            continue;
+        }
+
+        pthread_mutex_unlock( &outbox.lock );
+
+        size_t sent = 0;
+
+        while( sent < batch_size && !atomic_load( &outbox.abort ) && outbox.send( &batch[ sent ], &servers ) ) {
+            ++sent;
+        }
+
+        pthread_mutex_lock( &outbox.lock );
+
+        if( sent < batch_size && !atomic_load( &outbox.abort ) ) { //delivery failed: probably offline so the rest is deferred too
+            const unsigned attempts = ++batch[ sent ].attempts;
+            const time_t   next_try = time( NULL ) + ctune_Outbox_retryDelay( attempts );
+
+            CTUNE_LOG( CTUNE_LOG_WARNING,
+                       "[ctune_Outbox_sender( %p )] Failed to send %s request for station \"%s\" (attempt #%u): %lu item(s) deferred by %lds.",
+                       arg, ctune_Outbox_actionStr( batch[ sent ].action ), batch[ sent ].uuid, attempts,
+                       ( batch_size - sent ), (long) ( next_try - time( NULL ) )
+            );
+
+            for( size_t i = sent; i < batch_size; ++i ) {
+                batch[i].next_try = next_try;
+            }
+        }
+
+        if( sent < batch_size ) { //re-queued ahead of anything posted in the meantime
+            const size_t requeue = batch_size - sent;
+            const size_t room    = CTUNE_OUTBOX_MAX_ITEMS - outbox.count;
+            const size_t count   = ( requeue < room ? requeue : room );
+
+            memmove( &outbox.items[ count ], &outbox.items[0], outbox.count * sizeof( ctune_Outbox_Item_t ) );
+            memcpy( &outbox.items[0], &batch[ sent ], count * sizeof( ctune_Outbox_Item_t ) );
+            outbox.count += count;
+        }
+
+        ++outbox.revision;
+        outbox.dirty = true;
+    }
+
+    if( outbox.dirty ) {
+        ctune_Outbox_save();
+    }
+
+    pthread_mutex_unlock( &outbox.lock );
+
+    ctune_NetworkUtils.setAbortFlag( NULL );
+    ctune_ServerList.freeServerList( &servers );
+    return NULL;
+}
+
+/**
+ * Loads any items persisted from a previous session and starts the sender thread
+ * @param send Method delivering an item on the sender thread (true: delivered or rejected, false: retry later)
+ * @return Success
+ */
+static bool ctune_Outbox_init( bool (* send)( const ctune_Outbox_Item_t * item, ctune_ServerList_t * servers ) ) {
+    if( send == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_init( %p )] Invalid arg.", send );
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &outbox.lock );
+
+    if( outbox.started ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_init( %p )] Sender already running.", send );
+        pthread_mutex_unlock( &outbox.lock );
+        return false; //EARLY RETURN
+    }
+
+    ctune_Outbox_load();
+
+    outbox.send    = send;
+    outbox.running = true;
+    outbox.dirty   = false;
+    atomic_store( &outbox.abort, false );
+
+    if( pthread_create( &outbox.sender, NULL, ctune_Outbox_sender, NULL ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_init( %p )] Failed to create sender thread.", send );
+        ctune_err.set( CTUNE_ERR_THREAD_CREATE );
+        outbox.running = false;
+    }
+
+    outbox.started = outbox.running;
+
+    pthread_mutex_unlock( &outbox.lock );
+
+    return outbox.started;
+}
+
+/**
+ * [THREAD SAFE] Queues a request (an identical request already queued is not duplicated)
+ * @param action Request type
+ * @param uuid   Station UUID
+ * @return Success
+ */
+static bool ctune_Outbox_post( ctune_Outbox_Action_e action, const char * uuid ) {
+    if( uuid == NULL || strlen( uuid ) == 0 || strlen( uuid ) >= CTUNE_OUTBOX_UUID_SIZE || strpbrk( uuid, " \t\r\n" ) != NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_Outbox_post( %s, \"%s\" )] Invalid station UUID.", ctune_Outbox_actionStr( action ), uuid );
+        return false; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &outbox.lock );
+
+    for( size_t i = 0; i < outbox.count; ++i ) {
+        if( outbox.items[i].action == action && strcmp( outbox.items[i].uuid, uuid ) == 0 ) {
+            pthread_mutex_unlock( &outbox.lock );
+            return true; //EARLY RETURN - already queued
+        }
+    }
+
+    if( outbox.count == CTUNE_OUTBOX_MAX_ITEMS ) {
+        CTUNE_LOG( CTUNE_LOG_WARNING,
+                   "[ctune_Outbox_post( %s, \"%s\" )] Queue full: dropping oldest %s request for station \"%s\".",
+                   ctune_Outbox_actionStr( action ), uuid, ctune_Outbox_actionStr( outbox.items[0].action ), outbox.items[0].uuid
+        );
+
+        ctune_Outbox_remove( 0 );
+    }
+
+    ctune_Outbox_Item_t * item = &outbox.items[ outbox.count++ ];
+
+    item->action   = action;
+    item->queued   = time( NULL );
+    item->next_try = item->queued;
+    item->attempts = 0;
+    strcpy( item->uuid, uuid );
+
+    ++outbox.revision;
+    outbox.dirty = true;
+
+    pthread_cond_signal( &outbox.changed );
+    pthread_mutex_unlock( &outbox.lock );
+
+    return true;
+}
+
+/**
+ * [THREAD SAFE] Gets the number of items waiting to be delivered
+ * @return Number of items
+ */
+static size_t ctune_Outbox_pending( void ) {
+    pthread_mutex_lock( &outbox.lock );
+    const size_t count = outbox.count;
+    pthread_mutex_unlock( &outbox.lock );
+
+    return count;
+}
+
+/**
+ * Stops the sender thread (aborting any in-flight delivery) and persists the undelivered items
+ */
+static void ctune_Outbox_shutdown( void ) {
+    pthread_mutex_lock( &outbox.lock );
+
+    if( !outbox.started ) {
+        pthread_mutex_unlock( &outbox.lock );
+        return; //EARLY RETURN
+    }
+
+    outbox.running = false;
+    atomic_store( &outbox.abort, true );
+
+    pthread_cond_broadcast( &outbox.changed );
+    pthread_mutex_unlock( &outbox.lock );
+
+    pthread_join( outbox.sender, NULL );
+
+    pthread_mutex_lock( &outbox.lock );
+
+    outbox.started = false;
+    outbox.count   = 0;
+    outbox.send    = NULL;
+
+    pthread_mutex_unlock( &outbox.lock );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Outbox_shutdown()] Sender stopped." );
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_Outbox_Instance ctune_Outbox = {
+    .init     = &ctune_Outbox_init,
+    .post     = &ctune_Outbox_post,
+    .pending  = &ctune_Outbox_pending,
+    .shutdown = &ctune_Outbox_shutdown,
+};
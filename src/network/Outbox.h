@@ -0,0 +1,81 @@
+#ifndef CTUNE_NETWORK_OUTBOX_H
+#define CTUNE_NETWORK_OUTBOX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "../datastructure/ServerList.h"
+
+#define CTUNE_OUTBOX_FILE_NAME     "outbox.queue" //file in the XDG cache directory (undelivered items kept across sessions)
+#define CTUNE_OUTBOX_MAX_ITEMS     256            //max number of items queued (the oldest are dropped past that)
+#define CTUNE_OUTBOX_UUID_SIZE     64             //max size of a station UUID (incl. '\0')
+#define CTUNE_OUTBOX_BATCH_SIZE    16             //max number of due items sent per wake-up of the sender
+#define CTUNE_OUTBOX_RETRY_DELAY   15             //in seconds (delay before the 1st retry: doubles on each failure)
+#define CTUNE_OUTBOX_RETRY_MAX     3600           //in seconds (cap on the retry delay)
+#define CTUNE_OUTBOX_MAX_AGE       86400          //in seconds (undelivered items older than that are dropped)
+
+/**
+ * Outbound request types
+ */
+typedef enum {
+    CTUNE_OUTBOX_CLICK = 0, //station click counter
+    CTUNE_OUTBOX_VOTE,      //station vote
+
+    CTUNE_OUTBOX_ACTION_COUNT
+} ctune_Outbox_Action_e;
+
+/**
+ * Outbound request
+ * @param action   Request type
+ * @param uuid     Station UUID
+ * @param queued   Timestamp of when the request was first queued
+ * @param next_try Timestamp of when the next delivery attempt is due
+ * @param attempts Number of failed delivery attempts
+ */
+typedef struct ctune_Outbox_Item {
+    ctune_Outbox_Action_e action;
+    char                  uuid[CTUNE_OUTBOX_UUID_SIZE];
+    time_t                queued;
+    time_t                next_try;
+    unsigned              attempts;
+
+} ctune_Outbox_Item_t;
+
+/**
+ * Fire-and-forget queue for the RadioBrowser requests whose response nothing waits on (click counts, votes)
+ * -
+ * Requests are sent in batches on a background thread. Failed deliveries are retried with an exponential
+ * backoff and the queue is persisted to the cache directory while there are undelivered items so that
+ * these are sent on a later session when offline.
+ */
+extern const struct ctune_Outbox_Instance {
+    /**
+     * Loads any items persisted from a previous session and starts the sender thread
+     * @param send Method delivering an item on the sender thread (true: delivered or rejected, false: retry later)
+     * @return Success
+     */
+    bool (* init)( bool (* send)( const ctune_Outbox_Item_t * item, ctune_ServerList_t * servers ) );
+
+    /**
+     * [THREAD SAFE] Queues a request (an identical request already queued is not duplicated)
+     * @param action Request type
+     * @param uuid   Station UUID
+     * @return Success
+     */
+    bool (* post)( ctune_Outbox_Action_e action, const char * uuid );
+
+    /**
+     * [THREAD SAFE] Gets the number of items waiting to be delivered
+     * @return Number of items
+     */
+    size_t (* pending)( void );
+
+    /**
+     * Stops the sender thread (aborting any in-flight delivery) and persists the undelivered items
+     */
+    void (* shutdown)( void );
+
+} ctune_Outbox;
+
+#endif //CTUNE_NETWORK_OUTBOX_H
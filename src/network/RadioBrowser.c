@@ -8,54 +8,28 @@
 #include "project_version.h"
 #include "logger/src/Logger.h"
 #include "NetworkUtils.h"
+#include "MirrorStats.h"
 #include "../parser/JSON.h"
 #include "../ctune_err.h"
 
 #define CTUNE_RADIOBROWSER_DNS_ADDRESS  "all.api.radio-browser.info"
 #define CTUNE_RADIOBROWSER_SERVICE_PORT "443" //https
-
-/**
- * [PRIVATE] Shuffles a server list
- * @param addr_list Address StrList to randomize
- * @return Success
- */
-static int ctune_RadioBrowser_randomizeServerList( ctune_ServerList_t * addr_list ) {
-    srand( time( NULL ) );
-
-    size_t item_count = ctune_ServerList.size( addr_list );
-
-    for( size_t k = item_count; k > 0; --k ) {
-        int pick = rand() % k;
-
-        ServerListNode * node = ctune_ServerList.at( addr_list, pick );
-
-        if( node == NULL ) {
-            CTUNE_LOG( CTUNE_LOG_ERROR,
-                       "[ctune_RadioBrowser_randomizeServerList( %p )] "
-                       "Randomised index pick returns NULL (i=%i, k=%i)",
-                       addr_list, pick, k
-            );
-
-            return false;
-        }
-
-        node = ctune_ServerList.extract_node( addr_list, node );
-        ctune_ServerList.emplace_back( addr_list, node );
-    }
-
-    return true;
-}
+#define CTUNE_RADIOBROWSER_TTL_NONE     0                //no response caching
+#define CTUNE_RADIOBROWSER_TTL_STATS    ( 10 * 60 )      //in seconds
+#define CTUNE_RADIOBROWSER_TTL_CONFIG   ( 24 * 60 * 60 ) //in seconds
+#define CTUNE_RADIOBROWSER_TTL_CATEGORY ( 6 * 60 * 60 )  //in seconds
 
 /**
  * [PRIVATE] Download relevant data pertaining to a query
  * @param addr_list  List of available API servers for querying
  * @param timeout    Socket timeout value to use (seconds)
  * @param path       File path to get the data from
- * @param param      File path parameters
+ * @param ttl        Time-to-live (seconds) of the cached response (`CTUNE_RADIOBROWSER_TTL_NONE` to bypass the response cache)
+ * @param hedge      Flag allowing a duplicate request to the next mirror when the first is slow (idempotent queries only)
  * @param rcv_buffer String to store the response to the query into
  * @return Success
  */
-static bool ctune_RadioBrowser_downloadRadioBrowserData( ctune_ServerList_t * addr_list, int timeout, const char * path, String_t * rcv_buffer ) {
+static bool ctune_RadioBrowser_downloadRadioBrowserData( ctune_ServerList_t * addr_list, int timeout, const char * path, long ttl, bool hedge, String_t * rcv_buffer ) {
     CTUNE_LOG( CTUNE_LOG_TRACE,
                "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] Attempting to download data...",
                addr_list, path, rcv_buffer
@@ -70,28 +44,67 @@ static bool ctune_RadioBrowser_downloadRadioBrowserData( ctune_ServerList_t * ad
         return false;
     }
 
+    if( ttl > 0 && ctune_NetworkUtils.cachedResponse( path, false, rcv_buffer ) ) {
+        CTUNE_LOG( CTUNE_LOG_TRACE,
+                   "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] Served from the response cache.",
+                   addr_list, path, rcv_buffer
+        );
+
+        return true; //EARLY RETURN
+    }
+
     if( ctune_ServerList.size( addr_list ) == 0 ) {
         if( !ctune_NetworkUtils.nslookup( CTUNE_RADIOBROWSER_DNS_ADDRESS, CTUNE_RADIOBROWSER_SERVICE_PORT, addr_list ) ) {
-            return false;
+            return ( ttl > 0 && ctune_NetworkUtils.cachedResponse( path, true, rcv_buffer ) );
         }
-
-        ctune_RadioBrowser_randomizeServerList( addr_list );
     }
 
+    ctune_MirrorStats.rank( addr_list ); //fastest healthy mirror first
+
     ServerListNode * curr_srv      = addr_list->_front;
+    const char     * responder     = NULL;
     bool             fetch_success = false;
     long             http_code     = 0;
 
     while( !fetch_success && curr_srv ) {
-        http_code     = ctune_NetworkUtils.curlSecureFetch( curr_srv, path, timeout, rcv_buffer );
+        ServerListNode                 * next_srv = ( hedge ? curr_srv->next : NULL );
+        ctune_NetworkUtils_HedgeResult_t result   = { .responder = NULL, .http_code = { 0, 0 }, .failed = { false, false } };
+
+        String.free( rcv_buffer ); //drop any partial response from a previous server
+
+        if( ttl > 0 ) {
+            http_code = ctune_NetworkUtils.curlCachedFetch( curr_srv, path, timeout, ttl, rcv_buffer );
+
+        } else if( next_srv ) {
+            http_code = ctune_NetworkUtils.curlHedgedFetch( curr_srv, next_srv, path, timeout, ctune_MirrorStats.hedgeDelay( curr_srv->hostname ), rcv_buffer, &result );
+
+        } else {
+            http_code = ctune_NetworkUtils.curlSecureFetch( curr_srv, path, timeout, rcv_buffer );
+        }
+
         fetch_success = ( http_code == 200 );
 
-        if( !fetch_success ) {
+        if( fetch_success ) {
+            responder = ( result.responder ? result.responder->hostname : curr_srv->hostname );
+
+        } else if( ctune_NetworkUtils.abortRequested() ) {
+            CTUNE_LOG( CTUNE_LOG_DEBUG,
+                       "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] Download cancelled.",
+                       addr_list, path, rcv_buffer
+            );
+
+            return false; //EARLY RETURN - the mirror is not at fault so it stays in the list
+
+        } else {
             CTUNE_LOG( CTUNE_LOG_ERROR,
                        "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] Failed to fetch data on %s: HTTP %ld",
                        addr_list, path, rcv_buffer, curr_srv->hostname, http_code
             );
 
+            if( next_srv && result.failed[1] ) { //hedged request failed too
+                ctune_ServerList.remove( addr_list, next_srv );
+            }
+
             curr_srv = ctune_ServerList.remove( addr_list, curr_srv );
         }
     }
@@ -102,13 +115,22 @@ static bool ctune_RadioBrowser_downloadRadioBrowserData( ctune_ServerList_t * ad
                    addr_list, path, rcv_buffer
         );
 
+        if( ttl > 0 && ctune_NetworkUtils.cachedResponse( path, true, rcv_buffer ) ) {
+            CTUNE_LOG( CTUNE_LOG_WARNING,
+                       "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] Falling back to an expired cached response.",
+                       addr_list, path, rcv_buffer
+            );
+
+            return true; //EARLY RETURN
+        }
+
         return false;
     }
 
     if( String.empty( rcv_buffer ) ) {
         CTUNE_LOG( CTUNE_LOG_WARNING,
                    "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] No data returned from %s",
-                   addr_list, path, rcv_buffer, rcv_buffer->_raw, curr_srv->hostname
+                   addr_list, path, rcv_buffer, responder
         );
 
         return false;
@@ -116,7 +138,7 @@ static bool ctune_RadioBrowser_downloadRadioBrowserData( ctune_ServerList_t * ad
 
     CTUNE_LOG( CTUNE_LOG_TRACE,
                "[ctune_RadioBrowser_downloadRadioBrowserData( %p, \"%s\", %p )] Download successful on %s",
-               addr_list, path, rcv_buffer, curr_srv->hostname
+               addr_list, path, rcv_buffer, responder
     );
 
     return true;
@@ -133,7 +155,7 @@ static bool ctune_RadioBrowser_downloadServerStats( ctune_ServerList_t * addr_li
     static const char * path = "/json/stats";
 
     struct String rcv_buff = String.init();
-    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, path, &rcv_buff );
+    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, path, CTUNE_RADIOBROWSER_TTL_STATS, true, &rcv_buff );
     bool          parse_ok = true;
 
     if( dwl_ok ) {
@@ -170,7 +192,7 @@ static bool ctune_RadioBrowser_downloadServerConfig( ctune_ServerList_t * addr_l
     static const char * path = "/json/config";
 
     struct String rcv_buff = String.init();
-    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, path, &rcv_buff );
+    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, path, CTUNE_RADIOBROWSER_TTL_CONFIG, true, &rcv_buff );
     bool          parse_ok = true;
 
     if( dwl_ok ) {
@@ -226,7 +248,7 @@ static bool ctune_RadioBrowser_downloadStations(
         String.free( &filter_str );
     }
 
-    bool dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, &rcv_buff );
+    bool dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_NONE, true, &rcv_buff );
     bool parse_ok = true;
 
     if( dwl_ok ) {
@@ -285,7 +307,7 @@ static bool ctune_RadioBrowser_downloadCategoryItems(
         String.free( &filter_str );
     }
 
-    bool dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, &rcv_buff );
+    bool dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_CATEGORY, true, &rcv_buff );
     bool parse_ok = true;
 
     if( dwl_ok ) {
@@ -335,7 +357,7 @@ static bool ctune_RadioBrowser_increaseClickCounter( ctune_ServerList_t * addr_l
     String.append_back( &final_uri, station_uuid );
 
     struct String rcv_buff = String.init();
-    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, &rcv_buff );
+    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_NONE, false, &rcv_buff );
     bool          parse_ok = true;
 
     if( dwl_ok ) {
@@ -393,7 +415,7 @@ static bool ctune_RadioBrowser_downloadStationsBy(
     }
 
     struct String rcv_buff = String.init();
-    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, &rcv_buff );
+    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_NONE, true, &rcv_buff );
     bool          parse_ok = true;
 
     if( dwl_ok ) {
@@ -421,6 +443,49 @@ static bool ctune_RadioBrowser_downloadStationsBy(
     return ( dwl_ok && parse_ok );
 }
 
+/**
+ * Download radio station information for a batch of stations in one request
+ * @param addr_list      List of available source servers
+ * @param timeout        Socket timeout value to use (seconds)
+ * @param uuids          Comma separated list of station UUIDs
+ * @param radio_stations Data-structure to store the RadioStationInfo DTOs into (stations not found are omitted)
+ * @return Success
+ */
+static bool ctune_RadioBrowser_downloadStationsByUUIDs( ctune_ServerList_t * addr_list, int timeout, const char * uuids, Vector_t * radio_stations ) {
+    static const char * base_path = "/json/stations/byuuid?uuids=";
+
+    struct String final_uri = String.init();
+    String.append_back( &final_uri, base_path );
+    String.append_back( &final_uri, uuids );
+
+    struct String rcv_buff = String.init();
+    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_NONE, true, &rcv_buff );
+    bool          parse_ok = true;
+
+    if( dwl_ok ) {
+        if( !( parse_ok = ctune_parser_JSON.parseToRadioStationListFrom( &rcv_buff, CTUNE_STATIONSRC_RADIOBROWSER, radio_stations ) ) ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_RadioBrowser_downloadStationsByUUIDs( %p, %i, %p, %p )] Error parsing data (uri=\"%s\").",
+                       addr_list, timeout, uuids, radio_stations, final_uri._raw
+            );
+            CTUNE_LOG( CTUNE_LOG_TRACE,
+                       "[ctune_RadioBrowser_downloadStationsByUUIDs( %p, %i, %p, %p )] rcv_buff:\n%s",
+                       addr_list, timeout, uuids, radio_stations, ( String.empty( &rcv_buff ) ? "\"\"" : rcv_buff._raw )
+            );
+        }
+    } else {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_RadioBrowser_downloadStationsByUUIDs( %p, %i, %p, %p )] Error downloading data (uri=\"%s\").",
+                   addr_list, timeout, uuids, radio_stations, final_uri._raw
+        );
+    }
+
+    String.free( &rcv_buff );  //free buffer String
+    String.free( &final_uri ); //free constructed URI String
+
+    return ( dwl_ok && parse_ok );
+}
+
 /**
  * Cast a vote for a radio station
  * @param addr_list    List of available source servers
@@ -437,7 +502,7 @@ static bool ctune_RadioBrowser_voteForStation( ctune_ServerList_t * addr_list, i
     String.append_back( &final_uri, station_uuid );
 
     struct String rcv_buff = String.init();
-    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, &rcv_buff );
+    bool          dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_NONE, false, &rcv_buff );
     bool          parse_ok = true;
 
     if( dwl_ok ) {
@@ -487,7 +552,7 @@ static bool ctune_RadioBrowser_addNewStation( ctune_ServerList_t * addr_list, in
         String.free( &station_str );
     }
 
-    bool dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, &rcv_buff );
+    bool dwl_ok   = ctune_RadioBrowser_downloadRadioBrowserData( addr_list, timeout, final_uri._raw, CTUNE_RADIOBROWSER_TTL_NONE, false, &rcv_buff );
     bool parse_ok = true;
 
     if( dwl_ok ) {
@@ -513,14 +578,33 @@ static bool ctune_RadioBrowser_addNewStation( ctune_ServerList_t * addr_list, in
     return ( dwl_ok && parse_ok );
 }
 
+/**
+ * Resolves the API mirrors and probes their latency so that the fastest get queried first
+ * @param timeout Probe timeout value to use (seconds)
+ * @return Number of mirrors that responded
+ */
+static size_t ctune_RadioBrowser_probeServers( int timeout ) {
+    ctune_ServerList_t servers   = ctune_ServerList.init();
+    size_t             responded = 0;
+
+    if( ctune_NetworkUtils.nslookup( CTUNE_RADIOBROWSER_DNS_ADDRESS, CTUNE_RADIOBROWSER_SERVICE_PORT, &servers ) ) {
+        responded = ctune_MirrorStats.probe( &servers, ( (long) timeout * 1000 ) );
+    }
+
+    ctune_ServerList.freeServerList( &servers );
+
+    return responded;
+}
 
 ctune_RadioBrowser_Namespace const ctune_RadioBrowser = {
-    .downloadServerStats   = &ctune_RadioBrowser_downloadServerStats,
-    .downloadServerConfig  = &ctune_RadioBrowser_downloadServerConfig,
-    .downloadStations      = &ctune_RadioBrowser_downloadStations,
-    .downloadCategoryItems = &ctune_RadioBrowser_downloadCategoryItems,
-    .stationClickCounter   = &ctune_RadioBrowser_increaseClickCounter,
-    .downloadStationsBy    = &ctune_RadioBrowser_downloadStationsBy,
-    .voteForStation        = &ctune_RadioBrowser_voteForStation,
-    .addNewStation         = &ctune_RadioBrowser_addNewStation
+    .downloadServerStats     = &ctune_RadioBrowser_downloadServerStats,
+    .downloadServerConfig    = &ctune_RadioBrowser_downloadServerConfig,
+    .downloadStations        = &ctune_RadioBrowser_downloadStations,
+    .downloadCategoryItems   = &ctune_RadioBrowser_downloadCategoryItems,
+    .stationClickCounter     = &ctune_RadioBrowser_increaseClickCounter,
+    .downloadStationsBy      = &ctune_RadioBrowser_downloadStationsBy,
+    .downloadStationsByUUIDs = &ctune_RadioBrowser_downloadStationsByUUIDs,
+    .voteForStation          = &ctune_RadioBrowser_voteForStation,
+    .addNewStation           = &ctune_RadioBrowser_addNewStation,
+    .probeServers            = &ctune_RadioBrowser_probeServers,
 };
\ No newline at end of file
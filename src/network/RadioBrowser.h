@@ -78,6 +78,16 @@ typedef struct {
      */
     bool (* downloadStationsBy)( ctune_ServerList_t * addr_list, int timeout, const ctune_ByCategory_e category, const char * search_term, Vector_t * radio_stations );
 
+    /**
+     * Download radio station information for a batch of stations in one request
+     * @param addr_list      List of available source servers
+     * @param timeout        Socket timeout value to use (seconds)
+     * @param uuids          Comma separated list of station UUIDs
+     * @param radio_stations Data-structure to store the RadioStationInfo DTOs into (stations not found are omitted)
+     * @return Success
+     */
+    bool (* downloadStationsByUUIDs)( ctune_ServerList_t * addr_list, int timeout, const char * uuids, Vector_t * radio_stations );
+
     /**
      * Cast a vote for a radio station
      * @param addr_list    List of available source servers
@@ -97,6 +107,13 @@ typedef struct {
      */
     bool (* addNewStation)( ctune_ServerList_t * addr_list, int timeout, ctune_NewRadioStation_t * new_station );
 
+    /**
+     * Resolves the API mirrors and probes their latency so that the fastest get queried first
+     * @param timeout Probe timeout value to use (seconds)
+     * @return Number of mirrors that responded
+     */
+    size_t (* probeServers)( int timeout );
+
 } ctune_RadioBrowser_Namespace;
 
 extern ctune_RadioBrowser_Namespace const ctune_RadioBrowser;
@@ -0,0 +1,538 @@
+#include "ResponseCache.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "logger/src/Logger.h"
+#include "../fs/XDG.h"
+#include "../fs/fs.h"
+#include "../utils/utilities.h"
+
+#define CTUNE_RESPONSECACHE_FILE_MAGIC "CTRC1"
+
+/**
+ * Private vars
+ */
+static struct {
+    pthread_mutex_t             lock;
+    bool                        dir_resolved;
+    String_t                    dir_path;
+    ctune_ResponseCache_Entry_t memory[CTUNE_RESPONSECACHE_MEMORY_CAPACITY];
+    size_t                      memory_size; //total size (bytes) of the bodies held in memory
+    uint64_t                    tick;
+
+} cache = {
+    .lock         = PTHREAD_MUTEX_INITIALIZER,
+    .dir_resolved = false,
+    .dir_path     = { ._raw = NULL, ._length = 0 }, //i.e. String.init()
+    .memory_size  = 0,
+    .tick         = 0,
+};
+
+/**
+ * [PRIVATE] Checks if an entry is still within its time-to-live
+ * @param entry Pointer to ctune_ResponseCache_Entry_t object
+ * @param now   Current timestamp
+ * @return Freshness
+ */
+static bool ctune_ResponseCache_isFresh( const ctune_ResponseCache_Entry_t * entry, time_t now ) {
+    return ( entry->stored <= now && ( now - entry->stored ) < entry->ttl );
+}
+
+/**
+ * [PRIVATE] Copies an entry's content into another
+ * @param from Source entry
+ * @param to   Target entry
+ */
+static void ctune_ResponseCache_copyEntry( const ctune_ResponseCache_Entry_t * from, ctune_ResponseCache_Entry_t * to ) {
+    String.set( &to->key, ctune_fallbackStr( from->key._raw, "" ) );
+    String.set( &to->body, ctune_fallbackStr( from->body._raw, "" ) );
+    String.set( &to->etag, ctune_fallbackStr( from->etag._raw, "" ) );
+    String.set( &to->last_modified, ctune_fallbackStr( from->last_modified._raw, "" ) );
+    to->stored    = from->stored;
+    to->ttl       = from->ttl;
+    to->last_used = from->last_used;
+}
+
+/**
+ * [PRIVATE] Resolves the file path of a cached response (the directory is created on first call)
+ * @param key  Request key
+ * @param path String to store the path into
+ * @return Success
+ */
+static bool ctune_ResponseCache_resolveFilePath( const char * key, String_t * path ) {
+    char file_name[32];
+
+    if( !cache.dir_resolved ) {
+        ctune_XDG.resolveCacheFilePath( CTUNE_RESPONSECACHE_DIR_NAME, &cache.dir_path );
+        cache.dir_resolved = ctune_fs.createDirectory( &cache.dir_path );
+
+        if( !cache.dir_resolved ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_ResponseCache_resolveFilePath( \"%s\", %p )] Failed to create cache directory \"%s\".",
+                       key, path, cache.dir_path._raw
+            );
+
+            return false; //EARLY RETURN
+        }
+    }
+
+    snprintf( file_name, sizeof( file_name ), "%016" PRIx64 ".rsp", ctune_fnvHash( key ) );
+
+    String.set( path, cache.dir_path._raw );
+    String.append_back( path, file_name );
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Reads a fixed number of bytes from a file into a String
+ * @param file   File
+ * @param length Number of bytes to read
+ * @param str    String to store the bytes into
+ * @return Success
+ */
+static bool ctune_ResponseCache_readField( FILE * file, size_t length, String_t * str ) {
+    char * buffer = malloc( length + 1 );
+
+    if( buffer == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    if( length > 0 && fread( buffer, 1, length, file ) != length ) {
+        free( buffer );
+        return false; //EARLY RETURN
+    }
+
+    buffer[length] = '\0';
+
+    String.free( str );
+    str->_raw    = buffer;
+    str->_length = length;
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Loads a cached response from the disk tier
+ * @param key   Request key
+ * @param entry Initialised entry to load the response into
+ * @return Success (false when not found or invalid)
+ */
+static bool ctune_ResponseCache_readFile( const char * key, ctune_ResponseCache_Entry_t * entry ) {
+    bool      error_state = false;
+    String_t  path        = String.init();
+    FILE    * file        = NULL;
+    char      magic[8]    = { 0 };
+    long long stored      = 0;
+    long      ttl         = 0;
+    size_t    key_len     = 0;
+    size_t    etag_len    = 0;
+    size_t    lmod_len    = 0;
+    size_t    body_len    = 0;
+
+    if( !ctune_ResponseCache_resolveFilePath( key, &path ) ) {
+        error_state = true;
+        goto end;
+    }
+
+    if( ( file = fopen( path._raw, "rb" ) ) == NULL ) {
+        error_state = true; //not cached
+        goto end;
+    }
+
+    if( fscanf( file, "%7s %lld %ld %zu %zu %zu %zu", magic, &stored, &ttl, &key_len, &etag_len, &lmod_len, &body_len ) != 7
+        || strcmp( magic, CTUNE_RESPONSECACHE_FILE_MAGIC ) != 0
+        || fgetc( file ) != '\n' )
+    {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_ResponseCache_readFile( \"%s\", %p )] Invalid header in \"%s\".", key, entry, path._raw );
+        error_state = true;
+        goto end;
+    }
+
+    if( !ctune_ResponseCache_readField( file, key_len, &entry->key )
+        || !ctune_ResponseCache_readField( file, etag_len, &entry->etag )
+        || !ctune_ResponseCache_readField( file, lmod_len, &entry->last_modified )
+        || !ctune_ResponseCache_readField( file, body_len, &entry->body ) )
+    {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_ResponseCache_readFile( \"%s\", %p )] Truncated file \"%s\".", key, entry, path._raw );
+        error_state = true;
+        goto end;
+    }
+
+    if( strcmp( entry->key._raw, key ) != 0 ) { //hash collision
+        error_state = true;
+        goto end;
+    }
+
+    entry->stored = (time_t) stored;
+    entry->ttl    = ttl;
+
+    end:
+        if( file ) {
+            fclose( file );
+        }
+
+        String.free( &path );
+        return !( error_state );
+}
+
+/**
+ * [PRIVATE] Writes a cached response to the disk tier atomically (temporary file + fsync + rename)
+ * @param entry Entry to write
+ * @return Success
+ */
+static bool ctune_ResponseCache_writeFile( const ctune_ResponseCache_Entry_t * entry ) {
+    bool     error_state = false;
+    String_t path        = String.init();
+    String_t tmp_path    = String.init();
+    FILE   * file        = NULL;
+
+    if( !ctune_ResponseCache_resolveFilePath( entry->key._raw, &path ) ) {
+        error_state = true;
+        goto end;
+    }
+
+    String.set( &tmp_path, path._raw );
+    String.append_back( &tmp_path, ".tmp" );
+
+    if( ( file = fopen( tmp_path._raw, "wb" ) ) == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_ResponseCache_writeFile( %p )] Failed to open temporary file \"%s\": %s",
+                   entry, tmp_path._raw, strerror( errno )
+        );
+
+        error_state = true;
+        goto end;
+    }
+
+    if( fprintf( file, "%s %lld %ld %zu %zu %zu %zu\n",
+                 CTUNE_RESPONSECACHE_FILE_MAGIC, (long long) entry->stored, entry->ttl,
+                 entry->key._length, entry->etag._length, entry->last_modified._length, entry->body._length ) < 0
+        || fwrite( entry->key._raw, 1, entry->key._length, file ) != entry->key._length
+        || fwrite( entry->etag._raw, 1, entry->etag._length, file ) != entry->etag._length
+        || fwrite( entry->last_modified._raw, 1, entry->last_modified._length, file ) != entry->last_modified._length
+        || fwrite( entry->body._raw, 1, entry->body._length, file ) != entry->body._length
+        || fflush( file ) != 0
+        || fsync( fileno( file ) ) != 0 )
+    {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_ResponseCache_writeFile( %p )] Failed to write temporary file \"%s\": %s",
+                   entry, tmp_path._raw, strerror( errno )
+        );
+
+        error_state = true;
+    }
+
+    if( fclose( file ) != 0 ) {
+        error_state = true;
+    }
+
+    if( error_state || rename( tmp_path._raw, path._raw ) != 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_ResponseCache_writeFile( %p )] Failed to replace \"%s\" with \"%s\".",
+                   entry, path._raw, tmp_path._raw
+        );
+
+        unlink( tmp_path._raw );
+        error_state = true;
+    }
+
+    end:
+        String.free( &path );
+        String.free( &tmp_path );
+        return !( error_state );
+}
+
+/**
+ * [PRIVATE] Finds a response in the memory tier
+ * @param key Request key
+ * @return Pointer to the entry or NULL if not in memory
+ */
+static ctune_ResponseCache_Entry_t * ctune_ResponseCache_findInMemory( const char * key ) {
+    for( size_t i = 0; i < CTUNE_RESPONSECACHE_MEMORY_CAPACITY; ++i ) {
+        if( !String.empty( &cache.memory[i].key ) && strcmp( cache.memory[i].key._raw, key ) == 0 ) {
+            return &cache.memory[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * [PRIVATE] Finds the least recently used response in the memory tier
+ * @return Pointer to the entry or NULL if the memory tier is empty
+ */
+static ctune_ResponseCache_Entry_t * ctune_ResponseCache_findLRU( void ) {
+    ctune_ResponseCache_Entry_t * lru = NULL;
+
+    for( size_t i = 0; i < CTUNE_RESPONSECACHE_MEMORY_CAPACITY; ++i ) {
+        if( !String.empty( &cache.memory[i].key ) && ( lru == NULL || cache.memory[i].last_used < lru->last_used ) ) {
+            lru = &cache.memory[i];
+        }
+    }
+
+    return lru;
+}
+
+/**
+ * [PRIVATE] Evicts an entry from the memory tier
+ * @param entry Pointer to an entry inside the memory tier
+ */
+static void ctune_ResponseCache_evict( ctune_ResponseCache_Entry_t * entry ) {
+    cache.memory_size -= entry->body._length;
+    ctune_ResponseCache.freeEntry( entry );
+}
+
+/**
+ * [PRIVATE] Moves a response into the memory tier (evicting the least recently used entries as needed)
+ * @param entry Entry whose content is taken over (left untouched when too big for the memory tier)
+ * @return Pointer to the entry inside the memory tier or NULL if too big
+ */
+static ctune_ResponseCache_Entry_t * ctune_ResponseCache_promote( ctune_ResponseCache_Entry_t * entry ) {
+    ctune_ResponseCache_Entry_t * slot = ctune_ResponseCache_findInMemory( entry->key._raw );
+    ctune_ResponseCache_Entry_t * lru  = NULL;
+
+    if( slot ) {
+        ctune_ResponseCache_evict( slot );
+    }
+
+    if( entry->body._length > CTUNE_RESPONSECACHE_MEMORY_BUDGET ) {
+        return NULL; //EARLY RETURN - too big to keep in memory, disk tier only
+    }
+
+    while( ( cache.memory_size + entry->body._length ) > CTUNE_RESPONSECACHE_MEMORY_BUDGET && ( lru = ctune_ResponseCache_findLRU() ) != NULL ) {
+        ctune_ResponseCache_evict( lru );
+    }
+
+    for( size_t i = 0; slot == NULL && i < CTUNE_RESPONSECACHE_MEMORY_CAPACITY; ++i ) {
+        if( String.empty( &cache.memory[i].key ) ) {
+            slot = &cache.memory[i];
+        }
+    }
+
+    if( slot == NULL ) { //all slots used
+        slot = ctune_ResponseCache_findLRU();
+        ctune_ResponseCache_evict( slot );
+    }
+
+    *slot           = *entry;
+    slot->last_used = ++cache.tick;
+
+    cache.memory_size += slot->body._length;
+
+    ctune_ResponseCache.initEntry( entry );
+
+    return slot;
+}
+
+/**
+ * Initialises a response cache entry
+ * @param entry Pointer to a ctune_ResponseCache_Entry_t object
+ */
+static void ctune_ResponseCache_initEntry( void * entry ) {
+    ctune_ResponseCache_Entry_t * e = entry;
+
+    e->key           = String.init();
+    e->body          = String.init();
+    e->etag          = String.init();
+    e->last_modified = String.init();
+    e->stored        = 0;
+    e->ttl           = 0;
+    e->last_used     = 0;
+}
+
+/**
+ * De-allocates the content of a response cache entry
+ * @param entry Pointer to a ctune_ResponseCache_Entry_t object
+ */
+static void ctune_ResponseCache_freeEntry( void * entry ) {
+    ctune_ResponseCache_Entry_t * e = entry;
+
+    String.free( &e->key );
+    String.free( &e->body );
+    String.free( &e->etag );
+    String.free( &e->last_modified );
+    e->stored    = 0;
+    e->ttl       = 0;
+    e->last_used = 0;
+}
+
+/**
+ * [THREAD SAFE] Looks up a cached response (memory tier first, then disk tier)
+ * @param key   Request key
+ * @param entry Initialised entry to copy the cached response into (can be NULL)
+ * @return Lookup state
+ */
+static ctune_ResponseCache_State_e ctune_ResponseCache_lookup( const char * key, ctune_ResponseCache_Entry_t * entry ) {
+    ctune_ResponseCache_State_e   state  = CTUNE_RESPONSECACHE_MISS;
+    ctune_ResponseCache_Entry_t * cached = NULL;
+
+    if( key == NULL ) {
+        return CTUNE_RESPONSECACHE_MISS; //EARLY RETURN
+    }
+
+    pthread_mutex_lock( &cache.lock );
+
+    if( ( cached = ctune_ResponseCache_findInMemory( key ) ) == NULL ) {
+        ctune_ResponseCache_Entry_t loaded;
+        ctune_ResponseCache_initEntry( &loaded );
+
+        if( ctune_ResponseCache_readFile( key, &loaded ) && ( cached = ctune_ResponseCache_promote( &loaded ) ) == NULL ) {
+            //too big for the memory tier: served straight from the disk copy
+            state = ( ctune_ResponseCache_isFresh( &loaded, time( NULL ) ) ? CTUNE_RESPONSECACHE_FRESH : CTUNE_RESPONSECACHE_STALE );
+
+            if( entry ) {
+                ctune_ResponseCache_freeEntry( entry );
+                *entry = loaded;
+                ctune_ResponseCache_initEntry( &loaded );
+            }
+        }
+
+        ctune_ResponseCache_freeEntry( &loaded );
+    }
+
+    if( cached ) {
+        cached->last_used = ++cache.tick;
+        state = ( ctune_ResponseCache_isFresh( cached, time( NULL ) ) ? CTUNE_RESPONSECACHE_FRESH : CTUNE_RESPONSECACHE_STALE );
+
+        if( entry ) {
+            ctune_ResponseCache_copyEntry( cached, entry );
+        }
+    }
+
+    pthread_mutex_unlock( &cache.lock );
+
+    return state;
+}
+
+/**
+ * [THREAD SAFE] Stores a response in both tiers
+ * @param key           Request key
+ * @param body          Response body
+ * @param etag          'ETag' validator (can be NULL)
+ * @param last_modified 'Last-Modified' validator (can be NULL)
+ * @param ttl           Time-to-live in seconds
+ * @return Success
+ */
+static bool ctune_ResponseCache_store( const char * key, const char * body, const char * etag, const char * last_modified, long ttl ) {
+    bool                        error_state = false;
+    ctune_ResponseCache_Entry_t entry;
+
+    if( key == NULL || body == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_ResponseCache_store( %p, %p, %p, %p, %ld )] Key/Body is NULL.", key, body, etag, last_modified, ttl );
+        return false; //EARLY RETURN
+    }
+
+    ctune_ResponseCache_initEntry( &entry );
+
+    String.set( &entry.key, key );
+    String.set( &entry.body, body );
+    String.set( &entry.etag, ctune_fallbackStr( etag, "" ) );
+    String.set( &entry.last_modified, ctune_fallbackStr( last_modified, "" ) );
+    entry.stored = time( NULL );
+    entry.ttl    = ttl;
+
+    pthread_mutex_lock( &cache.lock );
+
+    error_state = !ctune_ResponseCache_writeFile( &entry );
+    ctune_ResponseCache_promote( &entry );
+
+    pthread_mutex_unlock( &cache.lock );
+
+    ctune_ResponseCache_freeEntry( &entry );
+
+    return !( error_state );
+}
+
+/**
+ * [THREAD SAFE] Marks a cached response as fresh again (i.e.: server replied '304 Not Modified')
+ * @param key Request key
+ * @param ttl Time-to-live in seconds
+ * @return Success (false if not cached)
+ */
+static bool ctune_ResponseCache_revalidate( const char * key, long ttl ) {
+    bool                          error_state = false;
+    ctune_ResponseCache_Entry_t * cached      = NULL;
+    ctune_ResponseCache_Entry_t   loaded;
+
+    if( key == NULL ) {
+        return false; //EARLY RETURN
+    }
+
+    ctune_ResponseCache_initEntry( &loaded );
+
+    pthread_mutex_lock( &cache.lock );
+
+    if( ( cached = ctune_ResponseCache_findInMemory( key ) ) == NULL ) {
+        if( !ctune_ResponseCache_readFile( key, &loaded ) ) {
+            error_state = true;
+            goto end;
+        }
+
+        cached = &loaded;
+    }
+
+    cached->stored    = time( NULL );
+    cached->ttl       = ttl;
+    cached->last_used = ++cache.tick;
+
+    error_state = !ctune_ResponseCache_writeFile( cached );
+
+    if( cached == &loaded ) {
+        ctune_ResponseCache_promote( &loaded );
+    }
+
+    end:
+        pthread_mutex_unlock( &cache.lock );
+        ctune_ResponseCache_freeEntry( &loaded );
+        return !( error_state );
+}
+
+/**
+ * [THREAD SAFE] Empties the memory tier (the disk tier is left as-is)
+ */
+static void ctune_ResponseCache_clear( void ) {
+    pthread_mutex_lock( &cache.lock );
+
+    for( size_t i = 0; i < CTUNE_RESPONSECACHE_MEMORY_CAPACITY; ++i ) {
+        ctune_ResponseCache_freeEntry( &cache.memory[i] );
+    }
+
+    cache.memory_size = 0;
+
+    pthread_mutex_unlock( &cache.lock );
+}
+
+/**
+ * De-allocates resources
+ */
+static void ctune_ResponseCache_free( void ) {
+    ctune_ResponseCache_clear();
+
+    pthread_mutex_lock( &cache.lock );
+
+    String.free( &cache.dir_path );
+    cache.dir_resolved = false;
+    cache.tick         = 0;
+
+    pthread_mutex_unlock( &cache.lock );
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_ResponseCache_Instance ctune_ResponseCache = {
+    .initEntry  = &ctune_ResponseCache_initEntry,
+    .freeEntry  = &ctune_ResponseCache_freeEntry,
+    .lookup     = &ctune_ResponseCache_lookup,
+    .store      = &ctune_ResponseCache_store,
+    .revalidate = &ctune_ResponseCache_revalidate,
+    .clear      = &ctune_ResponseCache_clear,
+    .free       = &ctune_ResponseCache_free,
+};
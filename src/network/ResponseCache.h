@@ -0,0 +1,99 @@
+#ifndef CTUNE_NETWORK_RESPONSECACHE_H
+#define CTUNE_NETWORK_RESPONSECACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "../datastructure/String.h"
+
+#define CTUNE_RESPONSECACHE_MEMORY_CAPACITY 32                  //max number of responses kept in memory
+#define CTUNE_RESPONSECACHE_MEMORY_BUDGET   ( 16 * 1024 * 1024 ) //max total size (bytes) of the responses kept in memory
+#define CTUNE_RESPONSECACHE_DIR_NAME        "responses/"         //sub-directory of the XDG cache directory
+
+/**
+ * Cache lookup state
+ */
+typedef enum {
+    CTUNE_RESPONSECACHE_MISS = 0, //not cached
+    CTUNE_RESPONSECACHE_FRESH,    //cached and within its time-to-live
+    CTUNE_RESPONSECACHE_STALE,    //cached but expired (needs revalidating)
+} ctune_ResponseCache_State_e;
+
+/**
+ * Cached response
+ * @param key           Host-independent request key (path + query)
+ * @param body          Response body
+ * @param etag          'ETag' validator sent by the server (can be empty)
+ * @param last_modified 'Last-Modified' validator sent by the server (can be empty)
+ * @param stored        Timestamp of the last download/revalidation
+ * @param ttl           Time-to-live in seconds
+ * @param last_used     LRU tick of the last access (memory tier only)
+ */
+typedef struct ctune_ResponseCache_Entry {
+    String_t key;
+    String_t body;
+    String_t etag;
+    String_t last_modified;
+    time_t   stored;
+    long     ttl;
+    uint64_t last_used;
+
+} ctune_ResponseCache_Entry_t;
+
+/**
+ * Two-tier (in-memory LRU + on-disk) HTTP response cache
+ */
+extern const struct ctune_ResponseCache_Instance {
+    /**
+     * Initialises a response cache entry
+     * @param entry Pointer to a ctune_ResponseCache_Entry_t object
+     */
+    void (* initEntry)( void * entry );
+
+    /**
+     * De-allocates the content of a response cache entry
+     * @param entry Pointer to a ctune_ResponseCache_Entry_t object
+     */
+    void (* freeEntry)( void * entry );
+
+    /**
+     * [THREAD SAFE] Looks up a cached response (memory tier first, then disk tier)
+     * @param key   Request key
+     * @param entry Initialised entry to copy the cached response into (can be NULL)
+     * @return Lookup state
+     */
+    ctune_ResponseCache_State_e (* lookup)( const char * key, ctune_ResponseCache_Entry_t * entry );
+
+    /**
+     * [THREAD SAFE] Stores a response in both tiers
+     * @param key           Request key
+     * @param body          Response body
+     * @param etag          'ETag' validator (can be NULL)
+     * @param last_modified 'Last-Modified' validator (can be NULL)
+     * @param ttl           Time-to-live in seconds
+     * @return Success
+     */
+    bool (* store)( const char * key, const char * body, const char * etag, const char * last_modified, long ttl );
+
+    /**
+     * [THREAD SAFE] Marks a cached response as fresh again (i.e.: server replied '304 Not Modified')
+     * @param key Request key
+     * @param ttl Time-to-live in seconds
+     * @return Success (false if not cached)
+     */
+    bool (* revalidate)( const char * key, long ttl );
+
+    /**
+     * [THREAD SAFE] Empties the memory tier (the disk tier is left as-is)
+     */
+    void (* clear)( void );
+
+    /**
+     * De-allocates resources
+     */
+    void (* free)( void );
+
+} ctune_ResponseCache;
+
+#endif //CTUNE_NETWORK_RESPONSECACHE_H
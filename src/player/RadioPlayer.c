@@ -2,22 +2,34 @@
 
 #include <unistd.h>
 #include <signal.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
 
 #include "../utils/Timeout.h"
 
+#define CTUNE_RADIOPLAYER_MAX_RETIRED 16 //max number of stopped pipelines waiting to be torn down
+
 /**
  * Argument container for playing streams
  * @param url         Stream url
  * @param init_vol    Starting volume for the stream playback
  * @param timeout_val Timeout value in seconds for connecting/playing
+ * @param pipeline    Pipeline ID
  */
 typedef struct ctune_RadioPlayer_PlaybackArgs {
     String_t url;
     int      init_vol;
     int      timeout_val;
+    uint64_t pipeline;
 
 } ctune_PlaybackArgs_t;
 
+/**
+ * ID of the pipeline running on the current thread (0: not a player thread)
+ */
+static __thread uint64_t pipeline_id = 0;
+
 /**
  * Private vars
  */
@@ -29,10 +41,19 @@ struct {
 
     struct { /* PLAYER CONTROL */
         pthread_t             thread;
-        volatile sig_atomic_t state; //used to interrupt playing of a stream
+        volatile sig_atomic_t state;    //used to interrupt playing of a stream
+        bool                  live;     //thread started and not yet handed over to the reaper
+        atomic_uint_fast64_t  pipeline; //ID of the current pipeline (retired pipelines see themselves as stopped)
     } player;
 
-    ctune_PlaybackArgs_t stream_args;
+    struct { /* PIPELINE TEARDOWN */
+        pthread_mutex_t lock;
+        pthread_cond_t  changed; //signalled when a pipeline is retired/reaped or the reaper stops
+        pthread_t       thread;
+        bool            running;
+        pthread_t       retired[CTUNE_RADIOPLAYER_MAX_RETIRED];
+        size_t          count;
+    } reaper;
 
     struct {
         void (* song_change_callback)( const char * str );
@@ -47,10 +68,13 @@ struct {
     .player_plugin      = NULL,
     .output_plugin      = NULL,
     .player.state       = CTUNE_PLAYBACK_CTRL_OFF,
-    .stream_args = {
-        { NULL, 0 },
-        0,
-        0
+    .player.live        = false,
+    .player.pipeline    = 0,
+    .reaper = {
+        .lock    = PTHREAD_MUTEX_INITIALIZER,
+        .changed = PTHREAD_COND_INITIALIZER,
+        .running = false,
+        .count   = 0,
     },
     .cb = {
         NULL,
@@ -66,6 +90,10 @@ struct {
  * @return Playback state (state/switch) or if a change occurred (on/off)
  */
 static bool ctune_RadioPlayer_setPlaybackState( enum CTUNE_PLAYBACK_CTRL ctrl ) {
+    if( pipeline_id != 0 && pipeline_id != atomic_load( &radio_player.player.pipeline ) ) {
+        return false; //EARLY RETURN - retired pipeline: stopped and no longer in control of the state
+    }
+
     ctune_PlaybackCtrl_e curr_state = radio_player.player.state;
 
     switch( ctrl ) {
@@ -157,8 +185,24 @@ static bool ctune_RadioPlayer_setPlaybackState( enum CTUNE_PLAYBACK_CTRL ctrl )
  * @return NULL
  */
 static void * ctune_RadioPlayer_launchPlayback( void * args ) {
-    if( radio_player.player_plugin != NULL ) {
-        ctune_PlaybackArgs_t *cast_args = args;
+    ctune_PlaybackArgs_t * cast_args = args;
+
+    pipeline_id = cast_args->pipeline;
+
+    { //the plugins and the sound server are shared so previous pipelines need to be torn down first
+        pthread_mutex_lock( &radio_player.reaper.lock );
+
+        while( radio_player.reaper.count > 0 && pipeline_id == atomic_load( &radio_player.player.pipeline ) ) {
+            pthread_cond_wait( &radio_player.reaper.changed, &radio_player.reaper.lock );
+        }
+
+        pthread_mutex_unlock( &radio_player.reaper.lock );
+    }
+
+    if( pipeline_id != atomic_load( &radio_player.player.pipeline ) ) {
+        CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_RadioPlayer_launchPlayback( %p )] Pipeline #%lu stopped before it started.", args, pipeline_id );
+
+    } else if( radio_player.player_plugin != NULL ) {
         radio_player.player_plugin->playRadioStream( cast_args->url._raw, cast_args->init_vol, cast_args->timeout_val );
 
     } else {
@@ -166,9 +210,104 @@ static void * ctune_RadioPlayer_launchPlayback( void * args ) {
         ctune_err.set( CTUNE_ERR_IO_PLUGIN_NULL );
     }
 
+    String.free( &cast_args->url );
+    free( cast_args );
+    return NULL;
+}
+
+/**
+ * [PRIVATE] Joins the threads of stopped pipelines (thread)
+ * @param arg Unused
+ * @return NULL
+ */
+static void * ctune_RadioPlayer_reaper( void * arg ) {
+    pthread_mutex_lock( &radio_player.reaper.lock );
+
+    for(;;) {
+        while( radio_player.reaper.running && radio_player.reaper.count == 0 ) {
+            pthread_cond_wait( &radio_player.reaper.changed, &radio_player.reaper.lock );
+        }
+
+        if( radio_player.reaper.count == 0 ) {
+            break; //stopped with nothing left to tear down
+        }
+
+        const pthread_t thread = radio_player.reaper.retired[0];
+
+        pthread_mutex_unlock( &radio_player.reaper.lock );
+
+        if( pthread_join( thread, NULL ) == 0 ) {
+            CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_RadioPlayer_reaper( %p )] Playback terminated.", arg );
+        } else {
+            ctune_err.set( CTUNE_ERR_THREAD_JOIN );
+        }
+
+        const int error = ctune_RadioPlayer.getError(); //before the next pipeline is let through
+
+        if( error != CTUNE_ERR_NONE ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_RadioPlayer_reaper( %p )] Player encountered an error: %s", arg, ctune_err.print( error ) );
+        }
+
+        pthread_mutex_lock( &radio_player.reaper.lock );
+
+        --radio_player.reaper.count;
+        memmove( &radio_player.reaper.retired[0], &radio_player.reaper.retired[1], radio_player.reaper.count * sizeof( pthread_t ) );
+
+        pthread_cond_broadcast( &radio_player.reaper.changed );
+    }
+
+    pthread_mutex_unlock( &radio_player.reaper.lock );
+
     return NULL;
 }
 
+/**
+ * [PRIVATE/THREAD SAFE] Hands over the current pipeline to the reaper so that it is torn down in the background
+ */
+static void ctune_RadioPlayer_retirePipeline( void ) {
+    pthread_mutex_lock( &radio_player.reaper.lock );
+
+    if( !radio_player.player.live ) {
+        pthread_mutex_unlock( &radio_player.reaper.lock );
+        return; //EARLY RETURN
+    }
+
+    radio_player.player.live = false;
+    atomic_fetch_add( &radio_player.player.pipeline, 1 ); //i.e.: interrupts the pipeline
+
+    if( !radio_player.reaper.running ) { //fallback
+        pthread_mutex_unlock( &radio_player.reaper.lock );
+
+        if( pthread_join( radio_player.player.thread, NULL ) != 0 ) {
+            ctune_err.set( CTUNE_ERR_THREAD_JOIN );
+        }
+
+        return; //EARLY RETURN
+    }
+
+    while( radio_player.reaper.count == CTUNE_RADIOPLAYER_MAX_RETIRED ) {
+        pthread_cond_wait( &radio_player.reaper.changed, &radio_player.reaper.lock );
+    }
+
+    radio_player.reaper.retired[ radio_player.reaper.count++ ] = radio_player.player.thread;
+
+    pthread_cond_broadcast( &radio_player.reaper.changed );
+    pthread_mutex_unlock( &radio_player.reaper.lock );
+}
+
+/**
+ * [PRIVATE/THREAD SAFE] Waits until all stopped pipelines are torn down
+ */
+static void ctune_RadioPlayer_awaitTeardown( void ) {
+    pthread_mutex_lock( &radio_player.reaper.lock );
+
+    while( radio_player.reaper.count > 0 ) {
+        pthread_cond_wait( &radio_player.reaper.changed, &radio_player.reaper.lock );
+    }
+
+    pthread_mutex_unlock( &radio_player.reaper.lock );
+}
+
 /**
  * Initialises the main functionalities
  * @param song_change_callback         Function to call when stream metadata changes (sends the current stream title)
@@ -189,6 +328,19 @@ static void ctune_RadioPlayer_init( void(* song_change_callback)( const char * )
     radio_player.cb.song_change_callback           = song_change_callback;
     radio_player.cb.volume_change_event_callback   = volume_change_event_callback;
     radio_player.initialised                       = true;
+
+    pthread_mutex_lock( &radio_player.reaper.lock );
+
+    radio_player.reaper.running = ( pthread_create( &radio_player.reaper.thread, NULL, ctune_RadioPlayer_reaper, NULL ) == 0 );
+
+    if( !radio_player.reaper.running ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_RadioPlayer_init( %p, %p )] Failed to create reaper thread: stopping playback will block.",
+                   song_change_callback, volume_change_event_callback
+        );
+    }
+
+    pthread_mutex_unlock( &radio_player.reaper.lock );
 }
 
 /**
@@ -211,6 +363,12 @@ static bool ctune_RadioPlayer_loadPlayerPlugin( ctune_Player_t * player ) {
         return false; //EARLY RETURN
     }
 
+    if( player == radio_player.player_plugin && radio_player.player_initialised ) {
+        return true; //EARLY RETURN - nothing to change
+    }
+
+    ctune_RadioPlayer_awaitTeardown(); //stopped pipelines may still be using the plugin
+
     if( radio_player.player_plugin == NULL ) {
         CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_RadioPlayer_loadPlayerPlugin( %p )] New player set: %s", player, player->name() );
         radio_player.player_plugin = player;
@@ -245,6 +403,12 @@ static bool ctune_RadioPlayer_loadPlayerPlugin( ctune_Player_t * player ) {
         return false; //EARLY RETURN
     }
 
+    if( sound_server == radio_player.output_plugin ) {
+        return true; //EARLY RETURN - nothing to change
+    }
+
+    ctune_RadioPlayer_awaitTeardown(); //stopped pipelines may still be writing to the sound server
+
     if( radio_player.output_plugin == NULL ) {
         CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_RadioPlayer_loadSoundServerPlugin( %p )] New sound server set: %s", sound_server, sound_server->name() );
         radio_player.output_plugin = sound_server;
@@ -255,8 +419,9 @@ static bool ctune_RadioPlayer_loadPlayerPlugin( ctune_Player_t * player ) {
     }
 
     radio_player.output_plugin->setVolumeChangeCallback( radio_player.cb.volume_change_event_callback );
+    radio_player.player_initialised = false; //player needs to be pointed at the new sound server
 
-    if( radio_player.player_plugin != NULL && radio_player.player_initialised == false ) {
+    if( radio_player.player_plugin != NULL ) {
         radio_player.player_plugin->init( radio_player.output_plugin,
                                           ctune_RadioPlayer_setPlaybackState,
                                           radio_player.cb.song_change_callback );
@@ -268,23 +433,11 @@ static bool ctune_RadioPlayer_loadPlayerPlugin( ctune_Player_t * player ) {
  }
 
 /**
- * [THREAD SAFE] Stops the playback of the currently playing stream
+ * [THREAD SAFE] Stops the playback of the currently playing stream (the pipeline is torn down in the background)
  */
 static void ctune_RadioPlayer_stopRadioStream( void ) {
-    if( ctune_RadioPlayer_setPlaybackState( CTUNE_PLAYBACK_CTRL_OFF ) ) {
-
-        if( pthread_join( radio_player.player.thread, NULL ) == 0 ) {
-            CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_RadioPlayer_stopRadioStream()] Playback terminated." );
-        } else {
-            ctune_err.set( CTUNE_ERR_THREAD_JOIN );
-        }
-
-        ctune_err.set( ctune_RadioPlayer.getError() );
-
-        if( ctune_err.number() != CTUNE_ERR_NONE ) {
-            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_RadioPlayer_stopRadioStream()] Player encountered an error: %s", ctune_err.strerror() );
-        }
-    }
+    ctune_RadioPlayer_setPlaybackState( CTUNE_PLAYBACK_CTRL_OFF );
+    ctune_RadioPlayer_retirePipeline();
 }
 
 /**
@@ -295,20 +448,42 @@ static void ctune_RadioPlayer_stopRadioStream( void ) {
  * @return Success (if false the error_no in RadioPlayer will be set accordingly)
  */
 static bool ctune_RadioPlayer_playRadioStream( const char * url, const int volume, int timeout_val ) {
-    if( ctune_PlaybackCtrl.isOn( ctune_RadioPlayer_setPlaybackState( CTUNE_PLAYBACK_CTRL_STATE_REQ ) ) ) {
-        ctune_RadioPlayer_stopRadioStream();
+    ctune_RadioPlayer_stopRadioStream(); //also hands over pipelines that stopped on their own
+
+    ctune_PlaybackArgs_t * args = malloc( sizeof( ctune_PlaybackArgs_t ) ); //owned by the player thread
+
+    if( args == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_FATAL,
+                   "[ctune_RadioPlayer_playRadioStream( \"%s\", %d, %d )] Failed to allocate playback arguments.",
+                   url, volume, timeout_val
+        );
+
+        ctune_err.set( CTUNE_ERR_MALLOC );
+        return false; //EARLY RETURN
     }
 
+    //set the playback arguments values
+    args->url         = String.init();
+    args->init_vol    = volume;
+    args->timeout_val = timeout_val;
+
+    String.set( &args->url, url );
+
     ctune_RadioPlayer_setPlaybackState( CTUNE_PLAYBACK_CTRL_PLAY );
 
-    //set the playback arguments values
-    String.set( &radio_player.stream_args.url, url );
-    radio_player.stream_args.init_vol    = volume;
-    radio_player.stream_args.timeout_val = timeout_val;
+    pthread_mutex_lock( &radio_player.reaper.lock );
+
+    args->pipeline = atomic_fetch_add( &radio_player.player.pipeline, 1 ) + 1;
 
     //start playback
-    if( pthread_create( &radio_player.player.thread, NULL, ctune_RadioPlayer_launchPlayback, (void *) &(radio_player.stream_args) ) != 0 ) {
+    radio_player.player.live = ( pthread_create( &radio_player.player.thread, NULL, ctune_RadioPlayer_launchPlayback, (void *) args ) == 0 );
+
+    pthread_mutex_unlock( &radio_player.reaper.lock );
+
+    if( !radio_player.player.live ) {
         ctune_RadioPlayer_setPlaybackState( CTUNE_PLAYBACK_CTRL_OFF );
+        String.free( &args->url );
+        free( args );
 
         CTUNE_LOG( CTUNE_LOG_FATAL,
                    "[ctune_RadioPlayer_playRadioStream( \"%s\", %d, %d )] Failed to create thread for player.",
@@ -322,6 +497,29 @@ static bool ctune_RadioPlayer_playRadioStream( const char * url, const int volum
     return true;
 }
 
+/**
+ * Stops playback and waits for all pipelines to be torn down
+ */
+static void ctune_RadioPlayer_shutdown( void ) {
+    ctune_RadioPlayer_stopRadioStream();
+
+    pthread_mutex_lock( &radio_player.reaper.lock );
+
+    if( !radio_player.reaper.running ) {
+        pthread_mutex_unlock( &radio_player.reaper.lock );
+        return; //EARLY RETURN
+    }
+
+    radio_player.reaper.running = false; //reaper exits once the retired pipelines are joined
+
+    pthread_cond_broadcast( &radio_player.reaper.changed );
+    pthread_mutex_unlock( &radio_player.reaper.lock );
+
+    pthread_join( radio_player.reaper.thread, NULL );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_RadioPlayer_shutdown()] Player pipelines torn down." );
+}
+
 /**
  * [THREAD SAFE] Gets the playback state
  * @return Playback state (boolean)
@@ -337,6 +535,15 @@ static bool ctune_RadioPlayer_getPlaybackState( void ) {
  * @return Success
  */
 static bool ctune_RadioPlayer_startRecording( const char * filepath, ctune_FileOut_t * plugin ) {
+    pthread_mutex_lock( &radio_player.reaper.lock );
+    const bool tearing_down = ( radio_player.reaper.count > 0 ); //the recording would be closed along with a stopped pipeline
+    pthread_mutex_unlock( &radio_player.reaper.lock );
+
+    if( tearing_down ) {
+        CTUNE_LOG( CTUNE_LOG_WARNING, "[ctune_RadioPlayer_startRecording( %s, %p )] Previous stream is still being shut down.", filepath, plugin );
+        return false; //EARLY RETURN
+    }
+
     if( radio_player.player_plugin != NULL && ctune_PlaybackCtrl.isOn( radio_player.player.state ) ) { //TODO check if we need to know REC state?
         CTUNE_LOG( CTUNE_LOG_TRACE,
                    "[ctune_RadioPlayer_startRecording( %s, %p )] Player plugin: %p (%s)",
@@ -424,6 +631,7 @@ const struct ctune_RadioPlayer_Namespace ctune_RadioPlayer = {
     .loadSoundServerPlugin  = &ctune_RadioPlayer_loadSoundServerPlugin,
     .playRadioStream        = &ctune_RadioPlayer_playRadioStream,
     .stopPlayback           = &ctune_RadioPlayer_stopRadioStream,
+    .shutdown               = &ctune_RadioPlayer_shutdown,
     .getPlaybackState       = &ctune_RadioPlayer_getPlaybackState,
     .startRecording         = &ctune_RadioPlayer_startRecording,
     .stopRecording          = &ctune_RadioPlayer_stopRecording,
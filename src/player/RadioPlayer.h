@@ -46,10 +46,15 @@ extern const struct ctune_RadioPlayer_Namespace {
     bool (* playRadioStream)( const char * url, const int volume, int timeout_val );
 
     /**
-     * [THREAD SAFE] Stops the playback of the currently playing stream
+     * [THREAD SAFE] Stops the playback of the currently playing stream (the pipeline is torn down in the background)
      */
     void (* stopPlayback)( void );
 
+    /**
+     * Stops playback and waits for all pipelines to be torn down
+     */
+    void (* shutdown)( void );
+
     /**
      * [THREAD SAFE] Gets the playback state
      * @return Playback state (boolean)
@@ -1,10 +1,16 @@
 #include "EventQueue.h"
 
+#include <stdint.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
 #include "logger/src/Logger.h"
 #include "../datastructure/CircularBuffer.h"
 
 static CircularBuffer_t event_queue;
 static processEventCb   event_processor_cb = NULL;
+static atomic_int       event_fd           = -1; //signalled on each `add(..)` so that a waiting UI loop wakes up
 
 /**
  * Initialises the EventQueue
@@ -32,6 +38,17 @@ static bool ctune_UI_EventQueue_init( processEventCb cb ) {
         return false;
     }
 
+    const int fd = eventfd( 0, ( EFD_NONBLOCK | EFD_CLOEXEC ) );
+
+    if( fd < 0 ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_UI_EventQueue_init( %p )] Failed to create the eventfd: events will wait on input.",
+                   cb
+        );
+    }
+
+    atomic_store( &event_fd, fd );
+
     event_processor_cb = cb;
 
     CTUNE_LOG( CTUNE_LOG_MSG,
@@ -54,6 +71,14 @@ static void ctune_UI_EventQueue_add( ctune_UI_Event_t * event ) {
                    "[ctune_UI_EventQueue_add( %p )] Failed to write Event (written %d/%d bytes): %s",
                    event, ln, sizeof( ctune_UI_Event_t ), ctune_UI_EventType.str( event->type )
         );
+
+        return; //EARLY RETURN
+    }
+
+    const int fd = atomic_load( &event_fd );
+
+    if( fd >= 0 && write( fd, &(uint64_t){ 1 }, sizeof( uint64_t ) ) < 0 ) {
+        //nothing to do: the counter can only overflow if the UI thread has stopped draining it
     }
 }
 
@@ -63,6 +88,16 @@ static void ctune_UI_EventQueue_add( ctune_UI_Event_t * event ) {
 static void ctune_UI_EventQueue_flush( void ) {
     CTUNE_LOG( CTUNE_LOG_MSG, "[ctune_UI_EventQueue_flush()] Flushing event queue..." );
 
+    const int fd = atomic_load( &event_fd );
+
+    if( fd >= 0 ) { //reset before reading so that events added from here on signal again
+        uint64_t counter;
+
+        if( read( fd, &counter, sizeof( uint64_t ) ) < 0 ) {
+            //nothing to do: not signalled
+        }
+    }
+
     while( !ctune_UI_EventQueue.empty() ) {
         ctune_UI_Event_t event;
 
@@ -89,10 +124,24 @@ static bool ctune_UI_EventQueue_empty( void ) {
     return CircularBuffer.empty( &event_queue );
 }
 
+/**
+ * Gets the file descriptor that becomes readable when events are added
+ * @return File descriptor (-1 if not available)
+ */
+static int ctune_UI_EventQueue_fd( void ) {
+    return atomic_load( &event_fd );
+}
+
 /**
  * De-allocates internal variables
  */
 static void ctune_UI_EventQueue_free( void ) {
+    const int fd = atomic_exchange( &event_fd, -1 );
+
+    if( fd >= 0 ) {
+        close( fd );
+    }
+
     CircularBuffer.free( &event_queue );
 }
 
@@ -104,5 +153,6 @@ const struct ctune_UI_EventQueue_Instance ctune_UI_EventQueue = {
     .add   = &ctune_UI_EventQueue_add,
     .flush = &ctune_UI_EventQueue_flush,
     .empty = &ctune_UI_EventQueue_empty,
+    .fd    = &ctune_UI_EventQueue_fd,
     .free  = &ctune_UI_EventQueue_free,
 } ;
\ No newline at end of file
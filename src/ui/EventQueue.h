@@ -33,7 +33,7 @@ extern const struct ctune_UI_EventQueue_Instance {
     bool (* init)( processEventCb cb );
 
     /**
-     * Adds new event to queue
+     * Adds new event to queue and wakes the UI loop
      * @param event Pointer to Event
      */
     void (* add)( ctune_UI_Event_t * event );
@@ -49,6 +49,12 @@ extern const struct ctune_UI_EventQueue_Instance {
      */
     bool (* empty)( void );
 
+    /**
+     * Gets the file descriptor that becomes readable when events are added
+     * @return File descriptor (-1 if not available)
+     */
+    int (* fd)( void );
+
     /**
      * De-allocates internal variables and resets everything back to an initialised state
      */
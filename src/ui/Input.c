@@ -0,0 +1,55 @@
+#include "Input.h"
+
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#include "logger/src/Logger.h"
+#include "EventQueue.h"
+#include "Resizer.h"
+
+/**
+ * Waits for a character input on a window or a UI event/resize request
+ * @param win Window to get the character from
+ * @return Character or ERR when woken up by a UI event or resize request (i.e.: service them)
+ */
+static int ctune_UI_Input_getChar( WINDOW * win ) {
+    wtimeout( win, 0 );
+
+    int ch = wgetch( win );
+
+    if( ch != ERR ) {
+        return ch; //EARLY RETURN - input was already buffered
+    }
+
+    struct pollfd fds[3] = {
+        { .fd = STDIN_FILENO,             .events = POLLIN, .revents = 0 },
+        { .fd = ctune_UI_Resizer.fd(),    .events = POLLIN, .revents = 0 }, //ignored by `poll(..)` when -1
+        { .fd = ctune_UI_EventQueue.fd(), .events = POLLIN, .revents = 0 }, //ignored by `poll(..)` when -1
+    };
+
+    const int timeout = ( fds[1].fd >= 0 && fds[2].fd >= 0 ) ? -1 : CTUNE_UI_INPUT_FALLBACK_TIMEOUT;
+    const int ready   = poll( fds, 3, timeout );
+
+    if( ready < 0 ) {
+        if( errno != EINTR ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_Input_getChar( %p )] Failed `poll(..)`: %s", win, strerror( errno ) );
+        }
+
+        return ERR; //EARLY RETURN
+    }
+
+    if( fds[0].revents & ( POLLIN | POLLHUP | POLLERR ) ) {
+        ch = wgetch( win );
+    }
+
+    return ch;
+}
+
+/**
+ * Namespace constructor
+ */
+const struct ctune_UI_Input_Instance ctune_UI_Input = {
+    .getChar = &ctune_UI_Input_getChar,
+};
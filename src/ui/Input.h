@@ -0,0 +1,28 @@
+#ifndef CTUNE_UI_INPUT_H
+#define CTUNE_UI_INPUT_H
+
+#ifdef NO_NCURSESW
+    #include <ncurses.h>
+#else
+    #include <ncursesw/ncurses.h>
+#endif
+
+#define CTUNE_UI_INPUT_FALLBACK_TIMEOUT 100 //in milliseconds (wake-up interval when the EventQueue/Resizer descriptors are not available)
+
+/**
+ * Input
+ * -
+ * Blocks the UI loops on the terminal input, the Resizer's self-pipe and the EventQueue's eventfd
+ * instead of waking them up at a fixed interval
+ */
+extern const struct ctune_UI_Input_Instance {
+    /**
+     * Waits for a character input on a window or a UI event/resize request
+     * @param win Window to get the character from
+     * @return Character or ERR when woken up by a UI event or resize request (i.e.: service them)
+     */
+    int (* getChar)( WINDOW * win );
+
+} ctune_UI_Input;
+
+#endif //CTUNE_UI_INPUT_H
@@ -1,7 +1,13 @@
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE //for `pipe2(..)`
+#endif
+
 #include "Resizer.h"
 
 #include <stdlib.h>
 #include <stdatomic.h>
+#include <unistd.h>
+#include <fcntl.h>
 
 #include "logger/src/Logger.h"
 #include "../datastructure/Deque.h"
@@ -21,15 +27,18 @@ typedef struct {
  * @param initialised  Init flag
  * @param request_flag Resizing request flag
  * @param queue        List of resize callbacks
+ * @param pipe         Self-pipe written to on resize requests so that a waiting UI loop wakes up ([0]: read end, [1]: write end)
  */
 struct {
     bool        initialised;
     atomic_bool request_flag;
     Deque_t     queue;
+    atomic_int  pipe[2];
 
 } resizer = {
     .initialised  = false,
     .request_flag = false,
+    .pipe         = { -1, -1 },
 };
 
 /**
@@ -37,6 +46,16 @@ struct {
  */
 static void ctune_UI_Resizer_init( void ) {
     if( !resizer.initialised ) {
+        int fd[2];
+
+        if( pipe2( fd, ( O_NONBLOCK | O_CLOEXEC ) ) == 0 ) {
+            atomic_store( &resizer.pipe[0], fd[0] );
+            atomic_store( &resizer.pipe[1], fd[1] );
+
+        } else {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_Resizer_init()] Failed to create the self-pipe: resizing will wait on input." );
+        }
+
         resizer.queue       = Deque.init();
         resizer.initialised = true;
     }
@@ -126,17 +145,42 @@ static void ctune_UI_Resizer_resize( void ) {
  * @return Request flag
  */
 static bool ctune_UI_resizingRequested( void ) {
+    if( !atomic_load( &resizer.request_flag ) )
+        return false; //EARLY RETURN
+
+    const int fd = atomic_load( &resizer.pipe[0] );
+
+    if( fd >= 0 ) { //drain before lowering the flag so that a request coming in-between always leaves a byte behind
+        char buffer[16];
+        while( read( fd, buffer, sizeof( buffer ) ) > 0 );
+    }
+
     bool expected = true;
     return atomic_compare_exchange_strong( &resizer.request_flag, &expected, false );
 }
 
 /**
- * Sets the resize request flag up
+ * Sets the resize request flag up and wakes the UI loop
  */
 static void ctune_UI_requestResizing( void ) {
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_resizingRequested()] resize requested." );
     bool expected = false;
-    atomic_compare_exchange_strong( &resizer.request_flag, &expected, true );
+
+    if( atomic_compare_exchange_strong( &resizer.request_flag, &expected, true ) ) {
+        const int fd = atomic_load( &resizer.pipe[1] );
+
+        if( fd >= 0 && write( fd, "R", 1 ) < 0 ) {
+            //nothing to do: the pipe is either full (i.e. already signalled) or gone
+        }
+    }
+}
+
+/**
+ * Gets the file descriptor that becomes readable when resizing is requested
+ * @return File descriptor (-1 if not available)
+ */
+static int ctune_UI_Resizer_fd( void ) {
+    return atomic_load( &resizer.pipe[0] );
 }
 
 /**
@@ -145,6 +189,15 @@ static void ctune_UI_requestResizing( void ) {
 static void ctune_UI_Resizer_free( void ) {
     if( resizer.initialised ) {
         Deque.free( &resizer.queue, free );
+
+        for( int i = 0; i < 2; ++i ) {
+            const int fd = atomic_exchange( &resizer.pipe[i], -1 );
+
+            if( fd >= 0 ) {
+                close( fd );
+            }
+        }
+
         resizer.initialised = false;
 
         CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_Resizer_free()] Resizer's vars freed." );
@@ -161,5 +214,6 @@ const struct ctune_UI_Resizer_Instance ctune_UI_Resizer = {
     .resize            = &ctune_UI_Resizer_resize,
     .requestResizing   = &ctune_UI_requestResizing,
     .resizingRequested = &ctune_UI_resizingRequested,
+    .fd                = &ctune_UI_Resizer_fd,
     .free              = &ctune_UI_Resizer_free,
 };
\ No newline at end of file
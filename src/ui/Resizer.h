@@ -39,10 +39,16 @@ extern const struct ctune_UI_Resizer_Instance {
     bool (* resizingRequested)( void );
 
     /**
-     * Sets the resize request flag up
+     * Sets the resize request flag up and wakes the UI loop
      */
     void (* requestResizing)( void );
 
+    /**
+     * Gets the file descriptor that becomes readable when resizing is requested
+     * @return File descriptor (-1 if not available)
+     */
+    int (* fd)( void );
+
     /**
      * De-allocates internal variables and resets everything back to an initialised state
      */
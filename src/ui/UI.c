@@ -19,6 +19,7 @@
 #include "../Controller.h"
 
 #include "EventQueue.h"
+#include "Input.h"
 #include "Resizer.h"
 #include "definitions/KeyBinding.h"
 #include "definitions/Theme.h"
@@ -79,6 +80,14 @@ static struct ctune_UI {
         ctune_UI_SetOutputDir_t setrecdir;
     } dialogs;
 
+    struct { //background searches
+        ctune_JobHandle_t find;    //'find station' dialog search
+        ctune_JobHandle_t sync;    //favourite station sync
+        bool              refresh; //redraw once the UI is idle (a search completed)
+    } async;
+
+    uint64_t             station_changes; //number of changes of the current station (part of the station state version)
+
     struct {
         int(* quietVolChangeCallback)( int );
     } cb;
@@ -86,6 +95,8 @@ static struct ctune_UI {
 } ui = {
     .screen_size = { 0, 0, 0, 0 },
     .init_stages = { false },
+    .async       = { CTUNE_NETWORKJOBS_HANDLE_NONE, CTUNE_NETWORKJOBS_HANDLE_NONE, false },
+    .station_changes = 0,
 };
 
 /* ============================================================================================== */
@@ -147,6 +158,17 @@ static unsigned ctune_UI_getStationState( const ctune_RadioStationInfo_t * rsi )
     return state;
 }
 
+/**
+ * [PRIVATE] Gets the version of the station states
+ * -
+ * Both the favourites' generation and the station change count only ever go up so their sum changes whenever
+ * any of the states returned by `ctune_UI_getStationState(..)` might have.
+ * @return State version
+ */
+static uint64_t ctune_UI_getStationStateVersion( void ) {
+    return ( ctune_Controller.cfg.favouritesGeneration() + ui.station_changes );
+}
+
 /**
  * [PRIVATE] Helper method to check if RSI is already a LOCAL favourite
  * @param rsi Pointer to RadioStationInfo_t object
@@ -234,6 +256,37 @@ static int ctune_UI_sortStationList( ctune_UI_PanelID_e tab, int sort_by ) {
     return 1;
 }
 
+/**
+ * [PRIVATE/CALLBACK] Completion callback for the background fetch of a favourite station's remote counterpart
+ * @param job  Finished network job
+ * @param data Station source of the favourite (as `intptr_t`)
+ */
+static void ctune_UI_syncRemoteStationCb( ctune_NetworkJob_t * job, void * data ) {
+    ui.async.sync = CTUNE_NETWORKJOBS_HANDLE_NONE;
+
+    if( atomic_load( &job->cancel ) )
+        return; //EARLY RETURN
+
+    if( job->success ) {
+        if( !Vector.empty( &job->results ) ) {
+            ctune_UI_RSListWin_PageState_t view_state = ctune_UI_MainWin.getViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES );
+
+            ctune_Controller.cfg.updateFavourite( Vector.at( &job->results, 0 ), (ctune_StationSrc_e) (intptr_t) data );
+            ctune_UI_MainWin.ctrl.updateFavourites( &ui.main_win, ctune_Controller.cfg.getListOfFavourites );
+
+            ctune_UI_MainWin.setViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES, view_state );
+
+            ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_SUCCESS ) );
+
+        } else {
+            ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_FETCH_REMOTE_NOT_FOUND ) );
+        }
+
+    } else {
+        ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_FETCH ) );
+    }
+}
+
 /**
  * [PRIVATE] Synchronises the selected favourite station from a remote source to its remote counterpart
  * @param tab PanelID of the current tab
@@ -243,8 +296,7 @@ static int ctune_UI_sortStationList( ctune_UI_PanelID_e tab, int sort_by ) {
 static int ctune_UI_syncRemoteStation( ctune_UI_PanelID_e tab, int arg ) {
     ctune_UI_OptionsMenu.close( &ui.dialogs.optmenu );
 
-    const ctune_RadioStationInfo_t * rsi    = NULL;
-    Vector_t                         vector = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    const ctune_RadioStationInfo_t * rsi = NULL;
 
     if( tab == CTUNE_UI_PANEL_FAVOURITES ) {
         if( !ctune_UI_MainWin.isCtrlRowSelected( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES ) ) {
@@ -253,35 +305,170 @@ static int ctune_UI_syncRemoteStation( ctune_UI_PanelID_e tab, int arg ) {
     }
 
     if( rsi != NULL && ctune_RadioStationInfo.get.stationSource( rsi ) != CTUNE_STATIONSRC_LOCAL ) {
-        if( ctune_Controller.search.getStationsBy( RADIOBROWSER_STATION_BY_UUID, ctune_RadioStationInfo.get.stationUUID( rsi ), &vector ) ) {
+        ctune_Controller.search.cancel( ui.async.sync );
 
-            if( !Vector.empty( &vector ) ) {
-                ctune_UI_RSListWin_PageState_t view_state = ctune_UI_MainWin.getViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES );
+        ui.async.sync = ctune_Controller.search.getStationsByAsync( RADIOBROWSER_STATION_BY_UUID,
+                                                                   ctune_RadioStationInfo.get.stationUUID( rsi ),
+                                                                   ctune_UI_syncRemoteStationCb,
+                                                                   (void *) (intptr_t) ctune_RadioStationInfo.get.stationSource( rsi ) );
 
-                ctune_Controller.cfg.updateFavourite( Vector.at( &vector, 0 ), ctune_RadioStationInfo.get.stationSource( rsi ) );
-                ctune_UI_MainWin.ctrl.updateFavourites( &ui.main_win, ctune_Controller.cfg.getListOfFavourites );
+        if( ui.async.sync == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
+            ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_FETCH ) );
+        }
 
-                ctune_UI_MainWin.setViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES, view_state );
+    } else {
+        ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_LOCAL_STATION ) );
+    }
 
-                ctune_UI_MainWin.show( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES );
-                ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_SUCCESS ) );
+    update_panels();
+    doupdate();
 
-            } else {
-                ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_FETCH_REMOTE_NOT_FOUND ) );
-            }
+    return 1;
+}
+
+/**
+ * [PRIVATE/CALLBACK] Progress callback for the bulk synchronisation of the favourite stations
+ * @param done  Number of batches completed
+ * @param total Total number of batches
+ */
+static void ctune_UI_syncAllFavouritesProgressCb( size_t done, size_t total ) {
+    char msg[256];
+
+    snprintf( msg, 256, "%s (%lu/%lu)", ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_BULK_PROGRESS ), done, total );
+
+    ctune_UI_MainWin.print.statusMsg( &ui.main_win, msg );
+}
+
+/**
+ * [PRIVATE/CALLBACK] Completion callback for the bulk synchronisation of the favourite stations
+ * @param success Success state (false if a batch failed or the synchronisation was cancelled)
+ * @param updated Number of favourites updated
+ * @param missing Number of favourites not found on the remote
+ */
+static void ctune_UI_syncAllFavouritesDoneCb( bool success, size_t updated, size_t missing ) {
+    if( updated > 0 ) {
+        ctune_UI_RSListWin_PageState_t view_state = ctune_UI_MainWin.getViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES );
+
+        ctune_UI_MainWin.ctrl.updateFavourites( &ui.main_win, ctune_Controller.cfg.getListOfFavourites );
+        ctune_UI_MainWin.setViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES, view_state );
+    }
+
+    if( success ) {
+        char msg[256];
+
+        snprintf( msg, 256, "%s (%lu updated, %lu not found)", ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_BULK_SUCCESS ), updated, missing );
+
+        ctune_UI_MainWin.print.statusMsg( &ui.main_win, msg );
+
+    } else {
+        ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_BULK_FAIL ) );
+    }
+}
+
+/**
+ * [PRIVATE] Synchronises all the favourite stations from remote sources to their remote counterparts
+ * @param tab PanelID of the current tab
+ * @param arg (unused)
+ * @return 1 (unused)
+ */
+static int ctune_UI_syncAllFavourites( ctune_UI_PanelID_e tab, int arg ) {
+    (void) arg;
 
+    ctune_UI_OptionsMenu.close( &ui.dialogs.optmenu );
+
+    if( tab == CTUNE_UI_PANEL_FAVOURITES ) {
+        const size_t batches = ctune_Controller.cfg.syncFavourites( ctune_UI_syncAllFavouritesProgressCb,
+                                                                    ctune_UI_syncAllFavouritesDoneCb );
+
+        if( batches == 0 ) {
+            ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_BULK_NONE ) );
         } else {
-            ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_FETCH ) );
+            ctune_UI_syncAllFavouritesProgressCb( 0, batches );
+        }
+    }
+
+    update_panels();
+    doupdate();
+
+    return 1;
+}
+
+/**
+ * [PRIVATE/CALLBACK] Progress callback for the stream check of the favourite stations
+ * @param done  Number of streams checked
+ * @param total Total number of streams to check
+ * @param name  Name of the station just checked
+ * @param job   Finished stream test job
+ */
+static void ctune_UI_checkAllStreamsProgressCb( size_t done, size_t total, const char * name, const ctune_NetworkJob_t * job ) {
+    char msg[256];
+
+    if( job != NULL && !atomic_load( &job->cancel ) ) {
+        if( job->success ) {
+            snprintf( msg, 256, "%s (%lu/%lu) %s: %s %lukbps %.0fms",
+                      ctune_UI_Language.text( CTUNE_UI_TEXT_CHECK_STREAMS_PROGRESS ), done, total, ( name ? name : "" ),
+                      ( job->stream.codec._raw ? job->stream.codec._raw : "?" ), job->stream.bitrate, job->stream.latency_ms );
+        } else {
+            snprintf( msg, 256, "%s (%lu/%lu) %s: %s",
+                      ctune_UI_Language.text( CTUNE_UI_TEXT_CHECK_STREAMS_PROGRESS ), done, total, ( name ? name : "" ),
+                      ctune_UI_Language.text( CTUNE_UI_TEXT_STREAM_UNREACHABLE ) );
         }
 
     } else {
-        ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_SYNC_FAIL_LOCAL_STATION ) );
+        snprintf( msg, 256, "%s (%lu/%lu)", ctune_UI_Language.text( CTUNE_UI_TEXT_CHECK_STREAMS_PROGRESS ), done, total );
+    }
+
+    ctune_UI_MainWin.print.statusMsg( &ui.main_win, msg );
+}
+
+/**
+ * [PRIVATE/CALLBACK] Completion callback for the stream check of the favourite stations
+ * @param success     Success state (false if the check was cancelled)
+ * @param reachable   Number of streams reachable
+ * @param unreachable Number of streams unreachable
+ */
+static void ctune_UI_checkAllStreamsDoneCb( bool success, size_t reachable, size_t unreachable ) {
+    char msg[256];
+
+    if( ( reachable + unreachable ) > 0 ) {
+        ctune_UI_RSListWin_PageState_t view_state = ctune_UI_MainWin.getViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES );
+
+        ctune_UI_MainWin.ctrl.updateFavourites( &ui.main_win, ctune_Controller.cfg.getListOfFavourites );
+        ctune_UI_MainWin.setViewState( &ui.main_win, CTUNE_UI_PANEL_FAVOURITES, view_state );
+    }
+
+    snprintf( msg, 256, "%s (%lu reachable, %lu unreachable)",
+              ctune_UI_Language.text( success ? CTUNE_UI_TEXT_CHECK_STREAMS_SUCCESS : CTUNE_UI_TEXT_CHECK_STREAMS_CANCELLED ),
+              reachable, unreachable );
+
+    ctune_UI_MainWin.print.statusMsg( &ui.main_win, msg );
+}
+
+/**
+ * [PRIVATE] Checks the streams of all the local favourite stations
+ * @param tab PanelID of the current tab
+ * @param arg (unused)
+ * @return 1 (unused)
+ */
+static int ctune_UI_checkAllStreams( ctune_UI_PanelID_e tab, int arg ) {
+    (void) arg;
+
+    ctune_UI_OptionsMenu.close( &ui.dialogs.optmenu );
+
+    if( tab == CTUNE_UI_PANEL_FAVOURITES ) {
+        const size_t tests = ctune_Controller.cfg.checkFavouriteStreams( ctune_UI_checkAllStreamsProgressCb,
+                                                                         ctune_UI_checkAllStreamsDoneCb );
+
+        if( tests == 0 ) {
+            ctune_UI_MainWin.print.statusMsg( &ui.main_win, ctune_UI_Language.text( CTUNE_UI_TEXT_CHECK_STREAMS_NONE ) );
+        } else {
+            ctune_UI_checkAllStreamsProgressCb( 0, tests, NULL, NULL );
+        }
     }
 
     update_panels();
     doupdate();
 
-    Vector.clear_vector( &vector );
     return 1;
 }
 
@@ -736,6 +923,26 @@ static void ctune_UI_openSelectedStationInformationDialog( const ctune_RadioStat
     }
 }
 
+/**
+ * [PRIVATE/CALLBACK] Completion callback for the background search of the 'find station' dialog
+ * @param job  Finished network job
+ * @param data (unused)
+ */
+static void ctune_UI_loadFindResults( ctune_NetworkJob_t * job, void * data ) {
+    (void) data;
+
+    ui.async.find = CTUNE_NETWORKJOBS_HANDLE_NONE;
+
+    if( atomic_load( &job->cancel ) )
+        return; //EARLY RETURN - keeps whatever results were there before
+
+    if( job->success && !Vector.empty( &job->results ) ) {
+        ctune_UI_MainWin.ctrl.loadSearchResults( &ui.main_win, &job->results, &job->filter );
+    } else {
+        ctune_UI_MainWin.ctrl.clearSearchResults( &ui.main_win );
+    }
+}
+
 /**
  * [PRIVATE] Opens the 'find station' dialog window
  */
@@ -750,18 +957,31 @@ static void ctune_UI_openFindDialog( void ) {
     }
 
     if( ctune_UI_RSFind.captureInput( &ui.dialogs.rsfind ) == CTUNE_UI_FORM_SUBMIT ) {
-        Vector_t results = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+        ctune_Controller.search.cancel( ui.async.find );
 
-        bool ret = ctune_Controller.search.getStations( ctune_UI_RSFind.getFilter( &ui.dialogs.rsfind ), &results );
+        const ctune_RadioStationInfo_t * local_match = ctune_UI_RSFind.getQuickSearchResult( &ui.dialogs.rsfind );
 
-        if( ret && !Vector.empty( &results ) ) {
-            ctune_UI_MainWin.ctrl.loadSearchResults( &ui.main_win, &results, ctune_UI_RSFind.getFilter( &ui.dialogs.rsfind ) );
-        } else {
+        if( local_match != NULL ) { //jump straight to the picked station
+            Vector_t results = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+            ctune_RadioStationInfo_t * rsi = Vector.init_back( &results, ctune_RadioStationInfo.init );
+
+            if( rsi != NULL ) {
+                ctune_RadioStationInfo.copy( local_match, rsi );
+                ctune_UI_MainWin.ctrl.loadSearchResults( &ui.main_win, &results, NULL );
+            }
+
+            Vector.clear_vector( &results );
+            ctune_UI_MainWin.show( &ui.main_win, CTUNE_UI_PANEL_SEARCH );
+            return; //EARLY RETURN
+        }
+
+        ui.async.find = ctune_Controller.search.getStationsAsync( ctune_UI_RSFind.getFilter( &ui.dialogs.rsfind ), ctune_UI_loadFindResults, NULL );
+
+        if( ui.async.find == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
             ctune_UI_MainWin.ctrl.clearSearchResults( &ui.main_win );
         }
 
         ctune_UI_MainWin.show( &ui.main_win, CTUNE_UI_PANEL_SEARCH );
-        Vector.clear_vector( &results );
     }
 }
 
@@ -891,6 +1111,8 @@ static void ctune_UI_openOptionsMenuDialog( ctune_UI_PanelID_e tab ) {
             ctune_UI_OptionsMenu.cb.setEditStationCallback( &ui.dialogs.optmenu, ctune_UI_openEditSelectedStationDialog );
             ctune_UI_OptionsMenu.cb.setToggleFavouriteCallback( &ui.dialogs.optmenu, ctune_UI_toggleFavourite );
             ctune_UI_OptionsMenu.cb.setSyncCurrSelectedStationCallback( &ui.dialogs.optmenu, ctune_UI_syncRemoteStation );
+            ctune_UI_OptionsMenu.cb.setSyncAllStationsCallback( &ui.dialogs.optmenu, ctune_UI_syncAllFavourites );
+            ctune_UI_OptionsMenu.cb.setCheckAllStreamsCallback( &ui.dialogs.optmenu, ctune_UI_checkAllStreams );
             ctune_UI_OptionsMenu.cb.setFavouriteTabThemingCallback( &ui.dialogs.optmenu, ctune_UI_setFavouriteTabTheming );
             ctune_UI_OptionsMenu.cb.setListRowSizeLargeCallback( &ui.dialogs.optmenu, ctune_UI_setCurrListRowSize );
             ctune_UI_OptionsMenu.cb.setGetUIConfigCallback( &ui.dialogs.optmenu, ctune_Controller.cfg.getUIConfig );
@@ -1020,6 +1242,17 @@ static void ctune_UI_processEvent( ctune_UI_Event_t * event ) {
             );
 
             ctune_UI_MainWin.ctrl.setCurrStation( &ui.main_win, event->data.pointer );
+            ++ui.station_changes;
+        } break;
+
+        case EVENT_SEARCH_JOB_COMPLETE: {
+            CTUNE_LOG( CTUNE_LOG_DEBUG,
+                       "[ctune_UI_processEvents( %p )] Dequeued search job complete event.",
+                       event
+            );
+
+            ctune_Controller.search.complete( event->data.pointer );
+            ui.async.refresh = true;
         } break;
     }
 }
@@ -1034,7 +1267,7 @@ static void ctune_UI_runKeyInterfaceLoop() {
     int                 pending_state  = ACTION_CANCELED;
 
     while( !( pending_action == CTUNE_UI_ACTION_QUIT && ( pending_state & ACTION_CONFIRMED ) ) ) {
-        character      = getch();
+        character      = ctune_UI_Input.getChar( stdscr );
         current_action = ctune_UI_KeyBinding.getAction( ctune_UI_MainWin.currentContext( &ui.main_win ), character );
 
         if( pending_action == CTUNE_UI_ACTION_QUIT && pending_state & ACTION_REQUEST && current_action != CTUNE_UI_ACTION_ERR ) {
@@ -1106,6 +1339,10 @@ static void ctune_UI_runKeyInterfaceLoop() {
             } break;
 
             case CTUNE_UI_ACTION_GO_BACK: {
+                if( ctune_Controller.search.pending() > 0 ) {
+                    ctune_Controller.search.cancelAll();
+                }
+
                 ctune_UI_MainWin.print.clearMsgLine( &ui.main_win );
                 ctune_UI_MainWin.show( &ui.main_win, ctune_UI_MainWin.previousPanelID( &ui.main_win ) );
             } break;
@@ -1237,6 +1474,11 @@ static void ctune_UI_runKeyInterfaceLoop() {
                 if( !ctune_UI_EventQueue.empty() ) {
                     ctune_UI_EventQueue.flush();
                 }
+
+                if( ui.async.refresh ) { //deferred to here so that results don't get drawn over any open dialogs
+                    ui.async.refresh = false;
+                    ctune_UI_MainWin.show( &ui.main_win, ctune_UI_MainWin.currentPanelID( &ui.main_win ) );
+                }
             } break;
 
             default: break;
@@ -1282,7 +1524,7 @@ static bool ctune_UI_setup( bool show_cursor ) {
     ui.screen_size = ctune_UI_getScreenSize();
     ui.main_win    = ctune_UI_MainWin.create( ctune_UI_Language.text, &ui.screen_size );
 
-    ctune_UI_MainWin.cb.setStationStateGetterCallback( &ui.main_win, ctune_UI_getStationState );
+    ctune_UI_MainWin.cb.setStationStateGetterCallback( &ui.main_win, ctune_UI_getStationState, ctune_UI_getStationStateVersion );
     ctune_UI_MainWin.cb.setOpenInfoDialogCallback( &ui.main_win, ctune_UI_openSelectedStationInformationDialog );
     ctune_UI_MainWin.cb.setPlayStationCallback( &ui.main_win, ctune_Controller.playback.start );
     ctune_UI_MainWin.cb.setOpenInfoDialogCallback( &ui.main_win, ctune_UI_openSelectedStationInformationDialog );
@@ -1305,9 +1547,10 @@ static bool ctune_UI_setup( bool show_cursor ) {
 
     const bool main_win_is_init = ctune_UI_MainWin.init( &ui.main_win,
                                                          ui_config,
-                                                         ctune_Controller.search.getStations,
+                                                         ctune_Controller.search.getStationsAsync,
                                                          ctune_Controller.search.getCategoryItems,
-                                                         ctune_Controller.search.getStationsBy,
+                                                         ctune_Controller.search.getStationsByAsync,
+                                                         ctune_Controller.search.cancel,
                                                          ctune_Controller.cfg.toggleFavourite );
 
     if( main_win_is_init ) {
@@ -1323,7 +1566,6 @@ static bool ctune_UI_setup( bool show_cursor ) {
     cbreak();
     noecho();
     keypad( stdscr, TRUE );
-    halfdelay( 1 );
 
     bool mouse_nav = ctune_UIConfig.mouse.enabled( ui_config, FLAG_GET_VALUE );
 
@@ -1367,6 +1609,7 @@ static bool ctune_UI_setup( bool show_cursor ) {
         return false; //EARLY RETURN
 
     } else {
+        ctune_UI_RSFind.setQuickSearchCallback( &ui.dialogs.rsfind, ctune_Controller.search.quickSearch );
         ui.init_stages[CTUNE_UI_INITSTAGE_RSFIND] = true;
     }
 
@@ -1374,7 +1617,8 @@ static bool ctune_UI_setup( bool show_cursor ) {
     ui.dialogs.rsedit = ctune_UI_RSEdit.create( &ui.screen_size,
                                                 ctune_UI_Language.text,
                                                 ctune_UI_generateLocalUUID,
-                                                ctune_Controller.playback.testStream,
+                                                ctune_Controller.playback.testStreamAsync,
+                                                ctune_Controller.playback.cancelStreamTest,
                                                 ctune_Controller.playback.validateURL );
     if( !ctune_UI_RSEdit.init( &ui.dialogs.rsedit, mouse_nav ) ) {
         CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_UI_setup( %i )] Could not init RSEdit dialog.", show_cursor );
@@ -1643,6 +1887,15 @@ static void ctune_UI_printStatusMsg( const char * info_str ) {
     ctune_UI_EventQueue.add( &event );
 }
 
+/**
+ * [THREAD SAFE] Queues a finished background search to be completed on the UI thread
+ * @param job Finished network job
+ */
+static void ctune_UI_completeSearchJob( ctune_NetworkJob_t * job ) {
+    ctune_UI_Event_t event = (ctune_UI_Event_t) { .type = EVENT_SEARCH_JOB_COMPLETE, .data.pointer = job };
+    ctune_UI_EventQueue.add( &event );
+}
+
 /**
  * Sets the callback to use when a volume change occurs without anything playing
  * @param cb Callback method
@@ -1666,5 +1919,6 @@ const struct ctune_UI_Instance ctune_UI = {
     .printSearchingState       = &ctune_UI_printSearchingState,
     .printError                = &ctune_UI_printError,
     .printStatusMsg            = &ctune_UI_printStatusMsg,
+    .completeSearchJob         = &ctune_UI_completeSearchJob,
     .setQuietVolChangeCallback = &ctune_UI_setQuietVolChangeCallback,
 };
\ No newline at end of file
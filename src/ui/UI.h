@@ -12,6 +12,7 @@
 #include "../dto/ArgOptions.h"
 #include "../dto/RadioStationInfo.h"
 #include "../enum/PlaybackCtrl.h"
+#include "../network/NetworkJobs.h"
 #include "enum/PanelID.h"
 #include "definitions/Language.h"
 
@@ -81,6 +82,12 @@ struct ctune_UI_Instance {
      */
     void (* printStatusMsg)( const char * info_str );
 
+    /**
+     * [THREAD SAFE] Queues a finished background search to be completed on the UI thread
+     * @param job Finished network job
+     */
+    void (* completeSearchJob)( ctune_NetworkJob_t * job );
+
     /**
      * Sets the callback to use when a volume change occurs without anything playing
      * @param cb Callback method
@@ -59,6 +59,7 @@ static const char * field_str[CTUNE_UI_TEXT_ENUM_COUNT] = {
     [CTUNE_UI_TEXT_LABEL_ORDER_BY                   ] = "Order by",
     [CTUNE_UI_TEXT_LABEL_REVERSE_ORDER              ] = "Reverse order",
     [CTUNE_UI_TEXT_LABEL_EXACT_MATCH                ] = "Exact match",
+    [CTUNE_UI_TEXT_LABEL_LOCAL_MATCHES              ] = "Local matches",
     [CTUNE_UI_TEXT_LABEL_GEO_COORDS                 ] = "Geo (x,y)",
     [CTUNE_UI_TEXT_LABEL_GEO_DISTANCE               ] = "Geo distance",
     [CTUNE_UI_TEXT_LABEL_STATION_SOURCE             ] = "Source",
@@ -133,6 +134,7 @@ static const char * field_str[CTUNE_UI_TEXT_ENUM_COUNT] = {
     [CTUNE_UI_TEXT_MENU_EDIT_STATION                ] = "Edit selected",
     [CTUNE_UI_TEXT_MENU_TOGGLE_FAV                  ] = "Remove selected",
     [CTUNE_UI_TEXT_MENU_SYNC_UPSTREAM_BULK          ] = "Sync all",
+    [CTUNE_UI_TEXT_MENU_CHECK_STREAMS_BULK          ] = "Check all streams",
     [CTUNE_UI_TEXT_MENU_SYNC_UPSTREAM               ] = "Sync selected",
     [CTUNE_UI_TEXT_MENU_OPTIONS                     ] = "Options",
     [CTUNE_UI_TEXT_MENU_UI_THEME                    ] = "UI Theme",
@@ -152,6 +154,7 @@ static const char * field_str[CTUNE_UI_TEXT_ENUM_COUNT] = {
     [CTUNE_UI_TEXT_BUTTON_SUBMIT                    ] = "[ Submit ]",
     [CTUNE_UI_TEXT_BUTTON_SAVE                      ] = "[  Save  ]",
     [CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM         ] = "[ Auto-detect/Test ]",
+    [CTUNE_UI_TEXT_BUTTON_TESTING_STREAM            ] = "[    Testing...    ]",
     [CTUNE_UI_TEXT_ERROR                            ] = "ERROR",
     [CTUNE_UI_TEXT_ELLIPSIS_LINE                    ] = "....",
     [CTUNE_UI_TEXT_STOP_LINE                        ] = "----",
@@ -166,6 +169,15 @@ static const char * field_str[CTUNE_UI_TEXT_ENUM_COUNT] = {
     [CTUNE_UI_TEXT_SYNC_FAIL_FETCH                  ] = "Failed station synchronisation: see log",
     [CTUNE_UI_TEXT_SYNC_FAIL_FETCH_REMOTE_NOT_FOUND ] = "Failed station synchronisation: remote station does not exist (deleted?)",
     [CTUNE_UI_TEXT_SYNC_FAIL_LOCAL_STATION          ] = "Failed station synchronisation: local stations are not sync-able",
+    [CTUNE_UI_TEXT_SYNC_BULK_PROGRESS               ] = "Synchronising favourites with remote...",
+    [CTUNE_UI_TEXT_SYNC_BULK_SUCCESS                ] = "Favourites synchronised with remote.",
+    [CTUNE_UI_TEXT_SYNC_BULK_FAIL                   ] = "Failed favourites synchronisation: see log",
+    [CTUNE_UI_TEXT_SYNC_BULK_NONE                   ] = "No favourites from remote sources to synchronise (or already synchronising)",
+    [CTUNE_UI_TEXT_CHECK_STREAMS_PROGRESS           ] = "Checking favourite streams...",
+    [CTUNE_UI_TEXT_CHECK_STREAMS_SUCCESS            ] = "Favourite streams checked.",
+    [CTUNE_UI_TEXT_CHECK_STREAMS_CANCELLED          ] = "Favourite streams check cancelled.",
+    [CTUNE_UI_TEXT_CHECK_STREAMS_NONE               ] = "No local favourites to check (or already checking)",
+    [CTUNE_UI_TEXT_STREAM_UNREACHABLE               ] = "unreachable",
     [CTUNE_UI_TEXT_HELP                             ] = "Help",
     [CTUNE_UI_TEXT_HELP_KEY                         ] = "Show/Hide contextual help",
     [CTUNE_UI_TEXT_HELP_ESC                         ] = "Go back",
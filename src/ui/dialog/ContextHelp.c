@@ -14,6 +14,7 @@
 #include "../datastructure/WindowMargin.h"
 #include "../widget/Dialog.h"
 #include "../EventQueue.h"
+#include "../Input.h"
 #include "../Resizer.h"
 
 /**
@@ -435,7 +436,7 @@ static void ctune_UI_ContextHelp_captureInput() {
     MEVENT mouse_event;
 
     while( !exit ) {
-        ch = wgetch( private.cache.dialogs[ctx].canvas.pad );
+        ch = ctune_UI_Input.getChar( private.cache.dialogs[ctx].canvas.pad );
 
         switch( ch ) {
             case ERR: {
@@ -4,6 +4,7 @@
 #include "../definitions/KeyBinding.h"
 #include "../definitions/Theme.h"
 #include "../EventQueue.h"
+#include "../Input.h"
 #include "../Resizer.h"
 #include "ContextHelp.h"
 
@@ -1293,6 +1294,40 @@ static int ctune_UI_Dialog_OptionsMenu_populateRootMenu( ctune_UI_OptionsMenu_t
         }
     }
 
+    if( om->cb.syncUpstreamBulk != NULL ) { //Synchronize all stations with upstream
+        const char                * text      = om->cb.getDisplayText( CTUNE_UI_TEXT_MENU_SYNC_UPSTREAM_BULK );
+        CbPayload_t               * payload   = createCbPayload( om, &om->cache.payloads, om->cb.syncUpstreamBulk, 0 );
+        ctune_UI_SlideMenu_Item_t * menu_item = ctune_UI_SlideMenu.createMenuItem( &om->menu.root, CTUNE_UI_SLIDEMENU_LEAF, text, payload, ctrlMenuFunctionCb );
+
+        if( payload && menu_item ) {
+            max_text_width = ctune_max_ul( max_text_width, strlen( text ) );
+
+        } else {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_UI_Dialog_OptionsMenu_populateRootMenu( %p )] Failed creation of menu item '%s'.",
+                       om, text
+            );
+            error_state = true;
+        }
+    }
+
+    if( om->cb.checkStreamsBulk != NULL ) { //Check the streams of all local stations
+        const char                * text      = om->cb.getDisplayText( CTUNE_UI_TEXT_MENU_CHECK_STREAMS_BULK );
+        CbPayload_t               * payload   = createCbPayload( om, &om->cache.payloads, om->cb.checkStreamsBulk, 0 );
+        ctune_UI_SlideMenu_Item_t * menu_item = ctune_UI_SlideMenu.createMenuItem( &om->menu.root, CTUNE_UI_SLIDEMENU_LEAF, text, payload, ctrlMenuFunctionCb );
+
+        if( payload && menu_item ) {
+            max_text_width = ctune_max_ul( max_text_width, strlen( text ) );
+
+        } else {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_UI_Dialog_OptionsMenu_populateRootMenu( %p )] Failed creation of menu item '%s'.",
+                       om, text
+            );
+            error_state = true;
+        }
+    }
+
     if( om->cb.favTabTheming != NULL || om->cb.listRowSizeLarge != NULL ) { //Configuration menu
         const char                * text      = om->cb.getDisplayText( CTUNE_UI_TEXT_MENU_CONFIGURATION );
         ctune_UI_SlideMenu_Item_t * menu_item = ctune_UI_SlideMenu.createMenuItem( &om->menu.root, CTUNE_UI_SLIDEMENU_MENU, text, NULL, NULL );
@@ -1351,6 +1386,8 @@ static ctune_UI_OptionsMenu_t ctune_UI_Dialog_OptionsMenu_create( const WindowPr
             .editStation         = NULL,
             .toggleFavourite     = NULL,
             .syncUpstream        = NULL,
+            .syncUpstreamBulk    = NULL,
+            .checkStreamsBulk    = NULL,
             .favTabTheming       = NULL,
             .favTabCustomTheming = NULL,
             .listRowSizeLarge    = NULL,
@@ -1530,7 +1567,7 @@ static void ctune_UI_Dialog_OptionsMenu_captureInput( ctune_UI_OptionsMenu_t * o
     MEVENT       mouse_event;
 
     while( om->cache.input_captured ) {
-        character = wgetch( om->menu.canvas_win );
+        character = ctune_UI_Input.getChar( om->menu.canvas_win );
 
         switch( ctune_UI_KeyBinding.getAction( CTUNE_UI_CTX_OPT_MENU, character ) ) {
             case CTUNE_UI_ACTION_ERR: {
@@ -1666,6 +1703,28 @@ static void ctune_UI_Dialog_OptionsMenu_cb_setSyncCurrSelectedStation( ctune_UI_
     }
 }
 
+/**
+ * Sets the callback method to sync all favourites from remote sources with their upstream counterparts
+ * @param om       Pointer to ctune_UI_OptionsMenu_t object
+ * @param callback Callback function
+ */
+static void ctune_UI_Dialog_OptionsMenu_cb_setSyncAllStations( ctune_UI_OptionsMenu_t * om, OptionsMenuCb_fn callback ) {
+    if( om != NULL ) {
+        om->cb.syncUpstreamBulk = callback;
+    }
+}
+
+/**
+ * Sets the callback method to check the streams of all local favourites
+ * @param om       Pointer to ctune_UI_OptionsMenu_t object
+ * @param callback Callback function
+ */
+static void ctune_UI_Dialog_OptionsMenu_cb_setCheckAllStreams( ctune_UI_OptionsMenu_t * om, OptionsMenuCb_fn callback ) {
+    if( om != NULL ) {
+        om->cb.checkStreamsBulk = callback;
+    }
+}
+
 /**
  * Sets the callback method to set/get the "favourite" tab's theming
  * @param om       Pointer to ctune_UI_OptionsMenu_t object
@@ -1824,6 +1883,8 @@ const struct ctune_UI_Dialog_OptionsMenu_Namespace ctune_UI_OptionsMenu = {
         .setEditStationCallback             = &ctune_UI_Dialog_OptionsMenu_cb_setEditStation,
         .setToggleFavouriteCallback         = &ctune_UI_Dialog_OptionsMenu_cb_setToggleFavourite,
         .setSyncCurrSelectedStationCallback = &ctune_UI_Dialog_OptionsMenu_cb_setSyncCurrSelectedStation,
+        .setSyncAllStationsCallback         = &ctune_UI_Dialog_OptionsMenu_cb_setSyncAllStations,
+        .setCheckAllStreamsCallback         = &ctune_UI_Dialog_OptionsMenu_cb_setCheckAllStreams,
         .setFavouriteTabThemingCallback     = &ctune_UI_Dialog_OptionsMenu_cb_setFavThemingCallback,
         .setFavTabCustomThemingCallback     = &ctune_UI_Dialog_OptionsMenu_cb_setFavTabCustomThemingCallback,
         .setListRowSizeLargeCallback        = &ctune_UI_Dialog_OptionsMenu_cb_setSetListRowSizeLarge,
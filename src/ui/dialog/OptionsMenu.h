@@ -49,6 +49,8 @@ typedef struct ctune_UI_Dialog_OptionsMenu {
         int                (* editStation)( ctune_UI_PanelID_e tab, int /* unused */ );
         int                (* toggleFavourite)( ctune_UI_PanelID_e tab, int /* unused */ );
         int                (* syncUpstream)( ctune_UI_PanelID_e tab, int /* unused */ );
+        int                (* syncUpstreamBulk)( ctune_UI_PanelID_e tab, int /* unused */ );
+        int                (* checkStreamsBulk)( ctune_UI_PanelID_e tab, int /* unused */ );
         int                (* favTabTheming)( ctune_UI_PanelID_e tab, int action_flag_e );
         int                (* favTabCustomTheming)( ctune_UI_PanelID_e tab, int action_flag_e );
         int                (* listRowSizeLarge)( ctune_UI_PanelID_e tab, int action_flag_e );
@@ -161,6 +163,20 @@ extern const struct ctune_UI_Dialog_OptionsMenu_Namespace {
          */
         void (* setSyncCurrSelectedStationCallback)( ctune_UI_OptionsMenu_t * om, OptionsMenuCb_fn callback );
 
+        /**
+         * Sets the callback method to sync all favourites from remote sources with their upstream counterparts
+         * @param om       Pointer to ctune_UI_OptionsMenu_t object
+         * @param callback Callback function
+         */
+        void (* setSyncAllStationsCallback)( ctune_UI_OptionsMenu_t * om, OptionsMenuCb_fn callback );
+
+        /**
+         * Sets the callback method to check the streams of all local favourites
+         * @param om       Pointer to ctune_UI_OptionsMenu_t object
+         * @param callback Callback function
+         */
+        void (* setCheckAllStreamsCallback)( ctune_UI_OptionsMenu_t * om, OptionsMenuCb_fn callback );
+
         /**
          * Sets the callback method to set/get the "favourite" tab's theming
          * @param om       Pointer to ctune_UI_OptionsMenu_t object
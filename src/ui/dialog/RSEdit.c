@@ -96,12 +96,110 @@ static void ctune_UI_RSEdit_highlightCurrField( ctune_UI_RSEdit_t * rsedit ) {
     }
 }
 
+/**
+ * [PRIVATE] Sets the auto-detect button's text and colour
+ * @param rsedit Pointer to a ctune_UI_RSEdit_t object
+ * @param text   Button text ID
+ * @param colour Button foreground theme item
+ */
+static void ctune_UI_RSEdit_setAutodetectButton( ctune_UI_RSEdit_t * rsedit, ctune_UI_TextID_e text, ctune_UI_ThemeItem_e colour ) {
+    ctune_UI_Form.field.setBuffer( &rsedit->form, BUTTON_AUTODETECT, rsedit->cb.getDisplayText( text ) );
+    ctune_UI_Form.field.setBackground( &rsedit->form, BUTTON_AUTODETECT, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_DFLT ) );
+    ctune_UI_Form.field.setForeground( &rsedit->form, BUTTON_AUTODETECT, ctune_UI_Theme.color( colour ) );
+}
+
+/**
+ * [PRIVATE] Cancels the background stream test in progress if any
+ * @param rsedit Pointer to a ctune_UI_RSEdit_t object
+ * @return Cancellation state (false if there was no test in progress)
+ */
+static bool ctune_UI_RSEdit_cancelStreamTest( ctune_UI_RSEdit_t * rsedit ) {
+    if( rsedit->cache.stream_test == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
+        return false; //EARLY RETURN
+    }
+
+    rsedit->cb.cancelStreamTest( rsedit->cache.stream_test );
+    rsedit->cache.stream_test = CTUNE_NETWORKJOBS_HANDLE_NONE;
+
+    ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM, CTUNE_UI_ITEM_BUTTON_DFLT );
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_RSEdit_cancelStreamTest( %p )] Stream test cancelled.", rsedit );
+
+    return true;
+}
+
+/**
+ * [PRIVATE/CALLBACK] Completion callback for the background stream test of the auto-detect action
+ * @param job  Finished stream test job
+ * @param data Pointer to the ctune_UI_RSEdit_t object
+ */
+static void ctune_UI_RSEdit_autodetectStreamPropertiesCb( ctune_NetworkJob_t * job, void * data ) {
+    ctune_UI_RSEdit_t        * rsedit    = data;
+    ctune_RadioStationInfo_t * rsi       = &rsedit->cache.station;
+    String_t                   bitrate   = String.init();
+    String_t                   timestamp = String.init();
+
+    rsedit->cache.stream_test = CTUNE_NETWORKJOBS_HANDLE_NONE;
+
+    if( atomic_load( &job->cancel ) ) { //i.e.: aborted with all the other network jobs
+        ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM, CTUNE_UI_ITEM_BUTTON_DFLT );
+        goto end;
+    }
+
+    ctune_RadioStationInfo.clearCheckTimestamps( rsi );
+    ctune_timestampISO8601( &timestamp );
+
+    if( job->success ) {
+        if( rsi->codec != NULL ) {
+            free( rsi->codec );
+            rsi->codec = NULL;
+        }
+
+        ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM, CTUNE_UI_ITEM_BUTTON_VALID );
+
+        ctune_strupr( job->stream.codec._raw );
+        ctune_UI_Form.field.setBuffer( &rsedit->form, INPUT_CODEC, ( job->stream.codec._raw == NULL ? "" : job->stream.codec._raw ) );
+
+        rsi->bitrate = job->stream.bitrate;
+
+        if( rsi->bitrate > 0 ) { //Bitrate field (ulong)
+            ctune_utos( rsi->bitrate, &bitrate );
+            ctune_UI_Form.field.setBuffer( &rsedit->form, INPUT_BITRATE, bitrate._raw );
+        }
+
+        ctune_RadioStationInfo.set.lastCheckOK( rsi, true );
+        ctune_RadioStationInfo.set.lastCheckOkTS( rsi, strdup( timestamp._raw ) );
+
+    } else {
+        ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM, CTUNE_UI_ITEM_BUTTON_INVALID );
+    }
+
+    ctune_RadioStationInfo.set.lastCheckTS( rsi, strdup( timestamp._raw ) );
+    ctune_RadioStationInfo.set.lastLocalCheckTS( rsi, strdup( timestamp._raw ) );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_UI_RSEdit_autodetectStreamPropertiesCb( %p, %p )] Stream \"%s\" %s (%.0fms).",
+               job, data, job->term._raw, ( job->success ? "OK" : "unreachable" ), job->stream.latency_ms
+    );
+
+    end:
+        ctune_UI_Form.display.refreshView( &rsedit->form );
+        String.free( &timestamp );
+        String.free( &bitrate );
+}
+
 /**
  * [PRIVATE] Performs the auto-detect action for the associated button (current field)
+ * -
+ * The stream is tested in the background: the button shows the test is in progress until the result
+ * comes in and triggering it again meanwhile cancels the test.
  * @param rsedit Pointer to a ctune_UI_RSEdit_t object
  * @param rsi    Pointer to cached RadioStationInfo_t object
  */
 static void ctune_UI_RSEdit_autodetectStreamProperties( ctune_UI_RSEdit_t * rsedit, ctune_RadioStationInfo_t * rsi ) {
+    if( ctune_UI_RSEdit_cancelStreamTest( rsedit ) ) {
+        return; //EARLY RETURN
+    }
+
     if( ctune_UI_Form.field.status( &rsedit->form, INPUT_URL ) ) {
         char * buffer = ctune_UI_Form.field.buffer( &rsedit->form, INPUT_URL );
         ctune_RadioStationInfo.set.stationURL( rsi, ctune_trimspace( buffer ) );
@@ -112,13 +210,11 @@ static void ctune_UI_RSEdit_autodetectStreamProperties( ctune_UI_RSEdit_t * rsed
         ctune_RadioStationInfo.set.resolvedURL( rsi, ctune_trimspace( buffer ) );
     }
 
-    const int  current_field_i  = ctune_UI_Form.field.currentIndex( &rsedit->form );
     const bool has_url          = ( ctune_RadioStationInfo.get.stationURL( rsi )  != NULL && strlen( ctune_RadioStationInfo.get.stationURL( rsi ) )  > 0 );
     const bool has_url_resolved = ( ctune_RadioStationInfo.get.resolvedURL( rsi ) != NULL && strlen( ctune_RadioStationInfo.get.resolvedURL( rsi ) ) > 0 );
 
     if( !has_url_resolved && !has_url ) { //i.e.: no URLs
-        ctune_UI_Form.field.setBackground( &rsedit->form, current_field_i, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_DFLT    ) );
-        ctune_UI_Form.field.setForeground( &rsedit->form, current_field_i, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_INVALID ) );
+        ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM, CTUNE_UI_ITEM_BUTTON_INVALID );
 
         ctune_UI_Form.field.setCurrent( &rsedit->form, INPUT_RESOLVED_URL );
         ctune_UI_RSEdit_highlightCurrField( rsedit );
@@ -126,52 +222,24 @@ static void ctune_UI_RSEdit_autodetectStreamProperties( ctune_UI_RSEdit_t * rsed
         return; //EARLY RETURN
     }
 
-    String_t     codec     = String.init();
-    String_t     bitrate   = String.init();
-    String_t     timestamp = String.init();
-    const char * url       = ( has_url_resolved ? ctune_RadioStationInfo.get.resolvedURL( rsi )
-                                                : ctune_RadioStationInfo.get.stationURL( rsi ) );
+    const char * url = ( has_url_resolved ? ctune_RadioStationInfo.get.resolvedURL( rsi )
+                                          : ctune_RadioStationInfo.get.stationURL( rsi ) );
 
     if( rsedit->cb.validateURL( url ) ) {
-        ctune_RadioStationInfo.clearCheckTimestamps( rsi );
-        ctune_timestampISO8601( &timestamp );
-
-        if( rsedit->cb.testStream( url, &codec, &rsi->bitrate ) ) {
-            if( rsi->codec != NULL ) {
-                free( rsi->codec );
-                rsi->codec = NULL;
-            }
-
-            ctune_UI_Form.field.setBackground( &rsedit->form, current_field_i, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_DFLT  ) );
-            ctune_UI_Form.field.setForeground( &rsedit->form, current_field_i, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_VALID ) );
-
-            ctune_strupr( codec._raw );
-            ctune_UI_Form.field.setBuffer( &rsedit->form, INPUT_CODEC, ( codec._raw == NULL ? "" : codec._raw ) );
-
-            if( rsi->bitrate > 0 ) { //Bitrate field (ulong)
-                ctune_utos( rsi->bitrate, &bitrate );
-                ctune_UI_Form.field.setBuffer( &rsedit->form, INPUT_BITRATE, bitrate._raw );
-            }
+        rsedit->cache.stream_test = rsedit->cb.testStreamAsync( url, ctune_UI_RSEdit_autodetectStreamPropertiesCb, rsedit );
 
-            ctune_RadioStationInfo.set.lastCheckOK( rsi, true );
-            ctune_RadioStationInfo.set.lastCheckOkTS( rsi, strdup( timestamp._raw ) );
+        if( rsedit->cache.stream_test == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSEdit_autodetectStreamProperties( %p, %p )] Failed to start stream test: %s", rsedit, rsi, url );
+            ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM, CTUNE_UI_ITEM_BUTTON_INVALID );
 
         } else {
-            ctune_UI_Form.field.setBackground( &rsedit->form, current_field_i, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_DFLT    ) );
-            ctune_UI_Form.field.setForeground( &rsedit->form, current_field_i, ctune_UI_Theme.color( CTUNE_UI_ITEM_BUTTON_INVALID ) );
+            ctune_UI_RSEdit_setAutodetectButton( rsedit, CTUNE_UI_TEXT_BUTTON_TESTING_STREAM, CTUNE_UI_ITEM_BUTTON_DFLT );
         }
 
-        ctune_RadioStationInfo.set.lastCheckTS( rsi, strdup( timestamp._raw ) );
-        ctune_RadioStationInfo.set.lastLocalCheckTS( rsi, strdup( timestamp._raw ) );
-
     } else {
         ctune_UI_Form.field.setCurrent( &rsedit->form, ( has_url_resolved ? INPUT_RESOLVED_URL : INPUT_URL ) );
         ctune_UI_RSEdit_highlightCurrField( rsedit );
     }
-
-    String.free( &timestamp );
-    String.free( &bitrate );
-    String.free( &codec );
 }
 
 /**
@@ -794,30 +862,34 @@ static bool ctune_UI_RSEdit_initForm( void * rsedit ) {
 
 /**
  * Creates a base ctune_UI_RSEdit_t object
- * @param parent         Pointer to size property of the parent window
- * @param getDisplayText Callback method to get text strings for the display
- * @param generateUUID   Callback method to create a unique UUID for new stations
- * @param testStream     Callback method to test and get codec/bitrate from a stream URL
- * @param validateURL    Callback method to check the validity of a URL string
+ * @param parent           Pointer to size property of the parent window
+ * @param getDisplayText   Callback method to get text strings for the display
+ * @param generateUUID     Callback method to create a unique UUID for new stations
+ * @param testStreamAsync  Callback method to test and get codec/bitrate from a stream URL in the background
+ * @param cancelStreamTest Callback method to cancel a background stream test
+ * @param validateURL      Callback method to check the validity of a URL string
  * @return Basic un-initialised ctune_UI_RSEdit_t object
  */
 static ctune_UI_RSEdit_t ctune_UI_RSEdit_create( const WindowProperty_t * parent,
-                                                 const char * (* getDisplayText)( ctune_UI_TextID_e ),
-                                                 bool         (* generateUUID)( String_t * ),
-                                                 bool         (* testStream)( const char *, String_t *, ulong * ),
-                                                 bool         (* validateURL)( const char * ) )
+                                                 const char *      (* getDisplayText)( ctune_UI_TextID_e ),
+                                                 bool              (* generateUUID)( String_t * ),
+                                                 ctune_JobHandle_t (* testStreamAsync)( const char *, ctune_NetworkJob_Callback_f, void * ),
+                                                 void              (* cancelStreamTest)( ctune_JobHandle_t ),
+                                                 bool              (* validateURL)( const char * ) )
 {
     return (ctune_UI_RSEdit_t) {
         .initialised = false,
         .form        = ctune_UI_Form.create( parent, getDisplayText( CTUNE_UI_TEXT_WIN_TITLE_RSEDIT ) ),
         .cache = {
             .max_label_width = 0,
+            .stream_test     = CTUNE_NETWORKJOBS_HANDLE_NONE,
         },
         .cb = {
-            .getDisplayText = getDisplayText,
-            .generateUUID   = generateUUID,
-            .testStream     = testStream,
-            .validateURL    = validateURL
+            .getDisplayText   = getDisplayText,
+            .generateUUID     = generateUUID,
+            .testStreamAsync  = testStreamAsync,
+            .cancelStreamTest = cancelStreamTest,
+            .validateURL      = validateURL
         },
     };
 }
@@ -845,8 +917,13 @@ static bool ctune_UI_RSEdit_init( ctune_UI_RSEdit_t * rsedit, bool mouse_ctrl )
             error_state = true;
         }
 
-        if( rsedit->cb.testStream == NULL ) {
-            CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_UI_RSEdit_init( %p )] Callback methods not set: 'testStream'", rsedit );
+        if( rsedit->cb.testStreamAsync == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_UI_RSEdit_init( %p )] Callback methods not set: 'testStreamAsync'", rsedit );
+            error_state = true;
+        }
+
+        if( rsedit->cb.cancelStreamTest == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_FATAL, "[ctune_UI_RSEdit_init( %p )] Callback methods not set: 'cancelStreamTest'", rsedit );
             error_state = true;
         }
 
@@ -1094,8 +1171,10 @@ static ctune_FormExit_e ctune_UI_RSEdit_captureInput( ctune_UI_RSEdit_t * rsedit
             } break;
 
             case CTUNE_UI_ACTION_ESC: {
-                exit_state = CTUNE_UI_FORM_ESC;
-                exit = true;
+                if( !ctune_UI_RSEdit_cancelStreamTest( rsedit ) ) {
+                    exit_state = CTUNE_UI_FORM_ESC;
+                    exit = true;
+                }
             } break;
 
             case CTUNE_UI_ACTION_FIELD_BEGIN: {
@@ -1215,6 +1294,7 @@ static ctune_FormExit_e ctune_UI_RSEdit_captureInput( ctune_UI_RSEdit_t * rsedit
         ctune_UI_Form.display.refreshView( &rsedit->form );
     }
 
+    ctune_UI_RSEdit_cancelStreamTest( rsedit );
     ctune_UI_Form.input.stop( &rsedit->form );
 
     return ( exit_state );
@@ -13,6 +13,7 @@
 #include "../widget/Form.h"
 #include "../enum/FormExit.h"
 #include "../../dto/RadioStationInfo.h"
+#include "../../network/NetworkJobs.h"
 
 /**
  * RSEdit object
@@ -29,14 +30,16 @@ typedef struct ctune_UI_Dialog_RSEdit {
         ctune_RadioStationInfo_t station;
         size_t                   max_label_width;
         regex_t                  url_regex;
+        ctune_JobHandle_t        stream_test; //background stream test in progress
 
     } cache;
 
     struct {
-        const char * (* getDisplayText)( ctune_UI_TextID_e );
-        bool         (* generateUUID)( String_t * uuid );
-        bool         (* testStream)( const char * url, String_t * codec, ulong * bitrate );
-        bool         (* validateURL)( const char * url );
+        const char *      (* getDisplayText)( ctune_UI_TextID_e );
+        bool              (* generateUUID)( String_t * uuid );
+        ctune_JobHandle_t (* testStreamAsync)( const char * url, ctune_NetworkJob_Callback_f cb, void * data );
+        void              (* cancelStreamTest)( ctune_JobHandle_t handle );
+        bool              (* validateURL)( const char * url );
     } cb;
 
 } ctune_UI_RSEdit_t;
@@ -47,18 +50,20 @@ typedef struct ctune_UI_Dialog_RSEdit {
 extern const struct ctune_UI_RSEdit_Namespace {
     /**
      * Creates a base ctune_UI_RSEdit_t object
-     * @param parent         Pointer to size property of the parent window
-     * @param getDisplayText Callback method to get text strings for the display
-     * @param generateUUID   Callback method to create a unique UUID for new stations
-     * @param testStream     Callback method to test and get codec/bitrate from a stream URL
-     * @param validateURL    Callback method to check the validity of a URL string
+     * @param parent           Pointer to size property of the parent window
+     * @param getDisplayText   Callback method to get text strings for the display
+     * @param generateUUID     Callback method to create a unique UUID for new stations
+     * @param testStreamAsync  Callback method to test and get codec/bitrate from a stream URL in the background
+     * @param cancelStreamTest Callback method to cancel a background stream test
+     * @param validateURL      Callback method to check the validity of a URL string
      * @return Basic un-initialised ctune_UI_RSEdit_t object
      */
     ctune_UI_RSEdit_t (* create)( const WindowProperty_t * parent,
-                                  const char * (* getDisplayText)( ctune_UI_TextID_e ),
-                                  bool         (* generateUUID)( String_t * uuid ),
-                                  bool         (* testStream)( const char * url, String_t * codec, ulong * bitrate ),
-                                  bool         (* validateURL)( const char * url ) );
+                                  const char *      (* getDisplayText)( ctune_UI_TextID_e ),
+                                  bool              (* generateUUID)( String_t * uuid ),
+                                  ctune_JobHandle_t (* testStreamAsync)( const char * url, ctune_NetworkJob_Callback_f cb, void * data ),
+                                  void              (* cancelStreamTest)( ctune_JobHandle_t handle ),
+                                  bool              (* validateURL)( const char * url ) );
 
     /**
      * Initialises RSFind (mostly checks base values are OK)
@@ -1,12 +1,15 @@
 #include "RSFind.h"
 
 #include "logger/src/Logger.h"
+#include "../../dto/RadioStationInfo.h"
 #include "../EventQueue.h"
 #include "../Resizer.h"
 #include "../definitions/KeyBinding.h"
 #include "../definitions/Theme.h"
 #include "ContextHelp.h"
 
+#define CTUNE_UI_RSFIND_QUICKSEARCH_PREVIEW_COUNT 3 //one `INPUT_QUICK_RESULT_*` field each
+
 typedef enum {
     LABEL_NAME = 0,
     LABEL_COUNTRY,
@@ -22,6 +25,7 @@ typedef enum {
     //separator label
     LABEL_BITRATE_TO, //#12
     LABEL_BITRATE_UNIT, //#13
+    LABEL_QUICK_SEARCH, //#14 (local match count)
 
     LABEL_COUNT,
 } RSFind_Label_e;
@@ -29,6 +33,9 @@ typedef enum {
 typedef enum {
     INPUT_NAME = LABEL_COUNT,
     INPUT_NAME_EXACT,
+    INPUT_QUICK_RESULT_1, //local matches (selectable only when filled)
+    INPUT_QUICK_RESULT_2,
+    INPUT_QUICK_RESULT_3,
     INPUT_COUNTRY,
     INPUT_COUNTRY_EXACT,
     INPUT_COUNTRY_CODE,
@@ -158,6 +165,24 @@ static bool ctune_UI_RSFind_isButton( ctune_UI_RSFind_t * rsfind, const FIELD *
         || field == ctune_UI_Form.field.get( &rsfind->form, BUTTON_SAVE   );
 }
 
+/**
+ * [PRIVATE] Checks if field is a filled local match field
+ * @param rsfind Pointer to a ctune_UI_RSFind_t object
+ * @param field  Form field
+ * @return Index of the match in the cached quick search results (-1 if not valid)
+ */
+static int ctune_UI_RSFind_isQuickResult( ctune_UI_RSFind_t * rsfind, const FIELD * field ) {
+    if( field != NULL ) {
+        for( int i = 0; i < CTUNE_UI_RSFIND_QUICKSEARCH_PREVIEW_COUNT; ++i ) {
+            if( field == ctune_UI_Form.field.get( &rsfind->form, ( INPUT_QUICK_RESULT_1 + i ) ) ) {
+                return ( (size_t) i < Vector.size( &rsfind->cache.quick_results ) ? i : -1 );
+            }
+        }
+    }
+
+    return -1;
+}
+
 /**
  * [PRIVATE] Check if given field is a form exit
  * @param rsfind    Pointer to a ctune_UI_RSFind_t object
@@ -166,6 +191,14 @@ static bool ctune_UI_RSFind_isButton( ctune_UI_RSFind_t * rsfind, const FIELD *
  * @return Exit state
  */
 static bool ctune_UI_RSFind_isExitState( ctune_UI_RSFind_t * rsfind, const FIELD * field, ctune_FormExit_e * exit_type ) {
+    const int quick_result = ctune_UI_RSFind_isQuickResult( rsfind, field );
+
+    if( quick_result >= 0 ) {
+        rsfind->cache.quick_selected = quick_result;
+        *exit_type = CTUNE_UI_FORM_SUBMIT;
+        return true;
+    }
+
     if( ctune_UI_RSFind_isButton( rsfind, field ) ) {
         if( field == ctune_UI_Form.field.get( &rsfind->form, BUTTON_CANCEL ) ) {
             *exit_type = CTUNE_UI_FORM_CANCEL;
@@ -231,7 +264,8 @@ static void ctune_UI_RSFind_highlightCurrField( ctune_UI_RSFind_t * rsfind ) {
 
     const bool curr_is_button   = ctune_UI_RSFind_isButton( rsfind, curr_field );
     const bool curr_is_toggle   = ( ctune_UI_RSFind_isToggle( rsfind, curr_field ) >= 0 );
-    const bool curr_is_editable = !( curr_is_button || curr_is_toggle || curr_field_id == INPUT_ORDER_BY );
+    const bool curr_is_result   = ( curr_field_id >= INPUT_QUICK_RESULT_1 && curr_field_id <= INPUT_QUICK_RESULT_3 );
+    const bool curr_is_editable = !( curr_is_button || curr_is_toggle || curr_is_result || curr_field_id == INPUT_ORDER_BY );
 
     curs_set( ( curr_is_editable ? 1 : 0 ) );
 
@@ -246,7 +280,7 @@ static void ctune_UI_RSFind_highlightCurrField( ctune_UI_RSFind_t * rsfind ) {
             ctune_UI_Form.field.setBackground( &rsfind->form, i, A_REVERSE );
 
         } else {
-            if( ctune_UI_RSFind_isButton( rsfind, field ) || ctune_UI_RSFind_isToggle( rsfind, field ) >= 0 ) {
+            if( ctune_UI_RSFind_isButton( rsfind, field ) || ctune_UI_RSFind_isToggle( rsfind, field ) >= 0 || ( i >= INPUT_QUICK_RESULT_1 && i <= INPUT_QUICK_RESULT_3 ) ) {
                 ctune_UI_Form.field.setBackground( &rsfind->form, i, A_NORMAL );
             } else {
                 ctune_UI_Form.field.setBackground( &rsfind->form, i, A_UNDERLINE );
@@ -255,6 +289,88 @@ static void ctune_UI_RSFind_highlightCurrField( ctune_UI_RSFind_t * rsfind ) {
     }
 }
 
+/**
+ * [PRIVATE] Prints the cached local matches into their fields and makes the filled ones selectable
+ * @param rsfind      Pointer to a ctune_UI_RSFind_t object
+ * @param match_count Total number of local matches
+ */
+static void ctune_UI_RSFind_printQuickResults( ctune_UI_RSFind_t * rsfind, size_t match_count ) {
+    String_t text = String.init();
+
+    if( match_count > 0 ) {
+        String_t count = String.init();
+        ctune_utos( match_count, &count );
+
+        String.set( &text, rsfind->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_LOCAL_MATCHES ) );
+        String.append_back( &text, ": " );
+        String.append_back( &text, count._raw );
+
+        String.free( &count );
+    }
+
+    ctune_UI_Form.field.setBuffer( &rsfind->form, LABEL_QUICK_SEARCH, ctune_fallbackStr( text._raw, "" ) );
+
+    for( size_t i = 0; i < CTUNE_UI_RSFIND_QUICKSEARCH_PREVIEW_COUNT; ++i ) {
+        const size_t field_id = ( INPUT_QUICK_RESULT_1 + i );
+
+        if( i < Vector.size( &rsfind->cache.quick_results ) ) {
+            const ctune_RadioStationInfo_t * rsi     = Vector.at( &rsfind->cache.quick_results, i );
+            const char                     * country = ctune_RadioStationInfo.get.country( rsi );
+
+            String.set( &text, "> " );
+            String.append_back( &text, ctune_fallbackStr( ctune_RadioStationInfo.get.stationName( rsi ), "?" ) );
+
+            if( country != NULL && country[0] != '\0' ) {
+                String.append_back( &text, " (" );
+                String.append_back( &text, country );
+                String.append_back( &text, ")" );
+            }
+
+            ctune_UI_Form.field.setBuffer( &rsfind->form, field_id, text._raw );
+            ctune_UI_Form.field.setOptions( &rsfind->form, field_id, O_VISIBLE | O_PUBLIC | O_ACTIVE | O_STATIC );
+
+        } else {
+            ctune_UI_Form.field.setBuffer( &rsfind->form, field_id, "" );
+            ctune_UI_Form.field.setOptions( &rsfind->form, field_id, O_VISIBLE | O_PUBLIC | O_STATIC ); //skipped by the navigation
+        }
+    }
+
+    String.free( &text );
+}
+
+/**
+ * [PRIVATE] Lists the best local matches for the station name field's content when it has changed
+ * @param rsfind Pointer to a ctune_UI_RSFind_t object
+ */
+static void ctune_UI_RSFind_refreshQuickSearch( ctune_UI_RSFind_t * rsfind ) {
+    if( rsfind->cb.quickSearch == NULL || !ctune_UI_Form.field.isCurrent( &rsfind->form, INPUT_NAME ) ) {
+        return; //EARLY RETURN
+    }
+
+    ctune_UI_Form.input.fwdToFormDriver( &rsfind->form, REQ_VALIDATION ); //syncs the field buffer with what is being typed
+
+    char * text = ctune_trimspace( ctune_UI_Form.field.buffer( &rsfind->form, INPUT_NAME ) );
+
+    if( text == NULL || ctune_streq( text, ctune_fallbackStr( rsfind->cache.quick_search._raw, "" ) ) ) {
+        free( text );
+        return; //EARLY RETURN
+    }
+
+    String.set( &rsfind->cache.quick_search, text );
+    Vector.reinit( &rsfind->cache.quick_results );
+
+    size_t match_count = 0;
+
+    if( text[0] == '\0' || !rsfind->cb.quickSearch( text, CTUNE_UI_RSFIND_QUICKSEARCH_PREVIEW_COUNT, &rsfind->cache.quick_results, &match_count ) ) {
+        Vector.reinit( &rsfind->cache.quick_results );
+        match_count = 0;
+    }
+
+    ctune_UI_RSFind_printQuickResults( rsfind, match_count );
+
+    free( text );
+}
+
 /**
  * [PRIVATE] Packs all the non-toggle field values into the cached filter
  * @param rsfind Pointer to a ctune_UI_RSFind_t object
@@ -372,6 +488,10 @@ static bool ctune_UI_RSFind_initFields( ctune_UI_RSFind_t * rsfind ) {
     ctune_UI_Form.field.setBuffer( &rsfind->form, LABEL_REVERSE,      rsfind->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_REVERSE_ORDER ) );
     ctune_UI_Form.field.setBuffer( &rsfind->form, LABEL_EXACT,        rsfind->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_EXACT_MATCH ) );
     ctune_UI_Form.field.setBuffer( &rsfind->form, INPUT_NAME,         ctune_fallbackStr( ctune_RadioBrowserFilter.get.name( filter ), "" ) );
+    String.free( &rsfind->cache.quick_search );
+    Vector.reinit( &rsfind->cache.quick_results );
+    rsfind->cache.quick_selected = -1;
+    ctune_UI_RSFind_printQuickResults( rsfind, 0 ); //LABEL_QUICK_SEARCH + INPUT_QUICK_RESULT_*
     ctune_UI_Form.field.setBuffer( &rsfind->form, INPUT_COUNTRY,      ctune_fallbackStr( ctune_RadioBrowserFilter.get.country( filter ), "" ) );
     ctune_UI_Form.field.setBuffer( &rsfind->form, INPUT_COUNTRY_CODE, ctune_fallbackStr( ctune_RadioBrowserFilter.get.countryCode( filter ), "" ) );
     ctune_UI_Form.field.setBuffer( &rsfind->form, INPUT_STATE,        ctune_fallbackStr( ctune_RadioBrowserFilter.get.state( filter ), "" ) );
@@ -534,6 +654,7 @@ static bool ctune_UI_RSFind_createFields( ctune_UI_RSFind_t * rsfind ) {
     const int toggle_field_col    = ( toggle_label_col + toggle_field_offset );
 
     const int form_width          = toggle_label_col + toggle_label_size;
+    const int preview_width       = form_width - field_col;
 
     const int bitrate_sep_len   = (int) strlen( rsfind->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_BITRATE_RANGE_SEPARATOR ) );
     const int bitrate_unit_len  = (int) strlen( rsfind->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_BITRATE_UNIT_LONG ) );
@@ -546,34 +667,38 @@ static bool ctune_UI_RSFind_createFields( ctune_UI_RSFind_t * rsfind ) {
     //Field labels                                                                                                   rows        cols                y   x
     ret[LABEL_EXACT         ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_EXACT,          (WindowProperty_t){ row_height, label_col_width,     0, toggle_label_col } );
     ret[LABEL_NAME          ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_NAME,           (WindowProperty_t){ row_height, label_col_width,     2, label_col } );
-    ret[LABEL_COUNTRY       ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_COUNTRY,        (WindowProperty_t){ row_height, label_col_width,     4, label_col } );
-    ret[LABEL_COUNTRY_CODE  ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_COUNTRY_CODE,   (WindowProperty_t){ row_height, label_col_width,     6, label_col } );
-    ret[LABEL_STATE         ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_STATE,          (WindowProperty_t){ row_height, label_col_width,     8, label_col } );
-    ret[LABEL_LANGUAGE      ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_LANGUAGE,       (WindowProperty_t){ row_height, label_col_width,    10, label_col } );
-    ret[LABEL_TAGS          ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_TAGS,           (WindowProperty_t){ row_height, label_col_width,    12, label_col } );
-    ret[LABEL_CODEC         ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_CODEC,          (WindowProperty_t){ row_height, label_col_width,    14, label_col } );
-    ret[LABEL_BITRATE       ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_BITRATE,        (WindowProperty_t){ row_height, label_col_width,    16, label_col } );
-    ret[LABEL_BITRATE_TO    ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_BITRATE_TO,     (WindowProperty_t){ row_height, bitrate_sep_len,    16, bitrate_sep_col } );
-    ret[LABEL_BITRATE_UNIT  ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_BITRATE_UNIT,   (WindowProperty_t){ row_height, bitrate_unit_len,   16, bitrate_unit_col } );
-    ret[LABEL_ORDER_BY      ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_ORDER_BY,       (WindowProperty_t){ row_height, label_col_width,    18, label_col } );
-    ret[LABEL_REVERSE       ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_REVERSE,        (WindowProperty_t){ row_height, label_col_width,    20, label_col } );
+    ret[LABEL_COUNTRY       ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_COUNTRY,        (WindowProperty_t){ row_height, label_col_width,     8, label_col } );
+    ret[LABEL_COUNTRY_CODE  ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_COUNTRY_CODE,   (WindowProperty_t){ row_height, label_col_width,    10, label_col } );
+    ret[LABEL_STATE         ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_STATE,          (WindowProperty_t){ row_height, label_col_width,    12, label_col } );
+    ret[LABEL_LANGUAGE      ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_LANGUAGE,       (WindowProperty_t){ row_height, label_col_width,    14, label_col } );
+    ret[LABEL_TAGS          ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_TAGS,           (WindowProperty_t){ row_height, label_col_width,    16, label_col } );
+    ret[LABEL_CODEC         ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_CODEC,          (WindowProperty_t){ row_height, label_col_width,    18, label_col } );
+    ret[LABEL_BITRATE       ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_BITRATE,        (WindowProperty_t){ row_height, label_col_width,    20, label_col } );
+    ret[LABEL_BITRATE_TO    ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_BITRATE_TO,     (WindowProperty_t){ row_height, bitrate_sep_len,    20, bitrate_sep_col } );
+    ret[LABEL_BITRATE_UNIT  ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_BITRATE_UNIT,   (WindowProperty_t){ row_height, bitrate_unit_len,   20, bitrate_unit_col } );
+    ret[LABEL_ORDER_BY      ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_ORDER_BY,       (WindowProperty_t){ row_height, label_col_width,    22, label_col } );
+    ret[LABEL_REVERSE       ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_REVERSE,        (WindowProperty_t){ row_height, label_col_width,    24, label_col } );
+    ret[LABEL_QUICK_SEARCH  ] = ctune_UI_Form.field.create( &rsfind->form, LABEL_QUICK_SEARCH,   (WindowProperty_t){ row_height, preview_width,       3, field_col } );
     //Field inputs                                                                                                  rows        cols                y    x
     ret[INPUT_NAME          ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_NAME,           (WindowProperty_t){ row_height, field_width,         2, field_col } );
     ret[INPUT_NAME_EXACT    ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_NAME_EXACT,     (WindowProperty_t){ row_height, toggle_field_width,  2, toggle_field_col } );
-    ret[INPUT_COUNTRY       ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_COUNTRY,        (WindowProperty_t){ row_height, field_width,         4, field_col } );
-    ret[INPUT_COUNTRY_EXACT ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_COUNTRY_EXACT,  (WindowProperty_t){ row_height, toggle_field_width,  4, toggle_field_col } );
-    ret[INPUT_COUNTRY_CODE  ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_COUNTRY_CODE,   (WindowProperty_t){ row_height, cc_field_width,      6, field_col } );
-    ret[INPUT_STATE         ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_STATE,          (WindowProperty_t){ row_height, field_width,         8, field_col } );
-    ret[INPUT_STATE_EXACT   ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_STATE_EXACT,    (WindowProperty_t){ row_height, toggle_field_width,  8, toggle_field_col } );
-    ret[INPUT_LANGUAGE      ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_LANGUAGE,       (WindowProperty_t){ row_height, field_width,        10, field_col } );
-    ret[INPUT_LANGUAGE_EXACT] = ctune_UI_Form.field.create( &rsfind->form, INPUT_LANGUAGE_EXACT, (WindowProperty_t){ row_height, toggle_field_width, 10, toggle_field_col } );
-    ret[INPUT_TAGS          ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_TAGS,           (WindowProperty_t){ row_height, field_width,        12, field_col } );
-    ret[INPUT_TAGS_EXACT    ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_TAGS_EXACT,     (WindowProperty_t){ row_height, toggle_field_width, 12, toggle_field_col } );
-    ret[INPUT_CODEC         ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_CODEC,          (WindowProperty_t){ row_height, field_width,        14, field_col } );
-    ret[INPUT_BITRATE_MIN   ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_BITRATE_MIN,    (WindowProperty_t){ row_height, bitrate_input_len,  16, field_col } );
-    ret[INPUT_BITRATE_MAX   ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_BITRATE_MAX,    (WindowProperty_t){ row_height, bitrate_input_len,  16, bitrate_max_col } );
-    ret[INPUT_ORDER_BY      ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_ORDER_BY,       (WindowProperty_t){ row_height, order_field_width,  18, field_col } );
-    ret[INPUT_REVERSE       ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_REVERSE,        (WindowProperty_t){ row_height, toggle_field_width, 20, field_col } );
+    ret[INPUT_QUICK_RESULT_1] = ctune_UI_Form.field.create( &rsfind->form, INPUT_QUICK_RESULT_1, (WindowProperty_t){ row_height, preview_width,       4, field_col } );
+    ret[INPUT_QUICK_RESULT_2] = ctune_UI_Form.field.create( &rsfind->form, INPUT_QUICK_RESULT_2, (WindowProperty_t){ row_height, preview_width,       5, field_col } );
+    ret[INPUT_QUICK_RESULT_3] = ctune_UI_Form.field.create( &rsfind->form, INPUT_QUICK_RESULT_3, (WindowProperty_t){ row_height, preview_width,       6, field_col } );
+    ret[INPUT_COUNTRY       ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_COUNTRY,        (WindowProperty_t){ row_height, field_width,         8, field_col } );
+    ret[INPUT_COUNTRY_EXACT ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_COUNTRY_EXACT,  (WindowProperty_t){ row_height, toggle_field_width,  8, toggle_field_col } );
+    ret[INPUT_COUNTRY_CODE  ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_COUNTRY_CODE,   (WindowProperty_t){ row_height, cc_field_width,     10, field_col } );
+    ret[INPUT_STATE         ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_STATE,          (WindowProperty_t){ row_height, field_width,        12, field_col } );
+    ret[INPUT_STATE_EXACT   ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_STATE_EXACT,    (WindowProperty_t){ row_height, toggle_field_width, 12, toggle_field_col } );
+    ret[INPUT_LANGUAGE      ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_LANGUAGE,       (WindowProperty_t){ row_height, field_width,        14, field_col } );
+    ret[INPUT_LANGUAGE_EXACT] = ctune_UI_Form.field.create( &rsfind->form, INPUT_LANGUAGE_EXACT, (WindowProperty_t){ row_height, toggle_field_width, 14, toggle_field_col } );
+    ret[INPUT_TAGS          ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_TAGS,           (WindowProperty_t){ row_height, field_width,        16, field_col } );
+    ret[INPUT_TAGS_EXACT    ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_TAGS_EXACT,     (WindowProperty_t){ row_height, toggle_field_width, 16, toggle_field_col } );
+    ret[INPUT_CODEC         ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_CODEC,          (WindowProperty_t){ row_height, field_width,        18, field_col } );
+    ret[INPUT_BITRATE_MIN   ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_BITRATE_MIN,    (WindowProperty_t){ row_height, bitrate_input_len,  20, field_col } );
+    ret[INPUT_BITRATE_MAX   ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_BITRATE_MAX,    (WindowProperty_t){ row_height, bitrate_input_len,  20, bitrate_max_col } );
+    ret[INPUT_ORDER_BY      ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_ORDER_BY,       (WindowProperty_t){ row_height, order_field_width,  22, field_col } );
+    ret[INPUT_REVERSE       ] = ctune_UI_Form.field.create( &rsfind->form, INPUT_REVERSE,        (WindowProperty_t){ row_height, toggle_field_width, 24, field_col } );
 
     const int button_separation = 6;
     const int max_button_width  = (int) ctune_max_ul( strlen( rsfind->cb.getDisplayText( CTUNE_UI_TEXT_BUTTON_SUBMIT ) ),
@@ -585,8 +710,8 @@ static bool ctune_UI_RSFind_createFields( ctune_UI_RSFind_t * rsfind ) {
         button_line_pad = ( form_width - button_line_ln ) / 2;
     }
     //Buttons                                                                                         rows        cols              y   x
-    ret[BUTTON_CANCEL] = ctune_UI_Form.field.create( &rsfind->form, BUTTON_CANCEL, (WindowProperty_t){ row_height, max_button_width, 22, button_line_pad } );
-    ret[BUTTON_SAVE  ] = ctune_UI_Form.field.create( &rsfind->form, BUTTON_SAVE,   (WindowProperty_t){ row_height, max_button_width, 22, ( button_line_pad + max_button_width + button_separation ) } );
+    ret[BUTTON_CANCEL] = ctune_UI_Form.field.create( &rsfind->form, BUTTON_CANCEL, (WindowProperty_t){ row_height, max_button_width, 26, button_line_pad } );
+    ret[BUTTON_SAVE  ] = ctune_UI_Form.field.create( &rsfind->form, BUTTON_SAVE,   (WindowProperty_t){ row_height, max_button_width, 26, ( button_line_pad + max_button_width + button_separation ) } );
 
     for( int i = 0; i < FIELD_LAST; ++i ) {
         if( !ret[i] ) {
@@ -607,6 +732,7 @@ static bool ctune_UI_RSFind_createFields( ctune_UI_RSFind_t * rsfind ) {
     ctune_UI_Form.field.setOptions( &rsfind->form, LABEL_BITRATE_UNIT, O_VISIBLE | O_PUBLIC | O_AUTOSKIP );
     ctune_UI_Form.field.setOptions( &rsfind->form, LABEL_ORDER_BY, O_VISIBLE | O_PUBLIC | O_AUTOSKIP );
     ctune_UI_Form.field.setOptions( &rsfind->form, LABEL_REVERSE, O_VISIBLE | O_PUBLIC | O_AUTOSKIP );
+    ctune_UI_Form.field.setOptions( &rsfind->form, LABEL_QUICK_SEARCH, O_VISIBLE | O_PUBLIC | O_AUTOSKIP | O_STATIC );
 
     ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_NAME, O_VISIBLE | O_PUBLIC | O_EDIT | O_ACTIVE | O_NULLOK );
     ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_COUNTRY, O_VISIBLE | O_PUBLIC | O_EDIT | O_ACTIVE | O_NULLOK );
@@ -626,6 +752,9 @@ static bool ctune_UI_RSFind_createFields( ctune_UI_RSFind_t * rsfind ) {
     ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_STATE_EXACT, O_VISIBLE | O_PUBLIC | O_ACTIVE | O_STATIC );
     ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_LANGUAGE_EXACT, O_VISIBLE | O_PUBLIC | O_ACTIVE | O_STATIC );
     ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_TAGS_EXACT, O_VISIBLE | O_PUBLIC | O_ACTIVE | O_STATIC );
+    ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_QUICK_RESULT_1, O_VISIBLE | O_PUBLIC | O_STATIC ); //activated when filled
+    ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_QUICK_RESULT_2, O_VISIBLE | O_PUBLIC | O_STATIC );
+    ctune_UI_Form.field.setOptions( &rsfind->form, INPUT_QUICK_RESULT_3, O_VISIBLE | O_PUBLIC | O_STATIC );
 
     ctune_UI_Form.field.setOptions( &rsfind->form, BUTTON_CANCEL, O_VISIBLE | O_PUBLIC | O_ACTIVE | O_STATIC );
     ctune_UI_Form.field.setOptions( &rsfind->form, BUTTON_SAVE, O_VISIBLE | O_PUBLIC | O_ACTIVE | O_STATIC );
@@ -684,8 +813,14 @@ static ctune_UI_RSFind_t ctune_UI_RSFind_create( const WindowProperty_t * parent
             .max_label_width = 0,
             .order_width     = 0,
             .order_selection = STATION_ATTR_NONE,
+            .quick_search    = String.init(),
+            .quick_results   = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent ),
+            .quick_selected  = -1,
+        },
+        .cb = {
+            .getDisplayText = getDisplayText,
+            .quickSearch    = NULL,
         },
-        .cb.getDisplayText = getDisplayText,
     };
 }
 
@@ -728,6 +863,15 @@ static void ctune_UI_RSFind_setMouseCtrl( ctune_UI_RSFind_t * rsfind, bool mouse
     ctune_UI_Form.mouse.setMouseCtrl( &rsfind->form, mouse_ctrl_flag );
 }
 
+/**
+ * [OPTIONAL] Sets the callback used to list the local matches for the station name as it is typed
+ * @param rsfind   Pointer to a ctune_UI_RSFind_t object
+ * @param callback Local search method
+ */
+static void ctune_UI_RSFind_setQuickSearchCallback( ctune_UI_RSFind_t * rsfind, bool (* callback)( const char * text, size_t limit, Vector_t * stations, size_t * match_count ) ) {
+    rsfind->cb.quickSearch = callback;
+}
+
 /**
  * Create and show a populated window with the find form
  * @param rsfind Pointer to a ctune_UI_RSFind_t object
@@ -808,6 +952,10 @@ static bool ctune_UI_RSFind_handleMouseEvent( ctune_UI_RSFind_t * rsfind, MEVENT
             ctune_UI_RSFind_highlightCurrField( rsfind );
             ctune_UI_RSFind_toggle( rsfind, ctune_UI_Form.field.currentIndex( &rsfind->form ), clicked_field );
 
+        } else if( ctune_UI_RSFind_isQuickResult( rsfind, clicked_field ) >= 0 ) { //local match
+            ctune_UI_RSFind_highlightCurrField( rsfind );
+            exit = ctune_UI_RSFind_isExitState( rsfind, clicked_field, exit_state );
+
         } else if( prev_selected_field == clicked_field ) { //same editable field
             ctune_UI_Form.input.fwdToFormDriver( &rsfind->form, REQ_BEG_FIELD );
 
@@ -837,6 +985,8 @@ static ctune_FormExit_e ctune_UI_RSFind_captureInput( ctune_UI_RSFind_t * rsfind
     int              character;
     MEVENT           mouse_event;
 
+    rsfind->cache.quick_selected = -1;
+
     ctune_UI_Form.input.start( &rsfind->form );
     ctune_UI_Form.input.fwdToFormDriver( &rsfind->form, REQ_FIRST_FIELD );
     ctune_UI_RSFind_highlightCurrField( rsfind );
@@ -928,7 +1078,7 @@ static ctune_FormExit_e ctune_UI_RSFind_captureInput( ctune_UI_RSFind_t * rsfind
 
             case CTUNE_UI_ACTION_TRIGGER: {
                 if( ( exit = ctune_UI_RSFind_isExitState( rsfind, ctune_UI_Form.field.current( &rsfind->form ), &exit_state ) ) ) {
-                    if( exit_state == CTUNE_UI_FORM_SUBMIT && !ctune_UI_RSFind_packFieldValues( rsfind, &rsfind->cache.filter ) ) {
+                    if( exit_state == CTUNE_UI_FORM_SUBMIT && rsfind->cache.quick_selected < 0 && !ctune_UI_RSFind_packFieldValues( rsfind, &rsfind->cache.filter ) ) {
                         exit = false;
                     }
 
@@ -952,7 +1102,7 @@ static ctune_FormExit_e ctune_UI_RSFind_captureInput( ctune_UI_RSFind_t * rsfind
 
             case CTUNE_UI_ACTION_TOGGLE_ALT: { //'space'
                 if( ( exit = ctune_UI_RSFind_isExitState( rsfind, ctune_UI_Form.field.current( &rsfind->form ), &exit_state ) ) ) {
-                    if( exit_state == CTUNE_UI_FORM_SUBMIT && !ctune_UI_RSFind_packFieldValues( rsfind, &rsfind->cache.filter ) ) {
+                    if( exit_state == CTUNE_UI_FORM_SUBMIT && rsfind->cache.quick_selected < 0 && !ctune_UI_RSFind_packFieldValues( rsfind, &rsfind->cache.filter ) ) {
                         exit = false;
                     }
 
@@ -989,7 +1139,7 @@ static ctune_FormExit_e ctune_UI_RSFind_captureInput( ctune_UI_RSFind_t * rsfind
             case CTUNE_UI_ACTION_MOUSE_EVENT: {
                 if( getmouse( &mouse_event ) == OK ) {
                     if( ( exit = ctune_UI_RSFind_handleMouseEvent( rsfind, &mouse_event, &exit_state ) ) ) {
-                        if( exit_state == CTUNE_UI_FORM_SUBMIT && !ctune_UI_RSFind_packFieldValues( rsfind, &rsfind->cache.filter ) ) {
+                        if( exit_state == CTUNE_UI_FORM_SUBMIT && rsfind->cache.quick_selected < 0 && !ctune_UI_RSFind_packFieldValues( rsfind, &rsfind->cache.filter ) ) {
                             exit = false;
                         }
                     }
@@ -1001,6 +1151,10 @@ static ctune_FormExit_e ctune_UI_RSFind_captureInput( ctune_UI_RSFind_t * rsfind
             } break;
         }
 
+        if( !exit ) {
+            ctune_UI_RSFind_refreshQuickSearch( rsfind );
+        }
+
         ctune_UI_Form.display.refreshView( &rsfind->form );
     }
 
@@ -1018,6 +1172,19 @@ static ctune_RadioBrowserFilter_t * ctune_UI_RSFind_getFilter( ctune_UI_RSFind_t
     return &rsfind->cache.filter;
 }
 
+/**
+ * Gets the local match picked by the user to exit the form
+ * @param rsfind Pointer to a ctune_UI_RSFind_t object
+ * @return Pointer to the picked station or NULL if the form was submitted/cancelled instead
+ */
+static const ctune_RadioStationInfo_t * ctune_UI_RSFind_getQuickSearchResult( ctune_UI_RSFind_t * rsfind ) {
+    if( rsfind->cache.quick_selected < 0 ) {
+        return NULL; //EARLY RETURN
+    }
+
+    return Vector.at( &rsfind->cache.quick_results, (size_t) rsfind->cache.quick_selected );
+}
+
 /**
  * De-allocates the form and its fields
  * @param rsfind Pointer to a ctune_UI_RSFind_t object
@@ -1025,6 +1192,8 @@ static ctune_RadioBrowserFilter_t * ctune_UI_RSFind_getFilter( ctune_UI_RSFind_t
 static void ctune_UI_RSFind_free( ctune_UI_RSFind_t * rsfind ) {
     ctune_UI_Form.freeContent( &rsfind->form );
     ctune_RadioBrowserFilter.freeContent( &rsfind->cache.filter );
+    String.free( &rsfind->cache.quick_search );
+    Vector.clear_vector( &rsfind->cache.quick_results );
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_RSFind_free( %p )] RSFind freed.", rsfind );
 }
 
@@ -1032,12 +1201,14 @@ static void ctune_UI_RSFind_free( ctune_UI_RSFind_t * rsfind ) {
  * Namespace constructor
  */
 const struct ctune_UI_RSFind_Namespace ctune_UI_RSFind = {
-    .create        = &ctune_UI_RSFind_create,
-    .init          = &ctune_UI_RSFind_init,
-    .isInitialised = &ctune_UI_RSFind_isInitialised,
-    .setMouseCtrl  = &ctune_UI_RSFind_setMouseCtrl,
-    .show          = &ctune_UI_RSFind_show,
-    .captureInput  = &ctune_UI_RSFind_captureInput,
-    .getFilter     = &ctune_UI_RSFind_getFilter,
-    .free          = &ctune_UI_RSFind_free,
+    .create                 = &ctune_UI_RSFind_create,
+    .init                   = &ctune_UI_RSFind_init,
+    .isInitialised          = &ctune_UI_RSFind_isInitialised,
+    .setMouseCtrl           = &ctune_UI_RSFind_setMouseCtrl,
+    .setQuickSearchCallback = &ctune_UI_RSFind_setQuickSearchCallback,
+    .show                   = &ctune_UI_RSFind_show,
+    .captureInput           = &ctune_UI_RSFind_captureInput,
+    .getFilter              = &ctune_UI_RSFind_getFilter,
+    .getQuickSearchResult   = &ctune_UI_RSFind_getQuickSearchResult,
+    .free                   = &ctune_UI_RSFind_free,
 };
\ No newline at end of file
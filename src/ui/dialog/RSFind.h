@@ -8,6 +8,9 @@
 #endif
 
 #include "../../dto/RadioBrowserFilter.h"
+#include "../../dto/RadioStationInfo.h"
+#include "../../datastructure/String.h"
+#include "../../datastructure/Vector.h"
 #include "../enum/FormExit.h"
 #include "../widget/Form.h"
 
@@ -28,11 +31,15 @@ typedef struct ctune_UI_Dialog_RSFind {
         const char               * order_items[STATION_ATTR_COUNT];
         size_t                     order_width;
         size_t                     order_selection;
+        String_t                   quick_search;
+        Vector_t                   quick_results;
+        int                        quick_selected;
 
     } cache;
 
     struct {
         const char * (* getDisplayText)( ctune_UI_TextID_e );
+        bool (* quickSearch)( const char * text, size_t limit, Vector_t * stations, size_t * match_count );
     } cb;
 
 } ctune_UI_RSFind_t;
@@ -72,6 +79,13 @@ extern const struct ctune_UI_RSFind_Namespace {
      */
     void (* setMouseCtrl)( ctune_UI_RSFind_t * rsfind, bool mouse_ctrl_flag );
 
+    /**
+     * [OPTIONAL] Sets the callback used to list the local matches for the station name as it is typed
+     * @param rsfind   Pointer to a ctune_UI_RSFind_t object
+     * @param callback Local search method
+     */
+    void (* setQuickSearchCallback)( ctune_UI_RSFind_t * rsfind, bool (* callback)( const char * text, size_t limit, Vector_t * stations, size_t * match_count ) );
+
     /**
      * Create and show a populated window with the find form
      * @param rsfind Pointer to a ctune_UI_RSFind_t object
@@ -93,6 +107,13 @@ extern const struct ctune_UI_RSFind_Namespace {
      */
     ctune_RadioBrowserFilter_t * (* getFilter)( ctune_UI_RSFind_t * rsfind );
 
+    /**
+     * Gets the local match picked by the user to exit the form
+     * @param rsfind Pointer to a ctune_UI_RSFind_t object
+     * @return Pointer to the picked station or NULL if the form was submitted/cancelled instead
+     */
+    const ctune_RadioStationInfo_t * (* getQuickSearchResult)( ctune_UI_RSFind_t * rsfind );
+
     /**
      * De-allocates the form and its fields
      * @param rsfind Pointer to a ctune_UI_RSFind_t object
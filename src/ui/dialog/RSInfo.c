@@ -12,6 +12,7 @@
 #include "../../ctune_err.h"
 #include "../../utils/utilities.h"
 #include "../EventQueue.h"
+#include "../Input.h"
 #include "../Resizer.h"
 #include "../definitions/Theme.h"
 #include "../definitions/KeyBinding.h"
@@ -791,7 +792,7 @@ static void ctune_UI_RSInfo_captureInput( ctune_UI_RSInfo_t * rsinfo ) {
     MEVENT mouse_event;
 
     while( !exit ) {
-        ch = wgetch( rsinfo->dialog.canvas.pad );
+        ch = ctune_UI_Input.getChar( rsinfo->dialog.canvas.pad );
 
         switch( ctune_UI_KeyBinding.getAction( CTUNE_UI_CTX_RSINFO, ch ) ) {
             case CTUNE_UI_ACTION_ERR: {
@@ -6,7 +6,7 @@
  * @return String
  */
 static const char * ctune_UI_EventType_str( ctune_UI_EventType_e event_type ) {
-    static const char * str[7] = {
+    static const char * str[8] = {
         [EVENT_SONG_CHANGE          ] = "song change",
         [EVENT_VOLUME_CHANGE        ] = "volume change",
         [EVENT_PLAYBACK_STATE_CHANGE] = "playback state change",
@@ -14,6 +14,7 @@ static const char * ctune_UI_EventType_str( ctune_UI_EventType_e event_type ) {
         [EVENT_ERROR_MSG            ] = "error message",
         [EVENT_STATUS_MSG           ] = "status message",
         [EVENT_STATION_CHANGE       ] = "station change",
+        [EVENT_SEARCH_JOB_COMPLETE  ] = "search job complete",
     };
 
     return str[event_type];
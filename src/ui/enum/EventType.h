@@ -8,7 +8,8 @@ typedef enum {
     EVENT_SEARCH_STATE_CHANGE,
     EVENT_ERROR_MSG,
     EVENT_STATUS_MSG,
-    EVENT_STATION_CHANGE
+    EVENT_STATION_CHANGE,
+    EVENT_SEARCH_JOB_COMPLETE,
 } ctune_UI_EventType_e;
 
 extern const struct ctune_UI_EventType_Namespace {
@@ -91,6 +91,7 @@ typedef enum ctune_UI_TextID {
     CTUNE_UI_TEXT_LABEL_ORDER_BY,
     CTUNE_UI_TEXT_LABEL_REVERSE_ORDER,
     CTUNE_UI_TEXT_LABEL_EXACT_MATCH,
+    CTUNE_UI_TEXT_LABEL_LOCAL_MATCHES,
     //Configuration
     CTUNE_UI_TEXT_ROWSIZE_1X,
     CTUNE_UI_TEXT_ROWSIZE_2X,
@@ -139,6 +140,7 @@ typedef enum ctune_UI_TextID {
     CTUNE_UI_TEXT_MENU_EDIT_STATION,
     CTUNE_UI_TEXT_MENU_TOGGLE_FAV,
     CTUNE_UI_TEXT_MENU_SYNC_UPSTREAM_BULK,
+    CTUNE_UI_TEXT_MENU_CHECK_STREAMS_BULK,
     CTUNE_UI_TEXT_MENU_SYNC_UPSTREAM,
     CTUNE_UI_TEXT_MENU_OPTIONS,
     CTUNE_UI_TEXT_MENU_UI_THEME,
@@ -159,6 +161,7 @@ typedef enum ctune_UI_TextID {
     CTUNE_UI_TEXT_BUTTON_SUBMIT,
     CTUNE_UI_TEXT_BUTTON_SAVE,
     CTUNE_UI_TEXT_BUTTON_AUTODETECT_STREAM,
+    CTUNE_UI_TEXT_BUTTON_TESTING_STREAM,
     CTUNE_UI_TEXT_ERROR,
     CTUNE_UI_TEXT_ELLIPSIS_LINE,
     CTUNE_UI_TEXT_STOP_LINE,
@@ -175,6 +178,15 @@ typedef enum ctune_UI_TextID {
     CTUNE_UI_TEXT_SYNC_FAIL_LOCAL_STATION,
     CTUNE_UI_TEXT_SYNC_FAIL_FETCH_REMOTE_NOT_FOUND,
     CTUNE_UI_TEXT_SYNC_FAIL_FETCH,
+    CTUNE_UI_TEXT_SYNC_BULK_PROGRESS,
+    CTUNE_UI_TEXT_SYNC_BULK_SUCCESS,
+    CTUNE_UI_TEXT_SYNC_BULK_FAIL,
+    CTUNE_UI_TEXT_SYNC_BULK_NONE,
+    CTUNE_UI_TEXT_CHECK_STREAMS_PROGRESS,
+    CTUNE_UI_TEXT_CHECK_STREAMS_SUCCESS,
+    CTUNE_UI_TEXT_CHECK_STREAMS_CANCELLED,
+    CTUNE_UI_TEXT_CHECK_STREAMS_NONE,
+    CTUNE_UI_TEXT_STREAM_UNREACHABLE,
     //Help text
     CTUNE_UI_TEXT_HELP,
     CTUNE_UI_TEXT_HELP_KEY,
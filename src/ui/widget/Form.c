@@ -6,6 +6,7 @@
 
 #include "logger/src/Logger.h"
 #include "../../ctune_err.h"
+#include "../Input.h"
 #include "../Resizer.h"
 
 /**
@@ -309,10 +310,10 @@ static int ctune_UI_Widget_Form_input_fwdToFormDriver( ctune_UI_Form_t * form, i
 /**
  * Gets a character input from the form's window
  * @param form Pointer to a ctune_UI_Form_t object
- * @return character
+ * @return character (ERR when woken up by a UI event or resize request)
  */
 static int ctune_UI_Widget_Form_input_getChar( ctune_UI_Form_t * form ) {
-    return wgetch( form->dialog.canvas.pad );
+    return ctune_UI_Input.getChar( form->dialog.canvas.pad );
 }
 
 /**
@@ -152,7 +152,7 @@ extern const struct ctune_UI_Widget_Form_Namespace {
         /**
          * Gets a character input from the form's window
          * @param form Pointer to a ctune_UI_Form_t object
-         * @return character
+         * @return character (ERR when woken up by a UI event or resize request)
          */
         int (* getChar)( ctune_UI_Form_t * form );
 
@@ -417,7 +417,6 @@ static bool ctune_UI_Widget_ScrollBar_show( ctune_UI_ScrollBar_t * scrollbar ) {
     }
 
     top_panel( scrollbar->canvas_panel );
-    wrefresh( scrollbar->canvas_win );
 
     update_panels();
     doupdate();
@@ -102,8 +102,47 @@ static bool ctune_UI_SlideMenu_triggerCtrlFunction( ctune_UI_SlideMenu_t * menu
     return false;
 }
 
+/**
+ * [PRIVATE] Prints a menu item's row at its position on the current page
+ * @param menu Pointer to a ctune_UI_SlideMenu_t object
+ * @param i    Index of the item in the current menu
+ */
+static void ctune_UI_SlideMenu_printRow( ctune_UI_SlideMenu_t * menu, size_t i ) {
+    if( i < menu->row.first_on_page || i > menu->row.last_on_page || i >= Vector.size( &menu->row.curr_menu->items ) )
+        return; //EARLY RETURN - not on the page
+
+    const int                         row  = (int) ( i - menu->row.first_on_page );
+    const ctune_UI_SlideMenu_Item_t * item = Vector.at( &menu->row.curr_menu->items, i );
+
+    if( item != NULL ) {
+        int row_theme = ( menu->row.selected == i
+                          ? ctune_UI_Theme.color( ( menu->in_focus ? CTUNE_UI_ITEM_ROW_SELECTED_FOCUSED : CTUNE_UI_ITEM_ROW_SELECTED_UNFOCUSED ) )
+                          : ctune_UI_Theme.color( CTUNE_UI_ITEM_ROW ) );
+
+        wattron( menu->canvas_win, row_theme );
+
+        mvwhline( menu->canvas_win, row, 0, ' ', menu->canvas_property->cols );
+        if( item->type == CTUNE_UI_SLIDEMENU_PARENT )
+            mvwprintw( menu->canvas_win, row, 0, "%s ", ctune_UI_Icons.icon( CTUNE_UI_ICON_LEFT_ARROW ) );
+
+        mvwprintw( menu->canvas_win, row, 2, "%s", item->text._raw );
+
+        if( item->type == CTUNE_UI_SLIDEMENU_MENU )
+            mvwprintw( menu->canvas_win, row, ( menu->canvas_property->cols - 3 ), " %s", ctune_UI_Icons.icon( CTUNE_UI_ICON_RIGHT_ARROW ) );
+
+        wattroff( menu->canvas_win, row_theme );
+
+    } else {
+        CTUNE_LOG( CTUNE_LOG_ERROR,
+                   "[ctune_UI_SlideMenu_printRow( %p, %lu )] Item is NULL (%p)",
+                   menu, i, menu->row.curr_menu
+        );
+    }
+}
+
 /**
  * [PRIVATE] Draw entries to the canvas window
+ * - when only the selection moved within the same page of the same menu, just the previously and newly selected rows are redrawn
  * @param menu   Pointer to a ctune_UI_SlideMenu_t object
  * @param resize Flag for resizing the canvas/panel
  */
@@ -111,14 +150,28 @@ static void ctune_UI_SlideMenu_drawCanvas( ctune_UI_SlideMenu_t * menu, bool res
     const size_t page_index_offset = menu->canvas_property->rows - 1;
 
     if( resize ) {
-        if( menu->canvas_panel ) {
-            del_panel( menu->canvas_panel );
-            menu->canvas_panel = NULL;
-        }
+        if( menu->canvas_win != NULL ) {
+            const int rows = menu->canvas_property->rows;
+            const int cols = menu->canvas_property->cols;
+            const int y    = menu->canvas_property->pos_y;
+            const int x    = menu->canvas_property->pos_x;
 
-        if( menu->canvas_win ) {
-            delwin( menu->canvas_win );
-            menu->canvas_win = NULL;
+            const bool shrink = ( getmaxy( menu->canvas_win ) > rows || getmaxx( menu->canvas_win ) > cols );
+
+            hide_panel( menu->canvas_panel ); //so that whatever is under the area uncovered gets refreshed
+
+            const bool fitted = ( shrink //shrink before moving so that it stays within the screen
+                                  ? ( wresize( menu->canvas_win, rows, cols ) == OK && move_panel( menu->canvas_panel, y, x ) == OK )
+                                  : ( move_panel( menu->canvas_panel, y, x ) == OK && wresize( menu->canvas_win, rows, cols ) == OK ) );
+
+            show_panel( menu->canvas_panel );
+
+            if( !fitted ) {
+                del_panel( menu->canvas_panel );
+                delwin( menu->canvas_win );
+                menu->canvas_panel = NULL;
+                menu->canvas_win   = NULL;
+            }
         }
 
         ctune_UI_ScrollBar.free( &menu->scrollbar );
@@ -128,13 +181,13 @@ static void ctune_UI_SlideMenu_drawCanvas( ctune_UI_SlideMenu_t * menu, bool res
         menu->update_scrollbar  = true;
         menu->row.first_on_page = 0;
         menu->row.last_on_page  = menu->row.first_on_page + page_index_offset;
+        menu->damage.full       = true;
     }
 
     if( menu->canvas_win == NULL ) {
         menu->canvas_win   = newwin( menu->canvas_property->rows, menu->canvas_property->cols, menu->canvas_property->pos_y, menu->canvas_property->pos_x );
         menu->canvas_panel = new_panel( menu->canvas_win );
-    } else {
-        werase( menu->canvas_win );
+        menu->damage.full  = true;
     }
 
     //calculate the page range based on the currently selected menu item
@@ -161,43 +214,34 @@ static void ctune_UI_SlideMenu_drawCanvas( ctune_UI_SlideMenu_t * menu, bool res
     ctune_UI_ScrollBar.setPosition( &menu->scrollbar, menu->row.first_on_page );
 
 
-    //Fill canvas with entries in the page range
-    int row = 0;
-    for( size_t i = menu->row.first_on_page; i <= menu->row.last_on_page; ++i ) {
-        if( i >= Vector.size( &menu->row.curr_menu->items ) )
-            break;
-
-        const ctune_UI_SlideMenu_Item_t * item = Vector.at( &menu->row.curr_menu->items, i );
-
-        if( item != NULL ) {
-            int row_theme = ( menu->row.selected == i
-                              ? ctune_UI_Theme.color( ( menu->in_focus ? CTUNE_UI_ITEM_ROW_SELECTED_FOCUSED : CTUNE_UI_ITEM_ROW_SELECTED_UNFOCUSED ) )
-                              : ctune_UI_Theme.color( CTUNE_UI_ITEM_ROW ) );
-
-            wattron( menu->canvas_win, row_theme );
-
-            mvwhline( menu->canvas_win, row, 0, ' ', menu->canvas_property->cols );
-            if( item->type == CTUNE_UI_SLIDEMENU_PARENT )
-                mvwprintw( menu->canvas_win, row, 0, "%s ", ctune_UI_Icons.icon( CTUNE_UI_ICON_LEFT_ARROW ) );
+    if( !menu->damage.full
+        && menu->damage.menu          == menu->row.curr_menu
+        && menu->damage.items         == Vector.size( &menu->row.curr_menu->items )
+        && menu->damage.first_on_page == menu->row.first_on_page )
+    {
+        if( menu->damage.selected != menu->row.selected ) {
+            ctune_UI_SlideMenu_printRow( menu, menu->damage.selected );
+        }
 
-            mvwprintw( menu->canvas_win, row, 2, "%s", item->text._raw );
+        ctune_UI_SlideMenu_printRow( menu, menu->row.selected );
 
-            if( item->type == CTUNE_UI_SLIDEMENU_MENU )
-                mvwprintw( menu->canvas_win, row, ( menu->canvas_property->cols - 3 ), " %s", ctune_UI_Icons.icon( CTUNE_UI_ICON_RIGHT_ARROW ) );
+    } else { //Fill canvas with entries in the page range
+        werase( menu->canvas_win );
 
-            wattroff( menu->canvas_win, row_theme );
+        for( size_t i = menu->row.first_on_page; i <= menu->row.last_on_page; ++i ) {
+            if( i >= Vector.size( &menu->row.curr_menu->items ) )
+                break;
 
-        } else {
-            CTUNE_LOG( CTUNE_LOG_ERROR,
-                       "[ctune_UI_SlideMenu_drawCanvas( %p )] Item i=%lu is NULL (%p)",
-                       menu, menu->row.selected, menu->row.curr_menu
-            );
+            ctune_UI_SlideMenu_printRow( menu, i );
         }
-
-        ++row;
     }
 
-    menu->redraw = false;
+    menu->damage.full          = false;
+    menu->damage.menu          = menu->row.curr_menu;
+    menu->damage.items         = Vector.size( &menu->row.curr_menu->items );
+    menu->damage.selected      = menu->row.selected;
+    menu->damage.first_on_page = menu->row.first_on_page;
+    menu->redraw               = false;
 }
 
 /**
@@ -224,6 +268,13 @@ static ctune_UI_SlideMenu_t ctune_UI_SlideMenu_create( void ) {
             .selected      = 0,
             .first_on_page = 0,
             .last_on_page  = 0,
+        },
+        .damage = {
+            .full          = true,
+            .menu          = NULL,
+            .items         = 0,
+            .selected      = 0,
+            .first_on_page = 0,
         }
     };
 }
@@ -253,6 +304,13 @@ static ctune_UI_SlideMenu_t ctune_UI_SlideMenu_init( const WindowProperty_t * ca
             .selected      = 0,
             .first_on_page = 0,
             .last_on_page  = 0,
+        },
+        .damage = {
+            .full          = true,
+            .menu          = NULL,
+            .items         = 0,
+            .selected      = 0,
+            .first_on_page = 0,
         }
     };
 }
@@ -268,6 +326,7 @@ static void ctune_UI_SlideMenu_setCanvasProperties( ctune_UI_SlideMenu_t * menu,
         menu->canvas_property = canvas_property;
         menu->scrollbar       = ctune_UI_ScrollBar.init( canvas_property, RIGHT, false );
         menu->mouse_ctrl      = mouse_ctrl;
+        menu->damage.full     = true;
         ctune_UI_ScrollBar.setShowControls( &menu->scrollbar, mouse_ctrl );
     }
 }
@@ -387,11 +446,12 @@ static bool ctune_UI_SlideMenu_mouseCtrl( ctune_UI_SlideMenu_t * menu ) {
 }
 
 /**
- * Sets the redraw flag on
+ * Sets the redraw flag on (whole canvas)
  * @param menu Pointer to a ctune_UI_SlideMenu_t object
  */
 static void ctune_UI_SlideMenu_setRedraw( ctune_UI_SlideMenu_t * menu ) {
-    menu->redraw = true;
+    menu->redraw      = true;
+    menu->damage.full = true;
     ctune_UI_ScrollBar.setRedraw( &menu->scrollbar );
 }
 
@@ -550,6 +610,7 @@ static void ctune_UI_SlideMenu_reset( ctune_UI_SlideMenu_t * menu ) {
     menu->row.depth        = 0;
     menu->row.curr_menu    = &menu->root;
     menu->redraw           = true;
+    menu->damage.full      = true;
     menu->update_scrollbar = true;
 }
 
@@ -573,7 +634,6 @@ static void ctune_UI_SlideMenu_resize( ctune_UI_SlideMenu_t * menu ) {
     }
 
     top_panel( menu->canvas_panel );
-    wrefresh( menu->canvas_win );
 
     ctune_UI_ScrollBar.show( &menu->scrollbar );
 
@@ -604,7 +664,6 @@ static bool ctune_UI_SlideMenu_show( ctune_UI_SlideMenu_t * menu ) {
     }
 
     top_panel( menu->canvas_panel );
-    wrefresh( menu->canvas_win );
 
     ctune_UI_ScrollBar.show( &menu->scrollbar );
 
@@ -637,7 +696,8 @@ static void ctune_UI_SlideMenu_hide( ctune_UI_SlideMenu_t * menu ) {
  */
 static void ctune_UI_SlideMenu_free( ctune_UI_SlideMenu_t * menu ) {
     if( menu ) {
-        menu->redraw = true;
+        menu->redraw      = true;
+        menu->damage.full = true;
 
         if( menu->canvas_panel ) {
             del_panel( menu->canvas_panel );
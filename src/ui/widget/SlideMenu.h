@@ -79,6 +79,7 @@ typedef struct ctune_UI_Widget_SlideMenu_Item {
  * @param scrollbar_change Flag to reset the scroll dimensions of the scrollbar
  * @param scrollbar        Scrollbar widget
  * @param row              Row properties (general/current)
+ * @param damage           State at the last draw (used to only redraw the rows whose selection state changed)
  */
 typedef struct {
     bool                      redraw;
@@ -99,6 +100,14 @@ typedef struct {
         size_t                      selected;
     } row;
 
+    struct {
+        bool                        full;          //whole canvas needs redrawing
+        ctune_UI_SlideMenu_Menu_t * menu;          //menu displayed at the last draw
+        size_t                      items;         //number of items in the menu at the last draw
+        size_t                      selected;      //selected row at the last draw
+        size_t                      first_on_page; //first row on the page at the last draw
+    } damage;
+
 } ctune_UI_SlideMenu_t;
 
 
@@ -63,43 +63,70 @@ static SubCategoryPayload_t * ctune_UI_BrowserWin_createSubCategoryPayload( ctun
 }
 
 /**
- * [PRIVATE/CALLBACK] Callback method to fetch sub-category results and populate the right RSListWin pane
- * @param menu_item ctune_UI_SlideMenu_Item_t object
- * @return Error free success
+ * [PRIVATE] Cancels any background fetch of sub-category stations still in progress
+ * @param win ctune_UI_BrowserWin_t object
  */
-static bool ctune_UI_BrowserWin_subCategoryCtrlFunctionCb( ctune_UI_SlideMenu_Item_t * menu_item ) {
-    bool                   error_state  = false;
-    SubCategoryPayload_t * payload      = (SubCategoryPayload_t *) menu_item->data;
-    Vector_t             * result_cache = &payload->browser_win->cache.rsi_results;
+static void ctune_UI_BrowserWin_cancelFetch( ctune_UI_BrowserWin_t * win ) {
+    if( win->cache.pending != CTUNE_NETWORKJOBS_HANDLE_NONE && win->cb.cancelSearch != NULL ) {
+        win->cb.cancelSearch( win->cache.pending );
+    }
+
+    win->cache.pending = CTUNE_NETWORKJOBS_HANDLE_NONE;
+}
+
+/**
+ * [PRIVATE/CALLBACK] Completion callback for a background fetch of sub-category stations
+ * @param job  Finished network job
+ * @param data ctune_UI_BrowserWin_t object
+ */
+static void ctune_UI_BrowserWin_loadFetchedStations( ctune_NetworkJob_t * job, void * data ) {
+    ctune_UI_BrowserWin_t * win = data;
 
-    if( !Vector.empty( &payload->browser_win->cache.rsi_results ) ) //clear old cache
-        Vector.reinit( &payload->browser_win->cache.rsi_results );
+    win->cache.pending = CTUNE_NETWORKJOBS_HANDLE_NONE;
 
-    if( !payload->browser_win->cb.getStationsBy( payload->by_category, menu_item->text._raw, result_cache ) ) {
+    if( !job->success ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_BrowserWin_loadFetchedStations( %p, %p )] Fetching stations failed.", job, data );
+        return; //EARLY RETURN
+    }
+
+    if( !ctune_UI_RSListWin.loadResults( &win->right_pane, &job->results, NULL ) ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_UI_BrowserWin_subCategoryCtrlFunctionCb( %p )] Fetching stations failed.",
-                   menu_item
+                   "[ctune_UI_BrowserWin_loadFetchedStations( %p, %p )] Loading station results into RSListWin failed.",
+                   job, data
         );
 
-        error_state = true;
-        goto end;
+        return; //EARLY RETURN
     }
 
-    if( !ctune_UI_RSListWin.loadResults( &payload->browser_win->right_pane, result_cache, NULL ) ) {
+    ctune_UI_BrowserWin.setFocus( win, FOCUS_PANE_RIGHT );
+}
+
+/**
+ * [PRIVATE/CALLBACK] Callback method to fetch sub-category results and populate the right RSListWin pane
+ * @param menu_item ctune_UI_SlideMenu_Item_t object
+ * @return Error free success (of the background fetch's submission)
+ */
+static bool ctune_UI_BrowserWin_subCategoryCtrlFunctionCb( ctune_UI_SlideMenu_Item_t * menu_item ) {
+    SubCategoryPayload_t  * payload = (SubCategoryPayload_t *) menu_item->data;
+    ctune_UI_BrowserWin_t * win     = payload->browser_win;
+
+    ctune_UI_BrowserWin_cancelFetch( win );
+
+    win->cache.pending = win->cb.getStationsBy( payload->by_category,
+                                                menu_item->text._raw,
+                                                ctune_UI_BrowserWin_loadFetchedStations,
+                                                win );
+
+    if( win->cache.pending == CTUNE_NETWORKJOBS_HANDLE_NONE ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_UI_BrowserWin_subCategoryCtrlFunctionCb( %p )] Loading station results into RSListWin failed.",
+                   "[ctune_UI_BrowserWin_subCategoryCtrlFunctionCb( %p )] Fetching stations failed.",
                    menu_item
         );
 
-        error_state = true;
-        goto end;
+        return false; //EARLY RETURN
     }
 
-    ctune_UI_BrowserWin.setFocus( payload->browser_win, FOCUS_PANE_RIGHT );
-    ctune_UI_RSListWin.show( &payload->browser_win->right_pane );
-
-    end:
-        return !( error_state );
+    return true;
 }
 
 /**
@@ -192,25 +219,30 @@ static bool ctune_UI_BrowserWin_categoryCtrlFunctionCb( ctune_UI_SlideMenu_Item_
  * @param left_canvas     Canvas property for the left pane
  * @param right_canvas    Canvas property for the right pane
  * @param getDisplayText  Callback method to get UI text
- * @param getStations     Callback method to fetch more stations
+ * @param getStations     Callback method to fetch more stations in the background
  * @param getCatItems     Callback method to fetch station search category items
+ * @param getStationsBy   Callback method to fetch stations based on a sub-category in the background
+ * @param cancelSearch    Callback method to cancel a background fetch
  * @param toggleFavourite Callback method to toggle a station's "favourite" status
  * @param getStationState Callback method to get a station's queued/favourite state
+ * @param getStateVersion Callback method to get the version of the station states (can be NULL)
  * @return Initialised ctune_UI_BrowserWin_t object
  */
 static ctune_UI_BrowserWin_t ctune_UI_BrowserWin_init( const WindowProperty_t * left_canvas,
                                                        const WindowProperty_t * right_canvas,
                                                        const char * (* getDisplayText)( ctune_UI_TextID_e ),
-                                                       bool (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * ),
+                                                       ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * ),
                                                        bool (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * ),
-                                                       bool (* getStationsBy)( const ctune_ByCategory_e, const char *, Vector_t * ),
+                                                       ctune_JobHandle_t (* getStationsBy)( const ctune_ByCategory_e, const char *, ctune_NetworkJob_Callback_f, void * ),
+                                                       void (* cancelSearch)( ctune_JobHandle_t ),
                                                        bool (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ),
-                                                       unsigned (* getStationState)( const ctune_RadioStationInfo_t * ) )
+                                                       unsigned (* getStationState)( const ctune_RadioStationInfo_t * ),
+                                                       uint64_t (* getStateVersion)( void ) )
 {
     return (ctune_UI_BrowserWin_t) {
         .pane_focus         = FOCUS_PANE_LEFT,
         .left_pane          = ctune_UI_SlideMenu.init( left_canvas ),
-        .right_pane         = ctune_UI_RSListWin.init( right_canvas, getDisplayText, getStations, toggleFavourite, getStationState ),
+        .right_pane         = ctune_UI_RSListWin.init( right_canvas, getDisplayText, getStations, cancelSearch, toggleFavourite, getStationState, getStateVersion ),
         .cache_menu         = false,
         .cache = {
             .cat2ui_text_enum = {
@@ -231,13 +263,14 @@ static ctune_UI_BrowserWin_t ctune_UI_BrowserWin_init( const WindowProperty_t *
             },
             .lvl1_menu_payloads = Vector.init( sizeof( CategoryPayload_t ), NULL ),
             .lvl2_menu_payloads = Vector.init( sizeof( SubCategoryPayload_t ), NULL ),
-            .rsi_results        = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent ),
+            .pending            = CTUNE_NETWORKJOBS_HANDLE_NONE,
         },
         .cb = {
             .getDisplayText = getDisplayText,
             .getStations    = getStations,
             .getCatItems    = getCatItems,
             .getStationsBy  = getStationsBy,
+            .cancelSearch   = cancelSearch,
         },
     };
 }
@@ -595,11 +628,11 @@ static bool ctune_UI_BrowserWin_isCtrlRowSelected( ctune_UI_BrowserWin_t * win )
  */
 static void ctune_UI_BrowserWin_free( ctune_UI_BrowserWin_t * win ) {
     if( win ) {
+        ctune_UI_BrowserWin_cancelFetch( win );
         ctune_UI_SlideMenu.free( &win->left_pane );
         ctune_UI_RSListWin.free( &win->right_pane );
         Vector.clear_vector( &win->cache.lvl1_menu_payloads );
         Vector.clear_vector( &win->cache.lvl2_menu_payloads );
-        Vector.clear_vector( &win->cache.rsi_results );
 
         CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_BrowserWin_free( %p )] BrowserWin freed.", win );
     }
@@ -43,14 +43,15 @@ typedef struct ctune_UI_BrowserWin {
         ctune_ByCategory_e cat2bycat       [RADIOBROWSER_CATEGORY_COUNT];
         Vector_t           lvl1_menu_payloads;
         Vector_t           lvl2_menu_payloads;
-        Vector_t           rsi_results;
+        ctune_JobHandle_t  pending; //background fetch of a sub-category's stations
     } cache;
 
     struct {
-        const char * (* getDisplayText)( ctune_UI_TextID_e );
-        bool         (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * );
-        bool         (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * );
-        bool         (* getStationsBy)( const ctune_ByCategory_e, const char *, Vector_t * );
+        const char *      (* getDisplayText)( ctune_UI_TextID_e );
+        ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * );
+        bool              (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * );
+        ctune_JobHandle_t (* getStationsBy)( const ctune_ByCategory_e, const char *, ctune_NetworkJob_Callback_f, void * );
+        void              (* cancelSearch)( ctune_JobHandle_t );
     } cb;
 
 } ctune_UI_BrowserWin_t;
@@ -64,21 +65,25 @@ extern const struct ctune_UI_BrowserWin_Namespace {
      * @param left_canvas     Canvas property for the left pane
      * @param right_canvas    Canvas property for the right pane
      * @param getDisplayText  Callback method to get UI text
-     * @param getStations     Callback method to fetch more stations
+     * @param getStations     Callback method to fetch more stations in the background
      * @param getCatItems     Callback method to fetch station search category items
-     * @param getStationsBy   Callback method to fetch stations based on a sub-category
+     * @param getStationsBy   Callback method to fetch stations based on a sub-category in the background
+     * @param cancelSearch    Callback method to cancel a background fetch
      * @param toggleFavourite Callback method to toggle a station's "favourite" status
      * @param getStationState Callback method to get a station's queued/favourite state
+     * @param getStateVersion Callback method to get the version of the station states (can be NULL)
      * @return Initialised ctune_UI_BrowserWin_t object
      */
     ctune_UI_BrowserWin_t (* init)( const WindowProperty_t * left_canvas,
                                     const WindowProperty_t * right_canvas,
-                                    const char * (* getDisplayText)( ctune_UI_TextID_e ),
-                                    bool         (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * ),
-                                    bool         (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * ),
-                                    bool         (* getStationsBy)( const ctune_ByCategory_e, const char *, Vector_t * ),
-                                    bool         (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ),
-                                    unsigned     (* getStationState)( const ctune_RadioStationInfo_t * ) );
+                                    const char *      (* getDisplayText)( ctune_UI_TextID_e ),
+                                    ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * ),
+                                    bool              (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * ),
+                                    ctune_JobHandle_t (* getStationsBy)( const ctune_ByCategory_e, const char *, ctune_NetworkJob_Callback_f, void * ),
+                                    void              (* cancelSearch)( ctune_JobHandle_t ),
+                                    bool              (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ),
+                                    unsigned          (* getStationState)( const ctune_RadioStationInfo_t * ),
+                                    uint64_t          (* getStateVersion)( void ) );
 
     /**
      * Switch mouse control UI on/off
@@ -304,6 +304,7 @@ static ctune_UI_MainWin_t ctune_UI_MainWin_create( const char * (* getDisplayTex
             .getDisplayText         = getDisplayText,
             .playStation            = NULL,
             .getStationState        = NULL,
+            .getStationStateVersion = NULL,
             .openInfoDialog         = NULL,
         },
         .cache = {
@@ -322,17 +323,19 @@ static ctune_UI_MainWin_t ctune_UI_MainWin_create( const char * (* getDisplayTex
  * Initialises main window
  * @param main            MainWin object
  * @param ui_config       Pointer to the UI configuration
- * @param getStations     Callback method to fetch more stations
+ * @param getStations     Callback method to fetch more stations in the background
  * @param getCatItems     Callback method to fetch station search category items
- * @param getStationsBy   Callback method to fetch stations based on a sub-category
+ * @param getStationsBy   Callback method to fetch stations based on a sub-category in the background
+ * @param cancelSearch    Callback method to cancel a background fetch
  * @param toggleFavourite Callback method to toggle a station's "favourite" status
  * @return Success
  */
 static bool ctune_UI_MainWin_init( ctune_UI_MainWin_t * main,
                                    ctune_UIConfig_t   * ui_config,
-                                   bool (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * ),
+                                   ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * ),
                                    bool (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * ),
-                                   bool (* getStationsBy)( const ctune_ByCategory_e, const char *, Vector_t * ),
+                                   ctune_JobHandle_t (* getStationsBy)( const ctune_ByCategory_e, const char *, ctune_NetworkJob_Callback_f, void * ),
+                                   void (* cancelSearch)( ctune_JobHandle_t ),
                                    bool (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ) )
 {
     main->mouse_ctrl = ctune_UIConfig.mouse.enabled( ui_config, FLAG_GET_VALUE );
@@ -343,8 +346,10 @@ static bool ctune_UI_MainWin_init( ctune_UI_MainWin_t * main,
         main->tabs.favourites = ctune_UI_RSListWin.init( &main->size.tab_canvas,
                                                          main->cb.getDisplayText,
                                                          NULL, /* no ctrl row so no need for ctrl callback */
+                                                         NULL,
                                                          toggleFavourite,
-                                                         main->cb.getStationState );
+                                                         main->cb.getStationState,
+                                                         main->cb.getStationStateVersion );
 
         ctune_UI_RSListWin.setMouseCtrl( &main->tabs.favourites, main->mouse_ctrl );
         ctune_UI_RSListWin.showCtrlRow( &main->tabs.favourites, false );
@@ -358,8 +363,10 @@ static bool ctune_UI_MainWin_init( ctune_UI_MainWin_t * main,
         main->tabs.search = ctune_UI_RSListWin.init( &main->size.tab_canvas,
                                                      main->cb.getDisplayText,
                                                      getStations,
+                                                     cancelSearch,
                                                      toggleFavourite,
-                                                     main->cb.getStationState );
+                                                     main->cb.getStationState,
+                                                     main->cb.getStationStateVersion );
 
         ctune_UI_RSListWin.setMouseCtrl( &main->tabs.search, main->mouse_ctrl );
         ctune_UI_RSListWin.showCtrlRow( &main->tabs.search, true );
@@ -374,8 +381,10 @@ static bool ctune_UI_MainWin_init( ctune_UI_MainWin_t * main,
                                                        getStations,
                                                        getCatItems,
                                                        getStationsBy,
+                                                       cancelSearch,
                                                        toggleFavourite,
-                                                       main->cb.getStationState );
+                                                       main->cb.getStationState,
+                                                       main->cb.getStationStateVersion );
 
         ctune_UI_BrowserWin.setMouseCtrl( &main->tabs.browser, main->mouse_ctrl );
         ctune_UI_BrowserWin.showCtrlRow( &main->tabs.browser, true );
@@ -849,7 +858,7 @@ static bool ctune_UI_MainWin_browserPaneisInFocus( ctune_UI_MainWin_t * main, ct
 static void ctune_UI_MainWin_ctrl_updateFavourites( ctune_UI_MainWin_t * main, bool (* cb)( Vector_t * ) ) {
     if( cb ) {
         cb( &main->cache.favourites );
-        ctune_UI_RSListWin.loadResults( &main->tabs.favourites, &main->cache.favourites, NULL );
+        ctune_UI_RSListWin.takeResults( &main->tabs.favourites, &main->cache.favourites );
     }
 }
 
@@ -1340,12 +1349,17 @@ static void ctune_UI_MainWin_print_clearMsgLine( ctune_UI_MainWin_t * main ) {
 }
 
 /**
- * Sets the callback to use to get a station's state
- * @param main Pointer to MainWin
- * @param cb   Callback method
+ * Sets the callbacks to use to get a station's state
+ * @param main       Pointer to MainWin
+ * @param cb         Callback method
+ * @param version_cb Callback method to get the version of the station states (changes when any state might have)
  */
-static void ctune_UI_MainWin_cb_setStationStateGetterCallback( ctune_UI_MainWin_t * main, unsigned (* cb)( const ctune_RadioStationInfo_t * ) ) {
-    main->cb.getStationState = cb;
+static void ctune_UI_MainWin_cb_setStationStateGetterCallback( ctune_UI_MainWin_t * main,
+                                                               unsigned (* cb)( const ctune_RadioStationInfo_t * ),
+                                                               uint64_t (* version_cb)( void ) )
+{
+    main->cb.getStationState        = cb;
+    main->cb.getStationStateVersion = version_cb;
 }
 
 /**
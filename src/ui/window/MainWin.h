@@ -42,6 +42,7 @@ typedef struct ctune_UI_Window_MainWin {
     struct {
         const char * (* getDisplayText)( ctune_UI_TextID_e );
         unsigned     (* getStationState)( const ctune_RadioStationInfo_t * rsi );
+        uint64_t     (* getStationStateVersion)( void );
         bool         (* playStation)( const ctune_RadioStationInfo_t * rsi );
         void         (* openInfoDialog)( const ctune_RadioStationInfo_t * rsi );
     } cb;
@@ -76,17 +77,19 @@ extern const struct ctune_UI_MainWinClass {
      * Initialises main window
      * @param main            MainWin object
      * @param ui_config       Pointer to the UI configuration
-     * @param getStations     Callback method to fetch more stations
+     * @param getStations     Callback method to fetch more stations in the background
      * @param getCatItems     Callback method to fetch station search category items
-     * @param getStationsBy   Callback method to fetch stations based on a sub-category
+     * @param getStationsBy   Callback method to fetch stations based on a sub-category in the background
+     * @param cancelSearch    Callback method to cancel a background fetch
      * @param toggleFavourite Callback method to toggle a station's "favourite" status
      * @return Success
      */
     bool (* init)( ctune_UI_MainWin_t * main,
                    ctune_UIConfig_t   * ui_config,
-                   bool (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * ),
+                   ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * ),
                    bool (* getCatItems)( const ctune_ListCategory_e, const ctune_RadioBrowserFilter_t *, Vector_t * ),
-                   bool (* getStationsBy)( const ctune_ByCategory_e, const char *, Vector_t * ),
+                   ctune_JobHandle_t (* getStationsBy)( const ctune_ByCategory_e, const char *, ctune_NetworkJob_Callback_f, void * ),
+                   void (* cancelSearch)( ctune_JobHandle_t ),
                    bool (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ) );
 
     /**
@@ -371,11 +374,12 @@ extern const struct ctune_UI_MainWinClass {
 
     struct {
         /**
-         * Sets the callback to use to get a station's state
-         * @param main Pointer to MainWin
-         * @param cb   Callback method
+         * Sets the callbacks to use to get a station's state
+         * @param main       Pointer to MainWin
+         * @param cb         Callback method
+         * @param version_cb Callback method to get the version of the station states (changes when any state might have)
          */
-        void (* setStationStateGetterCallback)( ctune_UI_MainWin_t * main, unsigned (* cb)( const ctune_RadioStationInfo_t * ) );
+        void (* setStationStateGetterCallback)( ctune_UI_MainWin_t * main, unsigned (* cb)( const ctune_RadioStationInfo_t * ), uint64_t (* version_cb)( void ) );
 
         /**
          * Sets the callback to use to trigger playback of a station
@@ -77,10 +77,402 @@ static int ctune_UI_RSListWin_getFavTextTheme( ctune_UI_RSListWin_t * win, ctune
 }
 
 /**
- * [PRIVATE] Callback to fetch more items to append to the current radio station list
+ * [PRIVATE] De-allocates a page's cached row draw data
+ * @param page Page
+ */
+static void ctune_UI_RSListWin_freeRowCache( ctune_UI_RSListWin_Page_t * page ) {
+    for( size_t i = 0; i < page->cache_size; ++i ) {
+        free( page->cache[i].text );
+    }
+
+    free( page->cache );
+    page->cache      = NULL;
+    page->cache_size = 0;
+}
+
+/**
+ * [PRIVATE] De-allocates a page's content
+ * @param page Pointer to a ctune_UI_RSListWin_Page_t object
+ */
+static void ctune_UI_RSListWin_freePage( void * page ) {
+    if( page != NULL ) {
+        Vector.clear_vector( &( (ctune_UI_RSListWin_Page_t *) page )->rows );
+        ctune_UI_RSListWin_freeRowCache( page );
+    }
+}
+
+/**
+ * [PRIVATE] Removes all entries
+ * @param win       RSListWin_t object
+ * @param page_size Number of rows per page for the entries to come (0 for unpaged)
+ */
+static void ctune_UI_RSListWin_clearEntries( ctune_UI_RSListWin_t * win, size_t page_size ) {
+    Vector.reinit( &win->entries.pages );
+    win->entries.page_size = ( page_size > 0 ? page_size : SIZE_MAX );
+    win->entries.count     = 0;
+    win->entries.resident  = 0;
+    win->sizes.name_ln     = 0;
+    win->sizes.tags_ln     = 0;
+}
+
+/**
+ * [PRIVATE] Checks if the entries are paged from a search that can be re-run at any offset
+ * @param win RSListWin_t object
+ * @return Paged state
+ */
+static bool ctune_UI_RSListWin_isPaged( ctune_UI_RSListWin_t * win ) {
+    return ( win->cache.filter != NULL && win->entries.page_size != SIZE_MAX && win->cb.getStations != NULL );
+}
+
+/**
+ * [PRIVATE] Gets an entry
+ * @param win RSListWin_t object
+ * @param i   List index of the entry
+ * @return RadioStationInfo_t object pointer or NULL if out of range/not loaded
+ */
+static ctune_RadioStationInfo_t * ctune_UI_RSListWin_entryAt( ctune_UI_RSListWin_t * win, size_t i ) {
+    if( i >= win->entries.count )
+        return NULL; //EARLY RETURN
+
+    ctune_UI_RSListWin_Page_t * page = Vector.at( &win->entries.pages, ( i / win->entries.page_size ) );
+    const size_t                row  = ( i % win->entries.page_size );
+
+    if( page == NULL || !page->resident || row >= Vector.size( &page->rows ) )
+        return NULL; //EARLY RETURN
+
+    return Vector.at( &page->rows, row );
+}
+
+/**
+ * [PRIVATE] Gets the cached draw data of an entry (grown to the page's row count on access)
  * @param win RSListWin_t object
+ * @param i   List index of the entry
+ * @return Pointer to the row's cache or NULL if not loaded/on allocation failure
+ */
+static ctune_UI_RSListWin_RowCache_t * ctune_UI_RSListWin_rowCache( ctune_UI_RSListWin_t * win, size_t i ) {
+    if( i >= win->entries.count )
+        return NULL; //EARLY RETURN
+
+    ctune_UI_RSListWin_Page_t * page = Vector.at( &win->entries.pages, ( i / win->entries.page_size ) );
+
+    if( page == NULL || !page->resident )
+        return NULL; //EARLY RETURN
+
+    if( page->cache_size < page->count ) {
+        ctune_UI_RSListWin_RowCache_t * cache = realloc( page->cache, ( page->count * sizeof( ctune_UI_RSListWin_RowCache_t ) ) );
+
+        if( cache == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_UI_RSListWin_rowCache( %p, %lu )] Failed to allocate the row cache of page #%lu.",
+                       win, i, ( i / win->entries.page_size )
+            );
+
+            return NULL; //EARLY RETURN
+        }
+
+        memset( &cache[ page->cache_size ], 0, ( ( page->count - page->cache_size ) * sizeof( ctune_UI_RSListWin_RowCache_t ) ) );
+        page->cache      = cache;
+        page->cache_size = page->count;
+    }
+
+    return &page->cache[ i % win->entries.page_size ];
+}
+
+/**
+ * [PRIVATE] Gets the queued/favourite state of an entry
+ * -
+ * States are cached per row and only got again from the callback once the state version has changed since.
+ * @param win RSListWin_t object
+ * @param i   List index of the entry
+ * @param rsi RadioStationInfo_t object of the entry
+ * @return Station state
+ */
+static unsigned ctune_UI_RSListWin_stationState( ctune_UI_RSListWin_t * win, size_t i, const ctune_RadioStationInfo_t * rsi ) {
+    ctune_UI_RSListWin_RowCache_t * cached = NULL;
+
+    if( win->cb.getStateVersion == NULL || ( cached = ctune_UI_RSListWin_rowCache( win, i ) ) == NULL )
+        return win->cb.getStationState( rsi ); //EARLY RETURN
+
+    const uint64_t version = win->cb.getStateVersion();
+
+    if( cached->version != version ) {
+        cached->state   = win->cb.getStationState( rsi );
+        cached->version = version;
+    }
+
+    return cached->state;
+}
+
+/**
+ * [PRIVATE] Gets the byte length of the first n UTF-8 code points of a string
+ * @param str String
+ * @param n   Number of code points
+ * @return Byte length
+ */
+static size_t ctune_UI_RSListWin_u8bytes( const char * str, size_t n ) {
+    size_t bytes = 0;
+
+    while( str[bytes] != '\0' ) {
+        if( ( str[bytes] & 0xC0 ) != 0x80 && n-- == 0 ) //i.e.: start of the code point after the n-th
+            break;
+
+        ++bytes;
+    }
+
+    return bytes;
+}
+
+/**
+ * [PRIVATE] Writes a string cut or padded with spaces to fit a cell
+ * @param dest  Buffer to write to (must fit `strlen( src ) + width + 1` bytes)
+ * @param src   UTF-8 string (can be NULL)
+ * @param width Width of the cell in code points
+ * @return Pointer to the '\0' written at the end of the cell
+ */
+static char * ctune_UI_RSListWin_writeCell( char * dest, const char * src, size_t width ) {
+    const size_t bytes = ( src != NULL ? ctune_UI_RSListWin_u8bytes( src, width ) : 0 );
+    const size_t cells = ( src != NULL ? String.u8strlen( src ) : 0 );
+
+    if( bytes > 0 ) {
+        memcpy( dest, src, bytes );
+        dest += bytes;
+    }
+
+    if( cells < width ) {
+        memset( dest, ' ', ( width - cells ) );
+        dest += ( width - cells );
+    }
+
+    *dest = '\0';
+    return dest;
+}
+
+/**
+ * [PRIVATE] Gets the key of the current row layout (formatted text is only valid for the layout it was formatted for)
+ * @param win RSListWin_t object
+ * @return Layout key (never 0)
+ */
+static uint64_t ctune_UI_RSListWin_layoutKey( ctune_UI_RSListWin_t * win ) {
+    return ( ( (uint64_t) win->canvas_property->cols << 1 ) | win->row.large_row ) + 1;
+}
+
+/**
+ * [PRIVATE] Gets the text cells of an entry cut and padded to the current layout's column widths
+ * @param win    RSListWin_t object
+ * @param rsi    RadioStationInfo_t object of the entry
+ * @param name_w Width of the name cell
+ * @param cached Row cache to format the text into (re-used when it was formatted for the current layout)
  * @return Success
  */
+static bool ctune_UI_RSListWin_formatRow( ctune_UI_RSListWin_t * win, const ctune_RadioStationInfo_t * rsi, size_t name_w, ctune_UI_RSListWin_RowCache_t * cached ) {
+    const uint64_t layout = ctune_UI_RSListWin_layoutKey( win );
+
+    if( cached->text != NULL && cached->layout == layout )
+        return true; //EARLY RETURN
+
+    const char * station_name = ctune_RadioStationInfo.get.stationName( rsi );
+    const char * station_cc   = ctune_RadioStationInfo.get.countryCode( rsi );
+    const char * station_tags = ctune_RadioStationInfo.get.tags( rsi );
+    const size_t cols         = ( win->canvas_property->cols > 0 ? (size_t) win->canvas_property->cols : 0 );
+    char         bitrate[64];
+    char         info[80];
+
+    snprintf( bitrate, sizeof( bitrate ), "%*lu%s",
+              MAX_BITRATE_FIELD_WIDTH, ctune_RadioStationInfo.get.bitrate( rsi ), win->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_BITRATE_UNIT_SHORT ) );
+
+    if( station_cc == NULL || strlen( station_cc ) < 2 )
+        station_cc = "??";
+
+    if( win->row.large_row )
+        snprintf( info, sizeof( info ), "%.*s", 2, station_cc );
+    else
+        snprintf( info, sizeof( info ), "%s|%.*s", bitrate, 2, station_cc );
+
+    const size_t name_ln = ( station_name != NULL ? strlen( station_name ) : 0 );
+    const size_t tags_ln = ( station_tags != NULL ? strlen( station_tags ) : 0 );
+    char       * text    = malloc( name_ln + tags_ln + strlen( info ) + strlen( bitrate ) + ( 2 * cols ) + 4 );
+
+    if( text == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_formatRow( %p, %p, %lu, %p )] Failed to allocate text.", win, rsi, name_w, cached );
+        return false; //EARLY RETURN
+    }
+
+    char * end = ctune_UI_RSListWin_writeCell( text, station_name, name_w );
+
+    free( cached->text );
+    cached->text      = text;
+    cached->layout    = layout;
+    cached->name_q_ln = ctune_UI_RSListWin_u8bytes( text, ( name_w > 2 ? ( name_w - 2 ) : 0 ) );
+    cached->info      = ( end + 1 );
+    cached->line2     = NULL;
+
+    end = ctune_UI_RSListWin_writeCell( ( end + 1 ), info, ( cols > name_w ? ( cols - name_w ) : 0 ) );
+
+    if( win->row.large_row ) {
+        const size_t bitrate_w = ( cols > win->sizes.kbps_ln ? win->sizes.kbps_ln : cols );
+
+        cached->line2 = ( end + 1 );
+        end = ctune_UI_RSListWin_writeCell( ( end + 1 ), station_tags, ( cols - bitrate_w ) );
+        ctune_UI_RSListWin_writeCell( end, bitrate, bitrate_w );
+    }
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Keeps track of the longest name/tags of the entries
+ * @param win RSListWin_t object
+ * @param rsi RadioStationInfo_t object
+ */
+static void ctune_UI_RSListWin_updateSizes( ctune_UI_RSListWin_t * win, const ctune_RadioStationInfo_t * rsi ) {
+    size_t name_ln = ( ctune_RadioStationInfo.get.stationName( rsi ) != NULL ? strlen( ctune_RadioStationInfo.get.stationName( rsi ) ) : 0 );
+    size_t tags_ln = ( ctune_RadioStationInfo.get.tags( rsi )        != NULL ? strlen( ctune_RadioStationInfo.get.tags( rsi )        ) : 0 );
+
+    if( name_ln > win->sizes.name_ln )
+        win->sizes.name_ln = name_ln;
+    if( tags_ln > win->sizes.tags_ln )
+        win->sizes.tags_ln = tags_ln;
+}
+
+/**
+ * [PRIVATE] Appends copies of stations to the entries (filling up the last page before starting a new one)
+ * @param win     RSListWin_t object
+ * @param results Collection of RadioStationInfo_t objects
+ * @return Success
+ */
+static bool ctune_UI_RSListWin_appendEntries( ctune_UI_RSListWin_t * win, Vector_t * results ) {
+    for( size_t i = 0; i < Vector.size( results ); ++i ) {
+        ctune_RadioStationInfo_t  * rsi  = Vector.at( results, i );
+        ctune_UI_RSListWin_Page_t * page = ( Vector.empty( &win->entries.pages )
+                                             ? NULL
+                                             : Vector.at( &win->entries.pages, ( Vector.size( &win->entries.pages ) - 1 ) ) );
+
+        if( page == NULL || page->count >= win->entries.page_size ) {
+            if( ( page = Vector.emplace_back( &win->entries.pages ) ) == NULL ) {
+                CTUNE_LOG( CTUNE_LOG_ERROR,
+                           "[ctune_UI_RSListWin_appendEntries( %p, %p )] Failed to add a page (i=%lu).",
+                           win, results, i
+                );
+                return false; //EARLY RETURN
+            }
+
+            page->count      = 0;
+            page->resident   = true;
+            page->rows       = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+            page->cache      = NULL;
+            page->cache_size = 0;
+        }
+
+        ctune_RadioStationInfo_t * copy = Vector.init_back( &page->rows, ctune_RadioStationInfo.init );
+
+        if( copy == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_UI_RSListWin_appendEntries( %p, %p )] "
+                       "Failed to Initialise RSI (i=%lu) in Vector (<%s>)",
+                       win, results, i, ctune_RadioStationInfo.get.stationUUID( rsi )
+            );
+            return false; //EARLY RETURN
+        }
+
+        ctune_RadioStationInfo.copy( rsi, copy );
+        ctune_UI_RSListWin_updateSizes( win, rsi );
+
+        page->count           += 1;
+        win->entries.count    += 1;
+        win->entries.resident += 1;
+    }
+
+    return true;
+}
+
+/**
+ * [PRIVATE] Evicts the loaded pages furthest away from the selection until the number of rows loaded is within budget
+ * - pages in or near the view and the last page (where fetched items are appended to) are never evicted
+ * @param win RSListWin_t object
+ */
+static void ctune_UI_RSListWin_evictPages( ctune_UI_RSListWin_t * win ) {
+    if( !ctune_UI_RSListWin_isPaged( win ) || win->entries.resident <= CTUNE_UI_RSLISTWIN_RESIDENT_ROWS )
+        return; //EARLY RETURN
+
+    const size_t page_size = win->entries.page_size;
+    const size_t last_page = ( Vector.size( &win->entries.pages ) - 1 );
+    const size_t curr_page = ( win->row.selected / page_size );
+    const size_t keep_from = ( win->row.first_on_page > CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ? ( win->row.first_on_page - CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ) : 0 ) / page_size;
+    const size_t keep_to   = ( win->row.last_on_page + CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ) / page_size;
+
+    while( win->entries.resident > CTUNE_UI_RSLISTWIN_RESIDENT_ROWS ) {
+        ctune_UI_RSListWin_Page_t * victim   = NULL;
+        size_t                      furthest = 0;
+
+        for( size_t p = 0; p < last_page; ++p ) {
+            if( p >= keep_from && p <= keep_to )
+                continue;
+
+            ctune_UI_RSListWin_Page_t * page     = Vector.at( &win->entries.pages, p );
+            const size_t                distance = ( p > curr_page ? ( p - curr_page ) : ( curr_page - p ) );
+
+            if( page->resident && ( victim == NULL || distance > furthest ) ) {
+                victim   = page;
+                furthest = distance;
+            }
+        }
+
+        if( victim == NULL )
+            break;
+
+        Vector.reinit( &victim->rows );
+        ctune_UI_RSListWin_freeRowCache( victim );
+        victim->resident       = false;
+        win->entries.resident -= victim->count;
+    }
+
+    CTUNE_LOG( CTUNE_LOG_TRACE,
+               "[ctune_UI_RSListWin_evictPages( %p )] %lu/%lu rows loaded.",
+               win, win->entries.resident, win->entries.count
+    );
+}
+
+/**
+ * [PRIVATE] Cancels any background fetch of more items or evicted pages still in progress
+ * @param win RSListWin_t object
+ */
+static void ctune_UI_RSListWin_cancelFetch( ctune_UI_RSListWin_t * win ) {
+    if( win->cache.pending != CTUNE_NETWORKJOBS_HANDLE_NONE && win->cb.cancelSearch != NULL ) {
+        win->cb.cancelSearch( win->cache.pending );
+    }
+
+    if( win->cache.refill != CTUNE_NETWORKJOBS_HANDLE_NONE && win->cb.cancelSearch != NULL ) {
+        win->cb.cancelSearch( win->cache.refill );
+    }
+
+    win->cache.pending = CTUNE_NETWORKJOBS_HANDLE_NONE;
+    win->cache.refill  = CTUNE_NETWORKJOBS_HANDLE_NONE;
+}
+
+/**
+ * [PRIVATE] Completion callback for a background fetch of more items
+ * @param job  Finished network job
+ * @param data RSListWin_t object
+ */
+static void ctune_UI_RSListWin_appendFetchedItems( ctune_NetworkJob_t * job, void * data ) {
+    ctune_UI_RSListWin_t * win = data;
+
+    win->cache.pending = CTUNE_NETWORKJOBS_HANDLE_NONE;
+
+    if( !job->success || win->cache.filter == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_appendFetchedItems( %p, %p )] Failed to fetch more items.", job, data );
+        return; //EARLY RETURN
+    }
+
+    ctune_RadioBrowserFilter.set.resultOffset( win->cache.filter, ctune_RadioBrowserFilter.get.resultOffset( &job->filter ) );
+    ctune_UI_RSListWin.appendResults( win, &job->results );
+}
+
+/**
+ * [PRIVATE] Callback to fetch more items to append to the current radio station list
+ * @param win RSListWin_t object
+ * @return Success (of the background fetch's submission)
+ */
 static bool ctune_UI_RSListWin_fetchMoreItems( ctune_UI_RSListWin_t * win ) {
     if( win->cb.getStations == NULL ) {
         CTUNE_LOG( CTUNE_LOG_FATAL,
@@ -92,22 +484,117 @@ static bool ctune_UI_RSListWin_fetchMoreItems( ctune_UI_RSListWin_t * win ) {
         return false; //EARLY RETURN
     }
 
-    Vector_t results = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+    if( win->cache.pending != CTUNE_NETWORKJOBS_HANDLE_NONE )
+        return true; //EARLY RETURN - already fetching
+
+    if( win->cache.filter == NULL )
+        return false; //EARLY RETURN
+
+    ctune_RadioBrowserFilter_t next = ctune_RadioBrowserFilter.init();
+    ctune_RadioBrowserFilter.copy( win->cache.filter, &next );
 
     size_t new_offset = ctune_RadioBrowserFilter.get.resultOffset( win->cache.filter )
                       + ctune_RadioBrowserFilter.get.resultLimit( win->cache.filter );
 
-    ctune_RadioBrowserFilter.set.resultOffset( win->cache.filter, new_offset );
+    ctune_RadioBrowserFilter.set.resultOffset( &next, new_offset ); //cached offset only moves on once the items are in
+
+    win->cache.pending = win->cb.getStations( &next, ctune_UI_RSListWin_appendFetchedItems, win );
+
+    ctune_RadioBrowserFilter.freeContent( &next );
+    return ( win->cache.pending != CTUNE_NETWORKJOBS_HANDLE_NONE );
+}
+
+/**
+ * [PRIVATE] Completion callback for a background re-fetch of an evicted page
+ * @param job  Finished network job
+ * @param data RSListWin_t object
+ */
+static void ctune_UI_RSListWin_loadFetchedPage( ctune_NetworkJob_t * job, void * data ) {
+    ctune_UI_RSListWin_t * win    = data;
+    const size_t           page_i = win->cache.refill_page;
+
+    win->cache.refill = CTUNE_NETWORKJOBS_HANDLE_NONE;
 
-    if( win->cb.getStations( win->cache.filter, &results ) ) {
-        if( ctune_UI_RSListWin.appendResults( win, &results ) ) {
-            Vector.clear_vector( &results );
-            return true;
+    if( !job->success || atomic_load( &job->cancel ) || page_i >= Vector.size( &win->entries.pages ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_loadFetchedPage( %p, %p )] Failed to re-fetch page #%lu.", job, data, page_i );
+        return; //EARLY RETURN
+    }
+
+    ctune_UI_RSListWin_Page_t * page = Vector.at( &win->entries.pages, page_i );
+
+    if( page->resident )
+        return; //EARLY RETURN
+
+    //the upstream list may have changed since: the page keeps its row count regardless
+    for( size_t i = 0; i < Vector.size( &job->results ) && i < page->count; ++i ) {
+        ctune_RadioStationInfo_t * copy = Vector.init_back( &page->rows, ctune_RadioStationInfo.init );
+
+        if( copy == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR,
+                       "[ctune_UI_RSListWin_loadFetchedPage( %p, %p )] Failed to Initialise RSI (i=%lu) in page #%lu.",
+                       job, data, i, page_i
+            );
+            break;
         }
+
+        ctune_RadioStationInfo.copy( Vector.at( &job->results, i ), copy );
     }
 
-    Vector.clear_vector( &results );
-    return false;
+    page->resident         = true;
+    win->entries.resident += page->count;
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_UI_RSListWin_loadFetchedPage( %p, %p )] Page #%lu re-fetched (%lu/%lu rows).",
+               job, data, page_i, Vector.size( &page->rows ), page->count
+    );
+
+    ctune_UI_RSListWin_evictPages( win );
+
+    win->redraw      = true;
+    win->damage.full = true;
+}
+
+/**
+ * [PRIVATE] Fetches in the background the next page of a paged list when the selection gets near the last row
+ *           and re-fetches any evicted page in or near the view
+ * @param win RSListWin_t object
+ */
+static void ctune_UI_RSListWin_fetchAround( ctune_UI_RSListWin_t * win ) {
+    if( !ctune_UI_RSListWin_isPaged( win ) )
+        return; //EARLY RETURN
+
+    const size_t page_size = win->entries.page_size;
+
+    if( win->row.ctrl_row_fn == &ctune_UI_RSListWin_fetchMoreItems
+        && win->entries.count > 0
+        && ( win->entries.count % page_size ) == 0 //i.e.: last page fetched was full so there may be more
+        && ( win->row.selected + CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ) >= win->entries.count )
+    {
+        ctune_UI_RSListWin_fetchMoreItems( win );
+    }
+
+    if( win->cache.refill != CTUNE_NETWORKJOBS_HANDLE_NONE || win->entries.resident == win->entries.count )
+        return; //EARLY RETURN
+
+    const size_t from = ( win->row.first_on_page > CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ? ( win->row.first_on_page - CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ) : 0 ) / page_size;
+    const size_t to   = ( win->row.last_on_page + CTUNE_UI_RSLISTWIN_PREFETCH_ROWS ) / page_size;
+
+    for( size_t p = from; p <= to && p < Vector.size( &win->entries.pages ); ++p ) {
+        const ctune_UI_RSListWin_Page_t * page = Vector.at( &win->entries.pages, p );
+
+        if( !page->resident ) {
+            ctune_RadioBrowserFilter_t filter = ctune_RadioBrowserFilter.init();
+            ctune_RadioBrowserFilter.copy( win->cache.filter, &filter );
+            ctune_RadioBrowserFilter.set.resultOffset( &filter, ( win->cache.base_offset + ( p * page_size ) ) );
+            ctune_RadioBrowserFilter.set.resultLimit( &filter, page_size );
+
+            win->cache.refill_page = p;
+            win->cache.refill      = win->cb.getStations( &filter, ctune_UI_RSListWin_loadFetchedPage, win );
+
+            ctune_RadioBrowserFilter.freeContent( &filter );
+            break;
+        }
+    }
 }
 
 /**
@@ -116,7 +603,7 @@ static bool ctune_UI_RSListWin_fetchMoreItems( ctune_UI_RSListWin_t * win ) {
  * @param offset Offset to move selection by
  */
 static void ctune_UI_RSListWin_selectRow( ctune_UI_RSListWin_t * win, int offset ) {
-    if( Vector.empty( &win->entries ) )
+    if( win->entries.count == 0 )
         return;
 
     if( offset < 0 ) {
@@ -127,8 +614,8 @@ static void ctune_UI_RSListWin_selectRow( ctune_UI_RSListWin_t * win, int offset
     }
 
     if( offset > 0 ) {
-        if( ( win->row.selected + offset ) >= Vector.size( &win->entries ) )
-            win->row.selected = Vector.size( &win->entries ) - ( win->row.show_ctrl_row ? 0 : 1 );
+        if( ( win->row.selected + offset ) >= win->entries.count )
+            win->row.selected = win->entries.count - ( win->row.show_ctrl_row ? 0 : 1 );
         else
             win->row.selected += offset;
     }
@@ -144,7 +631,7 @@ static void ctune_UI_RSListWin_selectRow( ctune_UI_RSListWin_t * win, int offset
  * @param win_row Pointer to the windows's row index
  */
 static void ctune_UI_RSListWin_printSmallItemRow( ctune_UI_RSListWin_t * win, ctune_RadioStationInfo_t * rsi, int i, int * win_row ) {
-    unsigned rsi_state   = win->cb.getStationState( rsi );
+    unsigned rsi_state   = ctune_UI_RSListWin_stationState( win, i, rsi );
     int      info_col    = 0;
 
     if( !ctune_utoi( ( win->canvas_property->cols - ( win->sizes.cc_ln + win->sizes.kbps_ln + 1 ) ), &info_col ) ) {
@@ -154,51 +641,57 @@ static void ctune_UI_RSListWin_printSmallItemRow( ctune_UI_RSListWin_t * win, ct
                    win, rsi, i, win_row, ( win->canvas_property->cols - win->sizes.cc_ln ) );
     }
 
-    //'Fav' check is here so that what is shown is always based on the most updated list of favourites
-    if( win->cb.isFavourite != NULL )
-        ctune_RadioStationInfo.set.favourite( rsi, win->cb.isFavourite( rsi ) );
+    ctune_UI_RSListWin_RowCache_t   uncached = { 0 };
+    ctune_UI_RSListWin_RowCache_t * cached   = ctune_UI_RSListWin_rowCache( win, i );
+
+    if( cached == NULL )
+        cached = &uncached;
 
-    const char             * station_name    = ctune_RadioStationInfo.get.stationName( rsi );
-    const char             * station_cc      = ctune_RadioStationInfo.get.countryCode( rsi );
-    ulong                    station_bitrate = ctune_RadioStationInfo.get.bitrate( rsi );
-    const ctune_StationSrc_e station_src     = ctune_RadioStationInfo.get.stationSource( rsi );
-    int                      row_theme       = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( i == win->row.selected ) );
+    if( !ctune_UI_RSListWin_formatRow( win, rsi, info_col, cached ) ) {
+        *win_row += SMALL_ENTRY_ROW_HEIGHT;
+        return; //EARLY RETURN
+    }
+
+    const ctune_StationSrc_e station_src = ctune_RadioStationInfo.get.stationSource( rsi );
+    int                      row_theme   = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( i == win->row.selected ) );
 
     //e.g. line #1: "Station na...   128k/DE"
     if( (*win_row) < win->canvas_property->rows ) {
         int name_col = 0;
 
         wattron( win->canvas_win, row_theme );
-        mvwprintw( win->canvas_win, (*win_row), 0, "%0*c", win->canvas_property->cols, ' ' );
+        mvwhline( win->canvas_win, (*win_row), 0, ' ', win->canvas_property->cols ); //in case the cells are narrower than their code point count
 
         if( ( rsi_state & ctune_RadioStationInfo.IS_QUEUED ) ) {
             int queued_theme = ctune_UI_RSListWin_getQueuedIconTheme( win->in_focus, ( i == win->row.selected ) );
 
             wattron( win->canvas_win, queued_theme );
-            mvwprintw( win->canvas_win, (*win_row), name_col, "%c ", '>' );
+            mvwaddstr( win->canvas_win, (*win_row), name_col, "> " );
             wattroff( win->canvas_win, queued_theme );
 
             name_col += 2;
         }
 
+        const int name_ln = ( name_col > 0 ? (int) cached->name_q_ln : -1 );
+
         if( ( rsi_state & ctune_RadioStationInfo.IS_FAV ) ) {
             int fav_theme = ctune_UI_RSListWin_getFavTextTheme( win, station_src, ( i == win->row.selected ) );
             wattron( win->canvas_win, fav_theme );
-            mvwprintw( win->canvas_win, (*win_row), name_col, "%-*s", info_col, station_name );
+            mvwaddnstr( win->canvas_win, (*win_row), name_col, cached->text, name_ln );
             wattroff( win->canvas_win, fav_theme );
             wattron( win->canvas_win, row_theme );
         } else {
             wattron( win->canvas_win, row_theme );
-            mvwprintw( win->canvas_win, (*win_row), name_col, "%-*s", info_col, station_name );
+            mvwaddnstr( win->canvas_win, (*win_row), name_col, cached->text, name_ln );
         }
 
-        mvwprintw( win->canvas_win, (*win_row), info_col, "%*lu%s|%.*s",
-                   MAX_BITRATE_FIELD_WIDTH, station_bitrate, win->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_BITRATE_UNIT_SHORT ),
-                   2, ( station_cc == NULL  || strlen( station_cc ) < 2 ? "??" : station_cc ) );
+        mvwaddstr( win->canvas_win, (*win_row), info_col, cached->info );
 
         wattroff( win->canvas_win, row_theme );
         *win_row += 1;
     }
+
+    free( uncached.text );
 }
 
 /**
@@ -218,9 +711,8 @@ static void ctune_UI_RSListWin_printLargeItemRow( ctune_UI_RSListWin_t * win, ct
         return; //EARLY RETURN
     }
 
-    unsigned rsi_state   = win->cb.getStationState( rsi );
+    unsigned rsi_state   = ctune_UI_RSListWin_stationState( win, i, rsi );
     int      cc_col      = 0;
-    int      bitrate_col = 0;
 
     if( !ctune_utoi( ( win->canvas_property->cols - win->sizes.cc_ln ), &cc_col ) ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
@@ -229,26 +721,22 @@ static void ctune_UI_RSListWin_printLargeItemRow( ctune_UI_RSListWin_t * win, ct
                    win, rsi, i, win_row, ( win->canvas_property->cols - win->sizes.cc_ln ) );
     }
 
-    if( !ctune_utoi( ( win->canvas_property->cols - win->sizes.kbps_ln ), &bitrate_col ) ) {
-        CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_UI_RSListWin_printLargeItemRow( %p, %p, %i, %p )] "
-                   "Integer overflow: bitrate column position (%i)",
-                   win, rsi, i, win_row, ( win->canvas_property->cols - win->sizes.kbps_ln ) );
-    }
+    ctune_UI_RSListWin_RowCache_t   uncached = { 0 };
+    ctune_UI_RSListWin_RowCache_t * cached   = ctune_UI_RSListWin_rowCache( win, i );
+
+    if( cached == NULL )
+        cached = &uncached;
 
-    //'Fav' check is here so that what is shown is always based on the most updated list of favourites
-    if( win->cb.isFavourite != NULL )
-        ctune_RadioStationInfo.set.favourite( rsi, win->cb.isFavourite( rsi ) );
+    if( !ctune_UI_RSListWin_formatRow( win, rsi, cc_col, cached ) ) {
+        *win_row += LARGE_ENTRY_ROW_HEIGHT;
+        return; //EARLY RETURN
+    }
 
     //e.g. line #1: "Station name... DE"
     //     line #2: "tag1, tag...  128k"
     //     line #3: "------------------"
-    const char             * station_name    = ctune_RadioStationInfo.get.stationName( rsi );
-    const char             * station_cc      = ctune_RadioStationInfo.get.countryCode( rsi );
-    const char             * station_tags    = ctune_RadioStationInfo.get.tags( rsi );
-    ulong                    station_bitrate = ctune_RadioStationInfo.get.bitrate( rsi );
-    const ctune_StationSrc_e station_src     = ctune_RadioStationInfo.get.stationSource( rsi );
-    int                      row_theme       = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( i == win->row.selected ) );
+    const ctune_StationSrc_e station_src = ctune_RadioStationInfo.get.stationSource( rsi );
+    int                      row_theme   = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( i == win->row.selected ) );
 
     wattron( win->canvas_win, row_theme );
 
@@ -256,39 +744,40 @@ static void ctune_UI_RSListWin_printLargeItemRow( ctune_UI_RSListWin_t * win, ct
     if( (*win_row) < win->canvas_property->rows ) {
         int name_col = 0;
 
-        mvwprintw( win->canvas_win, (*win_row), 0, "%0*c", win->canvas_property->cols, ' ' );
+        mvwhline( win->canvas_win, (*win_row), 0, ' ', win->canvas_property->cols ); //in case the cells are narrower than their code point count
 
         if( ( rsi_state & ctune_RadioStationInfo.IS_QUEUED ) ) {
             int queued_theme = ctune_UI_RSListWin_getQueuedIconTheme( win->in_focus, ( i == win->row.selected ) );
 
             wattron( win->canvas_win, queued_theme );
-            mvwprintw( win->canvas_win, (*win_row), name_col, "%c ", '>' );
+            mvwaddstr( win->canvas_win, (*win_row), name_col, "> " );
             wattroff( win->canvas_win, queued_theme );
 
             name_col += 2;
         }
 
+        const int name_ln = ( name_col > 0 ? (int) cached->name_q_ln : -1 );
+
         if( ( rsi_state & ctune_RadioStationInfo.IS_FAV ) ) {
             int fav_theme = ctune_UI_RSListWin_getFavTextTheme( win, station_src, ( i == win->row.selected ) );
             wattron( win->canvas_win, fav_theme );
-            mvwprintw( win->canvas_win, (*win_row), name_col, "%-*s", cc_col, station_name );
+            mvwaddnstr( win->canvas_win, (*win_row), name_col, cached->text, name_ln );
             wattroff( win->canvas_win, fav_theme );
             wattron( win->canvas_win, row_theme );
         } else {
             wattron( win->canvas_win, row_theme );
-            mvwprintw( win->canvas_win, (*win_row), name_col, "%-*s", cc_col, station_name );
+            mvwaddnstr( win->canvas_win, (*win_row), name_col, cached->text, name_ln );
         }
 
-        mvwprintw( win->canvas_win, (*win_row), cc_col, "%.*s", 2, ( station_cc == NULL || strlen( station_cc ) < 2 ? "??" : station_cc ) );
+        mvwaddstr( win->canvas_win, (*win_row), cc_col, cached->info );
 
         *win_row += 1;
     }
 
     //line #2
     if( (*win_row) < win->canvas_property->rows ) {
-        mvwprintw( win->canvas_win, (*win_row), 0, "%0*c", win->canvas_property->cols, ' ' );
-        mvwprintw( win->canvas_win, (*win_row), 0, "%-*s", bitrate_col, ( station_tags != NULL ? station_tags : "" ) );
-        mvwprintw( win->canvas_win, (*win_row), bitrate_col, "%*lu%s", MAX_BITRATE_FIELD_WIDTH, station_bitrate, win->cb.getDisplayText( CTUNE_UI_TEXT_LABEL_BITRATE_UNIT_SHORT ) );
+        mvwhline( win->canvas_win, (*win_row), 0, ' ', win->canvas_property->cols );
+        mvwaddstr( win->canvas_win, (*win_row), 0, cached->line2 );
 
         //FIXME on tags with right->left texts like arabic the bitrate value and tags string are swapped
         // but are correctly displayed when the text is themed (A_BOLD, colouring... but not B/W or W/B.. why??)
@@ -307,6 +796,8 @@ static void ctune_UI_RSListWin_printLargeItemRow( ctune_UI_RSListWin_t * win, ct
         wattroff( win->canvas_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
         *win_row += 1;
     }
+
+    free( uncached.text );
 }
 
 /**
@@ -337,7 +828,7 @@ static void ctune_UI_RSListWin_printSmallCtrlRow( ctune_UI_RSListWin_t * win, in
     }
 
 
-    int row_theme = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( win->row.selected >= Vector.size( &win->entries ) ) );
+    int row_theme = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( win->row.selected >= win->entries.count ) );
     wattron( win->canvas_win, row_theme );
 
     //line #1
@@ -388,7 +879,7 @@ static void ctune_UI_RSListWin_printLargeCtrlRow( ctune_UI_RSListWin_t * win, in
         );
     }
 
-    int row_theme = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( win->row.selected >= Vector.size( &win->entries ) )
+    int row_theme = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( win->row.selected >= win->entries.count )
     );
     wattron( win->canvas_win, row_theme );
 
@@ -407,8 +898,158 @@ static void ctune_UI_RSListWin_printLargeCtrlRow( ctune_UI_RSListWin_t * win, in
     String.free( &line2 );
 }
 
+/**
+ * [PRIVATE] Prints a placeholder row for an entry that is not loaded
+ * @param win     RSListWin_t object
+ * @param i       List index of the entry
+ * @param win_row Pointer to the windows's row index
+ */
+static void ctune_UI_RSListWin_printPendingRow( ctune_UI_RSListWin_t * win, size_t i, int * win_row ) {
+    const int row_theme = ctune_UI_RSListWin_getRowTheme( win->in_focus, ( i == win->row.selected ) );
+    const int lines     = ( win->row.large_row ? ( LARGE_ENTRY_ROW_HEIGHT - 1 ) : SMALL_ENTRY_ROW_HEIGHT );
+
+    wattron( win->canvas_win, row_theme );
+
+    for( int line = 0; line < lines && (*win_row) < win->canvas_property->rows; ++line ) {
+        mvwhline( win->canvas_win, (*win_row), 0, ' ', win->canvas_property->cols );
+
+        if( line == 0 )
+            mvwprintw( win->canvas_win, (*win_row), 0, "%s", win->cb.getDisplayText( CTUNE_UI_TEXT_ELLIPSIS_LINE ) );
+
+        *win_row += 1;
+    }
+
+    wattroff( win->canvas_win, row_theme );
+
+    //line delimiter
+    if( win->row.large_row && (*win_row) < win->canvas_property->rows ) {
+        wattron( win->canvas_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
+        mvwhline( win->canvas_win, (*win_row), 0, ACS_HLINE, win->canvas_property->cols );
+        wattroff( win->canvas_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
+        *win_row += 1;
+    }
+}
+
+/**
+ * [PRIVATE] Prints the row of an entry or the control row at its position on the current page
+ * @param win RSListWin_t object
+ * @param i   List index of the entry (index past the last entry for the control row)
+ */
+static void ctune_UI_RSListWin_printRow( ctune_UI_RSListWin_t * win, size_t i ) {
+    if( i < win->row.first_on_page )
+        return; //EARLY RETURN - not on the page
+
+    int row = (int) ( ( i - win->row.first_on_page ) * win->row.row_height );
+
+    if( row >= win->canvas_property->rows )
+        return; //EARLY RETURN - not on the page
+
+    if( i < win->entries.count ) {
+        ctune_RadioStationInfo_t * rsi = ctune_UI_RSListWin_entryAt( win, i );
+
+        if( rsi == NULL )
+            ctune_UI_RSListWin_printPendingRow( win, i, &row );
+        else if( win->row.large_row )
+            ctune_UI_RSListWin_printLargeItemRow( win, rsi, (int) i, &row );
+        else
+            ctune_UI_RSListWin_printSmallItemRow( win, rsi, (int) i, &row );
+
+    } else if( i == win->entries.count && win->row.show_ctrl_row ) {
+        if( win->row.large_row )
+            ctune_UI_RSListWin_printLargeCtrlRow( win, &row );
+        else
+            ctune_UI_RSListWin_printSmallCtrlRow( win, &row );
+    }
+}
+
+/**
+ * [PRIVATE] Fits an existing window/panel to a new size and position
+ * @param panel Panel of the window
+ * @param win   Window
+ * @param rows  Number of rows
+ * @param cols  Number of columns
+ * @param pos_y Row position on screen
+ * @param pos_x Column position on screen
+ * @return Success (on failure the window/panel should be re-created)
+ */
+static bool ctune_UI_RSListWin_fitWindow( PANEL * panel, WINDOW * win, int rows, int cols, int pos_y, int pos_x ) {
+    if( getmaxy( win ) == rows && getmaxx( win ) == cols && getbegy( win ) == pos_y && getbegx( win ) == pos_x )
+        return true; //EARLY RETURN - nothing to do
+
+    const bool shrink = ( getmaxy( win ) > rows || getmaxx( win ) > cols );
+
+    hide_panel( panel ); //so that whatever is under the area uncovered gets refreshed
+
+    const bool fitted = ( shrink //shrink before moving so that it stays within the screen
+                          ? ( wresize( win, rows, cols ) == OK && move_panel( panel, pos_y, pos_x ) == OK )
+                          : ( move_panel( panel, pos_y, pos_x ) == OK && wresize( win, rows, cols ) == OK ) );
+
+    show_panel( panel );
+
+    return fitted;
+}
+
+/**
+ * [PRIVATE] Draws the scrolling indicator (i.e. "[n/n]" or " ▲ [n/n] ▼ ") under the canvas
+ * @param win RSListWin_t object
+ */
+static void ctune_UI_RSListWin_drawIndicator( ctune_UI_RSListWin_t * win ) {
+    String_t entry_count = String.init();
+    ctune_utos( win->entries.count, &entry_count );
+
+    const size_t entry_count_ln = String.length( &entry_count ); // max of "n" length
+
+    win->indicator_width = (int) ( entry_count_ln * 2 ) + 3 + ( win->mouse_ctrl ? 6 : 0 );  // "[n/n]" or " ▲ [n/n] ▼ "
+
+    const int indicator_pos_y = ( win->canvas_property->pos_y + win->canvas_property->rows );
+    const int indicator_pos_x = ( ( win->canvas_property->cols / 2 ) - ( win->indicator_width / 2 ) ) + win->canvas_property->pos_x;
+
+    if( win->indicator_win != NULL && !ctune_UI_RSListWin_fitWindow( win->indicator_panel, win->indicator_win, 1, win->indicator_width, indicator_pos_y, indicator_pos_x ) ) {
+        del_panel( win->indicator_panel );
+        delwin( win->indicator_win );
+        win->indicator_panel = NULL;
+        win->indicator_win   = NULL;
+    }
+
+    if( win->indicator_win == NULL ) {
+        win->indicator_win   = newwin( 1, win->indicator_width, indicator_pos_y, indicator_pos_x );
+        win->indicator_panel = new_panel( win->indicator_win );
+    } else {
+        werase( win->indicator_win );
+    }
+
+    wattron( win->indicator_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
+
+    if( win->mouse_ctrl ) {
+        const char * up   = ( win->row.selected == 0
+                              ? ctune_UI_Icons.icon( CTUNE_UI_ICON_VOID )
+                              : ctune_UI_Icons.icon( CTUNE_UI_ICON_UP_ARROW ) );
+        const char * down = ( ( win->row.selected >= win->entries.count || win->row.selected == win->entries.count - 1 )
+                              ? ctune_UI_Icons.icon( CTUNE_UI_ICON_VOID )
+                              : ctune_UI_Icons.icon( CTUNE_UI_ICON_DOWN_ARROW ) );
+
+        if( win->row.selected >= win->entries.count ) {
+            mvwprintw( win->indicator_win, 0, 1, "%s [%*c/%lu] %s", up, entry_count_ln, '-', win->entries.count, down );
+        } else {
+            mvwprintw( win->indicator_win, 0, 1, "%s [%*i/%lu] %s", up, entry_count_ln, ( win->row.selected + 1 ), win->entries.count, down );
+        }
+
+    } else {
+        if( win->row.selected >= win->entries.count ) {
+            mvwprintw( win->indicator_win, 0, 0, "[%*c/%lu]", entry_count_ln, '-', win->entries.count );
+        } else {
+            mvwprintw( win->indicator_win, 0, 0, "[%*i/%lu]", entry_count_ln, ( win->row.selected + 1 ), win->entries.count );
+        }
+    }
+
+    wattroff( win->indicator_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
+
+    String.free( &entry_count );
+}
+
 /**
  * [PRIVATE] Draw entries to the canvas window
+ * - when only the selection moved within the same page, just the previously and newly selected rows are redrawn
  * @param win    RSListWin_t object
  * @param resize Flag for resizing the canvas/panel
  */
@@ -418,30 +1059,34 @@ static void ctune_UI_RSListWin_drawCanvas( ctune_UI_RSListWin_t * win, bool resi
     const size_t partly_shown_entry        = ( ( win->canvas_property->rows % win->row.row_height ) ? 1 : 0 );
 
     if( resize ) {
-        if( win->canvas_panel ) {
+        if( win->canvas_win != NULL && !ctune_UI_RSListWin_fitWindow( win->canvas_panel, win->canvas_win,
+                                                                        win->canvas_property->rows, win->canvas_property->cols,
+                                                                        win->canvas_property->pos_y, win->canvas_property->pos_x ) )
+        {
             del_panel( win->canvas_panel );
-            win->canvas_panel = NULL;
-        }
-
-        if( win->canvas_win ) {
             delwin( win->canvas_win );
-            win->canvas_win = NULL;
+            win->canvas_panel = NULL;
+            win->canvas_win   = NULL;
         }
 
         win->row.first_on_page = 0;
         win->row.last_on_page  = win->row.first_on_page + ( page_index_offset + partly_shown_entry );
+        win->damage.full       = true;
     }
 
     if( win->canvas_win == NULL ) {
         win->canvas_win   = newwin( win->canvas_property->rows, win->canvas_property->cols, win->canvas_property->pos_y, win->canvas_property->pos_x );
         win->canvas_panel = new_panel( win->canvas_win );
-    } else {
-        werase( win->canvas_win );
+        win->damage.full  = true;
     }
 
-    if( win->indicator_win != NULL ) {
-        del_panel( win->indicator_panel );
-        delwin( win->indicator_win );
+    if( win->cb.getStateVersion != NULL ) { //queued/favourite states may have changed on rows other than the selected ones
+        const uint64_t version = win->cb.getStateVersion();
+
+        if( version != win->damage.state_version ) {
+            win->damage.state_version = version;
+            win->damage.full          = true;
+        }
     }
 
 
@@ -460,95 +1105,90 @@ static void ctune_UI_RSListWin_drawCanvas( ctune_UI_RSListWin_t * win, bool resi
         }
     }
 
+    ctune_UI_RSListWin_drawIndicator( win );
 
-    //calculate the scrolling indicator properties + create window from that
-    String_t entry_count = String.init();
-    ctune_utos( Vector.size( &win->entries ), &entry_count );
-
-    const size_t entry_count_ln = String.length( &entry_count ); // max of "n" length
-
-    win->indicator_width = (int) ( entry_count_ln * 2 ) + 3 + ( win->mouse_ctrl ? 6 : 0 );  // "[n/n]" or " ▲ [n/n] ▼ "
+    if( !win->damage.full && win->damage.first_on_page == win->row.first_on_page ) {
+        if( win->damage.selected != win->row.selected ) {
+            ctune_UI_RSListWin_printRow( win, win->damage.selected );
+        }
 
-    const int indicator_pos_y = ( win->canvas_property->pos_y + win->canvas_property->rows );
-    const int indicator_pos_x = ( ( win->canvas_property->cols / 2 ) - ( win->indicator_width / 2 ) ) + win->canvas_property->pos_x;
+        ctune_UI_RSListWin_printRow( win, win->row.selected );
 
-    win->indicator_win   = newwin( 1, win->indicator_width, indicator_pos_y, indicator_pos_x );
-    win->indicator_panel = new_panel( win->indicator_win );
+    } else { //Fill canvas with entries in the page range
+        werase( win->canvas_win );
 
-    wattron( win->indicator_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
+        int row = 0;
+        for( size_t i = win->row.first_on_page; i <= win->row.last_on_page; ++i ) {
+            if( i >= win->entries.count )
+                break;
 
-    if( win->mouse_ctrl ) {
-        const char * up   = ( win->row.selected == 0
-                              ? ctune_UI_Icons.icon( CTUNE_UI_ICON_VOID )
-                              : ctune_UI_Icons.icon( CTUNE_UI_ICON_UP_ARROW ) );
-        const char * down = ( ( win->row.selected >= Vector.size( &win->entries ) || win->row.selected == Vector.size( &win->entries ) - 1 )
-                              ? ctune_UI_Icons.icon( CTUNE_UI_ICON_VOID )
-                              : ctune_UI_Icons.icon( CTUNE_UI_ICON_DOWN_ARROW ) );
+            ctune_RadioStationInfo_t * rsi = ctune_UI_RSListWin_entryAt( win, i );
 
-        if( win->row.selected >= Vector.size( &win->entries ) ) {
-            mvwprintw( win->indicator_win, 0, 1, "%s [%*c/%lu] %s", up, entry_count_ln, '-', Vector.size( &win->entries ), down );
-        } else {
-            mvwprintw( win->indicator_win, 0, 1, "%s [%*i/%lu] %s", up, entry_count_ln, ( win->row.selected + 1 ), Vector.size( &win->entries ), down );
+            if( rsi == NULL )
+                ctune_UI_RSListWin_printPendingRow( win, i, &row );
+            else if( win->row.large_row )
+                ctune_UI_RSListWin_printLargeItemRow( win, rsi, i, &row );
+            else
+                ctune_UI_RSListWin_printSmallItemRow( win, rsi, i, &row );
         }
 
-    } else {
-        if( win->row.selected >= Vector.size( &win->entries ) ) {
-            mvwprintw( win->indicator_win, 0, 0, "[%*c/%lu]", entry_count_ln, '-', Vector.size( &win->entries ) );
-        } else {
-            mvwprintw( win->indicator_win, 0, 0, "[%*i/%lu]", entry_count_ln, ( win->row.selected + 1 ), Vector.size( &win->entries ) );
+        //Write control row if required and in page
+        if( win->row.show_ctrl_row && row < win->canvas_property->rows ) {
+            if( win->row.large_row )
+                ctune_UI_RSListWin_printLargeCtrlRow( win, &row );
+            else
+                ctune_UI_RSListWin_printSmallCtrlRow( win, &row );
         }
     }
 
-    wattroff( win->indicator_win, ctune_UI_Theme.color( CTUNE_UI_ITEM_TAB_BG ) );
-
-    String.free( &entry_count );
-
-
-    //Fill canvas with entries in the page range
-    int row = 0;
-    for( size_t i = win->row.first_on_page; i <= win->row.last_on_page; ++i ) {
-        if( i >= Vector.size( &win->entries ) )
-            break;
+    curs_set( 0 );
 
-        ctune_RadioStationInfo_t * rsi = Vector.at( &win->entries, i );
+    ctune_UI_RSListWin_fetchAround( win );
 
-        if( win->row.large_row )
-            ctune_UI_RSListWin_printLargeItemRow( win, rsi, i, &row );
-        else
-            ctune_UI_RSListWin_printSmallItemRow( win, rsi, i, &row );
-    }
+    win->damage.full          = false;
+    win->damage.selected      = win->row.selected;
+    win->damage.first_on_page = win->row.first_on_page;
+    win->redraw               = false;
+}
 
-    //Write control row if required and in page
-    if( win->row.show_ctrl_row && row < win->canvas_property->rows ) {
-        if( win->row.large_row )
-            ctune_UI_RSListWin_printLargeCtrlRow( win, &row );
-        else
-            ctune_UI_RSListWin_printSmallCtrlRow( win, &row );
+/**
+ * [PRIVATE] Raises the canvas and indicator panels to the top of the stack unless they are already there
+ * @param win RSListWin_t object
+ */
+static void ctune_UI_RSListWin_raisePanels( ctune_UI_RSListWin_t * win ) {
+    if( panel_below( NULL ) != win->indicator_panel || panel_below( win->indicator_panel ) != win->canvas_panel ) {
+        top_panel( win->canvas_panel );
+        top_panel( win->indicator_panel );
     }
-
-    curs_set( 0 );
-
-    win->redraw = false;
 }
 
 /**
  * Creates an initialised RSListWin_t
  * @param canvas_property Canvas property to base sizes on
  * @param getDisplayText  Callback method to get UI text
- * @param getStations     Callback method to fetch more stations
+ * @param getStations     Callback method to fetch more stations in the background
+ * @param cancelSearch    Callback method to cancel a background fetch
  * @param toggleFavourite Callback method to toggle a station's "favourite" status
  * @param getStationState Callback method to get a station's queued/favourite state
+ * @param getStateVersion Callback method to get the version of the station states (NULL: states are got on every draw)
  * @return Initialised object
  */
 static ctune_UI_RSListWin_t ctune_UI_RSListWin_init(
     const WindowProperty_t * canvas_property,
-    const char * (* getDisplayText)( ctune_UI_TextID_e ),
-    bool         (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * ),
-    bool         (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ),
-    unsigned     (* getStationState)( const ctune_RadioStationInfo_t * ) )
+    const char *      (* getDisplayText)( ctune_UI_TextID_e ),
+    ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * ),
+    void              (* cancelSearch)( ctune_JobHandle_t ),
+    bool              (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ),
+    unsigned          (* getStationState)( const ctune_RadioStationInfo_t * ),
+    uint64_t          (* getStateVersion)( void ) )
 {
     return (ctune_UI_RSListWin_t) {
-        .entries         = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent ),
+        .entries = {
+            .pages     = Vector.init( sizeof( ctune_UI_RSListWin_Page_t ), ctune_UI_RSListWin_freePage ),
+            .page_size = SIZE_MAX,
+            .count     = 0,
+            .resident  = 0,
+        },
         .canvas_property = canvas_property,
         .canvas_panel    = NULL,
         .canvas_win      = NULL,
@@ -558,6 +1198,12 @@ static ctune_UI_RSListWin_t ctune_UI_RSListWin_init(
         .redraw          = true,
         .in_focus        = true,
         .mouse_ctrl      = false,
+        .damage = {
+            .full          = true,
+            .selected      = 0,
+            .first_on_page = 0,
+            .state_version = 0,
+        },
         .row = {
             .large_row     = false,
             .theme_favs    = true,
@@ -575,13 +1221,19 @@ static ctune_UI_RSListWin_t ctune_UI_RSListWin_init(
             .kbps_ln = MAX_BITRATE_FIELD_WIDTH + strlen( getDisplayText( CTUNE_UI_TEXT_LABEL_BITRATE_UNIT_SHORT ) ),
         },
         .cache = {
-            .filter = NULL
+            .filter      = NULL,
+            .pending     = CTUNE_NETWORKJOBS_HANDLE_NONE,
+            .base_offset = 0,
+            .refill      = CTUNE_NETWORKJOBS_HANDLE_NONE,
+            .refill_page = 0,
         },
         .cb = {
             .getDisplayText  = getDisplayText,
             .getStations     = getStations,
+            .cancelSearch    = cancelSearch,
             .toggleFavourite = toggleFavourite,
             .getStationState = getStationState,
+            .getStateVersion = getStateVersion,
         },
     };
 }
@@ -592,7 +1244,8 @@ static ctune_UI_RSListWin_t ctune_UI_RSListWin_init(
  * @param mouse_ctrl_flag Flag to turn feature on/off
  */
 static void ctune_UI_RSListWin_setMouseCtrl( ctune_UI_RSListWin_t * win, bool mouse_ctrl_flag ) {
-    win->mouse_ctrl = mouse_ctrl_flag;
+    win->mouse_ctrl  = mouse_ctrl_flag;
+    win->damage.full = true;
 }
 
 /**
@@ -603,6 +1256,7 @@ static void ctune_UI_RSListWin_setMouseCtrl( ctune_UI_RSListWin_t * win, bool mo
 static void ctune_UI_RSListWin_setLargeRow( ctune_UI_RSListWin_t * win, bool large_flag ) {
     win->row.large_row  = large_flag;
     win->row.row_height = ( large_flag ? LARGE_ENTRY_ROW_HEIGHT : SMALL_ENTRY_ROW_HEIGHT );
+    win->damage.full    = true;
 }
 
 /**
@@ -612,6 +1266,7 @@ static void ctune_UI_RSListWin_setLargeRow( ctune_UI_RSListWin_t * win, bool lar
  */
 void ctune_UI_RSListWin_setFavTheming( ctune_UI_RSListWin_t * win, bool theme_flag ) {
     win->row.theme_favs = theme_flag;
+    win->damage.full    = true;
 }
 
 /**
@@ -621,6 +1276,7 @@ void ctune_UI_RSListWin_setFavTheming( ctune_UI_RSListWin_t * win, bool theme_fl
  */
 static void ctune_UI_RSListWin_showCtrlRow( ctune_UI_RSListWin_t * win, bool show_ctrl_row ) {
     win->row.show_ctrl_row = show_ctrl_row;
+    win->damage.full       = true;
 }
 
 /**
@@ -638,6 +1294,8 @@ static bool ctune_UI_RSListWin_loadResults( ctune_UI_RSListWin_t * win, Vector_t
         return false;
     }
 
+    ctune_UI_RSListWin_cancelFetch( win );
+
     if( win->cache.filter != NULL ) { //clear out old filter
         ctune_RadioBrowserFilter.freeContent( win->cache.filter );
         free( win->cache.filter );
@@ -662,40 +1320,20 @@ static bool ctune_UI_RSListWin_loadResults( ctune_UI_RSListWin_t * win, Vector_t
     }
 
     //reset everything
-    Vector.reinit( &win->entries );
-    win->sizes.name_ln     = 0;
-    win->sizes.tags_ln     = 0;
+    ctune_UI_RSListWin_clearEntries( win, ( filter != NULL ? ctune_RadioBrowserFilter.get.resultLimit( filter ) : 0 ) );
+    win->cache.base_offset = ( filter != NULL ? ctune_RadioBrowserFilter.get.resultOffset( filter ) : 0 );
     win->row.first_on_page = 0;
     win->row.last_on_page  = 0;
     win->row.selected      = 0;
 
-    //fill ListWin_t entry Vector with results
-    for( size_t i = 0; i < Vector.size( results ); ++i ) {
-        ctune_RadioStationInfo_t * rsi  = Vector.at( results, i );
-        ctune_RadioStationInfo_t * copy = Vector.init_back( &win->entries, ctune_RadioStationInfo.init );
-
-        if( copy == NULL ) {
-            CTUNE_LOG( CTUNE_LOG_ERROR,
-                       "[ctune_UI_RSListWin_loadResults( %p, %p, %p )] "
-                       "Failed to Initialise RSI (i=%lu) in Vector (<%s>)",
-                       win, results, filter, i, ctune_RadioStationInfo.get.stationUUID( rsi )
-            );
-            return false;
-        };
-
-        ctune_RadioStationInfo.copy( rsi, copy );
-
-        size_t name_ln = ( ctune_RadioStationInfo.get.stationName( rsi ) != NULL ? strlen( ctune_RadioStationInfo.get.stationName( rsi ) ) : 0 );
-        size_t tags_ln = ( ctune_RadioStationInfo.get.tags( rsi )        != NULL ? strlen( ctune_RadioStationInfo.get.tags( rsi )        ) : 0 );
-
-        if( name_ln > win->sizes.name_ln )
-            win->sizes.name_ln = name_ln;
-        if( tags_ln > win->sizes.tags_ln )
-            win->sizes.tags_ln = tags_ln;
+    //fill ListWin_t entries with results
+    if( !ctune_UI_RSListWin_appendEntries( win, results ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_loadResults( %p, %p, %p )] Failed to load results.", win, results, filter );
+        return false; //EARLY RETURN
     }
 
     //set final row
-    if( Vector.empty( &win->entries ) || ( win->cache.filter != NULL && ctune_RadioBrowserFilter.get.resultLimit( win->cache.filter ) != 0 ) ) {
+    if( win->entries.count == 0 || ( win->cache.filter != NULL && ctune_RadioBrowserFilter.get.resultLimit( win->cache.filter ) != 0 ) ) {
         win->row.ctrl_row_fn = &ctune_UI_RSListWin_fetchMoreItems;
     } else {
         win->row.ctrl_row_fn = NULL;
@@ -703,10 +1341,76 @@ static bool ctune_UI_RSListWin_loadResults( ctune_UI_RSListWin_t * win, Vector_t
 
     CTUNE_LOG( CTUNE_LOG_DEBUG,
                "[ctune_UI_RSListWin_loadResults( %p, %p, %p )] Loaded %lu stations.",
-               win, results, filter, Vector.size( &win->entries )
+               win, results, filter, win->entries.count
     );
 
-    win->redraw = true;
+    win->redraw      = true;
+    win->damage.full = true;
+    return true;
+}
+
+/**
+ * Loads a set of results into RSListWin's internal store by taking over their content instead of copying it
+ * @param win     RSListWin_t object
+ * @param results Collection of RadioStationInfo_t objects (emptied)
+ * @return Success
+ */
+static bool ctune_UI_RSListWin_takeResults( ctune_UI_RSListWin_t * win, Vector_t * results ) {
+    CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_RSListWin_takeResults( %p, %p )] Moving stations to RSListWin.", win, results );
+
+    if( results == NULL ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_takeResults( %p, %p )] Vector of results is NULL.", win, results );
+        return false; //EARLY RETURN
+    }
+
+    ctune_UI_RSListWin_cancelFetch( win );
+
+    if( win->cache.filter != NULL ) { //clear out old filter
+        ctune_RadioBrowserFilter.freeContent( win->cache.filter );
+        free( win->cache.filter );
+        win->cache.filter = NULL;
+    }
+
+    //swap in the results' content as a single page
+    ctune_UI_RSListWin_clearEntries( win, 0 );
+    win->cache.base_offset = 0;
+    win->row.first_on_page = 0;
+    win->row.last_on_page  = 0;
+    win->row.selected      = 0;
+
+    if( !Vector.empty( results ) ) {
+        ctune_UI_RSListWin_Page_t * page = Vector.emplace_back( &win->entries.pages );
+
+        if( page == NULL ) {
+            CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_takeResults( %p, %p )] Failed to add a page.", win, results );
+            return false; //EARLY RETURN
+        }
+
+        page->rows       = *results;
+        page->count      = Vector.size( &page->rows );
+        page->resident   = true;
+        page->cache      = NULL;
+        page->cache_size = 0;
+        *results         = Vector.init( sizeof( ctune_RadioStationInfo_t ), ctune_RadioStationInfo.freeContent );
+
+        win->entries.count    = page->count;
+        win->entries.resident = page->count;
+
+        for( size_t i = 0; i < page->count; ++i ) {
+            ctune_UI_RSListWin_updateSizes( win, Vector.at( &page->rows, i ) );
+        }
+    }
+
+    //set final row
+    win->row.ctrl_row_fn = ( win->entries.count == 0 ? &ctune_UI_RSListWin_fetchMoreItems : NULL );
+
+    CTUNE_LOG( CTUNE_LOG_DEBUG,
+               "[ctune_UI_RSListWin_takeResults( %p, %p )] Loaded %lu stations.",
+               win, results, win->entries.count
+    );
+
+    win->redraw      = true;
+    win->damage.full = true;
     return true;
 }
 
@@ -724,31 +1428,14 @@ static bool ctune_UI_RSListWin_appendResults( ctune_UI_RSListWin_t * win, Vector
         return false;
     }
 
-    //append ListWin_t entry Vector with results
-    for( size_t i = 0; i < Vector.size( results ); ++i ) {
-        ctune_RadioStationInfo_t * rsi  = Vector.at( results, i );
-        ctune_RadioStationInfo_t * copy = Vector.init_back( &win->entries, ctune_RadioStationInfo.init );
-
-        if( copy == NULL ) {
-            CTUNE_LOG( CTUNE_LOG_ERROR,
-                       "[ctune_UI_RSListWin_appendResults( %p, %p )] "
-                       "Failed to Initialise RSI (i=%lu) in Vector (<%s>)",
-                       win, results, i, ctune_RadioStationInfo.get.stationUUID( rsi )
-            );
-            return false;
-        };
-
-        ctune_RadioStationInfo.copy( rsi, copy );
-
-        size_t name_ln = ( ctune_RadioStationInfo.get.stationName( rsi ) != NULL ? strlen( ctune_RadioStationInfo.get.stationName( rsi ) ) : 0 );
-        size_t tags_ln = ( ctune_RadioStationInfo.get.tags( rsi )        != NULL ? strlen( ctune_RadioStationInfo.get.tags( rsi ) )        : 0 );
-
-        if( name_ln > win->sizes.name_ln )
-            win->sizes.name_ln = name_ln;
-        if( tags_ln > win->sizes.tags_ln )
-            win->sizes.tags_ln = tags_ln;
+    //append results to the ListWin_t entries
+    if( !ctune_UI_RSListWin_appendEntries( win, results ) ) {
+        CTUNE_LOG( CTUNE_LOG_ERROR, "[ctune_UI_RSListWin_appendResults( %p, %p )] Failed to append results.", win, results );
+        return false; //EARLY RETURN
     }
 
+    ctune_UI_RSListWin_evictPages( win );
+
     //set final row
     if( Vector.empty( results ) || Vector.size( results ) < ctune_RadioBrowserFilter.get.resultLimit( win->cache.filter ) ) { //looks like there is no more to be fetched
         win->row.ctrl_row_fn = NULL;
@@ -758,10 +1445,11 @@ static bool ctune_UI_RSListWin_appendResults( ctune_UI_RSListWin_t * win, Vector
 
     CTUNE_LOG( CTUNE_LOG_DEBUG,
                "[ctune_UI_RSListWin_appendResults( %p, %p )] Loaded %lu/%lu stations.",
-               win, results, Vector.size( results ), Vector.size( &win->entries )
+               win, results, Vector.size( results ), win->entries.count
     );
 
-    win->redraw = true;
+    win->redraw      = true;
+    win->damage.full = true;
     return true;
 }
 
@@ -771,9 +1459,8 @@ static bool ctune_UI_RSListWin_appendResults( ctune_UI_RSListWin_t * win, Vector
  */
 static void ctune_UI_RSListWin_loadNothing( ctune_UI_RSListWin_t * win ) {
     //reset everything
-    Vector.reinit( &win->entries );
-    win->sizes.name_ln     = 0;
-    win->sizes.tags_ln     = 0;
+    ctune_UI_RSListWin_cancelFetch( win );
+    ctune_UI_RSListWin_clearEntries( win, 0 );
     win->row.first_on_page = 0;
     win->row.last_on_page  = 0;
     win->row.selected      = 0;
@@ -783,15 +1470,17 @@ static void ctune_UI_RSListWin_loadNothing( ctune_UI_RSListWin_t * win ) {
 
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_RSListWin_loadNothing( %p )] Loaded nothing.", win );
 
-    win->redraw = true;
+    win->redraw      = true;
+    win->damage.full = true;
 }
 
 /**
- * Sets the redraw flag on
+ * Sets the redraw flag on (whole canvas)
  * @param win RSListWin_t object
  */
 static void ctune_UI_RSListWin_setRedraw( ctune_UI_RSListWin_t * win ) {
-    win->redraw = true;
+    win->redraw      = true;
+    win->damage.full = true;
 }
 
 /**
@@ -851,7 +1540,7 @@ static void ctune_UI_RSListWin_selectFirst( ctune_UI_RSListWin_t * win ) {
  * @param win RSListWin_t object
  */
 static void ctune_UI_RSListWin_selectLast( ctune_UI_RSListWin_t * win ) {
-    win->row.selected = (int) Vector.size( &win->entries ) - ( win->row.show_ctrl_row ? 0 : 1 );
+    win->row.selected = (int) win->entries.count - ( win->row.show_ctrl_row ? 0 : 1 );
     win->redraw       = true;
 }
 
@@ -860,12 +1549,12 @@ static void ctune_UI_RSListWin_selectLast( ctune_UI_RSListWin_t * win ) {
  * @param win RSListWin_t object
  */
 static void ctune_UI_RSListWin_toggleFav( ctune_UI_RSListWin_t * win ) {
-    if( win->row.selected >= Vector.size( &win->entries ) ) {
+    if( win->row.selected >= win->entries.count ) {
         CTUNE_LOG( CTUNE_LOG_TRACE, "[ctune_UI_RSListWin_toggleFav( %p )] Out-of-range row selected.", win );
         return; //EARLY RETURN
     }
 
-    ctune_RadioStationInfo_t * rsi = Vector.at( &win->entries, win->row.selected );
+    ctune_RadioStationInfo_t * rsi = ctune_UI_RSListWin_entryAt( win, win->row.selected );
     CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_UI_RSListWin_toggleFav( %p )] Toggling 'favourite' state of station", rsi );
 
     if( rsi != NULL ) {
@@ -877,7 +1566,7 @@ static void ctune_UI_RSListWin_toggleFav( ctune_UI_RSListWin_t * win ) {
 
     } else {
         CTUNE_LOG( CTUNE_LOG_ERROR,
-                   "[ctune_UI_RSListWin_toggleFav( %p )] Selected row (%ul) returned NULL in Vector_t of entries.",
+                   "[ctune_UI_RSListWin_toggleFav( %p )] Selected row (%ul) returned NULL in entries (not loaded?).",
                    win, win->row.selected
         );
     }
@@ -927,12 +1616,12 @@ static ctune_UI_ScrollMask_m ctune_UI_RSListWin_isScrollButton( ctune_UI_RSListW
  * @return RadioStationInfo_t object pointer or NULL if out of range of the collection/is ctrl row
  */
 static const ctune_RadioStationInfo_t * ctune_UI_RSListWin_getSelected( ctune_UI_RSListWin_t * win ) {
-    if( win->row.selected > Vector.size( &win->entries ) ) {
+    if( win->row.selected > win->entries.count ) {
         CTUNE_LOG( CTUNE_LOG_TRACE, "[ctune_UI_RSListWin_getSelected( %p )] Out-of-range row selected.", win );
         return NULL; //EARLY RETURN
     }
 
-    if( win->row.selected == Vector.size( &win->entries ) ) { //CTRL row selected
+    if( win->row.selected == win->entries.count ) { //CTRL row selected
         CTUNE_LOG( CTUNE_LOG_TRACE, "[ctune_UI_RSListWin_getSelected( %p )] CTRL row selected.", win );
         if( win->row.ctrl_row_fn != NULL ) {
             CTUNE_LOG( CTUNE_LOG_TRACE, "[ctune_UI_RSListWin_getSelected( %p )] CTRL row cb exists.", win );
@@ -950,7 +1639,7 @@ static const ctune_RadioStationInfo_t * ctune_UI_RSListWin_getSelected( ctune_UI
         return NULL; //EARLY RETURN
     }
 
-    return Vector.at( &win->entries, win->row.selected );
+    return ctune_UI_RSListWin_entryAt( win, win->row.selected ); //NULL when not loaded (yet)
 }
 
 /**
@@ -973,7 +1662,7 @@ static ctune_UI_RSListWin_PageState_t ctune_UI_RSListWin_getSelectedIndex( ctune
  * @return Success
  */
 static bool ctune_UI_RSListWin_setSelected( ctune_UI_RSListWin_t * win, ctune_UI_RSListWin_PageState_t state ) {
-    if( state.selected > Vector.size( &win->entries ) ) {
+    if( state.selected > win->entries.count ) {
         CTUNE_LOG( CTUNE_LOG_ERROR,
                    "[ctune_UI_RSListWin_setSelected( %p, %lu )] "
                    "Index is out of range of current entries.",
@@ -987,8 +1676,8 @@ static bool ctune_UI_RSListWin_setSelected( ctune_UI_RSListWin_t * win, ctune_UI
         win->row.first_on_page = state.first_on_page;
         win->row.last_on_page  = state.last_on_page;
         win->row.selected      = state.selected;
-        win->row.selected      = state.selected;
         win->redraw            = true;
+        win->damage.full       = true;
     }
 
     return true;
@@ -1000,7 +1689,7 @@ static bool ctune_UI_RSListWin_setSelected( ctune_UI_RSListWin_t * win, ctune_UI
  * @return is the Ctrl row
  */
 static bool ctune_UI_RSListWin_isCtrlRowSelected( ctune_UI_RSListWin_t * win ) {
-    return ( win->row.selected == Vector.size( &win->entries ) );
+    return ( win->row.selected == win->entries.count );
 }
 
 /**
@@ -1045,11 +1734,7 @@ static bool ctune_UI_RSListWin_show( ctune_UI_RSListWin_t * win ) {
         return false; //EARLY RETURN
     }
 
-    top_panel( win->canvas_panel );
-    top_panel( win->indicator_panel );
-
-    wrefresh( win->canvas_win );
-    wrefresh( win->indicator_win );
+    ctune_UI_RSListWin_raisePanels( win );
 
     update_panels();
     doupdate();
@@ -1079,11 +1764,7 @@ static void ctune_UI_RSListWin_resize( ctune_UI_RSListWin_t * win ) {
         return; //EARLY RETURN
     }
 
-    top_panel( win->canvas_panel );
-    top_panel( win->indicator_panel );
-
-    wrefresh( win->canvas_win );
-    wrefresh( win->indicator_win );
+    ctune_UI_RSListWin_raisePanels( win );
 
     update_panels();
     doupdate();
@@ -1095,7 +1776,8 @@ static void ctune_UI_RSListWin_resize( ctune_UI_RSListWin_t * win ) {
  */
 static void ctune_UI_RSListWin_free( ctune_UI_RSListWin_t * win ) {
     if( win ) {
-        win->redraw = true;
+        win->redraw      = true;
+        win->damage.full = true;
 
         if( win->canvas_panel ) {
             del_panel( win->canvas_panel );
@@ -1120,7 +1802,10 @@ static void ctune_UI_RSListWin_free( ctune_UI_RSListWin_t * win ) {
         win->row.first_on_page = 0;
         win->row.last_on_page  = 0;
         win->row.selected      = 0;
-        Vector.clear_vector( &win->entries );
+        Vector.clear_vector( &win->entries.pages );
+        win->entries.count    = 0;
+        win->entries.resident = 0;
+        ctune_UI_RSListWin_cancelFetch( win );
 
         if( win->cache.filter != NULL ) {
             ctune_RadioBrowserFilter.freeContent( win->cache.filter );
@@ -1142,6 +1827,7 @@ struct ctune_UI_RSListWinClass ctune_UI_RSListWin = {
     .themeFavourites   = &ctune_UI_RSListWin_setFavTheming,
     .showCtrlRow       = &ctune_UI_RSListWin_showCtrlRow,
     .loadResults       = &ctune_UI_RSListWin_loadResults,
+    .takeResults       = &ctune_UI_RSListWin_takeResults,
     .appendResults     = &ctune_UI_RSListWin_appendResults,
     .loadNothing       = &ctune_UI_RSListWin_loadNothing,
     .selectUp          = &ctune_UI_RSListWin_selectUp,
@@ -13,8 +13,51 @@
 #include "../../dto/RadioStationInfo.h"
 #include "../../dto/RadioBrowserFilter.h"
 #include "../../datastructure/Vector.h"
+#include "../../network/NetworkJobs.h"
 #include "../enum/TextID.h"
 
+#define CTUNE_UI_RSLISTWIN_RESIDENT_ROWS 2000 //max number of rows kept loaded in a paged list (the pages furthest from the view are evicted past that)
+#define CTUNE_UI_RSLISTWIN_PREFETCH_ROWS 50   //distance from the last loaded row at which the next page of a paged list is fetched
+
+/**
+ * Cached draw data of a list row
+ * - the text cells are cut/padded to their column widths and hold no theming so a draw is a straight copy
+ * @param version   State version the state was got at (0: never got)
+ * @param state     Station queued/favourite state
+ * @param layout    Layout the text was formatted for (0: not formatted)
+ * @param text      Name cell followed by the other cells ('\0' separated)
+ * @param name_q_ln Byte length of the name cell's part shown when shifted by the 'queued' icon
+ * @param info      Cell right of the name (small row: bitrate and country code, large row: country code)
+ * @param line2     Second line (large row only: tags and bitrate cells)
+ */
+typedef struct ctune_UI_Window_RSListWin_RowCache {
+    uint64_t     version;
+    unsigned     state;
+    uint64_t     layout;
+    char       * text;
+    size_t       name_q_ln;
+    const char * info;
+    const char * line2;
+
+} ctune_UI_RSListWin_RowCache_t;
+
+/**
+ * Page of list entries
+ * @param count      Number of list rows the page spans
+ * @param resident   Flag for when the rows are loaded (evicted pages only keep their row count)
+ * @param rows       Deep copies of RadioStationInfo_t objects (empty when evicted)
+ * @param cache      Cached draw data of the rows (allocated on the first draw of the page)
+ * @param cache_size Number of rows in `cache`
+ */
+typedef struct ctune_UI_Window_RSListWin_Page {
+    size_t                          count;
+    bool                            resident;
+    Vector_t                        rows;
+    ctune_UI_RSListWin_RowCache_t * cache;
+    size_t                          cache_size;
+
+} ctune_UI_RSListWin_Page_t;
+
 typedef struct ctune_UI_Window_RSListWin_PageState {
     size_t first_on_page;
     size_t last_on_page;
@@ -22,7 +65,12 @@ typedef struct ctune_UI_Window_RSListWin_PageState {
 } ctune_UI_RSListWin_PageState_t;
 
 typedef struct ctune_UI_Window_RSListWin {
-    Vector_t entries;  //keeps deep copies of RadioStationInfo_t objects
+    struct {
+        Vector_t pages;     //ctune_UI_RSListWin_Page_t objects
+        size_t   page_size; //number of rows per page (only the last page can be shorter)
+        size_t   count;     //total number of rows
+        size_t   resident;  //number of rows loaded
+    } entries;
 
     const WindowProperty_t * canvas_property;
     PANEL                  * canvas_panel;
@@ -34,6 +82,13 @@ typedef struct ctune_UI_Window_RSListWin {
     bool                     in_focus;
     bool                     mouse_ctrl;
 
+    struct {
+        bool     full;          //whole canvas needs redrawing (otherwise only rows whose selection state changed are)
+        size_t   selected;      //selected row at the last draw
+        size_t   first_on_page; //first row on the page at the last draw
+        uint64_t state_version; //station state version at the last draw (see `cb.getStateVersion`)
+    } damage;
+
     struct {
         bool   large_row;
         bool   theme_favs;
@@ -54,14 +109,19 @@ typedef struct ctune_UI_Window_RSListWin {
 
     struct {
         ctune_RadioBrowserFilter_t * filter;
+        ctune_JobHandle_t            pending;     //background fetch of more items
+        size_t                       base_offset; //result offset of the first row
+        ctune_JobHandle_t            refill;      //background re-fetch of an evicted page
+        size_t                       refill_page; //index of the page being re-fetched
     } cache;
 
     struct {
-        bool         (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * );
-        const char * (* getDisplayText)( ctune_UI_TextID_e );
-        bool         (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e );
-        bool         (* isFavourite)( const ctune_RadioStationInfo_t * );
-        unsigned     (* getStationState)( const ctune_RadioStationInfo_t * );
+        ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * );
+        void              (* cancelSearch)( ctune_JobHandle_t );
+        const char *      (* getDisplayText)( ctune_UI_TextID_e );
+        bool              (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e );
+        unsigned          (* getStationState)( const ctune_RadioStationInfo_t * );
+        uint64_t          (* getStateVersion)( void );
     } cb;
 
 } ctune_UI_RSListWin_t;
@@ -72,16 +132,20 @@ extern struct ctune_UI_RSListWinClass {
      * Creates an initialised RSListWin_t
      * @param canvas_property Canvas property to base sizes on
      * @param getDisplayText  Callback method to get UI text
-     * @param getStations     Callback method to fetch more stations
+     * @param getStations     Callback method to fetch more stations in the background
+     * @param cancelSearch    Callback method to cancel a background fetch
      * @param toggleFavourite Callback method to toggle a station's "favourite" status
      * @param getStationState Callback method to get a station's queued/favourite state
+     * @param getStateVersion Callback method to get the version of the station states (NULL: states are got on every draw)
      * @return Initialised object
      */
     ctune_UI_RSListWin_t (* init)( const WindowProperty_t * canvas_property,
                                    const char * (* getDisplayText)( ctune_UI_TextID_e ),
-                                   bool (* getStations)( ctune_RadioBrowserFilter_t *, Vector_t * ),
+                                   ctune_JobHandle_t (* getStations)( const ctune_RadioBrowserFilter_t *, ctune_NetworkJob_Callback_f, void * ),
+                                   void (* cancelSearch)( ctune_JobHandle_t ),
                                    bool (* toggleFavourite)( ctune_RadioStationInfo_t *, ctune_StationSrc_e ),
-                                   unsigned (* getStationState)( const ctune_RadioStationInfo_t * ) );
+                                   unsigned (* getStationState)( const ctune_RadioStationInfo_t * ),
+                                   uint64_t (* getStateVersion)( void ) );
 
     /**
      * Switch mouse control UI on/off
@@ -120,6 +184,14 @@ extern struct ctune_UI_RSListWinClass {
      */
     bool (* loadResults)( ctune_UI_RSListWin_t * win, Vector_t * results, const ctune_RadioBrowserFilter_t * filter );
 
+    /**
+     * Loads a set of results into RSListWin's internal store by taking over their content instead of copying it
+     * @param win     RSListWin_t object
+     * @param results Collection of RadioStationInfo_t objects (emptied)
+     * @return Success
+     */
+    bool (* takeResults)( ctune_UI_RSListWin_t * win, Vector_t * results );
+
     /**
      * Loads a set of results to append to RSListWin's internal store
      * @param win     RSListWin_t object
@@ -222,7 +294,7 @@ extern struct ctune_UI_RSListWinClass {
     /**
      * Gets a RSI pointer to the currently selected item in list or if ctrl row then trigger callback
      * @param win RSListWin_t object
-     * @return RadioStationInfo_t object pointer or NULL if out of range of the collection/is ctrl row
+     * @return RadioStationInfo_t object pointer or NULL if out of range of the collection/is ctrl row/is not loaded
      */
     const ctune_RadioStationInfo_t * (* getSelected)( ctune_UI_RSListWin_t * win );
 
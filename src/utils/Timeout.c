@@ -11,6 +11,7 @@
 static int ctune_Timeout_timedOut( void * self ) {
     ctune_Timeout_t * timer = (struct ctune_Timeout *) self;
     if( ( time(0) - timer->start ) >= timer->timeout_val ) {
+        timer->timed_out = true;
         if( timer->set_errno_cb != NULL )
             timer->set_errno_cb( timer->errno_on_timeout );
         CTUNE_LOG( CTUNE_LOG_DEBUG, "[ctune_Timeout_timedOut( %p )] Timed-out (%ds).", self, timer->timeout_val )